@@ -16,6 +16,7 @@
 #include "spotfx.h"
 #include "water.h"
 #include "util.h"
+#include "pool.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -49,7 +50,7 @@ extern	MCLOADHEADER		MCloadheadert0;
 /*===================================================================
 	Globals
 ===================================================================*/
-FMPOLY		FmPolys[ MAXNUMOF2DPOLYS ];
+FMPOLY	*	FmPolys = NULL;
 u_int16_t		FirstFmPolyUsed;
 u_int16_t		FirstFmPolyFree;
 u_int32_t		TotalFmPolysInUse = 0;
@@ -59,19 +60,19 @@ void FadeColour( u_int8_t * Colour, u_int8_t WantedColour, float Speed );
 
 #define RGBA_MAKE2(r, g, b, a)   ((COLOR) (( (DWORD) ((a) & 0xff) << 24) | ( (DWORD) ((r) & 0xff) << 16) | ( (DWORD) ((g) & 0xff) << 8) | (DWORD) ((b) & 0xff)))
 
+POOLSTATS	FmPolyPool = { "FmPolys", "FmPolyBudget", MAXNUMOF2DPOLYS, MAXNUMOF2DPOLYSBUDGET, 0, 0, 0, 0, 0, 0 };
+
 /*===================================================================
-	Procedure	:	Init Faceme poly structures
-	Input		:	Nothing
+	Procedure	:	Link a range of FmPolys into the free list
+	Input		:	u_int32_t	First FmPoly
+				:	u_int32_t	One past the last FmPoly
 	Output		:	Nothing
 ===================================================================*/
-void InitFmPoly( void )
+static void LinkFreeFmPolys( u_int32_t Start, u_int32_t End )
 {
-	int i;
-
-	FirstFmPolyUsed = (u_int16_t) -1;
-	FirstFmPolyFree = 0;
+	u_int32_t i;
 
-	for( i=0;i<MAXNUMOF2DPOLYS;i++)
+	for( i = Start; i < End; i++ )
 	{
 		memset( &FmPolys[i], 0, sizeof( FMPOLY ) );
 
@@ -95,26 +96,50 @@ void InitFmPoly( void )
 		FmPolys[i].NextInTPage = (u_int16_t) -1;
 		FmPolys[i].PrevInTPage = (u_int16_t) -1;
 
-		FmPolys[i].Next = i + 1;
+		FmPolys[i].Next = (u_int16_t) ( i + 1 );
 		FmPolys[i].Prev = (u_int16_t) -1;
 	}
-	FmPolys[MAXNUMOF2DPOLYS-1].Next = (u_int16_t) -1;
+	FmPolys[End-1].Next = (u_int16_t) -1;
+
+	FirstFmPolyFree = (u_int16_t) Start;
+}
+
+/*===================================================================
+	Procedure	:	Init Faceme poly structures
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void InitFmPoly( void )
+{
+	PoolInit( &FmPolyPool, (void **) &FmPolys, sizeof( FMPOLY ) );
+
+	FirstFmPolyUsed = (u_int16_t) -1;
+	TotalFmPolysInUse = 0;
+
+	LinkFreeFmPolys( 0, FmPolyPool.Linked );
 
 	InitFmPolyTPages();
 }
 
 /*===================================================================
 	Procedure	:	Find a free FmPoly and move it from the free list to
-					the used list
+					the used list, growing the pool if needed
 	Input		:	Nothing
 	Output		:	u_int16_t	Number of the free FmPoly
 ===================================================================*/
 u_int16_t FindFreeFmPoly( void )
 {
 	u_int16_t i;
+	u_int32_t Start;
 
 	i = FirstFmPolyFree;
-	if( i == (u_int16_t) -1 ) return i;
+	if( i == (u_int16_t) -1 )
+	{
+		Start = FmPolyPool.Linked;
+		if( PoolGrow( &FmPolyPool ) == Start ) return i;
+		LinkFreeFmPolys( Start, FmPolyPool.Linked );
+		i = FirstFmPolyFree;
+	}
 
 	FmPolys[i].Prev = FirstFmPolyUsed;
 
@@ -127,6 +152,7 @@ u_int16_t FindFreeFmPoly( void )
 	FirstFmPolyFree = FmPolys[i].Next;
 
 	TotalFmPolysInUse++;
+	PoolUsed( &FmPolyPool, TotalFmPolysInUse );
 
 	return i ;
 }
@@ -2448,6 +2474,7 @@ FILE * LoadFmPolys( FILE * fp )
 
 		while( i != (u_int16_t) -1 )
 		{
+			if( !PoolLinked( &FmPolyPool, i ) ) return NULL;
 			fread( &FmPolys[ i ].Next, sizeof( u_int16_t ), 1, fp );
 			fread( &FmPolys[ i ].Prev, sizeof( u_int16_t ), 1, fp );
 			fread( &FmPolys[ i ].NextInTPage, sizeof( u_int16_t ), 1, fp );
@@ -2486,6 +2513,7 @@ FILE * LoadFmPolys( FILE * fp )
 
 		while( i != (u_int16_t) -1 )
 		{
+			if( !PoolLinked( &FmPolyPool, i ) ) return NULL;
 			memset( &FmPolys[i], 0, sizeof( FMPOLY ) );
 			FmPolys[i].xsize = ( 16.0F * GLOBAL_SCALE );
 			FmPolys[i].ysize = ( 16.0F * GLOBAL_SCALE );
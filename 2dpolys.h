@@ -29,7 +29,8 @@
 	Defines
 ===================================================================*/
 #define	EXPLO_DISTANCE		( 256.0F * GLOBAL_SCALE )
-#define MAXNUMOF2DPOLYS		2000
+#define MAXNUMOF2DPOLYS		2000	// linked in at level start
+#define MAXNUMOF2DPOLYSBUDGET	8000	// most the pool grows to ( "FmPolyBudget" config )
 #define	MAXVERTSPER2DPOLY	4
 #define MaxColDistance		( 64000.0F * GLOBAL_SCALE )
 #define	MAXFMPOLYVERTS		700
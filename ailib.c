@@ -25,6 +25,7 @@
 #include "controls.h"
 #include "ai.h"
 #include "lines.h"
+#include "loscache.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -328,23 +329,7 @@ bool AI_InViewCone( VECTOR * Pos, MATRIX * Mat , VECTOR * TPos, float ViewConeCo
 ===================================================================*/
 bool AI_ClearLOS( VECTOR * SPos, u_int16_t Group , VECTOR * Pos )
 {
-	VECTOR	Dir;
-	VECTOR	Int_Point;
-	u_int16_t	Int_Group;
-	NORMAL	Int_Normal;
-	VECTOR	TempVector;
-
-	Dir.x = ( Pos->x - SPos->x );
-	Dir.y = ( Pos->y - SPos->y );
-	Dir.z = ( Pos->z - SPos->z );
-	
-	if( BackgroundCollide( &MCloadheadert0, &Mloadheader, SPos, Group, &Dir,
-						&Int_Point, &Int_Group, &Int_Normal, &TempVector, true, NULL ) )
-	{
-		return false;
-	}
-	
-	return true;
+	return LOSCacheClearRay( SPos, Group, Pos );
 }
 /*===================================================================
 	Procedure	:	Is a VECTOR * Pos in Clear LOS And will the SPos
@@ -358,16 +343,18 @@ bool AI_ClearLOSNonZero( OBJECT * SObject, VECTOR * Pos , float radius )
 {
 	VECTOR	Dir;
 	BGOBJECT * BGObject;
+	bool	Clear;
+
+	if( LOSCacheLookup( LOS_Object, &SObject->Pos, SObject->Group, Pos, radius, &Clear ) ) return Clear;
 
 	Dir.x = ( Pos->x - SObject->Pos.x );
 	Dir.y = ( Pos->y - SObject->Pos.y );
 	Dir.z = ( Pos->z - SObject->Pos.z );
 
-	if( WouldObjectCollide( SObject, &Dir, radius, &BGObject ) )
-	{
-		return false;
-	}
-	return true;
+	Clear = !WouldObjectCollide( SObject, &Dir, radius, &BGObject );
+	LOSCacheStore( LOS_Object, &SObject->Pos, SObject->Group, Pos, radius, Clear );
+
+	return Clear;
 }
 /*===================================================================
 	Procedure	:	Is a VECTOR * Pos in Clear LOS And will the SPos
@@ -383,11 +370,18 @@ bool AI_ClearLOSNonZeroNonObject( VECTOR * SPos, u_int16_t Group , VECTOR * Pos
 	VECTOR Impact_Point;
 	u_int16_t Impact_Group;
 	NORMAL Impact_Normal;
+	bool	Clear;
+
+	if( LOSCacheLookup( LOS_Sphere, SPos, Group, Pos, radius, &Clear ) ) return Clear;
 
 	Dir.x = ( Pos->x - SPos->x );
 	Dir.y = ( Pos->y - SPos->y );
 	Dir.z = ( Pos->z - SPos->z );
-	return !QCollide( SPos , Group , &Dir, radius , &Impact_Point, &Impact_Group, &Impact_Normal );
+
+	Clear = !QCollide( SPos , Group , &Dir, radius , &Impact_Point, &Impact_Group, &Impact_Normal );
+	LOSCacheStore( LOS_Sphere, SPos, Group, Pos, radius, Clear );
+
+	return Clear;
 }
 /*===================================================================
 	Procedure	:	Find a Target...
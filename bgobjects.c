@@ -42,7 +42,7 @@ extern	VECTOR			SlideUp;
 extern	VECTOR			SlideDown;
 extern	VECTOR			SlideLeft;
 extern	VECTOR			SlideRight;
-extern	MODEL			Models[ MAXNUMOFMODELS ];
+extern	MODEL			*	Models;
 extern	float			framelag;
 extern	MATRIX			MATRIX_Identity;
 extern	int16_t			LevelNum;
@@ -44,10 +44,13 @@ extern BYTE WhoIAm;
 extern MCLOADHEADER	MCloadheader;
 extern MCLOADHEADER	MCloadheadert0;
 extern MLOADHEADER Mloadheader;
-extern MODEL Models[MAXNUMOFMODELS];
+extern MODEL *	Models;
 extern PICKUP Pickups[ MAXPICKUPS ];
 extern PRIMARYWEAPONATTRIB PrimaryWeaponAttribs[ TOTALPRIMARYWEAPONS ];
 extern PRIMARYWEAPONBULLET PrimBulls[ MAXPRIMARYWEAPONBULLETS ];
+extern VECTOR PrimBullPos[ MAXPRIMARYWEAPONBULLETS ];
+extern VECTOR PrimBullDir[ MAXPRIMARYWEAPONBULLETS ];
+extern float PrimBullSpeed[ MAXPRIMARYWEAPONBULLETS ];
 extern SECONDARYWEAPONBULLET SecBulls[ MAXSECONDARYWEAPONBULLETS ];
 extern SHIPCONTROL control;
 extern SHIPHEALTHMSG PlayerHealths[ MAX_PLAYERS+1 ];
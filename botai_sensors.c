@@ -775,11 +775,11 @@ float BOTAI_WhenWillBulletHitMe(VECTOR * MyPos)
 			switch( PrimaryWeaponAttribs[ PrimBulls[i].Weapon ].ColType )
 			{
 				case COLTYPE_Transpulse:
-					TempVector.x = Ships[ WhoIAm ].Object.Pos.x - PrimBulls[i].Pos.x;
-					TempVector.y = Ships[ WhoIAm ].Object.Pos.y - PrimBulls[i].Pos.y;
-					TempVector.z = Ships[ WhoIAm ].Object.Pos.z - PrimBulls[i].Pos.z;
+					TempVector.x = Ships[ WhoIAm ].Object.Pos.x - PrimBullPos[i].x;
+					TempVector.y = Ships[ WhoIAm ].Object.Pos.y - PrimBullPos[i].y;
+					TempVector.z = Ships[ WhoIAm ].Object.Pos.z - PrimBullPos[i].z;
 					NormaliseVector( &TempVector );
-					Cos = (float) ( 1.0F - fabs( DotProduct( &TempVector, &PrimBulls[i].Dir ) ) );
+					Cos = (float) ( 1.0F - fabs( DotProduct( &TempVector, &PrimBullDir[i] ) ) );
 					Cos = (float) ( Cos * ( 1.0F - fabs( DotProduct( &TempVector, &PrimBulls[i].UpVector ) ) ) );
 					ShipRadius = SHIP_RADIUS + ( PrimBulls[i].ColRadius * Cos );
 					break;
@@ -796,10 +796,10 @@ float BOTAI_WhenWillBulletHitMe(VECTOR * MyPos)
 			}
 
 			// bullet will (currently) eventually collide with this position
-			if(RaytoSphere2( MyPos, ShipRadius, &PrimBulls[i].Pos, &PrimBulls[i].Dir, &TempVect, &TempVect ))
+			if(RaytoSphere2( MyPos, ShipRadius, &PrimBullPos[i], &PrimBullDir[i], &TempVect, &TempVect ))
 			{
-				dist = DistanceVector2Vector(MyPos, &PrimBulls[i].Pos);
-				time = dist/PrimBulls[i].Speed;
+				dist = DistanceVector2Vector(MyPos, &PrimBullPos[i]);
+				time = dist/PrimBullSpeed[i];
 				if(time < shortestTime)
 					shortestTime = time;
 			}
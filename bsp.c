@@ -184,7 +184,6 @@ static bool BSP_LoadPortals( char *fname )
 {
 	char	Filename[ 256 ];
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	char		*	OrgBuffer;
 	int16_t		*	int16_tpnt;
@@ -197,22 +196,17 @@ static bool BSP_LoadPortals( char *fname )
 
 	Change_Ext( fname, Filename, ".PBS" );
 
-	File_Size = Get_File_Size( Filename );	
-	if( !File_Size )
+	if( !Get_File_Size( Filename ) )
 	{
-		Msg( "Bsp_Portalload() no PBS file %s", Filename );
+		DebugPrintf( "Bsp_Portalload() no PBS file %s\n", Filename );
 		return false;
 	}
 
-	Buffer = malloc( File_Size );
+	Buffer = load_file_buffer( Filename, &File_Size, 0 );
 	OrgBuffer = Buffer;
 
 	if( Buffer == NULL ) return false;
 
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size ) return false;
-
 	Uint32Pnt = (u_int32_t *) Buffer;
 	MagicNumber = *Uint32Pnt++;
 	VersionNumber = *Uint32Pnt++;
@@ -220,7 +214,8 @@ static bool BSP_LoadPortals( char *fname )
 
 	if( ( MagicNumber != MAGIC_NUMBER ) || ( VersionNumber != BSP_PORTAL_VERSION_NUMBER  ) )
 	{
-		Msg( "Bsp_Portalload() Incompatible PBS file %s", Filename );
+		DebugPrintf( "Bsp_Portalload() Incompatible PBS file %s\n", Filename );
+		release_file_buffer( OrgBuffer );
 		return( false );
 	}
 	int16_tpnt = ( int16_t * ) Buffer;
@@ -235,7 +230,7 @@ static bool BSP_LoadPortals( char *fname )
 		}
 	}
 
-	free( OrgBuffer );
+	release_file_buffer( OrgBuffer );
 
 	Bsp_Portal_Header.state = true;
 
@@ -251,7 +246,6 @@ bool Bspload( char * Filename, BSP_HEADER *Bsp_Header )
 {
 #ifdef BSP
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	char		*	OrgBuffer;
 	int16_t		*	int16_tpnt;
@@ -262,23 +256,18 @@ bool Bspload( char * Filename, BSP_HEADER *Bsp_Header )
 
 	Bsp_Header->State = false;
 
-	File_Size = Get_File_Size( Filename );	
-	if( !File_Size )
+	if( !Get_File_Size( Filename ) )
 	{
-		Msg( "Bspload() no BSP file %s", Filename );
+		DebugPrintf( "Bspload() no BSP file %s\n", Filename );
 		return false;
 	}
 
-	Buffer = malloc( File_Size );
+	Buffer = load_file_buffer( Filename, &File_Size, 0 );
 
 	if( Buffer == NULL ) return false;
 
 	OrgBuffer = Buffer;
 
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size ) return false;
-
 	Uint32Pnt = (u_int32_t *) Buffer;
 	MagicNumber = *Uint32Pnt++;
 	VersionNumber = *Uint32Pnt++;
@@ -286,7 +275,8 @@ bool Bspload( char * Filename, BSP_HEADER *Bsp_Header )
 
 	if( ( MagicNumber != MAGIC_NUMBER ) || ( VersionNumber != BSP_VERSION_NUMBER  ) )
 	{
-		Msg( "Bspload() Incompatible BSP file %s", Filename );
+		DebugPrintf( "Bspload() Incompatible BSP file %s\n", Filename );
+		release_file_buffer( OrgBuffer );
 		return( false );
 	}
 	int16_tpnt = ( int16_t * ) Buffer;
@@ -300,7 +290,7 @@ bool Bspload( char * Filename, BSP_HEADER *Bsp_Header )
 			return false;
 		}
 	}
-	free( OrgBuffer );
+	release_file_buffer( OrgBuffer );
 
 #endif
 	Bsp_Header->State = true;
@@ -26,6 +26,7 @@
 #include "secondary.h"
 #include "restart.h"
 #include "util.h"
+#include "file.h"
 
 //#undef COLLISION_FUDGE
 //#define COLLISION_FUDGE	(0.065F)
@@ -136,7 +137,6 @@ bool MCload( char * Filename , MCLOADHEADER * MCloadheader )
 {
 #ifdef POLYGONAL_COLLISIONS
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	u_int16_t		*	Uint16Pnt;
 	u_int32_t		*	Uint32Pnt;
@@ -144,20 +144,11 @@ bool MCload( char * Filename , MCLOADHEADER * MCloadheader )
 	u_int32_t			MagicNumber;
 	u_int32_t			VersionNumber;
 
-	File_Size = Get_File_Size( Filename );	
-
-	if( !File_Size )
-		return ( false );
-
-	Buffer = malloc( File_Size );
+	// the faces are used where they lie in the mapped file
+	Buffer = load_file_buffer( Filename, &File_Size, 0 );
 
 	if( Buffer == NULL )
 		return( false );
-
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size )
-		return( false );
 	
 	MCloadheader->Buffer = Buffer;
 
@@ -168,7 +159,7 @@ bool MCload( char * Filename , MCLOADHEADER * MCloadheader )
 
 	if( ( MagicNumber != MAGIC_NUMBER ) || ( VersionNumber != MC_VERSION_NUMBER  ) )
 	{
-		Msg( "MCload() Incompatible collision ( .MC ) file %s", Filename );
+		DebugPrintf( "MCload() Incompatible collision ( .MC ) file %s\n", Filename );
 		return( false );
 	}
 
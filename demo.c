@@ -26,6 +26,8 @@
 #include "util.h"
 #include "demo.h"
 #include "file.h"
+#include "demofile.h"
+#include "oct2.h"
 
 
 extern BYTE TeamNumber[MAX_PLAYERS];
@@ -38,15 +40,20 @@ extern u_int16_t RandomStartPosModify;
 extern int CameraStatus;  
 extern bool CountDownOn;
 extern bool DemoShipInit[];
+extern int16_t NumLevels;
+extern int16_t LevelNum;
+extern BYTE MyGameStatus;
 extern u_int16_t CopyOfSeed1;
 extern u_int16_t CopyOfSeed2;
 extern bool RandomPickups;
 extern bool PlayDemo;
+extern bool IsHost;
 extern void DebugLastError( void );
 extern bool ChangeLevel( void );
+extern void ReleaseView( void );
 
-FILE	*	DemoFp = NULL;
-FILE	*	DemoFpClean = NULL;
+DEMOSTREAM *	DemoFp = NULL;
+DEMOSTREAM *	DemoFpClean = NULL;
 
 char *DemoFileName( char *demoname )
 {
@@ -85,12 +92,28 @@ char *DemoName( char *demofilename )
 
 void StartDemoCleaning( MENUITEM * Item )
 {
+#ifdef DEMO_SUPPORT
+	if ( !DemoCleanFile( DemoFileName( DemoList.item[DemoList.selected_item] ) ) )
+		return;
+
+	if (CameraStatus != CAMERA_AtStart)
+		MenuBack();
+	else
+		MenuExit();
+#endif
+}
+
+// rewrites a demo with interpolation messages, false if it can't be read
+bool DemoCleanFile( char * Filename )
+{
 #ifdef DEMO_SUPPORT
 	char buf[256];
 	int i;
 	u_int32_t mp_version;
 	u_int32_t flags;
-	char *clean_name;
+	char clean_name[256];
+	char from[256];
+	int Cleaned;
 	u_int16_t	TempSeed1, TempSeed2;
 	bool	TempRandomPickups;
 	u_int32_t	TempPackedInfo[ MAX_PICKUPFLAGS ];
@@ -98,39 +121,38 @@ void StartDemoCleaning( MENUITEM * Item )
 	NewLevelNum = -1;
 
 	memset (TeamNumber, 255, sizeof(BYTE) * MAX_PLAYERS);
-	DemoFp = file_open( DemoFileName( DemoList.item[DemoList.selected_item] ) , "rb" );
+	DemoFp = DemoStreamOpen( Filename );
 	if ( !DemoFp )
 	{
 		// can't open file
-		return;
+		return false;
 	}
 
-	setvbuf( DemoFp, NULL, _IONBF , 0 );		// size of stream buffer...
 	
-	fread( &mp_version, sizeof( mp_version ), 1, DemoFp );
+	DemoStreamRead( &mp_version, sizeof( mp_version ), 1, DemoFp );
 	if ( (mp_version > MULTIPLAYER_VERSION) || (mp_version < DEMO_MULTIPLAYER_VERSION) )
 	{
 		// incompatible multiplayer version
-		fclose( DemoFp );
-		return;
+		DemoStreamClose( DemoFp );
+		return false;
 	}
 
-	fread( &TempSeed1, sizeof( TempSeed1 ), 1, DemoFp );
-	fread( &TempSeed2, sizeof( TempSeed2 ), 1, DemoFp );
-	fread( &TempRandomPickups, sizeof( TempRandomPickups ), 1, DemoFp );
-	fread( &TempPackedInfo[ 0 ], sizeof( TempPackedInfo ), 1, DemoFp );
+	DemoStreamRead( &TempSeed1, sizeof( TempSeed1 ), 1, DemoFp );
+	DemoStreamRead( &TempSeed2, sizeof( TempSeed2 ), 1, DemoFp );
+	DemoStreamRead( &TempRandomPickups, sizeof( TempRandomPickups ), 1, DemoFp );
+	DemoStreamRead( &TempPackedInfo[ 0 ], sizeof( TempPackedInfo ), 1, DemoFp );
 
-	fread( &flags, sizeof( flags ), 1, DemoFp );
+	DemoStreamRead( &flags, sizeof( flags ), 1, DemoFp );
 	TeamGame = ( flags & TeamGameBit ) ? true : false;
 	CTF = ( flags & CTFGameBit ) ? true : false;
 	CaptureTheFlag = ( flags & FlagGameBit ) ? true : false;
 	BountyHunt = ( flags & BountyGameBit ) ? true : false;
 
-	fread( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFp );
+	DemoStreamRead( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFp );
 
 	for( i = 0 ; i < 256 ; i++ )
 	{
-		fread( &buf[i], sizeof(char), 1, DemoFp );
+		DemoStreamRead( &buf[i], sizeof(char), 1, DemoFp );
 		if( buf[i] == 0 )
 		{
 			break;
@@ -149,60 +171,79 @@ void StartDemoCleaning( MENUITEM * Item )
 	
 	if( ( NewLevelNum == -1 ) || ( i == 256 ) )
 	{
-		fclose( DemoFp );
-		return;
+		DemoStreamClose( DemoFp );
+		return false;
 	}
 
-	clean_name = _tempnam( ".", "dmo" );
-	if ( !clean_name )
-	{
-		// unable to create unique temporary filename
-		return;
-	}
+	// named after the demo so batch workers cleaning side by side
+	// never pick the same temporary file
+	snprintf( clean_name, sizeof( clean_name ), "%s.clean", Filename );
 	DebugPrintf( "temp demo clean name = %s\n", clean_name );
 //	DemoFpClean = file_open( DemoFileName( DemoGameName.text ) , "wbc" );
-	DemoFpClean = file_open( clean_name , "wbc" );
-	setvbuf( DemoFpClean, NULL, _IONBF , 0 );		// size of stream buffer...
+	DemoFpClean = DemoStreamCreate( clean_name );
+	if ( !DemoFpClean )
+	{
+		DemoStreamClose( DemoFp );
+		return false;
+	}
 
-	fwrite( &mp_version, sizeof( mp_version ), 1, DemoFpClean );
+	DemoStreamWrite( &mp_version, sizeof( mp_version ), 1, DemoFpClean );
 
-	fwrite( &TempSeed1, sizeof( TempSeed1 ), 1, DemoFpClean );
-	fwrite( &TempSeed2, sizeof( TempSeed2 ), 1, DemoFpClean );
-	fwrite( &TempRandomPickups, sizeof( TempRandomPickups ), 1, DemoFpClean );
-	fwrite( &TempPackedInfo[ 0 ], sizeof( TempPackedInfo ), 1, DemoFpClean );
+	DemoStreamWrite( &TempSeed1, sizeof( TempSeed1 ), 1, DemoFpClean );
+	DemoStreamWrite( &TempSeed2, sizeof( TempSeed2 ), 1, DemoFpClean );
+	DemoStreamWrite( &TempRandomPickups, sizeof( TempRandomPickups ), 1, DemoFpClean );
+	DemoStreamWrite( &TempPackedInfo[ 0 ], sizeof( TempPackedInfo ), 1, DemoFpClean );
 
-	fwrite( &flags, sizeof( flags ), 1, DemoFpClean );
-	fwrite( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFpClean );
+	DemoStreamWrite( &flags, sizeof( flags ), 1, DemoFpClean );
+	DemoStreamWrite( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFpClean );
 	for( i = 0 ; i < 256 ; i++ )
 	{
-		fwrite( &buf[i], sizeof(char), 1, DemoFpClean );
+		DemoStreamWrite( &buf[i], sizeof(char), 1, DemoFpClean );
 		if( buf[i] == 0 )
 		{
 			break;
 		}
 	}
 
-	DemoClean();
-	
-	fclose( DemoFp );
-	fclose( DemoFpClean );
-	if ( !delete_file( DemoFileName( DemoList.item[DemoList.selected_item] ) ) )
+	Cleaned = DemoClean();
+
+	// an interpolated demo was cleaned before, leave it as it is
+	if ( !Cleaned && !DemoStreamFailed( DemoFp ) )
 	{
-		DebugPrintf( "delete_file( %s ) failed\n", DemoFileName( DemoList.item[DemoList.selected_item] ) );
-		DebugLastError();
+		DemoStreamClose( DemoFp );
+		DemoStreamClose( DemoFpClean );
+		delete_file( clean_name );
+		return true;
 	}
-	if ( !MoveFile( clean_name, DemoFileName( DemoList.item[DemoList.selected_item] ) ) )
+
+	// a corrupt block ends the demo early, keep the original
+	if ( ( Cleaned < 0 ) || DemoStreamFailed( DemoFp ) )
 	{
-		DebugPrintf( "MoveFile( %s, %s ) failed\n",
-			clean_name, DemoFileName( DemoList.item[DemoList.selected_item] ) );
-		DebugLastError();
+		DebugPrintf( "DemoCleanFile( %s ) the demo is corrupt\n", Filename );
+		DemoStreamClose( DemoFp );
+		DemoStreamClose( DemoFpClean );
+		delete_file( clean_name );
+		return false;
 	}
-	free( clean_name );
 
-	if (CameraStatus != CAMERA_AtStart)
-		MenuBack();
-	else
-		MenuExit();
+	DemoStreamClose( DemoFp );
+	DemoStreamClose( DemoFpClean );
+	if ( !delete_file( Filename ) )
+	{
+		DebugPrintf( "delete_file( %s ) failed\n", Filename );
+		DebugLastError();
+	}
+	strncpy( from, convert_path( clean_name ), sizeof( from ) - 1 );
+	from[ sizeof( from ) - 1 ] = 0;
+	if ( rename( from, convert_path( Filename ) ) != 0 )
+	{
+		DebugPrintf( "rename( %s, %s ) failed\n",
+			clean_name, Filename );
+		return false;
+	}
+	return true;
+#else
+	return false;
 #endif
 }
 
@@ -231,7 +272,7 @@ void StartDemoPlayback( MENUITEM * Item )
 	DemoShipInit[ MAX_PLAYERS ] = true;
 	memset (TeamNumber, 255, sizeof(BYTE) * MAX_PLAYERS);
 
-	DemoFp = file_open( DemoFileName( DemoList.item[DemoList.selected_item] ) , "rb" );
+	DemoFp = DemoStreamOpen( DemoFileName( DemoList.item[DemoList.selected_item] ) );
 
 	if( !DemoFp )
 	{
@@ -239,34 +280,33 @@ void StartDemoPlayback( MENUITEM * Item )
 		return;
 	}
 
-	setvbuf( DemoFp, NULL, _IONBF , 0 );		// size of stream buffer...
 	
 
-	fread( &mp_version, sizeof( mp_version ), 1, DemoFp );
+	DemoStreamRead( &mp_version, sizeof( mp_version ), 1, DemoFp );
 	if ( (mp_version > MULTIPLAYER_VERSION) || (mp_version < DEMO_MULTIPLAYER_VERSION) )
 	{
 		// incompatible multiplayer version
-		fclose( DemoFp );
+		DemoStreamClose( DemoFp );
 		return;
 	}
 
-	fread( &CopyOfSeed1, sizeof( CopyOfSeed1 ), 1, DemoFp );
-	fread( &CopyOfSeed2, sizeof( CopyOfSeed2 ), 1, DemoFp );
-	fread( &RandomPickups, sizeof( RandomPickups ), 1, DemoFp );
-	fread( &PackedInfo[ 0 ], sizeof( PackedInfo ), 1, DemoFp );
+	DemoStreamRead( &CopyOfSeed1, sizeof( CopyOfSeed1 ), 1, DemoFp );
+	DemoStreamRead( &CopyOfSeed2, sizeof( CopyOfSeed2 ), 1, DemoFp );
+	DemoStreamRead( &RandomPickups, sizeof( RandomPickups ), 1, DemoFp );
+	DemoStreamRead( &PackedInfo[ 0 ], sizeof( PackedInfo ), 1, DemoFp );
 	UnpackPickupInfo( &PackedInfo[ 0 ] );
 
-	fread( &flags, sizeof( flags ), 1, DemoFp );
+	DemoStreamRead( &flags, sizeof( flags ), 1, DemoFp );
 	TeamGame = ( flags & TeamGameBit ) ? true : false;
 	CTF = ( flags & CTFGameBit ) ? true : false;
 	CaptureTheFlag = ( flags & FlagGameBit ) ? true : false;
 	BountyHunt = ( flags & BountyGameBit ) ? true : false;
 
-	fread( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFp );
+	DemoStreamRead( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFp );
 
 	for( i = 0 ; i < 256 ; i++ )
 	{
-		fread( &buf[i], sizeof(char), 1, DemoFp );
+		DemoStreamRead( &buf[i], sizeof(char), 1, DemoFp );
 		if( buf[i] == 0 )
 		{
 			break;
@@ -285,7 +325,7 @@ void StartDemoPlayback( MENUITEM * Item )
 	
 	if( ( NewLevelNum == -1 ) || ( i == 256 ) )
 	{
-		fclose( DemoFp );
+		DemoStreamClose( DemoFp );
 		return;
 	}
 	MenuAbort();
@@ -296,6 +336,7 @@ void StartDemoPlayback( MENUITEM * Item )
 
 	MyGameStatus = STATUS_ChangeLevelPostPlayingDemo;
 	WhoIAm = MAX_PLAYERS;
+	IsHost = false;	// the host's messages are in the demo
 
 //	RandomStartPosModify = 0;
 	SetupNetworkGame();
@@ -9,10 +9,17 @@
 #define DEMOFILE_EXTENSION		".DMO"
 #define DEMOFILE_SEARCHPATH		DEMOFOLDER"\\*"DEMOFILE_EXTENSION
 
+// game type flags in a demo header
+#define TeamGameBit				(1<<0)
+#define CTFGameBit				(1<<1)
+#define FlagGameBit				(1<<2)
+#define BountyGameBit			(1<<3)
+
 char *DemoFileName( char *demoname );
 char *DemoName( char *demofilename );
 
 void StartDemoCleaning( MENUITEM * Item );
+bool DemoCleanFile( char * Filename );
 void StartDemoPlayback( MENUITEM * Item );
 
 #endif
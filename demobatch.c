@@ -0,0 +1,591 @@
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <SDL.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include "demobatch.h"
+#include "title.h"
+#include "demo.h"
+#include "demofile.h"
+#include "networking.h"
+#include "oct2.h"
+#include "file.h"
+#include "util.h"
+
+extern bool InitLevels( char * levels_list );
+extern int16_t NumLevels;
+
+static const char * ModeNames[] = { "", "clean", "validate", "stats" };
+
+bool DemoBatchSetup( DEMOBATCH * Batch, char * Mode, char * List, char * Output )
+{
+	int i;
+
+	Batch->Mode = DEMOBATCH_None;
+	for ( i = DEMOBATCH_Clean; i <= DEMOBATCH_Stats; i++ )
+	{
+		if ( !strcasecmp( Mode, ModeNames[ i ] ) )
+			Batch->Mode = i;
+	}
+	if ( Batch->Mode == DEMOBATCH_None )
+		return false;
+
+	strncpy( Batch->List, List, sizeof( Batch->List ) - 1 );
+	Batch->List[ sizeof( Batch->List ) - 1 ] = 0;
+	strncpy( Batch->Output, Output, sizeof( Batch->Output ) - 1 );
+	Batch->Output[ sizeof( Batch->Output ) - 1 ] = 0;
+	return true;
+}
+
+#ifdef DEMO_SUPPORT
+
+#ifdef WIN32
+typedef HANDLE WORKER;
+#else
+typedef pid_t WORKER;
+#endif
+
+typedef char DEMOBATCHNAME[ MAX_DEMONAME_LENGTH + 1 ];
+
+// what a walk over the messages of a demo found
+typedef struct
+{
+	u_int32_t	Version;
+	u_int32_t	Flags;
+	char		Level[ 256 ];
+	int			Messages;
+	int			SystemMessages;
+	int			Keyframes;
+	int64_t		Bytes;
+	LONGLONG	FirstTime;
+	LONGLONG	LastTime;
+	int			Codes[ 256 ];
+} DEMOSUMMARY;
+
+static BYTE WalkBuffer[ MAX_BUFFER_SIZE ];
+
+// the list file or every demo in the demo folder, NULL if there are none
+static DEMOBATCHNAME * LoadList( char * List, int * Count )
+{
+	DEMOBATCHNAME * Names = NULL;
+	int Allocated = 0;
+	char line[ 256 ];
+	char * name;
+	char * end;
+	FILE * f = NULL;
+
+	*Count = 0;
+
+	if ( !strcasecmp( List, "all" ) )
+	{
+		name = find_file( DEMOFILE_SEARCHPATH );
+	}
+	else
+	{
+		f = file_open( List, "r" );
+		if ( !f )
+		{
+			Msg( "DemoBatch: couldn't open the list %s\n", List );
+			return NULL;
+		}
+		name = fgets( line, sizeof( line ), f );
+	}
+
+	while ( name )
+	{
+		// trim the line
+		while ( *name == ' ' || *name == '\t' )
+			name++;
+		end = name + strlen( name );
+		while ( end > name && ( end[ -1 ] == '\n' || end[ -1 ] == '\r' || end[ -1 ] == ' ' || end[ -1 ] == '\t' ) )
+			*--end = 0;
+
+		if ( *name )
+		{
+			if ( *Count == Allocated )
+			{
+				DEMOBATCHNAME * More;
+
+				Allocated = Allocated ? Allocated * 2 : 64;
+				More = realloc( Names, Allocated * sizeof( DEMOBATCHNAME ) );
+				if ( !More )
+				{
+					Msg( "DemoBatch: out of memory for the list\n" );
+					free( Names );
+					Names = NULL;
+					*Count = 0;
+					break;
+				}
+				Names = More;
+			}
+			strncpy( Names[ *Count ], DemoName( name ), sizeof( DEMOBATCHNAME ) - 1 );
+			Names[ *Count ][ sizeof( DEMOBATCHNAME ) - 1 ] = 0;
+			( *Count )++;
+		}
+
+		name = f ? fgets( line, sizeof( line ), f ) : find_next_file();
+	}
+
+	if ( f )
+		fclose( f );
+	else
+		find_close();
+
+	return Names;
+}
+
+static void JsonString( FILE * f, const char * s )
+{
+	fputc( '"', f );
+	for ( ; *s; s++ )
+	{
+		if ( *s == '"' || *s == '\\' )
+			fprintf( f, "\\%c", *s );
+		else if ( (unsigned char) *s < ' ' )
+			fprintf( f, "\\u%04x", (unsigned char) *s );
+		else
+			fputc( *s, f );
+	}
+	fputc( '"', f );
+}
+
+// header and every message of a demo, Error says what was wrong
+static bool WalkDemo( char * Filename, DEMOSUMMARY * Summary, const char ** Error )
+{
+	DEMOSTREAM * Demo;
+	u_int16_t Seed;
+	bool RandomPickups;
+	u_int32_t PackedInfo[ MAX_PICKUPFLAGS ];
+	u_int16_t StartPosModify;
+	LONGLONG Time;
+	DWORD nBytes;
+	DPID from;
+	bool InKeyframe = false;
+	int i;
+
+	memset( Summary, 0, sizeof( *Summary ) );
+
+	Demo = DemoStreamOpen( Filename );
+	if ( !Demo )
+	{
+		*Error = "can't open the demo";
+		return false;
+	}
+
+	if ( !DemoStreamRead( &Summary->Version, sizeof( Summary->Version ), 1, Demo ) ||
+		 Summary->Version > MULTIPLAYER_VERSION || Summary->Version < DEMO_MULTIPLAYER_VERSION )
+	{
+		*Error = "incompatible multiplayer version";
+		DemoStreamClose( Demo );
+		return false;
+	}
+
+	DemoStreamRead( &Seed, sizeof( Seed ), 1, Demo );
+	DemoStreamRead( &Seed, sizeof( Seed ), 1, Demo );
+	DemoStreamRead( &RandomPickups, sizeof( RandomPickups ), 1, Demo );
+	DemoStreamRead( &PackedInfo[ 0 ], sizeof( PackedInfo ), 1, Demo );
+	DemoStreamRead( &Summary->Flags, sizeof( Summary->Flags ), 1, Demo );
+	DemoStreamRead( &StartPosModify, sizeof( StartPosModify ), 1, Demo );
+
+	for ( i = 0; i < (int) sizeof( Summary->Level ) - 1; i++ )
+	{
+		if ( !DemoStreamRead( &Summary->Level[ i ], sizeof( char ), 1, Demo ) || !Summary->Level[ i ] )
+			break;
+	}
+	Summary->Level[ i ] = 0;
+
+	for ( i = 0; i < NumLevels; i++ )
+	{
+		if ( !strcasecmp( ShortLevelNames[ i ], Summary->Level ) )
+			break;
+	}
+	if ( i == NumLevels )
+	{
+		*Error = "the level isn't installed";
+		DemoStreamClose( Demo );
+		return false;
+	}
+
+	while ( DemoStreamRead( &Time, sizeof( LONGLONG ), 1, Demo ) )
+	{
+		if ( !DemoStreamRead( &nBytes, sizeof( DWORD ), 1, Demo ) ||
+			 !DemoStreamRead( &from, sizeof( DPID ), 1, Demo ) )
+		{
+			*Error = "truncated message";
+			break;
+		}
+		if ( !nBytes || nBytes > sizeof( WalkBuffer ) )
+		{
+			*Error = "message size out of range";
+			break;
+		}
+		if ( !DemoStreamRead( &WalkBuffer[ 0 ], nBytes, 1, Demo ) )
+		{
+			*Error = "truncated message";
+			break;
+		}
+		if ( Summary->Messages && Time < Summary->LastTime )
+		{
+			*Error = "message times go backwards";
+			break;
+		}
+
+		if ( !Summary->Messages )
+			Summary->FirstTime = Time;
+		Summary->LastTime = Time;
+		Summary->Messages++;
+		Summary->Bytes += nBytes;
+
+		// a keyframe is a run of records from DEMO_KEYFRAME_ID
+		if ( from == DEMO_KEYFRAME_ID && !InKeyframe )
+			Summary->Keyframes++;
+		InKeyframe = ( from == DEMO_KEYFRAME_ID );
+
+		if ( from == DPID_SYSMSG )
+			Summary->SystemMessages++;
+		else if ( from != DEMO_KEYFRAME_ID )
+			Summary->Codes[ WalkBuffer[ 0 ] ]++;
+	}
+
+	if ( !*Error && DemoStreamFailed( Demo ) )
+		*Error = "corrupt block";
+
+	DemoStreamClose( Demo );
+	return *Error == NULL;
+}
+
+// one demo, the result goes to Result as a json object
+static bool RunJob( int Mode, char * Name, char * Result )
+{
+	DEMOSUMMARY Summary;
+	const char * Error = NULL;
+	char * Filename;
+	long Before = 0;
+	bool ok;
+	int i;
+	FILE * f;
+
+	Filename = DemoFileName( Name );
+
+	if ( Mode == DEMOBATCH_Clean )
+	{
+		Before = Get_File_Size( Filename );
+		ok = DemoCleanFile( Filename );
+		if ( !ok )
+			Error = "can't clean the demo";
+	}
+	else
+	{
+		ok = WalkDemo( Filename, &Summary, &Error );
+	}
+
+	f = file_open( Result, "w" );
+	if ( !f )
+	{
+		DebugPrintf( "DemoBatch: couldn't write %s\n", Result );
+		return false;
+	}
+
+	fprintf( f, "{ \"demo\": " );
+	JsonString( f, Name );
+	fprintf( f, ", \"ok\": %s", ok ? "true" : "false" );
+	if ( Error )
+	{
+		fprintf( f, ", \"error\": " );
+		JsonString( f, Error );
+	}
+
+	if ( Mode == DEMOBATCH_Clean )
+	{
+		if ( ok )
+			fprintf( f, ", \"bytes_before\": %ld, \"bytes_after\": %ld", Before, Get_File_Size( Filename ) );
+	}
+	else if ( Summary.Version )
+	{
+		LONGLONG Freq;
+
+		QueryPerformanceFrequency( (LARGE_INTEGER *) &Freq );
+
+		fprintf( f, ", \"version\": %u, \"level\": ", Summary.Version );
+		JsonString( f, Summary.Level );
+		fprintf( f, ", \"seconds\": %.2f, \"messages\": %d",
+			(double) ( Summary.LastTime - Summary.FirstTime ) / (double) Freq, Summary.Messages );
+
+		if ( Mode == DEMOBATCH_Stats )
+		{
+			bool first = true;
+
+			fprintf( f, ", \"flags\": %u, \"bytes\": %lld, \"system_messages\": %d, \"keyframes\": %d, \"codes\": {",
+				Summary.Flags, (long long) Summary.Bytes, Summary.SystemMessages, Summary.Keyframes );
+			for ( i = 0; i < 256; i++ )
+			{
+				if ( !Summary.Codes[ i ] )
+					continue;
+				fprintf( f, "%s \"0x%02x\": %d", first ? "" : ",", i, Summary.Codes[ i ] );
+				first = false;
+			}
+			fprintf( f, " }" );
+		}
+	}
+
+	fprintf( f, " }" );
+	fclose( f );
+
+	DebugPrintf( "DemoBatch: %s %s %s\n", ModeNames[ Mode ], Name, ok ? "ok" : Error );
+	return ok;
+}
+
+static char * ResultName( DEMOBATCH * Batch, int Index )
+{
+	static char name[ 160 ];
+
+	snprintf( name, sizeof( name ), "%s.%d", Batch->Output, Index );
+	return name;
+}
+
+// starts a worker for one list entry, false if it couldn't be started
+static bool StartWorker( DEMOBATCH * Batch, DEMOBATCHNAME * Names, int Index, WORKER * Worker )
+{
+#ifdef WIN32
+	char exe[ MAX_PATH ];
+	char cmd[ MAX_PATH + 320 ];
+	STARTUPINFO si;
+	PROCESS_INFORMATION pi;
+
+	if ( !GetModuleFileName( NULL, exe, sizeof( exe ) ) )
+		return false;
+	snprintf( cmd, sizeof( cmd ), "\"%s\" -DemoBatch %s %s %s -DemoBatchJob %d",
+		exe, ModeNames[ Batch->Mode ], Batch->List, Batch->Output, Index );
+
+	memset( &si, 0, sizeof( si ) );
+	si.cb = sizeof( si );
+	if ( !CreateProcess( NULL, cmd, NULL, NULL, FALSE, CREATE_NO_WINDOW, NULL, NULL, &si, &pi ) )
+		return false;
+	CloseHandle( pi.hThread );
+	*Worker = pi.hProcess;
+	return true;
+#else
+	pid_t pid;
+
+	// so the worker doesn't write out what the batch had buffered
+	fflush( NULL );
+
+	pid = fork();
+	if ( pid < 0 )
+		return false;
+	if ( !pid )
+	{
+		bool ok = RunJob( Batch->Mode, Names[ Index ], ResultName( Batch, Index ) );
+		fflush( NULL );
+		_exit( ok ? 0 : 1 );
+	}
+	*Worker = pid;
+	return true;
+#endif
+}
+
+// waits for any worker to exit, the slot it was in and how it ended
+static int WaitWorker( WORKER * Workers, int Count, bool * Passed, char * Ended, size_t EndedSize )
+{
+#ifdef WIN32
+	DWORD code = 0;
+	DWORD slot;
+
+	slot = WaitForMultipleObjects( Count, Workers, FALSE, INFINITE ) - WAIT_OBJECT_0;
+	if ( slot >= (DWORD) Count )
+		return -1;
+	GetExitCodeProcess( Workers[ slot ], &code );
+	CloseHandle( Workers[ slot ] );
+	*Passed = ( code == 0 );
+	snprintf( Ended, EndedSize, "worker exited with %lu", (unsigned long) code );
+	return (int) slot;
+#else
+	int status;
+	pid_t pid;
+	int slot;
+
+	do
+		pid = waitpid( -1, &status, 0 );
+	while ( pid < 0 && errno == EINTR );
+
+	for ( slot = 0; slot < Count; slot++ )
+	{
+		if ( Workers[ slot ] == pid )
+			break;
+	}
+	if ( slot == Count )
+		return -1;
+
+	*Passed = WIFEXITED( status ) && !WEXITSTATUS( status );
+	if ( WIFSIGNALED( status ) )
+		snprintf( Ended, EndedSize, "worker killed by signal %d", WTERMSIG( status ) );
+	else
+		snprintf( Ended, EndedSize, "worker exited with %d", WEXITSTATUS( status ) );
+	return slot;
+#endif
+}
+
+bool DemoBatchRun( DEMOBATCH * Batch )
+{
+	DEMOBATCHNAME * Names;
+	WORKER Workers[ DEMOBATCH_MAXWORKERS ];
+	int Slots[ DEMOBATCH_MAXWORKERS ];
+	char ** Ended;			// how each failed worker ended
+	char ended[ 64 ];
+	bool passed;
+	char * result;
+	long size;
+	int Count, Running, Next, Passed;
+	int NumWorkers;
+	int slot, i;
+	bool Written;
+	FILE * f;
+
+	if ( !InitLevels( DEMO_LEVELS ) && !InitLevels( DEFAULT_LEVELS ) )
+	{
+		Msg( "DemoBatch: no levels are installed\n" );
+		return false;
+	}
+
+	Names = LoadList( Batch->List, &Count );
+	if ( !Names )
+	{
+		Msg( "DemoBatch: no demos in %s\n", Batch->List );
+		return false;
+	}
+
+	// a worker started for one entry
+	if ( Batch->Job >= 0 )
+	{
+		bool ok = ( Batch->Job < Count ) && RunJob( Batch->Mode, Names[ Batch->Job ], ResultName( Batch, Batch->Job ) );
+		free( Names );
+		return ok;
+	}
+
+	NumWorkers = Batch->Workers;
+	if ( NumWorkers <= 0 )
+	{
+		NumWorkers = 2;
+#if SDL_VERSION_ATLEAST(2,0,0)
+		NumWorkers = SDL_GetCPUCount();
+#endif
+	}
+	if ( NumWorkers > DEMOBATCH_MAXWORKERS )
+		NumWorkers = DEMOBATCH_MAXWORKERS;
+	if ( NumWorkers > Count )
+		NumWorkers = Count;
+
+	Ended = calloc( Count, sizeof( char * ) );
+	if ( !Ended )
+	{
+		free( Names );
+		return false;
+	}
+
+	DebugPrintf( "DemoBatch: %s %d demos with %d workers\n", ModeNames[ Batch->Mode ], Count, NumWorkers );
+
+	Running = 0;
+	Next = 0;
+	while ( Next < Count || Running )
+	{
+		// keep every worker busy
+		while ( Next < Count && Running < NumWorkers )
+		{
+			delete_file( ResultName( Batch, Next ) );
+			if ( !StartWorker( Batch, Names, Next, &Workers[ Running ] ) )
+			{
+				Ended[ Next ] = strdup( "couldn't start a worker" );
+				Next++;
+				continue;
+			}
+			Slots[ Running++ ] = Next++;
+		}
+		if ( !Running )
+			break;
+
+		slot = WaitWorker( Workers, Running, &passed, ended, sizeof( ended ) );
+		if ( slot < 0 )
+			continue;
+		if ( !passed )
+			Ended[ Slots[ slot ] ] = strdup( ended );
+
+		// keep the running workers packed at the front
+		Running--;
+		Workers[ slot ] = Workers[ Running ];
+		Slots[ slot ] = Slots[ Running ];
+	}
+
+	Passed = 0;
+	for ( i = 0; i < Count; i++ )
+	{
+		if ( !Ended[ i ] )
+			Passed++;
+	}
+
+	// fold the results into the output in list order
+	Written = false;
+	f = file_open( Batch->Output, "w" );
+	if ( !f )
+	{
+		Msg( "DemoBatch: couldn't create %s\n", Batch->Output );
+	}
+	else
+	{
+		fprintf( f, "{\n\"mode\": \"%s\",\n\"demos\": [\n", ModeNames[ Batch->Mode ] );
+		for ( i = 0; i < Count; i++ )
+		{
+			result = load_file_buffer( ResultName( Batch, i ), &size, 0 );
+			if ( result )
+			{
+				fwrite( result, 1, size, f );
+			}
+			else
+			{
+				// the worker died before it wrote anything
+				fprintf( f, "{ \"demo\": " );
+				JsonString( f, Names[ i ] );
+				fprintf( f, ", \"ok\": false, \"error\": " );
+				JsonString( f, Ended[ i ] ? Ended[ i ] : "no result" );
+				fprintf( f, " }" );
+			}
+			if ( result )
+				release_file_buffer( result );
+			delete_file( ResultName( Batch, i ) );
+			fprintf( f, "%s\n", ( i < Count - 1 ) ? "," : "" );
+		}
+		fprintf( f, "],\n\"passed\": %d,\n\"failed\": %d\n}\n", Passed, Count - Passed );
+		Written = ( fclose( f ) == 0 );
+	}
+
+	DebugPrintf( "DemoBatch: %d of %d demos passed\n", Passed, Count );
+
+	for ( i = 0; i < Count; i++ )
+	{
+		if ( Ended[ i ] )
+			free( Ended[ i ] );
+	}
+	free( Ended );
+	free( Names );
+
+	return Written && Passed == Count;
+}
+
+#else
+
+bool DemoBatchRun( DEMOBATCH * Batch )
+{
+	Msg( "DemoBatch: this build has no demo support\n" );
+	return false;
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef DEMOBATCH_INCLUDED
+#define DEMOBATCH_INCLUDED
+
+#include "main.h"
+
+//
+// Batch Demo Processing
+//
+// Cleans, validates or gathers stats from a list of demos without
+// opening a window, starting sound or touching gl:
+//
+//   -DemoBatch <clean|validate|stats> <list> <output.json>
+//   -DemoJobs <n>
+//
+// The list is a text file of demo names, one per line, or "all" for
+// every demo in the demo folder.  Each demo is handled by a worker
+// process of its own, at most -DemoJobs of them at once ( one per core
+// by default ), so a demo that crashes its worker only fails itself.
+// The output is a json object with one result per demo in list order.
+//
+// A worker writes its result to <output.json>.<n> which is folded into
+// the output and deleted once the worker exits.  On windows workers
+// are started as the game again with -DemoBatchJob <n> added.
+//
+
+#define DEMOBATCH_None		0
+#define DEMOBATCH_Clean		1
+#define DEMOBATCH_Validate	2
+#define DEMOBATCH_Stats		3
+
+#define DEMOBATCH_MAXWORKERS	32
+
+typedef struct DEMOBATCH
+{
+	int		Mode;			// DEMOBATCH_None unless -DemoBatch was given
+	char	List[ 128 ];
+	char	Output[ 128 ];
+	int		Workers;		// 0 is one per core
+	int		Job;			// list entry a worker runs, -1 for the batch itself
+} DEMOBATCH;
+
+// from the -DemoBatch arguments, false if the mode isn't known
+bool DemoBatchSetup( DEMOBATCH * Batch, char * Mode, char * List, char * Output );
+
+// runs the batch, or the one job of a worker, true if every demo passed
+bool DemoBatchRun( DEMOBATCH * Batch );
+
+#endif
@@ -0,0 +1,703 @@
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include <SDL.h>
+
+#include "demofile.h"
+#include "file.h"
+#include "util.h"
+
+typedef struct
+{
+	char		Magic[4];
+	u_int32_t	Version;
+	u_int32_t	BlockSize;
+} DEMOHEADER;
+
+typedef struct
+{
+	u_int32_t	RawSize;
+	u_int32_t	PackedSize;
+	int64_t		Time;			// of the first message in the block
+	u_int32_t	Flags;
+	u_int32_t	Unused;
+} DEMOBLOCKHEADER;
+
+typedef struct
+{
+	int64_t		Time;
+	int64_t		Offset;			// in the uncompressed stream
+	int64_t		FilePos;		// of the block header
+	u_int32_t	Flags;
+	u_int32_t	Unused;
+} DEMOINDEX;
+
+typedef struct
+{
+	int64_t		IndexPos;
+	u_int32_t	Count;
+	char		Magic[4];
+} DEMOTRAILER;
+
+typedef struct DEMOBLOCK
+{
+	char	*	Data;
+	u_int32_t	Size;
+	int64_t		Time;
+	int64_t		Offset;
+	u_int32_t	Flags;
+	struct DEMOBLOCK * Next;
+} DEMOBLOCK;
+
+struct DEMOSTREAM
+{
+	FILE	*	fp;
+	bool		Writing;
+	bool		Compressed;		// false for demos from before blocks
+	bool		Failed;
+
+	// recording
+	char	*	Block;
+	size_t		Used;
+	size_t		Allocated;
+	int64_t		BlockTime;
+	u_int32_t	BlockFlags;
+	int64_t		LastTime;
+	int64_t		Offset;			// of Block[0]
+	SDL_Thread * Thread;
+	SDL_mutex *	Lock;
+	SDL_sem	*	Queued;			// one post per block ( and one to quit )
+	DEMOBLOCK *	Head;
+	DEMOBLOCK *	Tail;
+	bool		Quit;
+
+	// playback
+	char	*	Data;
+	size_t		DataSize;
+	size_t		DataPos;
+	int64_t		DataOffset;
+	int			Current;		// index of the block in Data, -1 for none
+	bool		End;
+
+	DEMOINDEX *	Index;
+	int			NumIndex;
+	int			MaxIndex;
+};
+
+static const char DemoMagic[4] = { 'P', 'X', 'D', 'M' };
+static const char DemoIndexMagic[4] = { 'P', 'X', 'D', 'I' };
+
+static bool AddIndex( DEMOSTREAM * Demo, int64_t Time, int64_t Offset, int64_t FilePos, u_int32_t Flags )
+{
+	DEMOINDEX * Index;
+
+	if ( Demo->NumIndex == Demo->MaxIndex )
+	{
+		int Max = Demo->MaxIndex ? Demo->MaxIndex * 2 : 256;
+		Index = realloc( Demo->Index, Max * sizeof(DEMOINDEX) );
+		if ( !Index )
+			return false;
+		Demo->Index = Index;
+		Demo->MaxIndex = Max;
+	}
+
+	Index = &Demo->Index[ Demo->NumIndex++ ];
+	Index->Time = Time;
+	Index->Offset = Offset;
+	Index->FilePos = FilePos;
+	Index->Flags = Flags;
+	Index->Unused = 0;
+	return true;
+}
+
+//
+// Recording
+//
+
+// runs on the writer thread, or on the caller when there isn't one
+
+static void WriteBlock( DEMOSTREAM * Demo, DEMOBLOCK * Block )
+{
+	DEMOBLOCKHEADER Header;
+	uLongf PackedSize = compressBound( Block->Size );
+	Bytef * Packed = malloc( PackedSize );
+	long FilePos = ftell( Demo->fp );
+
+	if ( !Packed || compress2( Packed, &PackedSize, (const Bytef *) Block->Data, Block->Size, Z_DEFAULT_COMPRESSION ) != Z_OK )
+	{
+		DebugPrintf( "demo: couldn't compress a block\n" );
+		Demo->Failed = true;
+		free( Packed );
+		return;
+	}
+
+	Header.RawSize = Block->Size;
+	Header.PackedSize = PackedSize;
+	Header.Time = Block->Time;
+	Header.Flags = Block->Flags;
+	Header.Unused = 0;
+
+	if ( FilePos < 0 ||
+		 fwrite( &Header, sizeof(Header), 1, Demo->fp ) != 1 ||
+		 fwrite( Packed, PackedSize, 1, Demo->fp ) != 1 ||
+		 !AddIndex( Demo, Block->Time, Block->Offset, FilePos, Block->Flags ) )
+	{
+		DebugPrintf( "demo: couldn't write a block\n" );
+		Demo->Failed = true;
+	}
+
+	free( Packed );
+}
+
+static int DemoWriter( void * Data )
+{
+	DEMOSTREAM * Demo = (DEMOSTREAM *) Data;
+	DEMOBLOCK * Block;
+	bool Quit;
+
+	for (;;)
+	{
+		SDL_SemWait( Demo->Queued );
+
+		SDL_LockMutex( Demo->Lock );
+		Block = Demo->Head;
+		if ( Block )
+		{
+			Demo->Head = Block->Next;
+			if ( !Demo->Head )
+				Demo->Tail = NULL;
+		}
+		Quit = Demo->Quit && !Block;
+		SDL_UnlockMutex( Demo->Lock );
+
+		if ( Quit )
+			break;
+		if ( !Block )
+			continue;
+
+		WriteBlock( Demo, Block );
+		free( Block->Data );
+		free( Block );
+	}
+
+	return 0;
+}
+
+static void QueueBlock( DEMOSTREAM * Demo )
+{
+	DEMOBLOCK * Block;
+
+	if ( !Demo->Used )
+		return;
+
+	Block = malloc( sizeof(DEMOBLOCK) );
+	if ( !Block )
+	{
+		Demo->Failed = true;
+		Demo->Used = 0;
+		return;
+	}
+	Block->Data = Demo->Block;
+	Block->Size = Demo->Used;
+	Block->Time = Demo->BlockTime;
+	Block->Offset = Demo->Offset;
+	Block->Flags = Demo->BlockFlags;
+	Block->Next = NULL;
+
+	Demo->Offset += Demo->Used;
+	Demo->BlockFlags = 0;
+	Demo->Block = malloc( Demo->Allocated );
+	Demo->Used = 0;
+	if ( !Demo->Block )
+	{
+		Demo->Allocated = 0;
+		Demo->Failed = true;
+	}
+
+	if ( !Demo->Thread )
+	{
+		WriteBlock( Demo, Block );
+		free( Block->Data );
+		free( Block );
+		return;
+	}
+
+	SDL_LockMutex( Demo->Lock );
+	Block->Next = NULL;
+	if ( Demo->Tail )
+		Demo->Tail->Next = Block;
+	else
+		Demo->Head = Block;
+	Demo->Tail = Block;
+	SDL_UnlockMutex( Demo->Lock );
+
+	SDL_SemPost( Demo->Queued );
+}
+
+DEMOSTREAM * DemoStreamCreate( char * Filename )
+{
+	DEMOSTREAM * Demo;
+	DEMOHEADER Header;
+
+	Demo = calloc( 1, sizeof(DEMOSTREAM) );
+	if ( !Demo )
+		return NULL;
+
+	Demo->fp = file_open( Filename, "wb" );
+	Demo->Allocated = DEMOSTREAM_BLOCK_SIZE * 2;
+	Demo->Block = malloc( Demo->Allocated );
+	if ( !Demo->fp || !Demo->Block )
+	{
+		if ( Demo->fp )
+			fclose( Demo->fp );
+		free( Demo->Block );
+		free( Demo );
+		return NULL;
+	}
+	Demo->Writing = true;
+	Demo->Compressed = true;
+	Demo->Current = -1;
+
+	memcpy( Header.Magic, DemoMagic, sizeof(DemoMagic) );
+	Header.Version = DEMOSTREAM_VERSION;
+	Header.BlockSize = DEMOSTREAM_BLOCK_SIZE;
+	if ( fwrite( &Header, sizeof(Header), 1, Demo->fp ) != 1 )
+		Demo->Failed = true;
+
+	Demo->Lock = SDL_CreateMutex();
+	Demo->Queued = SDL_CreateSemaphore( 0 );
+	if ( Demo->Lock && Demo->Queued )
+	{
+#if SDL_VERSION_ATLEAST(2,0,0)
+		Demo->Thread = SDL_CreateThread( DemoWriter, "demo_writer", Demo );
+#else
+		Demo->Thread = SDL_CreateThread( DemoWriter, Demo );
+#endif
+	}
+	if ( !Demo->Thread )
+		DebugPrintf( "demo: no writer thread, blocks are written as they fill\n" );
+
+	return Demo;
+}
+
+void DemoStreamMark( DEMOSTREAM * Demo, int64_t Time )
+{
+	if ( !Demo || !Demo->Writing )
+		return;
+
+	// names go in with a time of 1 so only ever move forward
+	if ( Time > Demo->LastTime )
+		Demo->LastTime = Time;
+
+	if ( Demo->Used >= DEMOSTREAM_BLOCK_SIZE )
+		QueueBlock( Demo );
+
+	if ( !Demo->Used )
+		Demo->BlockTime = Demo->LastTime;
+}
+
+void DemoStreamKeyframe( DEMOSTREAM * Demo, int64_t Time )
+{
+	if ( !Demo || !Demo->Writing )
+		return;
+
+	if ( Time > Demo->LastTime )
+		Demo->LastTime = Time;
+
+	QueueBlock( Demo );
+
+	Demo->BlockTime = Demo->LastTime;
+	Demo->BlockFlags = DEMOBLOCK_KEYFRAME;
+}
+
+size_t DemoStreamWrite( const void * Buffer, size_t Size, size_t Count, DEMOSTREAM * Demo )
+{
+	size_t Bytes = Size * Count;
+
+	if ( !Demo || !Demo->Writing || !Demo->Block )
+		return 0;
+
+	// a message bigger than the room left grows the block, it's
+	// only ever cut before a message
+	if ( Demo->Used + Bytes > Demo->Allocated )
+	{
+		size_t Allocated = Demo->Allocated;
+		char * Block;
+
+		while ( Demo->Used + Bytes > Allocated )
+			Allocated *= 2;
+		Block = realloc( Demo->Block, Allocated );
+		if ( !Block )
+		{
+			Demo->Failed = true;
+			return 0;
+		}
+		Demo->Block = Block;
+		Demo->Allocated = Allocated;
+	}
+
+	memcpy( Demo->Block + Demo->Used, Buffer, Bytes );
+	Demo->Used += Bytes;
+	return Count;
+}
+
+static void FinishRecording( DEMOSTREAM * Demo )
+{
+	DEMOBLOCKHEADER End;
+	DEMOTRAILER Trailer;
+	long IndexPos;
+
+	QueueBlock( Demo );
+
+	if ( Demo->Thread )
+	{
+		SDL_LockMutex( Demo->Lock );
+		Demo->Quit = true;
+		SDL_UnlockMutex( Demo->Lock );
+		SDL_SemPost( Demo->Queued );
+		SDL_WaitThread( Demo->Thread, NULL );
+		Demo->Thread = NULL;
+	}
+
+	memset( &End, 0, sizeof(End) );
+	fwrite( &End, sizeof(End), 1, Demo->fp );
+
+	IndexPos = ftell( Demo->fp );
+	Trailer.IndexPos = IndexPos;
+	Trailer.Count = Demo->NumIndex;
+	memcpy( Trailer.Magic, DemoIndexMagic, sizeof(DemoIndexMagic) );
+
+	if ( IndexPos < 0 ||
+		 ( Demo->NumIndex && fwrite( Demo->Index, sizeof(DEMOINDEX), Demo->NumIndex, Demo->fp ) != (size_t) Demo->NumIndex ) ||
+		 fwrite( &Trailer, sizeof(Trailer), 1, Demo->fp ) != 1 )
+		Demo->Failed = true;
+
+	if ( Demo->Failed )
+		DebugPrintf( "demo: recording is incomplete\n" );
+	else
+		DebugPrintf( "demo: recorded %ld bytes in %d blocks, %ld on disk\n",
+			(long) Demo->Offset, Demo->NumIndex, IndexPos );
+}
+
+//
+// Playback
+//
+
+// the trailer's index, or one made by walking the blocks if the
+// recording never finished
+
+static bool ReadIndex( DEMOSTREAM * Demo )
+{
+	DEMOTRAILER Trailer;
+	DEMOBLOCKHEADER Header;
+	int64_t Offset = 0;
+	long FilePos;
+
+	if ( fseek( Demo->fp, -(long) sizeof(Trailer), SEEK_END ) == 0 &&
+		 fread( &Trailer, sizeof(Trailer), 1, Demo->fp ) == 1 &&
+		 !memcmp( Trailer.Magic, DemoIndexMagic, sizeof(DemoIndexMagic) ) &&
+		 Trailer.Count < 0x1000000 )
+	{
+		Demo->Index = malloc( ( Trailer.Count ? Trailer.Count : 1 ) * sizeof(DEMOINDEX) );
+		if ( Demo->Index &&
+			 fseek( Demo->fp, (long) Trailer.IndexPos, SEEK_SET ) == 0 &&
+			 fread( Demo->Index, sizeof(DEMOINDEX), Trailer.Count, Demo->fp ) == Trailer.Count )
+		{
+			Demo->NumIndex = Demo->MaxIndex = Trailer.Count;
+			return true;
+		}
+		free( Demo->Index );
+		Demo->Index = NULL;
+	}
+
+	DebugPrintf( "demo: no index, walking the blocks\n" );
+
+	FilePos = sizeof(DEMOHEADER);
+	while ( fseek( Demo->fp, FilePos, SEEK_SET ) == 0 &&
+			fread( &Header, sizeof(Header), 1, Demo->fp ) == 1 &&
+			Header.RawSize )
+	{
+		if ( !AddIndex( Demo, Header.Time, Offset, FilePos, Header.Flags ) )
+			return false;
+		Offset += Header.RawSize;
+		FilePos += sizeof(Header) + Header.PackedSize;
+	}
+	return true;
+}
+
+static bool LoadBlock( DEMOSTREAM * Demo, int Block )
+{
+	DEMOBLOCKHEADER Header;
+	uLongf RawSize;
+	Bytef * Packed;
+	char * Data;
+	bool ok;
+
+	if ( Block < 0 || Block >= Demo->NumIndex )
+		return false;
+
+	// past the last block is the end, anything else going wrong is not
+	if ( fseek( Demo->fp, (long) Demo->Index[ Block ].FilePos, SEEK_SET ) != 0 ||
+		 fread( &Header, sizeof(Header), 1, Demo->fp ) != 1 ||
+		 !Header.RawSize )
+	{
+		DebugPrintf( "demo: block %d is truncated\n", Block );
+		Demo->Failed = true;
+		return false;
+	}
+
+	Packed = malloc( Header.PackedSize ? Header.PackedSize : 1 );
+	Data = Header.RawSize > Demo->DataSize || !Demo->Data ? malloc( Header.RawSize ) : Demo->Data;
+	RawSize = Header.RawSize;
+	ok = Packed && Data &&
+		 fread( Packed, Header.PackedSize, 1, Demo->fp ) == 1 &&
+		 uncompress( (Bytef *) Data, &RawSize, Packed, Header.PackedSize ) == Z_OK &&
+		 RawSize == Header.RawSize;
+	free( Packed );
+
+	if ( Data != Demo->Data )
+	{
+		if ( Demo->Data )
+			free( Demo->Data );
+		Demo->Data = Data;
+	}
+	if ( !ok )
+	{
+		DebugPrintf( "demo: block %d is corrupt\n", Block );
+		Demo->DataSize = 0;
+		Demo->Failed = true;
+		return false;
+	}
+
+	Demo->DataSize = Header.RawSize;
+	Demo->DataPos = 0;
+	Demo->DataOffset = Demo->Index[ Block ].Offset;
+	Demo->Current = Block;
+	return true;
+}
+
+DEMOSTREAM * DemoStreamOpen( char * Filename )
+{
+	DEMOSTREAM * Demo;
+	DEMOHEADER Header;
+
+	Demo = calloc( 1, sizeof(DEMOSTREAM) );
+	if ( !Demo )
+		return NULL;
+
+	Demo->fp = file_open( Filename, "rb" );
+	if ( !Demo->fp )
+	{
+		free( Demo );
+		return NULL;
+	}
+	Demo->Current = -1;
+
+	if ( fread( &Header, sizeof(Header), 1, Demo->fp ) != 1 ||
+		 memcmp( Header.Magic, DemoMagic, sizeof(DemoMagic) ) )
+	{
+		// an old demo, read straight through
+		rewind( Demo->fp );
+		return Demo;
+	}
+
+	if ( Header.Version != DEMOSTREAM_VERSION || !ReadIndex( Demo ) )
+	{
+		DebugPrintf( "demo: %s is not a version %d demo\n", Filename, DEMOSTREAM_VERSION );
+		fclose( Demo->fp );
+		free( Demo->Index );
+		free( Demo );
+		return NULL;
+	}
+	Demo->Compressed = true;
+
+	if ( !LoadBlock( Demo, 0 ) )
+		Demo->End = true;
+
+	return Demo;
+}
+
+size_t DemoStreamRead( void * Buffer, size_t Size, size_t Count, DEMOSTREAM * Demo )
+{
+	size_t Wanted = Size * Count;
+	size_t Got = 0;
+	size_t Bytes;
+
+	if ( !Demo || Demo->Writing || !Size )
+		return 0;
+
+	if ( !Demo->Compressed )
+	{
+		Got = fread( Buffer, Size, Count, Demo->fp );
+		if ( Got != Count )
+		{
+			Demo->End = true;
+			if ( ferror( Demo->fp ) )
+				Demo->Failed = true;
+		}
+		return Got;
+	}
+
+	while ( Got < Wanted )
+	{
+		if ( Demo->DataPos == Demo->DataSize &&
+			 ( Demo->End || !LoadBlock( Demo, Demo->Current + 1 ) ) )
+		{
+			Demo->End = true;
+			break;
+		}
+		Bytes = Demo->DataSize - Demo->DataPos;
+		if ( Bytes > Wanted - Got )
+			Bytes = Wanted - Got;
+		memcpy( (char *) Buffer + Got, Demo->Data + Demo->DataPos, Bytes );
+		Demo->DataPos += Bytes;
+		Got += Bytes;
+	}
+
+	return Got / Size;
+}
+
+bool DemoStreamEnd( DEMOSTREAM * Demo )
+{
+	if ( !Demo )
+		return true;
+	if ( !Demo->Compressed )
+		return Demo->End || feof( Demo->fp ) || ferror( Demo->fp );
+	return Demo->End;
+}
+
+bool DemoStreamFailed( DEMOSTREAM * Demo )
+{
+	return !Demo || Demo->Failed;
+}
+
+int64_t DemoStreamTell( DEMOSTREAM * Demo )
+{
+	if ( !Demo )
+		return 0;
+	if ( Demo->Writing )
+		return Demo->Offset + Demo->Used;
+	if ( !Demo->Compressed )
+		return ftell( Demo->fp );
+	return Demo->DataOffset + Demo->DataPos;
+}
+
+bool DemoStreamSeek( DEMOSTREAM * Demo, int64_t Offset )
+{
+	int Low, High, Mid;
+
+	if ( !Demo || Demo->Writing )
+		return false;
+
+	Demo->End = false;
+
+	if ( !Demo->Compressed )
+		return fseek( Demo->fp, (long) Offset, SEEK_SET ) == 0;
+
+	if ( !Demo->NumIndex || Offset < 0 )
+		return false;
+
+	// last block starting at or before the offset
+	Low = 0;
+	High = Demo->NumIndex - 1;
+	while ( Low < High )
+	{
+		Mid = ( Low + High + 1 ) / 2;
+		if ( Demo->Index[ Mid ].Offset <= Offset )
+			Low = Mid;
+		else
+			High = Mid - 1;
+	}
+
+	if ( Low != Demo->Current && !LoadBlock( Demo, Low ) )
+		return false;
+	if ( Offset - Demo->DataOffset > (int64_t) Demo->DataSize )
+		return false;
+
+	Demo->DataPos = (size_t) ( Offset - Demo->DataOffset );
+	return true;
+}
+
+// last keyframe block at or before Time, -1 if there isn't one
+
+static int FindKeyframe( DEMOSTREAM * Demo, int64_t Time )
+{
+	int Low, High, Mid;
+
+	if ( !Demo || Demo->Writing || !Demo->Compressed || !Demo->NumIndex )
+		return -1;
+
+	// block times never go backwards
+	Low = 0;
+	High = Demo->NumIndex - 1;
+	while ( Low < High )
+	{
+		Mid = ( Low + High + 1 ) / 2;
+		if ( Demo->Index[ Mid ].Time <= Time )
+			Low = Mid;
+		else
+			High = Mid - 1;
+	}
+
+	while ( Low >= 0 && !( Demo->Index[ Low ].Flags & DEMOBLOCK_KEYFRAME ) )
+		Low--;
+	if ( Low >= 0 && Demo->Index[ Low ].Time <= Time )
+		return Low;
+
+	// nothing before Time can be restored, the first keyframe is the nearest
+	for ( Low = 0; Low < Demo->NumIndex; Low++ )
+	{
+		if ( Demo->Index[ Low ].Flags & DEMOBLOCK_KEYFRAME )
+			return Low;
+	}
+	return -1;
+}
+
+bool DemoStreamFindKeyframe( DEMOSTREAM * Demo, int64_t Time, int64_t * Found )
+{
+	int Block = FindKeyframe( Demo, Time );
+
+	if ( Block < 0 )
+		return false;
+	if ( Found )
+		*Found = Demo->Index[ Block ].Time;
+	return true;
+}
+
+bool DemoStreamSeekTime( DEMOSTREAM * Demo, int64_t Time, int64_t * Found )
+{
+	int Block = FindKeyframe( Demo, Time );
+
+	if ( Block < 0 || !LoadBlock( Demo, Block ) )
+		return false;
+
+	Demo->End = false;
+	if ( Found )
+		*Found = Demo->Index[ Block ].Time;
+	return true;
+}
+
+void DemoStreamClose( DEMOSTREAM * Demo )
+{
+	if ( !Demo )
+		return;
+
+	if ( Demo->Writing )
+		FinishRecording( Demo );
+
+	if ( Demo->Queued )
+		SDL_DestroySemaphore( Demo->Queued );
+	if ( Demo->Lock )
+		SDL_DestroyMutex( Demo->Lock );
+
+	fclose( Demo->fp );
+	if ( Demo->Block )
+		free( Demo->Block );
+	if ( Demo->Data )
+		free( Demo->Data );
+	if ( Demo->Index )
+		free( Demo->Index );
+	free( Demo );
+}
@@ -0,0 +1,70 @@
+#ifndef DEMOFILE_INCLUDED
+#define DEMOFILE_INCLUDED
+
+#include "main.h"
+#include <stdio.h>
+#include <stdint.h>
+
+//
+// Demo Streams
+//
+// A recorded demo is a stream of network messages each prefixed with
+// the game time it arrived at.  Recording appends to a block in memory,
+// a block is handed to a background thread once it's full which
+// compresses it and appends it to the file, so the game never waits on
+// the disk.  Blocks only ever start on a message so each can be read
+// on its own.
+//
+//   header     "PXDM", version, block size
+//   blocks     raw size, packed size, time of the first message,
+//              flags, zlib data
+//   end        a block header of zero sizes
+//   index      time, stream offset, file offset and flags of every
+//              block
+//   trailer    file offset of the index, block count, "PXDI"
+//
+// A keyframe always starts a block of its own and the block is flagged
+// so the index lets playback jump to the last keyframe before any time
+// without reading what comes before it.  A demo that was never closed
+// has no index, it's rebuilt by walking the block headers.
+//
+// Demos recorded before this format are still read, as a plain
+// uncompressed stream without seeking by time.
+//
+
+#define DEMOSTREAM_VERSION		2
+#define DEMOSTREAM_BLOCK_SIZE	( 32 * 1024 )
+
+#define DEMOBLOCK_KEYFRAME		( 1 << 0 )
+
+typedef struct DEMOSTREAM DEMOSTREAM;
+
+DEMOSTREAM * DemoStreamCreate( char * Filename );
+DEMOSTREAM * DemoStreamOpen( char * Filename );
+void DemoStreamClose( DEMOSTREAM * Demo );
+
+// recording: mark the start of each message before writing it
+void DemoStreamMark( DEMOSTREAM * Demo, int64_t Time );
+// or mark the first message of a keyframe, it starts a new block
+void DemoStreamKeyframe( DEMOSTREAM * Demo, int64_t Time );
+size_t DemoStreamWrite( const void * Buffer, size_t Size, size_t Count, DEMOSTREAM * Demo );
+
+// playback: reads like fread, a short read means the end was reached
+size_t DemoStreamRead( void * Buffer, size_t Size, size_t Count, DEMOSTREAM * Demo );
+bool DemoStreamEnd( DEMOSTREAM * Demo );
+// true if the end came early because the file couldn't be read or a
+// block didn't inflate, rather than the demo simply running out
+bool DemoStreamFailed( DEMOSTREAM * Demo );
+
+// offsets into the uncompressed stream
+int64_t DemoStreamTell( DEMOSTREAM * Demo );
+bool DemoStreamSeek( DEMOSTREAM * Demo, int64_t Offset );
+
+// when the last keyframe at or before Time was recorded,
+// the first keyframe if Time is before all of them
+bool DemoStreamFindKeyframe( DEMOSTREAM * Demo, int64_t Time, int64_t * Found );
+
+// move to the start of that keyframe, Found says when it was recorded
+bool DemoStreamSeekTime( DEMOSTREAM * Demo, int64_t Time, int64_t * Found );
+
+#endif
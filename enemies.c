@@ -35,6 +35,7 @@
 #include "title.h"
 #include "util.h"
 #include "oct2.h"
+#include "visi.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -47,8 +48,8 @@ extern	MLOADHEADER		Mloadheader;
 extern	MCLOADHEADER	MCloadheader;
 extern	MCLOADHEADER	MCloadheadert0;
 extern	XLIGHT			XLights[ MAXXLIGHTS ];
-extern	FMPOLY			FmPolys[ MAXNUMOF2DPOLYS ];
-extern	MODEL			Models[ MAXNUMOFMODELS ];
+extern	FMPOLY			*	FmPolys;
+extern	MODEL			*	Models;
 extern	float			framelag;
 extern	MATRIX			MATRIX_Identity;
 extern	int16_t			LevelNum;
@@ -451,6 +452,15 @@ GUNTYPE	GunTypes[] = {
 	u_int16_t		NumEnemiesPerGroup[ MAXGROUPS ];
 	ENEMY	*	FirstEnemyUsed = NULL;
 	ENEMY	*	FirstEnemyFree = NULL;
+	int			EnemySwarm = 0;		// extra enemies cloned into each level for stress testing ( swarm:N )
+	static u_int32_t	EnemySepTests = 0;		// enemy pairs distance tested for separation
+	static u_int32_t	EnemySepFrames = 0;
+	static u_int16_t	EnemySepPeak = 0;		// most enemies binned in one frame
+	static bool			EnemyGroupSeen[ MAXGROUPS ];	// a player can see into the group this frame
+	static float		EnemyGroupHeard[ MAXGROUPS ];	// sound distance from the nearest player's group
+	static u_int32_t	EnemyLODFrame = 0;
+	static u_int32_t	EnemyThinks = 0;
+	static u_int32_t	EnemyThinksSkipped = 0;
 
 ANIM_SEQ	PulseTurretSeqs[] = {
 	{ 0.0F * ANIM_SECOND, 0.0F * ANIM_SECOND },	// Closed
@@ -3787,6 +3797,10 @@ void InitGuns( BYTE how_many_guns , u_int16_t * GunType , OBJECT * Object );
 void SetWheelPos( VECTOR * DestPos , VECTOR * SourcePos , float xoff , float zoff , VECTOR * Right, VECTOR * Forward, u_int16_t Group , u_int16_t * DestGroup );
 bool Enemy2EnemyCollide( ENEMY * SEnemy , VECTOR * Move );
 bool Enemy2EnemyCollideSpecial( ENEMY * SEnemy , VECTOR * StartPos);
+static void BinEnemies( void );
+static void FindPerceivedGroups( void );
+static bool EnemyThinksThisFrame( ENEMY * Enemy );
+static void SpawnEnemySwarm( void );
 void AutoDisplayMatrix( OBJECT * Object );
 
 	
@@ -3932,6 +3946,9 @@ void InitEnemies( void )
 
 	Enemies[ 0 ].PrevFree = NULL;
 	Enemies[ MAXENEMIES - 1 ].NextFree = NULL;
+
+	// no framelag saved up from the last level
+	EnemyLODFrame = 0;
 }
 
 /*===================================================================
@@ -4143,6 +4160,25 @@ void ReleaseAllEnemies( void )
 	ENEMY	*	PrevObject;
 	ENEMY	*	NextUsedObject;
 
+	if( EnemySepFrames )
+	{
+		DebugPrintf( "enemies: %.1f separation tests a frame over %d frames, at most %d enemies\n",
+			(float) EnemySepTests / (float) EnemySepFrames, (int) EnemySepFrames, (int) EnemySepPeak );
+		EnemySepTests = 0;
+		EnemySepFrames = 0;
+		EnemySepPeak = 0;
+	}
+
+	if( EnemyThinks + EnemyThinksSkipped )
+	{
+		DebugPrintf( "enemies: %d of %d enemy thinks skipped for enemies no player could perceive\n",
+			(int) EnemyThinksSkipped, (int) ( EnemyThinks + EnemyThinksSkipped ) );
+		EnemyThinks = 0;
+		EnemyThinksSkipped = 0;
+	}
+
+	EnemyLODFrame = 0;
+
 	Object = FirstEnemyUsed;
 
 	while( Object != NULL )
@@ -5111,6 +5147,11 @@ bool LoadEnemies( void )
 		fclose( fp );
 	}
 
+	if( EnemySwarm && ( ChangeLevel_MyGameStatus != STATUS_TitleLoadGamePostStartingSinglePlayer ) )
+	{
+		SpawnEnemySwarm();
+	}
+
 	// work out formation offsets....	
 	Enemy = FirstEnemyUsed;
 	while( Enemy )
@@ -5133,6 +5174,84 @@ bool LoadEnemies( void )
 	return( true );
 }
 
+/*===================================================================
+	Procedure	:	Clone the flying and crawling enemies of the
+				:	level until EnemySwarm extra ones are in, to
+				:	stress test enemy separation ( swarm:N )
+				:	Clones start half a radius away from their
+				:	original so they have to push apart.
+	Input		:	nothing
+	Output		:	nothing
+===================================================================*/
+static void SpawnEnemySwarm( void )
+{
+	static const VECTOR SwarmOffsets[ 6 ] = {
+		{ 1.0F, 0.0F, 0.0F }, { -1.0F, 0.0F, 0.0F },
+		{ 0.0F, 1.0F, 0.0F }, { 0.0F, -1.0F, 0.0F },
+		{ 0.0F, 0.0F, 1.0F }, { 0.0F, 0.0F, -1.0F },
+	};
+	ENEMY	*	FirstOriginal;
+	ENEMY	*	Source;
+	ENEMY	*	Enemy;
+	VECTOR		Pos;
+	VECTOR		UpVector = { 0.0F, 1.0F, 0.0F };
+	float		Offset;
+	int			Spawned = 0;
+	int			Round;
+	bool		Cloned;
+
+	FirstOriginal = FirstEnemyUsed;
+
+	for( Round = 0; Spawned < EnemySwarm; Round++ )
+	{
+		Cloned = false;
+
+		// new enemies go on the front of the used list so this only sees originals
+		for( Source = FirstOriginal; Source != NULL && Spawned < EnemySwarm; Source = Source->NextUsed )
+		{
+			if( !( Source->Status & ENEMY_STATUS_Enable ) || Source->Object.Components ||
+				( Source->ModelNum == (u_int16_t) -1 ) || Source->FormationLink ||
+				( ( Source->Object.ControlType != ENEMY_CONTROLTYPE_FLY_AI ) &&
+				  ( Source->Object.ControlType != ENEMY_CONTROLTYPE_CRAWL_AI ) ) )
+				continue;
+
+			Offset = EnemyTypes[ Source->Type ].Radius * 0.5F * (float) ( 1 + ( Round / 6 ) );
+			Pos.x = Source->Object.Pos.x + ( SwarmOffsets[ Round % 6 ].x * Offset );
+			Pos.y = Source->Object.Pos.y + ( SwarmOffsets[ Round % 6 ].y * Offset );
+			Pos.z = Source->Object.Pos.z + ( SwarmOffsets[ Round % 6 ].z * Offset );
+
+			if( AmIOutsideGroup( &Mloadheader, &Pos, Source->Object.Group ) )
+				continue;
+
+			Enemy = InitOneEnemy( ENEMY_GENTYPE_Initialised, &Pos, &Source->Object.DirVector, &UpVector,
+								  Source->Object.Group, Source->ModelNum, (u_int16_t) -1, Source->Type,
+								  Source->Object.NodeNetwork, -1, (u_int16_t) -1, 0.0F );
+			if( !Enemy )
+			{
+				DebugPrintf( "enemies: swarm ran out of enemies after %d\n", Spawned );
+				return;
+			}
+
+			Enemy->Object.AnimSpeed = Source->Object.AnimSpeed;
+			Enemy->Object.AnimSeqs = Source->Object.AnimSeqs;
+			if( Enemy->Object.AnimSeqs ) Enemy->Object.CurAnimSeq = 0;
+			else Enemy->Object.CurAnimSeq = -1;
+			Enemy->Object.TopLeft = Source->Object.TopLeft;
+			Enemy->Object.BottomRight = Source->Object.BottomRight;
+			Enemy->Object.Time = 0.0F;
+			Enemy->Object.OverallTime = Source->Object.OverallTime;
+
+			Spawned++;
+			Cloned = true;
+		}
+
+		if( !Cloned && ( Round >= 6 ) )
+			break;
+	}
+
+	DebugPrintf( "enemies: swarm added %d enemies\n", Spawned );
+}
+
 /*===================================================================
 	Procedure	:	Init Enemy
 	Input		:	u_int16_t		GenType
@@ -5225,6 +5344,7 @@ ENEMY * InitOneEnemy( u_int16_t GenType, VECTOR * Pos, VECTOR * Dir, VECTOR * Up
 		Enemy->ImInNodeTransition = false;
 		Enemy->PickNewNodeNow = false;
 		Enemy->SmokeTime = 0.0F;
+		Enemy->LODFramelag = 0.0F;
 		
 		Enemy->SplineNode1 = NULL;
 		Enemy->SplineNode2 = NULL;
@@ -5352,6 +5472,81 @@ ENEMY * InitOneEnemy( u_int16_t GenType, VECTOR * Pos, VECTOR * Dir, VECTOR * Up
 	return( NULL );
 }
 
+/*===================================================================
+	Procedure	:	Work out which groups the players can perceive
+				:	Uses the group visibility and sound distance
+				:	tables, so it is only done once a frame.
+	Input		:	nothing
+	Output		:	nothing
+===================================================================*/
+static void FindPerceivedGroups( void )
+{
+	u_int16_t	Group;
+	u_int16_t	ShipGroup;
+	int			i;
+
+	for( Group = 0; Group < Mloadheader.num_groups; Group++ )
+	{
+		EnemyGroupSeen[ Group ] = false;
+		EnemyGroupHeard[ Group ] = -1.0F;
+	}
+
+	for( i = 0; i < MAX_PLAYERS; i++ )
+	{
+		if( !Ships[ i ].enable )
+			continue;
+
+		ShipGroup = Ships[ i ].Object.Group;
+		if( ShipGroup >= Mloadheader.num_groups )
+			continue;
+
+		for( Group = 0; Group < Mloadheader.num_groups; Group++ )
+		{
+			if( GroupsAreVisible( ShipGroup, Group ) )
+				EnemyGroupSeen[ Group ] = true;
+
+			if( ( EnemyGroupHeard[ Group ] < 0.0F ) || ( SoundInfo[ ShipGroup ][ Group ] < EnemyGroupHeard[ Group ] ) )
+				EnemyGroupHeard[ Group ] = SoundInfo[ ShipGroup ][ Group ];
+		}
+	}
+}
+
+/*===================================================================
+	Procedure	:	AI level of detail...
+				:	Flying and crawling enemies in groups no player
+				:	can see, and too far away by sound for any
+				:	player to come into their think range, only
+				:	think every ENEMY_LOD_INTERVAL frames.  The
+				:	frames are staggered by enemy index.  Everyone
+				:	else thinks every frame.
+	Input		:	ENEMY	*	Enemy
+	Output		:	bool		true if the enemy thinks this frame,
+				:				Enemy->LODFramelag is the time to cover
+===================================================================*/
+static bool EnemyThinksThisFrame( ENEMY * Enemy )
+{
+	u_int16_t	Group;
+
+	Enemy->LODFramelag += framelag;
+
+	Group = Enemy->Object.Group;
+
+	if( ( ( Enemy->Object.ControlType != ENEMY_CONTROLTYPE_FLY_AI ) &&
+		  ( Enemy->Object.ControlType != ENEMY_CONTROLTYPE_CRAWL_AI ) ) ||
+		Enemy->IveBeenHitTimer || Enemy->FormationLink ||
+		( Group >= Mloadheader.num_groups ) || EnemyGroupSeen[ Group ] ||
+		( EnemyGroupHeard[ Group ] < 0.0F ) ||
+		( EnemyGroupHeard[ Group ] < EnemyTypes[ Enemy->Type ].Behave.ThinkRange ) ||
+		( ( ( EnemyLODFrame + Enemy->Index ) % ENEMY_LOD_INTERVAL ) == 0 ) )
+	{
+		EnemyThinks++;
+		return true;
+	}
+
+	EnemyThinksSkipped++;
+	return false;
+}
+
 /*===================================================================
 	Procedure	:	Process all Enemies
 	Input		:	nothing
@@ -5366,12 +5561,18 @@ void ProcessEnemies( void )
 	u_int16_t			OldGroup;
 	VECTOR			OldPos;
 	bool			OldComponentCollide;
+	float			OldFramelag;
 
 #if ENABLEENEMYCOLLISIONS
 	VECTOR			PushVector;
 	float			Damage;
 #endif
 	EnemiesActive = 0;
+
+	BinEnemies();
+	FindPerceivedGroups();
+	EnemyLODFrame++;
+
 	Enemy = FirstEnemyUsed;
 
 	while( Enemy != NULL )
@@ -5416,22 +5617,32 @@ void ProcessEnemies( void )
 						Enemy->IveBeenHitTimer = 0.0F;
 				}
 
-				Enemy->AI_Angle.x = 0.0F;
-				Enemy->AI_Angle.y = 0.0F;
-				Enemy->AI_Angle.z = 0.0F;
-				OldComponentCollide = Enemy->CompCollision;
-				Enemy->CompCollision = false;
-				( * EnemyControlType[ Enemy->Object.ControlType ] )(Enemy);		//go off and do his thing...
-				Enemy->CompCollision = OldComponentCollide;
-
-				if( !(Enemy->Status & ENEMY_STATUS_Enable) )
-					goto KilledInAI;
+				if( EnemyThinksThisFrame( Enemy ) )
+				{
+					// enemies thinking at a reduced rate catch up on the frames they skipped
+					OldFramelag = framelag;
+					framelag = Enemy->LODFramelag;
+					Enemy->LODFramelag = 0.0F;
+
+					Enemy->AI_Angle.x = 0.0F;
+					Enemy->AI_Angle.y = 0.0F;
+					Enemy->AI_Angle.z = 0.0F;
+					OldComponentCollide = Enemy->CompCollision;
+					Enemy->CompCollision = false;
+					( * EnemyControlType[ Enemy->Object.ControlType ] )(Enemy);		//go off and do his thing...
+					Enemy->CompCollision = OldComponentCollide;
+
+					framelag = OldFramelag;
+
+					if( !(Enemy->Status & ENEMY_STATUS_Enable) )
+						goto KilledInAI;
  		
 
-				if( ( (Enemy->Object.ControlType == ENEMY_CONTROLTYPE_FLY_AI) ||
-					  (Enemy->Object.ControlType == ENEMY_CONTROLTYPE_SPLINE) ) &&
-					  ( ( OldPos.x != Enemy->Object.Pos.x) || ( OldPos.y != Enemy->Object.Pos.y) || ( OldPos.z != Enemy->Object.Pos.z) ) )
-					UpdateNearestNode( &Enemy->Object );
+					if( ( (Enemy->Object.ControlType == ENEMY_CONTROLTYPE_FLY_AI) ||
+						  (Enemy->Object.ControlType == ENEMY_CONTROLTYPE_SPLINE) ) &&
+						  ( ( OldPos.x != Enemy->Object.Pos.x) || ( OldPos.y != Enemy->Object.Pos.y) || ( OldPos.z != Enemy->Object.Pos.z) ) )
+						UpdateNearestNode( &Enemy->Object );
+				}
 				
 				if( Enemy->AIFlags & AI_ANYPLAYERINRANGE )
 				{
@@ -7099,8 +7310,125 @@ void RestrictMovement( ENEMY * Enemy , VECTOR * Move )
 	}
 }
 
+/*===================================================================
+	Enemy separation grid
+	Enabled enemies are binned into cells once a frame so the enemy to
+	enemy tests only look at the 27 cells around an enemy instead of
+	the whole used list.  Cells are hashed into a fixed number of
+	buckets so the grid does not depend on the size of the level.
+===================================================================*/
+#define	ENEMYGRID_BUCKETS		256			// must be a power of 2
+#define	ENEMYGRID_NEIGHBOURS	27
+#define	ENEMYGRID_MINCELLSIZE	( 64.0F * GLOBAL_SCALE )
+
+static ENEMY	*	EnemyGridBucket[ ENEMYGRID_BUCKETS ];
+static ENEMY	*	EnemyGridNext[ MAXENEMIES ];		// next enemy in the same bucket
+static u_int16_t	EnemyGridOrder[ MAXENEMIES ];		// position in the used list when binned
+static float		EnemyGridCellSize = ENEMYGRID_MINCELLSIZE;
+
+/*===================================================================
+	Procedure	:	Hash a grid cell into a bucket
+	Input		:	int32_t	x, y, z	Cell
+	Output		:	u_int32_t		Bucket
+===================================================================*/
+static u_int32_t EnemyGridHash( int32_t x, int32_t y, int32_t z )
+{
+	return( ( ( (u_int32_t) x * 73856093U ) ^ ( (u_int32_t) y * 19349663U ) ^ ( (u_int32_t) z * 83492791U ) ) & ( ENEMYGRID_BUCKETS - 1 ) );
+}
+
+/*===================================================================
+	Procedure	:	Get the buckets of the cells around a position
+	Input		:	VECTOR		*	Pos
+				:	u_int32_t	*	Buckets ( ENEMYGRID_NEIGHBOURS )
+	Output		:	int16_t			Number of different buckets
+===================================================================*/
+static int16_t EnemyGridNeighbours( VECTOR * Pos, u_int32_t * Buckets )
+{
+	int32_t		x, y, z;
+	int32_t		dx, dy, dz;
+	u_int32_t	Bucket;
+	int16_t		Num = 0;
+	int16_t		Count;
+
+	x = (int32_t) floor( Pos->x / EnemyGridCellSize );
+	y = (int32_t) floor( Pos->y / EnemyGridCellSize );
+	z = (int32_t) floor( Pos->z / EnemyGridCellSize );
+
+	for( dx = -1; dx <= 1; dx++ )
+	{
+		for( dy = -1; dy <= 1; dy++ )
+		{
+			for( dz = -1; dz <= 1; dz++ )
+			{
+				Bucket = EnemyGridHash( x + dx, y + dy, z + dz );
+
+				for( Count = 0; Count < Num; Count++ )
+				{
+					if( Buckets[ Count ] == Bucket ) break;
+				}
+				if( Count == Num ) Buckets[ Num++ ] = Bucket;
+			}
+		}
+	}
+
+	return( Num );
+}
+
+/*===================================================================
+	Procedure	:	Bin all enabled enemies into the separation grid
+				:	Cells are big enough for the crawler test ( 1.5
+				:	times both radii ) with room left over for the
+				:	moves made during the frame.
+	Input		:	nothing
+	Output		:	nothing
+===================================================================*/
+static void BinEnemies( void )
+{
+	ENEMY	*	Enemy;
+	float		MaxRadius = 0.0F;
+	u_int16_t	Order = 0;
+	u_int16_t	Binned = 0;
+	u_int32_t	Bucket;
+	int16_t		Count;
+
+	for( Count = 0; Count < ENEMYGRID_BUCKETS; Count++ )
+	{
+		EnemyGridBucket[ Count ] = NULL;
+	}
+
+	for( Enemy = FirstEnemyUsed; Enemy != NULL; Enemy = Enemy->NextUsed )
+	{
+		if( ( Enemy->Status & ENEMY_STATUS_Enable ) && ( EnemyTypes[ Enemy->Type ].Radius > MaxRadius ) )
+			MaxRadius = EnemyTypes[ Enemy->Type ].Radius;
+	}
+
+	EnemyGridCellSize = MaxRadius * 4.0F;
+	if( EnemyGridCellSize < ENEMYGRID_MINCELLSIZE ) EnemyGridCellSize = ENEMYGRID_MINCELLSIZE;
+
+	for( Enemy = FirstEnemyUsed; Enemy != NULL; Enemy = Enemy->NextUsed )
+	{
+		EnemyGridOrder[ Enemy->Index ] = Order++;
+
+		if( !( Enemy->Status & ENEMY_STATUS_Enable ) )
+			continue;
+
+		Bucket = EnemyGridHash( (int32_t) floor( Enemy->Object.Pos.x / EnemyGridCellSize ),
+								(int32_t) floor( Enemy->Object.Pos.y / EnemyGridCellSize ),
+								(int32_t) floor( Enemy->Object.Pos.z / EnemyGridCellSize ) );
+		EnemyGridNext[ Enemy->Index ] = EnemyGridBucket[ Bucket ];
+		EnemyGridBucket[ Bucket ] = Enemy;
+		Binned++;
+	}
+
+	EnemySepFrames++;
+	if( Binned > EnemySepPeak ) EnemySepPeak = Binned;
+}
+
 /*===================================================================
 	Procedure	:	Enemy to Enemy Collide...
+				:	Pushes away from the first enemy in the used
+				:	list that overlaps, only neighbours in the
+				:	separation grid are tested.
 	Input		:	ENEMY * Enemy
 				:	VECTOR * Move offset....
 	Output		:	Nothing
@@ -7108,50 +7436,62 @@ void RestrictMovement( ENEMY * Enemy , VECTOR * Move )
 bool Enemy2EnemyCollide( ENEMY * SEnemy , VECTOR * Move )
 {
 	ENEMY * TEnemy;
+	ENEMY * HitEnemy = NULL;
 	float Move_Length;
 	VECTOR	Move_Dir;
-
-	TEnemy = FirstEnemyUsed;
+	u_int32_t	Buckets[ ENEMYGRID_NEIGHBOURS ];
+	int16_t		NumBuckets;
+	int16_t		Count;
 
 	if( !EnemyTypes[SEnemy->Type].Radius )
 		return false;
-	while( TEnemy != NULL )
+
+	NumBuckets = EnemyGridNeighbours( &SEnemy->Object.Pos, &Buckets[ 0 ] );
+
+	for( Count = 0; Count < NumBuckets; Count++ )
 	{
-		if( TEnemy != SEnemy )
+		for( TEnemy = EnemyGridBucket[ Buckets[ Count ] ]; TEnemy != NULL; TEnemy = EnemyGridNext[ TEnemy->Index ] )
 		{
-			if( ( TEnemy->Status & ENEMY_STATUS_Enable ) )
+			if( TEnemy != SEnemy && TEnemy->Used && ( TEnemy->Status & ENEMY_STATUS_Enable ) )
 			{
 				if( !SoundInfo[SEnemy->Object.Group][TEnemy->Object.Group] && EnemyTypes[TEnemy->Type].Radius )
 				{
 					// Two Enemies are within visible params....
+					EnemySepTests++;
 					Move_Length = DistanceVector2Vector( &SEnemy->Object.Pos , &TEnemy->Object.Pos );
 					if( Move_Length < ( EnemyTypes[SEnemy->Type].Radius + EnemyTypes[TEnemy->Type].Radius ) )
 					{
-						// the ships are to close....Move them apart...Guarenteed..
-						Move_Dir.x = SEnemy->Object.Pos.x - TEnemy->Object.Pos.x;
-						Move_Dir.y = SEnemy->Object.Pos.y - TEnemy->Object.Pos.y;
-						Move_Dir.z = SEnemy->Object.Pos.z - TEnemy->Object.Pos.z;
-						NormaliseVector( &Move_Dir );
-
-						if( SEnemy->Index < TEnemy->Index )
-						{
-							SEnemy->Object.ExternalForce.x += Move_Dir.x * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 1.9F) * framelag );
-							SEnemy->Object.ExternalForce.y += Move_Dir.y * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 1.9F) * framelag );
-							SEnemy->Object.ExternalForce.z += Move_Dir.z * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 1.9F) * framelag );
-						}else{
-							SEnemy->Object.ExternalForce.x += Move_Dir.x * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 2.1F) * framelag );
-							SEnemy->Object.ExternalForce.y += Move_Dir.y * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 2.1F) * framelag );
-							SEnemy->Object.ExternalForce.z += Move_Dir.z * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 2.1F) * framelag );
-						}
-						SEnemy->AIMoveFlags |= AI_CONTROL_COLLISION;
-						return true;
+						if( !HitEnemy || ( EnemyGridOrder[ TEnemy->Index ] < EnemyGridOrder[ HitEnemy->Index ] ) )
+							HitEnemy = TEnemy;
 					}
 				}
 			}
 		}
-		TEnemy = TEnemy->NextUsed;
 	}
-	return false;
+
+	if( !HitEnemy )
+		return false;
+
+	TEnemy = HitEnemy;
+
+	// the ships are to close....Move them apart...Guarenteed..
+	Move_Dir.x = SEnemy->Object.Pos.x - TEnemy->Object.Pos.x;
+	Move_Dir.y = SEnemy->Object.Pos.y - TEnemy->Object.Pos.y;
+	Move_Dir.z = SEnemy->Object.Pos.z - TEnemy->Object.Pos.z;
+	NormaliseVector( &Move_Dir );
+
+	if( SEnemy->Index < TEnemy->Index )
+	{
+		SEnemy->Object.ExternalForce.x += Move_Dir.x * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 1.9F) * framelag );
+		SEnemy->Object.ExternalForce.y += Move_Dir.y * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 1.9F) * framelag );
+		SEnemy->Object.ExternalForce.z += Move_Dir.z * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 1.9F) * framelag );
+	}else{
+		SEnemy->Object.ExternalForce.x += Move_Dir.x * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 2.1F) * framelag );
+		SEnemy->Object.ExternalForce.y += Move_Dir.y * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 2.1F) * framelag );
+		SEnemy->Object.ExternalForce.z += Move_Dir.z * ( EnemyTypes[SEnemy->Type].MaxMoveRate * (EnemyTypes[SEnemy->Type].MoveRateAccell * 2.1F) * framelag );
+	}
+	SEnemy->AIMoveFlags |= AI_CONTROL_COLLISION;
+	return true;
 
 }
 /*===================================================================
@@ -7164,18 +7504,22 @@ bool Enemy2EnemyCollideSpecial( ENEMY * SEnemy , VECTOR * StartPos)
 	ENEMY * TEnemy;
 	float Move_Length;
  	float Move_Length2;
+	u_int32_t	Buckets[ ENEMYGRID_NEIGHBOURS ];
+	int16_t		NumBuckets;
+	int16_t		Count;
 
-	TEnemy = FirstEnemyUsed;
+	NumBuckets = EnemyGridNeighbours( &SEnemy->Object.Pos, &Buckets[ 0 ] );
 
-	while( TEnemy != NULL )
+	for( Count = 0; Count < NumBuckets; Count++ )
 	{
-		if( TEnemy != SEnemy && (TEnemy->Status & ENEMY_STATUS_Enable) && (TEnemy->Object.ControlType == ENEMY_CONTROLTYPE_CRAWL_AI) )
+		for( TEnemy = EnemyGridBucket[ Buckets[ Count ] ]; TEnemy != NULL; TEnemy = EnemyGridNext[ TEnemy->Index ] )
 		{
-			if( ( TEnemy->Status & ENEMY_STATUS_Enable ) )
+			if( TEnemy != SEnemy && TEnemy->Used && (TEnemy->Status & ENEMY_STATUS_Enable) && (TEnemy->Object.ControlType == ENEMY_CONTROLTYPE_CRAWL_AI) )
 			{
 				if( !SoundInfo[SEnemy->Object.Group][TEnemy->Object.Group] )
 				{
 					// Two Enemies are within visible params....
+					EnemySepTests++;
 					Move_Length = DistanceVector2Vector( &SEnemy->Object.Pos , &TEnemy->Object.Pos );
 					if( Move_Length < ( ( EnemyTypes[SEnemy->Type].Radius + EnemyTypes[TEnemy->Type].Radius ) * 1.5F ) )
 					{
@@ -7189,7 +7533,6 @@ bool Enemy2EnemyCollideSpecial( ENEMY * SEnemy , VECTOR * StartPos)
 				}
 			}
 		}
-		TEnemy = TEnemy->NextUsed;
 	}
 	return false;
 
@@ -9228,6 +9571,7 @@ bool Enemy_Load( FILE * fp )
 		fread( &Enemies[i].MasterGenerationDelay, sizeof( Enemies[i].MasterGenerationDelay ), 1, fp );
 		fread( &Enemies[i].SmokeTime, sizeof( Enemies[i].SmokeTime ), 1, fp );
 		fread( &Enemies[i].FirePosCount, sizeof( Enemies[i].FirePosCount ), 1, fp );
+		Enemies[i].LODFramelag = 0.0F;
 
 		if( Enemies[i].Alive || (Enemies[i].Status & ENEMY_STATUS_Enable) )
 		{
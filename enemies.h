@@ -115,6 +115,8 @@ struct ENEMY * FormationLink;
 
 	float	SmokeTime;
 
+	float	LODFramelag;		// framelag saved up while thinking at a reduced rate
+
 	int16_t				FirePosCount;	// if I have more than 1 firing position then cycle between them..
 
 #ifdef DEBUG_ON
@@ -340,6 +342,8 @@ enum
 #define	MAXENEMIES				256
 #define	MAX_ENEMY_TYPES			56
 
+#define	ENEMY_LOD_INTERVAL		4		// frames between thinks for enemies no player can perceive
+
 #define	YES_STEALTH_MODE		true
 #define	NO_STEALTH_MODE			false
 
@@ -6,7 +6,9 @@
 
 #include	"main.h"
 #include	"file.h"
+#include	"package.h"
 #include	"util.h"
+#include	<SDL.h>
 
 #ifdef WIN32
 #include	<io.h>		// for various things
@@ -32,6 +34,7 @@
 #define		S_IWRITE	_S_IWRITE
 #else // ! WIN32
 #include	<time.h>      // for file_time function
+#include	<sys/mman.h>  // for load_file_buffer
 #define		O_BINARY 	0 // no such thing on unixa
 #endif
 
@@ -49,6 +52,12 @@ extern bool Debug;
 
 FILE * file_open(char * filename, char * mode)
 {
+	FILE * fp;
+
+	// level packages are read only
+	if ( mode[0] == 'r' && !strchr( mode, '+' ) && ( fp = package_fopen( filename ) ) )
+		return fp;
+
 	return fopen(convert_path(filename), mode);
 }
 
@@ -109,8 +118,14 @@ int folder_exists( char *pathspec, ... )
 
 bool File_Exists( char * str )
 {
-	char * path = convert_path(str);
-	int rval  = (access( path, 0 ) == 0);
+	char * path;
+	int rval;
+
+	if ( package_size( str ) >= 0 )
+		return true;
+
+	path = convert_path(str);
+	rval = (access( path, 0 ) == 0);
 	DebugPrintf("file: check exists '%s' = %s\n",
 		path, (rval)?"exits":"missing");
 	return rval;
@@ -138,7 +153,11 @@ long Get_File_Size( char * Filename )
 #ifdef WIN32
 
 	int		Handle = -1;
-	long	Read_Size = 0;
+	long	Read_Size = package_size( Filename );
+
+	if ( Read_Size >= 0 )
+		return Read_Size;
+	Read_Size = 0;
 
 	// open the file
 	Handle = open( Filename, O_RDONLY | O_BINARY );
@@ -160,8 +179,13 @@ long Get_File_Size( char * Filename )
 #else // ! WIN32
 
 	struct stat st;
+	long size = package_size( Filename );
+	char * path;
 
-	char * path = convert_path(Filename);
+	if ( size >= 0 )
+		return size;
+
+	path = convert_path(Filename);
 
   if ( !stat( path, &st ) ) 
 	{
@@ -184,6 +208,9 @@ bool file_time( const char * path, struct filetime *t )
 	FILETIME Time;
 	SYSTEMTIME systime;
 
+	if ( package_time( path, t ) )
+		return true;
+
 	hfile = CreateFile( path,	// pointer to name of the file 
 						GENERIC_READ,	// read mode 
 						FILE_SHARE_READ,	// share mode 
@@ -217,6 +244,9 @@ bool file_time( const char * path, struct filetime *t )
 	struct stat st;
 	struct tm lt;
 
+	if ( package_time( path, t ) )
+		return true;
+
 	if ( stat( convert_path(path), &st ) != 0 )
 	{
 		DebugPrintf("failed to retrieve file '%s' modification time\n", path);
@@ -238,9 +268,14 @@ bool file_time( const char * path, struct filetime *t )
 long Read_File( char * Filename, char * File_Buffer, long Read_Size )
 {
 	int	Handle = -1;
-	long	Bytes_Read = 0;
+	long	Bytes_Read = package_read( Filename, File_Buffer, Read_Size );
+	char * path;
+
+	if ( Bytes_Read >= 0 )
+		return Bytes_Read;
+	Bytes_Read = 0;
 
-	char * path = convert_path(Filename);
+	path = convert_path(Filename);
 
 	// get the size of the file
 	if( Read_Size == 0 ) 
@@ -268,6 +303,191 @@ long Read_File( char * Filename, char * File_Buffer, long Read_Size )
 	return ( Bytes_Read );
 }
 
+//
+// Whole File Buffers
+//
+// The level loaders walk a file in memory from start to end.  Rather
+// than reading it all into a heap buffer the file is mapped copy on
+// write: nothing is read up front, pages come in as the parser gets to
+// them and stay shared with the file cache unless something writes to
+// them.  When a file can't be mapped it is read in as before.
+//
+// Either way Padding zero bytes follow the data since the parsers have
+// always been allowed to peek that far.  That only holds for a mapping
+// when the file doesn't end too close to a page boundary ( past the
+// last page the map faults ), so those files are read in too.
+//
+
+typedef struct mapped_file_s
+{
+	char * address;
+	long size;
+	struct mapped_file_s * next;
+} mapped_file_t;
+
+static mapped_file_t * mapped_files = NULL;
+static SDL_mutex * mapped_files_lock = NULL;
+
+// the level load workers map and release files side by side so the
+// list is only touched with the lock held, the lock is made by
+// whoever gets here first
+static SDL_mutex * mapped_lock( void )
+{
+	SDL_mutex * lock;
+
+	if ( mapped_files_lock )
+		return mapped_files_lock;
+
+	lock = SDL_CreateMutex();
+	if ( !lock )
+		return NULL;
+#ifdef WIN32
+	if ( InterlockedCompareExchangePointer( (PVOID *) &mapped_files_lock, lock, NULL ) != NULL )
+#else
+	if ( !__sync_bool_compare_and_swap( &mapped_files_lock, NULL, lock ) )
+#endif
+		SDL_DestroyMutex( lock );
+	return mapped_files_lock;
+}
+
+static long page_size( void )
+{
+#ifdef WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo( &info );
+	return (long) info.dwPageSize;
+#else
+	return sysconf( _SC_PAGESIZE );
+#endif
+}
+
+static char * map_file( char * Filename, long Size, long Padding )
+{
+	char * address = NULL;
+	mapped_file_t * mapped;
+	SDL_mutex * lock;
+	long page = page_size();
+
+	if ( page <= 0 || ( Padding && ( ( Size % page ) == 0 || ( Size % page ) > page - Padding ) ) )
+		return NULL;
+
+#ifdef WIN32
+	{
+		HANDLE file, mapping;
+		file = CreateFile( Filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+		if ( file == INVALID_HANDLE_VALUE )
+			return NULL;
+		mapping = CreateFileMapping( file, NULL, PAGE_WRITECOPY, 0, 0, NULL );
+		CloseHandle( file );
+		if ( !mapping )
+			return NULL;
+		address = (char *) MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 );
+		CloseHandle( mapping ); // the view keeps it alive
+		if ( !address )
+			return NULL;
+	}
+#else
+	{
+		int handle = open( convert_path( Filename ), O_RDONLY );
+		if ( handle == -1 )
+			return NULL;
+		address = mmap( NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, handle, 0 );
+		close( handle );
+		if ( address == MAP_FAILED )
+			return NULL;
+	#ifdef MADV_SEQUENTIAL
+		madvise( address, Size, MADV_SEQUENTIAL );
+	#endif
+	}
+#endif
+
+	mapped = malloc( sizeof( mapped_file_t ) );
+	lock = mapped_lock();
+	if ( !mapped || !lock )
+	{
+		free( mapped );
+#ifdef WIN32
+		UnmapViewOfFile( address );
+#else
+		munmap( address, Size );
+#endif
+		return NULL;
+	}
+	mapped->address = address;
+	mapped->size = Size;
+
+	SDL_LockMutex( lock );
+	mapped->next = mapped_files;
+	mapped_files = mapped;
+	SDL_UnlockMutex( lock );
+
+	return address;
+}
+
+char * load_file_buffer( char * Filename, long * Size, long Padding )
+{
+	char * Buffer;
+
+	*Size = Get_File_Size( Filename );
+	if ( *Size <= 0 )
+		return NULL;
+
+	// packaged files are copied out of the package's mapping
+	Buffer = package_size( Filename ) < 0 ? map_file( Filename, *Size, Padding ) : NULL;
+	if ( Buffer )
+		return Buffer;
+
+	Buffer = calloc( 1, *Size + Padding );
+	if ( !Buffer )
+		return NULL;
+
+	if ( Read_File( Filename, Buffer, *Size ) != *Size )
+	{
+		free( Buffer );
+		return NULL;
+	}
+
+	return Buffer;
+}
+
+void release_file_buffer( char * Buffer )
+{
+	mapped_file_t ** link;
+	mapped_file_t * mapped = NULL;
+
+	if ( !Buffer )
+		return;
+
+	// nothing was ever mapped if there's no lock yet
+	if ( mapped_files_lock )
+	{
+		SDL_LockMutex( mapped_files_lock );
+		for ( link = &mapped_files; *link; link = &(*link)->next )
+		{
+			if ( (*link)->address == Buffer )
+			{
+				mapped = *link;
+				*link = mapped->next;
+				break;
+			}
+		}
+		SDL_UnlockMutex( mapped_files_lock );
+	}
+
+	if ( !mapped )
+	{
+		free( Buffer );
+		return;
+	}
+
+#ifdef WIN32
+	UnmapViewOfFile( Buffer );
+#else
+	munmap( Buffer, mapped->size );
+#endif
+	free( mapped );
+}
+
 bool delete_file( char * str )
 {
 #ifdef WIN32
@@ -26,6 +26,11 @@ long Read_File( char * Filename, char * File_Buffer, long Read_Size );
 bool File_Exists( char * Filename );
 bool delete_file( char * path );
 
+// a whole file mapped ( or read ) into memory followed by zero padding,
+// hand it back to release_file_buffer rather than free
+char * load_file_buffer( char * Filename, long * Size, long Padding );
+void release_file_buffer( char * Buffer );
+
 char* find_file( char * path );
 char* find_next_file( void );
 void find_close( void );
@@ -44,7 +44,7 @@ extern	u_int32_t			TeamFlagMask[ MAX_TEAMS ];
 extern	int8_t			TeamFlagPickup[ MAX_TEAMS ];
 extern	bool			TeamFlagAtHome[ MAX_TEAMS ];
 extern	int16_t			NumPickupType[ MAXPICKUPTYPES ];
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
+extern	FMPOLY			*	FmPolys;
 extern	FRAME_INFO	*	GreyFlare_Header;
 extern	float			framelag;
 extern	u_int8_t			Colourtrans[MAXFONTCOLOURS][3];
@@ -71,6 +71,10 @@ u_int16_t	FirstXLightFree;
 WORD	status;		
 DWORD	chop_status;		
 
+static	RENDERLIGHT	ShaderLights[ MAX_RENDER_LIGHTS ];	// FirstLightVisible as handed to the renderer
+static	int		NumShaderLights = 0;
+static	bool	LightsInShader = false;				// renderer lights vertices, don't touch colours
+
 /*===================================================================
 	Floating Point Cull Mode
 ===================================================================*/
@@ -225,6 +229,189 @@ void SetLightDie ( u_int16_t light )
 	XLights[light].g = 0.0F;
 	XLights[light].b = 0.0F;
 }
+/*===================================================================
+	Procedure	:	Hand the visible lights over to the renderer
+				:	so it can light vertices in its shader
+	Input		:	nothing
+	Output		:	nothing
+===================================================================*/
+static void SetShaderLights( void )
+{
+	XLIGHT * XLightPnt;
+	RENDERLIGHT * Light;
+
+	NumShaderLights = 0;
+	LightsInShader = false;
+
+	for( XLightPnt = FirstLightVisible; XLightPnt; XLightPnt = XLightPnt->NextVisible )
+	{
+		// too many for the shader, light on the cpu this time round
+		if( NumShaderLights == MAX_RENDER_LIGHTS )
+			return;
+
+		Light = &ShaderLights[ NumShaderLights++ ];
+		Light->pos = XLightPnt->Pos;
+		Light->size = XLightPnt->Size;
+		Light->dir = XLightPnt->Dir;
+		Light->cosarc = XLightPnt->CosArc;
+		Light->r = XLightPnt->r;
+		Light->g = XLightPnt->g;
+		Light->b = XLightPnt->b;
+		Light->spot = ( XLightPnt->Type == SPOT_LIGHT );
+	}
+
+	LightsInShader = FSSetLights( ShaderLights, NumShaderLights );
+}
+
+/*===================================================================
+	Procedure	:	Find which of the shader lights reach a box
+	Input		:	u_int16_t	Group the box is in ( -1 any )
+				:	VECTOR	*	Center
+				:	VECTOR	*	Half Size
+	Output		:	u_int32_t	Bit n set if ShaderLights[n] reaches it
+===================================================================*/
+static u_int32_t ShaderLightsInBox( u_int16_t Group, VECTOR * Center, VECTOR * HalfSize )
+{
+	XLIGHT * XLightPnt;
+	u_int32_t Lights = 0;
+	int i;
+
+	for( XLightPnt = FirstLightVisible, i = 0; XLightPnt; XLightPnt = XLightPnt->NextVisible, i++ )
+	{
+		if( ( Group != (u_int16_t) -1 ) && !GroupsAreVisible( Group, XLightPnt->Group ) )
+			continue;
+		if( ( fabs( XLightPnt->Pos.x - Center->x ) <= ( HalfSize->x + XLightPnt->Size ) ) &&
+			( fabs( XLightPnt->Pos.y - Center->y ) <= ( HalfSize->y + XLightPnt->Size ) ) &&
+			( fabs( XLightPnt->Pos.z - Center->z ) <= ( HalfSize->z + XLightPnt->Size ) ) )
+			Lights |= ( 1 << i );
+	}
+
+	return Lights;
+}
+
+/*===================================================================
+	Procedure	:	Put the unlit colours back into a vertex buffer
+				:	if anything has changed them, then let the
+				:	renderer add the lights
+	Input		:	RENDEROBJECT *	Render Object
+				:	LPLVERTEX		Original Vertices
+				:	int				Number of Vertices
+				:	u_int32_t		Lights reaching it
+	Output		:	bool			true/false
+===================================================================*/
+static bool ShaderLightRenderObject( RENDEROBJECT * RenderObject, LPLVERTEX lpOriginal, int vert, u_int32_t Lights )
+{
+	LPLVERTEX lpLVERTEX;
+
+	if( !RenderObject->vbOriginalColors )
+	{
+		if( !FSLockVertexBuffer( RenderObject, &lpLVERTEX ) )
+			return false;
+		while( vert-- )
+		{
+			lpLVERTEX->color = lpOriginal->color;
+			lpLVERTEX++;
+			lpOriginal++;
+		}
+		if( !FSUnlockVertexBuffer( RenderObject ) )
+			return false;
+		RenderObject->vbOriginalColors = true;
+	}
+
+	RenderObject->lights = Lights;
+	return true;
+}
+
+/*===================================================================
+	Procedure	:	Move the animating polys of an execbuf on
+				:	to their new frames
+	Input		:	MLOADHEADER *	Mloadheader
+				:	u_int16_t		Group
+				:	int				Execbuf
+				:	LPLVERTEX		Locked vertices ( NULL to just check )
+	Output		:	bool			true if any have changed frame
+===================================================================*/
+static bool AnimateGroupPolys( MLOADHEADER * Mloadheader, u_int16_t group, int execbuf, LPLVERTEX lpPointer )
+{
+	POLYANIM * PolyAnim;
+	TANIMUV * TanimUV;
+	LPLVERTEX lpLVERTEX;
+	u_int32_t * u_int32Pnt;
+	bool Changed = false;
+	int i,e;
+
+	PolyAnim = Mloadheader->Group[group].polyanim[execbuf];
+
+	for( i = 0 ; i < Mloadheader->Group[group].num_animating_polys[execbuf] ; i++ )
+	{
+		
+		if( PolyAnim->currentframe != PolyAnim->newframe )
+		{
+			// something has changed....
+			Changed = true;
+			if( !lpPointer )
+				return Changed;
+
+			u_int32Pnt = (u_int32_t*)PolyAnim->vert;
+			for( e = 0 ; e < PolyAnim->vertices ; e++ )
+			{
+
+				lpLVERTEX = lpPointer+ *u_int32Pnt++;
+				TanimUV = PolyAnim->UVs;
+				TanimUV += e + (PolyAnim->vertices * PolyAnim->newframe);
+				lpLVERTEX->tu = TanimUV->u;
+				lpLVERTEX->tv = TanimUV->v;
+			}
+
+			PolyAnim->currentframe = PolyAnim->newframe;
+		}
+		PolyAnim++;
+	}
+
+	return Changed;
+}
+
+/*===================================================================
+	Procedure	:	Xlight 1 Group in the shader
+				:	Only the polys that have animated get uploaded
+	Input		:	MLOADHEADER *	Mloadheader
+				:	u_int16_t		Group
+	Output		:	bool			true/false
+===================================================================*/
+static bool ShaderLight1Group( MLOADHEADER * Mloadheader, u_int16_t group )
+{
+	RENDEROBJECT * RenderObject;
+	LPLVERTEX lpPointer;
+	u_int32_t Lights;
+	bool Original;
+	int execbuf;
+
+	Lights = ShaderLightsInBox( group, (VECTOR *) &Mloadheader->Group[group].center, (VECTOR *) &Mloadheader->Group[group].half_size );
+
+	for( execbuf = 0; execbuf < Mloadheader->Group[group].num_execbufs; execbuf++ )
+	{
+		RenderObject = (RENDEROBJECT*) &Mloadheader->Group[group].renderObject[execbuf];
+
+		if( AnimateGroupPolys( Mloadheader, group, execbuf, NULL ) )
+		{
+			// only the uvs get written
+			Original = RenderObject->vbOriginalColors;
+			if( !FSLockVertexBuffer( RenderObject, &lpPointer ) )
+				return false;
+			AnimateGroupPolys( Mloadheader, group, execbuf, lpPointer );
+			if( !FSUnlockVertexBuffer( RenderObject ) )
+				return false;
+			RenderObject->vbOriginalColors = Original;
+		}
+
+		if( !ShaderLightRenderObject( RenderObject, Mloadheader->Group[group].originalVerts[execbuf],
+			Mloadheader->Group[group].num_verts_per_execbuf[execbuf], Lights ) )
+			return false;
+	}
+
+	return true;
+}
+
 /*===================================================================
 	Procedure	:	Xlight 1 Group Only...
 	Input		:	nothing
@@ -287,10 +474,6 @@ bool	XLight1Group( MLOADHEADER * Mloadheader, u_int16_t group )
 	u_int32_t carry;
 	u_int32_t clamp;
 	u_int32_t r,g,b,intWhiteOut;
-	POLYANIM * PolyAnim;
-	int i,e;
-	u_int32_t * u_int32Pnt;
-	TANIMUV * TanimUV;
 	float	intensity;
 
 #ifdef NEW_LIGHTING
@@ -315,6 +498,11 @@ bool	XLight1Group( MLOADHEADER * Mloadheader, u_int16_t group )
 	return true;
 #endif
 
+	// the water and whiteout effects still rewrite the colours here
+	if( LightsInShader && ( WhiteOut == 0.0F ) && !ShowPlaneRGB &&
+		( GroupWaterInfo[group] == WATERSTATE_NOWATER ) )
+		return ShaderLight1Group( Mloadheader, group );
+
 	intWhiteOut = (int)WhiteOut;
 	if( intWhiteOut >= 256 )
 	{
@@ -340,34 +528,7 @@ bool	XLight1Group( MLOADHEADER * Mloadheader, u_int16_t group )
 		NumOfyCells = Mloadheader->Group[group].ycells[execbuf];
 		NumOfzCells = Mloadheader->Group[group].zcells[execbuf];
 
-		if( Mloadheader->Group[group].num_animating_polys[execbuf] != 0 )
-		{
-
-			PolyAnim = Mloadheader->Group[group].polyanim[execbuf];
-
-			for( i = 0 ; i < Mloadheader->Group[group].num_animating_polys[execbuf] ; i++ )
-			{
-				
-				if( PolyAnim->currentframe != PolyAnim->newframe )
-				{
-					// something has changed....
-
-					u_int32Pnt = (u_int32_t*)PolyAnim->vert;
-					for( e = 0 ; e < PolyAnim->vertices ; e++ )
-					{
-
-						lpLVERTEX = lpPointer+ *u_int32Pnt++;
-						TanimUV = PolyAnim->UVs;
-						TanimUV += e + (PolyAnim->vertices * PolyAnim->newframe);
-						lpLVERTEX->tu = TanimUV->u;
-						lpLVERTEX->tv = TanimUV->v;
-					}
-
-					PolyAnim->currentframe = PolyAnim->newframe;
-				}
-				PolyAnim++;
-			}
-		}
+		AnimateGroupPolys( Mloadheader, group, execbuf, lpPointer );
 		
 		
 		
@@ -948,6 +1109,7 @@ bool	XLightMxloadHeader( MXLOADHEADER * MXloadheader , VECTOR * Pos , float Radi
 	float	blf;
 	float	glf;
 	float	rlf;
+	u_int32_t	Lights;
 
 #ifdef NEW_LIGHTING
 	render_lighting_enabled = 1;
@@ -955,6 +1117,25 @@ bool	XLightMxloadHeader( MXLOADHEADER * MXloadheader , VECTOR * Pos , float Radi
 	return true;
 #endif
 
+	if( LightsInShader )
+	{
+		Temp.x = Radius;
+		Temp.y = Radius;
+		Temp.z = Radius;
+		Lights = ShaderLightsInBox( (u_int16_t) -1, Pos, &Temp );
+		for( group = 0; group < MXloadheader->num_groups; group++ )
+		{
+			for( execbuf = 0; execbuf < MXloadheader->Group[group].num_execbufs; execbuf++ )
+			{
+				if( !ShaderLightRenderObject( &MXloadheader->Group[group].renderObject[execbuf],
+					MXloadheader->Group[group].originalVerts[execbuf],
+					MXloadheader->Group[group].num_verts_per_execbuf[execbuf], Lights ) )
+					return false;
+			}
+		}
+		return true;
+	}
+
 	group = MXloadheader->num_groups;
 	while( group--)
 	{
@@ -1180,6 +1361,7 @@ bool	XLightMxaloadHeader( MXALOADHEADER * MXloadheader , VECTOR * Pos , float Ra
 	float	blf;
 	float	glf;
 	float	rlf;
+	u_int32_t	Lights;
 
 #ifdef NEW_LIGHTING
 	render_lighting_enabled = 1;
@@ -1187,6 +1369,25 @@ bool	XLightMxaloadHeader( MXALOADHEADER * MXloadheader , VECTOR * Pos , float Ra
 	return true;
 #endif
 
+	if( LightsInShader )
+	{
+		Temp.x = Radius;
+		Temp.y = Radius;
+		Temp.z = Radius;
+		Lights = ShaderLightsInBox( (u_int16_t) -1, Pos, &Temp );
+		for( group = 0; group < MXloadheader->num_groups; group++ )
+		{
+			for( execbuf = 0; execbuf < MXloadheader->Group[group].num_execbufs; execbuf++ )
+			{
+				if( !ShaderLightRenderObject( &MXloadheader->Group[group].renderObject[execbuf],
+					MXloadheader->Group[group].originalVerts[execbuf],
+					MXloadheader->Group[group].num_verts_per_execbuf[execbuf], Lights ) )
+					return false;
+			}
+		}
+		return true;
+	}
+
 	group = MXloadheader->num_groups;
 	while( group--)
 	{
@@ -1482,6 +1683,8 @@ void BuildVisibleLightList( u_int16_t Group )
 		}
 		light = XLights[light].Prev;
 	}
+
+	SetShaderLights();
 }
 
 /*===================================================================
@@ -44,6 +44,7 @@
 #include "util.h"
 #include "timer.h"
 #include "oct2.h"
+#include "savefile.h"
 
 /*			Stuff that needs to be saved/loaded.....
 
@@ -140,10 +141,10 @@ bool PreInGameLoad( MENUITEM * MenuItem )
 	u_int32_t		VersionNumber;
 
 #ifdef SAVEGAME_SLOTS
-	fp = file_open( SaveGameFileName( LoadSavedGameList.selected_item ), "rb" );
+	fp = savefile_open( SaveGameFileName( LoadSavedGameList.selected_item ), SAVEFILE_INFO_SIZE );
 #else
 	sprintf( &LoadGameFilename[ 0 ], "savegame\\%s", &LoadSavedGameList.item[ LoadSavedGameList.selected_item ][ 0 ] );
-	fp = file_open( &LoadGameFilename[ 0 ], "rb" );
+	fp = savefile_open( &LoadGameFilename[ 0 ], SAVEFILE_INFO_SIZE );
 #endif
 
 	if( fp != NULL )
@@ -184,10 +185,10 @@ bool PreInGameLoad( MENUITEM * MenuItem )
 		
 		if( ( NewLevelNum == -1 ) || ( i == 256 ) )
 		{
-			fclose( fp );
+			savefile_close( fp );
 			return false;
 		}
-		fclose( fp );
+		savefile_close( fp );
 		return true;
 	}
 	return false;
@@ -211,9 +212,9 @@ void InGameLoad( MENUITEM * MenuItem )
 	u_int32_t		VersionNumber;
 
 #ifdef SAVEGAME_SLOTS
-	fp = file_open( SaveGameFileName( LoadSavedGameList.selected_item ), "rb" );
+	fp = savefile_open( SaveGameFileName( LoadSavedGameList.selected_item ), 0 );
 #else
-	fp = file_open( &LoadGameFilename[ 0 ], "rb" );
+	fp = savefile_open( &LoadGameFilename[ 0 ], 0 );
 #endif
 
 	if( fp != NULL )
@@ -368,7 +369,7 @@ void InGameLoad( MENUITEM * MenuItem )
 		fread( &Cheated, sizeof( bool ), 1, fp );
 
 		DebugPrintf( "Loaded OK\n" );
-		fclose( fp );
+		savefile_close( fp );
 
 		timer_clear( &countdown_timer );
 	}
@@ -483,7 +484,8 @@ bool InGameSave( MENUITEM * MenuItem )
 		return false;
 	}
 
-	fp = file_open( &Filename[ 0 ], "wb" );
+	// built in memory and written out in the background
+	fp = savefile_create();
 
 	if( fp != NULL )
 	{
@@ -507,56 +509,63 @@ bool InGameSave( MENUITEM * MenuItem )
 		fwrite( &Lives, sizeof( Lives ), 1, fp );
 
 		fp = SaveShips( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		if( !Enemy_Save( fp ) )
+		{
+			savefile_abort( fp );
 			return false;
+		}
 		fp = SaveAllSfx( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveTextureAnimations( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveStartRestartPoints( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveRemoteCameras( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveScreenPolys( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveTriggerAreas( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveExternalForces( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveTeleports( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveRealTimeLights( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveXLights( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveAllTriggers( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveBGObjects( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveAllPickups( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SavePrimBulls( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveSecBulls( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveModels( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SavePolys( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveFmPolys( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveAllSpotFX( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		fp = SaveAllText( fp );
-		if( !fp ) return false;
+		if( !fp ) goto failed;
 		
 		fwrite( &Cheated, sizeof( bool ), 1, fp );
 
-		fclose( fp );
-		return true;
+		return savefile_commit( fp, &Filename[ 0 ] );
 	}
 	return false;
+
+failed:
+	// the Save functions close the stream when they fail
+	savefile_abort( NULL );
+	return false;
 }
 
 
@@ -574,7 +583,7 @@ char *SavedGameInfo( int slot )
 	u_int32_t		MagicNumber;
 	u_int32_t		VersionNumber;
 
-	fp = file_open( SaveGameFileName( slot ), "rb" );
+	fp = savefile_open( SaveGameFileName( slot ), SAVEFILE_INFO_SIZE );
 
 	if( fp != NULL )
 	{
@@ -623,7 +632,7 @@ char *SavedGameInfo( int slot )
 				LevelName,
 				Hours * 60 + Minutes, Seconds,
 				KilledEnemiesNum, InitEnemiesNum );
-		fclose( fp );
+		savefile_close( fp );
 	}
 	else
 	{
@@ -640,7 +649,7 @@ bool SaveGameSlotUsed( int slot )
 	u_int32_t		MagicNumber;
 	u_int32_t		VersionNumber;
 
-	fp = file_open( SaveGameFileName( slot ), "rb" );
+	fp = savefile_open( SaveGameFileName( slot ), SAVEFILE_INFO_SIZE );
 	if ( fp )
 	{
 		fread( &MagicNumber, sizeof( u_int32_t ), 1, fp );
@@ -655,7 +664,7 @@ bool SaveGameSlotUsed( int slot )
 		}
 		*/
 
-		fclose( fp );
+		savefile_close( fp );
 		return true;
 	}
 	return false;
@@ -0,0 +1,397 @@
+/*===================================================================
+*	l o a d t a s k . c
+*	Runs the level loaders as a dependency graph, the ones that only
+*	parse files on worker threads, the rest on the main thread...
+===================================================================*/
+#include "main.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <SDL.h>
+#include "loadtask.h"
+#include "util.h"
+
+/*===================================================================
+	Globals
+===================================================================*/
+static const char *	GraphName = "";
+static LOADTASK		Tasks[ MAXLOADTASKS ];
+static int			NumTasks = 0;
+static bool			Broken = false;			// a task couldn't be added
+
+static SDL_Thread *	Workers[ MAXLOADWORKERS ];
+static int			NumWorkers = 0;
+static SDL_mutex *	Lock = NULL;
+static SDL_cond *	Changed = NULL;			// broadcast whenever a task finishes
+
+static int			NumDone;
+static int			NumRunning;
+static int			WorkerTasksLeft;		// worker tasks nobody has picked up yet
+static bool			Failed;
+static u_int32_t	RunStart;
+static u_int32_t	RunTime;
+
+/*===================================================================
+	Procedure	:	Start a new graph, forgetting the last one
+	Input		:	const char	*	Name used in the log
+	Output		:	Nothing
+===================================================================*/
+void LoadTasksBegin( const char * Name )
+{
+	GraphName = Name;
+	NumTasks = 0;
+	Broken = false;
+	RunTime = 0;
+}
+
+/*===================================================================
+	Procedure	:	Add a task to the graph
+				:	Deps are the indices LoadTaskAdd returned for
+				:	the tasks this one has to wait for, so a task
+				:	can only depend on ones added before it.
+	Input		:	const char	*	Name
+				:	LOADTASKFUNC	Func	( false fails the load )
+				:	bool			MainThread
+				:	int				NumDeps
+				:	...				int		Deps
+	Output		:	int				Index of the task, -1 if it
+				:					couldn't be added
+===================================================================*/
+int LoadTaskAdd( const char * Name, LOADTASKFUNC Func, bool MainThread, int NumDeps, ... )
+{
+	LOADTASK *	Task;
+	va_list		args;
+	int			Dep;
+	int			i;
+
+	if( NumTasks >= MAXLOADTASKS || NumDeps > MAXLOADTASKDEPS )
+	{
+		DebugPrintf( "loadtask: no room for %s in %s\n", Name, GraphName );
+		Broken = true;
+		return -1;
+	}
+
+	Task = &Tasks[ NumTasks ];
+	Task->Name = Name;
+	Task->Func = Func;
+	Task->MainThread = MainThread;
+	Task->NumDeps = 0;
+	Task->Waiting = 0;
+	Task->State = LOADTASK_Pending;
+	Task->Worker = -1;
+	Task->Start = 0;
+	Task->Time = 0;
+
+	va_start( args, NumDeps );
+	for( i = 0; i < NumDeps; i++ )
+	{
+		Dep = va_arg( args, int );
+		if( Dep < 0 || Dep >= NumTasks )
+		{
+			DebugPrintf( "loadtask: %s depends on a task that wasn't added\n", Name );
+			Broken = true;
+			continue;
+		}
+		Task->Deps[ Task->NumDeps++ ] = Dep;
+		Task->Waiting++;
+	}
+	va_end( args );
+
+	return NumTasks++;
+}
+
+/*===================================================================
+	Procedure	:	Find the first task ready to run
+				:	The main thread also takes worker tasks when
+				:	there are no workers.  Lock must be held.
+	Input		:	bool			MainThread
+	Output		:	LOADTASK	*	NULL if none are ready
+===================================================================*/
+static LOADTASK * ReadyTask( bool MainThread )
+{
+	LOADTASK *	Task;
+	int			i;
+
+	for( i = 0; i < NumTasks; i++ )
+	{
+		Task = &Tasks[ i ];
+		if( Task->State != LOADTASK_Pending || Task->Waiting )
+			continue;
+		if( MainThread ? ( Task->MainThread || !NumWorkers ) : !Task->MainThread )
+			return Task;
+	}
+	return NULL;
+}
+
+/*===================================================================
+	Procedure	:	Run a task and release the ones waiting on it
+				:	Lock must be held, it is dropped while the
+				:	task runs.
+	Input		:	LOADTASK	*	Task
+				:	int				Worker	( -1 for the main thread )
+	Output		:	Nothing
+===================================================================*/
+static void RunTask( LOADTASK * Task, int Worker )
+{
+	int		Index = (int) ( Task - Tasks );
+	bool	ok;
+	int		i, j;
+
+	Task->State = LOADTASK_Running;
+	Task->Worker = Worker;
+	Task->Start = SDL_GetTicks() - RunStart;
+	if( !Task->MainThread )
+		WorkerTasksLeft--;
+	NumRunning++;
+	SDL_UnlockMutex( Lock );
+
+	ok = Task->Func();
+
+	SDL_LockMutex( Lock );
+	Task->Time = SDL_GetTicks() - RunStart - Task->Start;
+	NumRunning--;
+
+	if( ok )
+	{
+		Task->State = LOADTASK_Done;
+		NumDone++;
+		for( i = 0; i < NumTasks; i++ )
+		{
+			for( j = 0; j < Tasks[ i ].NumDeps; j++ )
+			{
+				if( Tasks[ i ].Deps[ j ] == Index )
+					Tasks[ i ].Waiting--;
+			}
+		}
+	}
+	else
+	{
+		DebugPrintf( "loadtask: %s failed\n", Task->Name );
+		Task->State = LOADTASK_Failed;
+		Failed = true;
+	}
+
+	SDL_CondBroadcast( Changed );
+}
+
+/*===================================================================
+	Procedure	:	Worker thread, runs worker tasks until there
+				:	are none left or one failed
+	Input		:	void	*	Worker number
+	Output		:	int			0
+===================================================================*/
+static int LoadWorker( void * Data )
+{
+	int			Worker = (int) (intptr_t) Data;
+	LOADTASK *	Task;
+
+	SDL_LockMutex( Lock );
+	while( !Failed && WorkerTasksLeft )
+	{
+		Task = ReadyTask( false );
+		if( Task )
+			RunTask( Task, Worker );
+		else
+			SDL_CondWait( Changed, Lock );
+	}
+	SDL_UnlockMutex( Lock );
+
+	return 0;
+}
+
+/*===================================================================
+	Procedure	:	Start as many workers as are useful
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+static void StartWorkers( void )
+{
+	int	Count = 2;
+	int	i;
+
+#if SDL_VERSION_ATLEAST(2,0,0)
+	// leave a core for the main thread
+	Count = SDL_GetCPUCount() - 1;
+	if( Count < 1 )
+		Count = 1;
+#endif
+	if( Count > MAXLOADWORKERS )
+		Count = MAXLOADWORKERS;
+	if( Count > WorkerTasksLeft )
+		Count = WorkerTasksLeft;
+#ifdef DEBUG_ON
+	// the worker tasks allocate, the main thread runs them all
+	// if the debug allocator can't be shared
+	if( !XMem_ThreadSafe() )
+		Count = 0;
+#endif
+
+	NumWorkers = 0;
+
+	Lock = SDL_CreateMutex();
+	Changed = SDL_CreateCond();
+	if( !Lock || !Changed )
+	{
+		DebugPrintf( "loadtask: couldn't create locks: %s\n", SDL_GetError() );
+		return;
+	}
+
+	// hold the lock so no worker looks at the graph before
+	// NumWorkers says who runs the worker tasks
+	SDL_LockMutex( Lock );
+	for( i = 0; i < Count; i++ )
+	{
+#if SDL_VERSION_ATLEAST(2,0,0)
+		Workers[ i ] = SDL_CreateThread( LoadWorker, "load_worker", (void *) (intptr_t) i );
+#else
+		Workers[ i ] = SDL_CreateThread( LoadWorker, (void *) (intptr_t) i );
+#endif
+		if( !Workers[ i ] )
+		{
+			DebugPrintf( "loadtask: couldn't create worker: %s\n", SDL_GetError() );
+			break;
+		}
+		NumWorkers++;
+	}
+	SDL_UnlockMutex( Lock );
+}
+
+/*===================================================================
+	Procedure	:	Wait for the workers and free the locks
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+static void StopWorkers( void )
+{
+	int	i;
+
+	for( i = 0; i < NumWorkers; i++ )
+		SDL_WaitThread( Workers[ i ], NULL );
+	NumWorkers = 0;
+
+	if( Changed )
+		SDL_DestroyCond( Changed );
+	if( Lock )
+		SDL_DestroyMutex( Lock );
+	Changed = NULL;
+	Lock = NULL;
+}
+
+/*===================================================================
+	Procedure	:	Run the graph
+				:	Returns once every task has run, or once the
+				:	tasks already running have finished after one
+				:	failed.  Tasks report their own errors.
+	Input		:	Nothing
+	Output		:	bool	true if every task succeeded
+===================================================================*/
+bool LoadTasksRun( void )
+{
+	LOADTASK *	Task;
+	int			i;
+
+	if( Broken )
+	{
+		Msg( "LoadTasksRun() %s has a broken task list\n", GraphName );
+		return false;
+	}
+
+	NumDone = 0;
+	NumRunning = 0;
+	Failed = false;
+	WorkerTasksLeft = 0;
+	for( i = 0; i < NumTasks; i++ )
+	{
+		if( !Tasks[ i ].MainThread )
+			WorkerTasksLeft++;
+	}
+
+	RunStart = SDL_GetTicks();
+	StartWorkers();
+
+	SDL_LockMutex( Lock );
+	while( NumDone < NumTasks && !Failed )
+	{
+		Task = ReadyTask( true );
+		if( Task )
+		{
+			RunTask( Task, -1 );
+			continue;
+		}
+
+		// nothing running and nothing can start, a task waits on itself
+		if( !NumRunning && ( !NumWorkers || !ReadyTask( false ) ) )
+		{
+			DebugPrintf( "loadtask: %s can't finish, the tasks wait on each other\n", GraphName );
+			Failed = true;
+			break;
+		}
+
+		SDL_CondWait( Changed, Lock );
+	}
+
+	// let idle workers see the failure, the busy ones finish their task
+	if( Failed )
+		SDL_CondBroadcast( Changed );
+	SDL_UnlockMutex( Lock );
+
+	StopWorkers();
+
+	RunTime = SDL_GetTicks() - RunStart;
+	LoadTasksLogStats();
+
+	// the tasks only log why they failed, Msg may not run on a worker
+	if( Failed )
+	{
+		for( i = 0; i < NumTasks; i++ )
+		{
+			if( Tasks[ i ].State == LOADTASK_Failed )
+				break;
+		}
+		Msg( "LoadTasksRun() %s failed at %s\n", GraphName, ( i < NumTasks ) ? Tasks[ i ].Name : "a task waiting on itself" );
+	}
+
+	return !Failed;
+}
+
+/*===================================================================
+	Procedure	:	Log when each task of the last run started,
+				:	how long it took and where it ran
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void LoadTasksLogStats( void )
+{
+	LOADTASK *	Task;
+	u_int32_t	Total = 0;
+	char		Where[ 16 ];
+	int			i;
+
+	for( i = 0; i < NumTasks; i++ )
+		Total += Tasks[ i ].Time;
+
+	DebugPrintf( "loadtask: %s took %u ms, %u ms of loading\n", GraphName, RunTime, Total );
+
+	for( i = 0; i < NumTasks; i++ )
+	{
+		Task = &Tasks[ i ];
+
+		if( Task->Worker < 0 )
+			snprintf( Where, sizeof( Where ), "main" );
+		else
+			snprintf( Where, sizeof( Where ), "worker %d", Task->Worker );
+
+		switch( Task->State )
+		{
+		case LOADTASK_Done:
+			DebugPrintf( "loadtask:   %-24s %-8s at %5u ms took %5u ms\n", Task->Name, Where, Task->Start, Task->Time );
+			break;
+		case LOADTASK_Failed:
+			DebugPrintf( "loadtask:   %-24s %-8s at %5u ms failed\n", Task->Name, Where, Task->Start );
+			break;
+		default:
+			DebugPrintf( "loadtask:   %-24s not run\n", Task->Name );
+			break;
+		}
+	}
+}
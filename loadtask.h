@@ -0,0 +1,64 @@
+/*==========================================================================
+ *  l o a d t a s k . h
+ *
+ *  Level loading as a graph of load tasks.
+ *
+ *  Each task is one loader ( Mload, Bspload, MCload ... ) and names the
+ *  tasks it has to wait for.  Tasks that only parse their own files
+ *  into their own globals run on a handful of worker threads, anything
+ *  that touches gl, sound or game state shared with other loaders is
+ *  marked main thread and is run by the caller, in the order it was
+ *  added, between waiting for the workers.
+ *
+ *  Every run logs how long each task took and when it started so the
+ *  slow loaders and the critical path show up in the debug log.
+ ***************************************************************************/
+#ifndef LOADTASK_INCLUDED
+#define LOADTASK_INCLUDED
+
+/*===================================================================
+	Includes
+===================================================================*/
+#include "main.h"
+
+/*===================================================================
+	Defines
+===================================================================*/
+#define	MAXLOADTASKS		32
+#define	MAXLOADTASKDEPS		8
+#define	MAXLOADWORKERS		4
+
+#define	LOADTASK_Pending	0
+#define	LOADTASK_Running	1
+#define	LOADTASK_Done		2
+#define	LOADTASK_Failed		3
+
+/*===================================================================
+	Structures
+===================================================================*/
+typedef bool (*LOADTASKFUNC)( void );
+
+typedef struct LOADTASK {
+
+	const char	*	Name;
+	LOADTASKFUNC	Func;
+	bool			MainThread;			// touches gl, sound or shared state
+	int				NumDeps;
+	int				Deps[ MAXLOADTASKDEPS ];
+	int				Waiting;			// deps not finished yet
+	int				State;
+	int				Worker;				// who ran it, -1 for the main thread
+	u_int32_t		Start;				// ms after the run started
+	u_int32_t		Time;				// ms it took
+
+} LOADTASK;
+
+/*===================================================================
+	Prototypes
+===================================================================*/
+void LoadTasksBegin( const char * Name );
+int LoadTaskAdd( const char * Name, LOADTASKFUNC Func, bool MainThread, int NumDeps, ... );
+bool LoadTasksRun( void );
+void LoadTasksLogStats( void );
+
+#endif	// LOADTASK_INCLUDED
@@ -0,0 +1,238 @@
+/*===================================================================
+*	l o s c a c h e . c
+*	Per frame cache of line of sight answers for the AI and HUD
+===================================================================*/
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "new3d.h"
+#include "mload.h"
+#include "collision.h"
+#include "loscache.h"
+#include "util.h"
+
+/*===================================================================
+	Structures
+===================================================================*/
+typedef struct LOSCACHEENTRY {
+
+	VECTOR			SPos;				// the two ends asked about
+	VECTOR			Pos;
+	float			Radius;
+	u_int32_t		Frame;
+	u_int16_t		Group;
+	u_int8_t		Type;
+	bool			Clear;
+
+} LOSCACHEENTRY;
+
+/*===================================================================
+	Externals
+===================================================================*/
+extern	MLOADHEADER		Mloadheader;
+extern	MCLOADHEADER	MCloadheadert0;
+
+/*===================================================================
+	Globals
+===================================================================*/
+static LOSCACHEENTRY	LOSCache[ LOSCACHE_SIZE ];
+static u_int32_t		LOSCacheFrame = 1;				// 0 marks an empty slot
+static u_int32_t		LOSCacheHits = 0;
+static u_int32_t		LOSCacheMisses = 0;
+static u_int32_t		LOSCacheLevelHits = 0;
+static u_int32_t		LOSCacheLevelMisses = 0;
+u_int32_t				LOSCacheHitsLastFrame = 0;
+u_int32_t				LOSCacheMissesLastFrame = 0;
+
+/*===================================================================
+	Procedure	:	Which LOSCACHE_TOLERANCE sized cell a
+				:	coordinate falls in
+	Input		:	float		Coordinate
+	Output		:	u_int32_t	Cell
+===================================================================*/
+static u_int32_t LOSCacheCell( float Coord )
+{
+	return (u_int32_t) (int32_t) floorf( Coord * ( 1.0F / LOSCACHE_TOLERANCE ) );
+}
+
+/*===================================================================
+	Procedure	:	Find the slot a query lives in
+				:	Positions are hashed by the cell they are in so
+				:	small moves usually land in the same slot, a move
+				:	across a cell edge just costs a miss
+	Input		:	int				Type
+				:	VECTOR		*	Source Pos
+				:	u_int16_t		Source Group
+				:	VECTOR		*	Target Pos
+	Output		:	LOSCACHEENTRY *	Slot
+===================================================================*/
+static LOSCACHEENTRY * LOSCacheSlot( int Type, VECTOR * SPos, u_int16_t Group, VECTOR * Pos )
+{
+	u_int32_t	Hash;
+
+	Hash = LOSCacheCell( SPos->x ) * 2654435761U;
+	Hash = ( Hash ^ LOSCacheCell( SPos->y ) ) * 2246822519U;
+	Hash = ( Hash ^ LOSCacheCell( SPos->z ) ) * 3266489917U;
+	Hash = ( Hash ^ LOSCacheCell( Pos->x ) ) * 2654435761U;
+	Hash = ( Hash ^ LOSCacheCell( Pos->y ) ) * 2246822519U;
+	Hash = ( Hash ^ LOSCacheCell( Pos->z ) ) * 3266489917U;
+	Hash ^= ( (u_int32_t) Group << 8 ) ^ (u_int32_t) Type;
+	Hash ^= Hash >> 16;
+
+	return &LOSCache[ Hash & ( LOSCACHE_SIZE - 1 ) ];
+}
+
+/*===================================================================
+	Procedure	:	Has a position moved too far to reuse an answer
+	Input		:	VECTOR	*	Then
+				:	VECTOR	*	Now
+	Output		:	bool		true if it has
+===================================================================*/
+static bool LOSCacheMoved( VECTOR * Then, VECTOR * Now )
+{
+	float	x, y, z;
+
+	x = Now->x - Then->x;
+	y = Now->y - Then->y;
+	z = Now->z - Then->z;
+
+	return ( ( x * x ) + ( y * y ) + ( z * z ) ) > ( LOSCACHE_TOLERANCE * LOSCACHE_TOLERANCE );
+}
+
+/*===================================================================
+	Procedure	:	Start a new frame
+				:	Ages all answers and keeps last frame's counters
+				:	for the on screen stats
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void LOSCacheNewFrame( void )
+{
+	LOSCacheFrame++;
+
+	LOSCacheHitsLastFrame = LOSCacheHits;
+	LOSCacheMissesLastFrame = LOSCacheMisses;
+	LOSCacheLevelHits += LOSCacheHits;
+	LOSCacheLevelMisses += LOSCacheMisses;
+	LOSCacheHits = 0;
+	LOSCacheMisses = 0;
+}
+
+/*===================================================================
+	Procedure	:	Forget every answer and log the level's hit rate
+				:	Must be called when the level geometry goes
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void LOSCacheFlush( void )
+{
+	u_int32_t	Total;
+
+	LOSCacheNewFrame();
+
+	Total = LOSCacheLevelHits + LOSCacheLevelMisses;
+
+	if( Total )
+	{
+		DebugPrintf( "loscache: %d queries, %d hits (%d%%), %d misses\n",
+			(int) Total, (int) LOSCacheLevelHits,
+			(int) ( ( (float) LOSCacheLevelHits * 100.0F ) / (float) Total ),
+			(int) LOSCacheLevelMisses );
+	}
+
+	memset( LOSCache, 0, sizeof( LOSCache ) );
+	LOSCacheLevelHits = 0;
+	LOSCacheLevelMisses = 0;
+	LOSCacheHitsLastFrame = 0;
+	LOSCacheMissesLastFrame = 0;
+}
+
+/*===================================================================
+	Procedure	:	Look for a recent answer to a query
+	Input		:	int				Type
+				:	VECTOR		*	Source Pos
+				:	u_int16_t		Source Group
+				:	VECTOR		*	Target Pos
+				:	float			Radius
+				:	bool		*	Clear ( filled in on a hit )
+	Output		:	bool			true if the answer was cached
+===================================================================*/
+bool LOSCacheLookup( int Type, VECTOR * SPos, u_int16_t Group, VECTOR * Pos, float Radius, bool * Clear )
+{
+	LOSCACHEENTRY	*	Entry;
+
+	Entry = LOSCacheSlot( Type, SPos, Group, Pos );
+
+	if( Entry->Frame && ( Entry->Type == Type ) &&
+		( Entry->Group == Group ) && ( Entry->Radius == Radius ) &&
+		( ( LOSCacheFrame - Entry->Frame ) <= LOSCACHE_MAXAGE ) &&
+		!LOSCacheMoved( &Entry->SPos, SPos ) && !LOSCacheMoved( &Entry->Pos, Pos ) )
+	{
+		*Clear = Entry->Clear;
+		LOSCacheHits++;
+		return true;
+	}
+
+	LOSCacheMisses++;
+	return false;
+}
+
+/*===================================================================
+	Procedure	:	Remember the answer to a query
+	Input		:	int				Type
+				:	VECTOR		*	Source Pos
+				:	u_int16_t		Source Group
+				:	VECTOR		*	Target Pos
+				:	float			Radius
+				:	bool			Clear
+	Output		:	Nothing
+===================================================================*/
+void LOSCacheStore( int Type, VECTOR * SPos, u_int16_t Group, VECTOR * Pos, float Radius, bool Clear )
+{
+	LOSCACHEENTRY	*	Entry;
+
+	Entry = LOSCacheSlot( Type, SPos, Group, Pos );
+
+	Entry->SPos = *SPos;
+	Entry->Pos = *Pos;
+	Entry->Radius = Radius;
+	Entry->Frame = LOSCacheFrame;
+	Entry->Group = Group;
+	Entry->Type = (u_int8_t) Type;
+	Entry->Clear = Clear;
+}
+
+/*===================================================================
+	Procedure	:	Is there a clear line through the background
+				:	between two positions
+				:	Only for callers that want nothing but the
+				:	answer, BackgroundCollide's side effects ( hit
+				:	point, enemy hit ) are not repeated on a hit
+	Input		:	VECTOR	*	Source Pos
+				:	u_int16_t	Source Group
+				:	VECTOR	*	Target Pos
+	Output		:	bool		true if clear
+===================================================================*/
+bool LOSCacheClearRay( VECTOR * SPos, u_int16_t Group, VECTOR * Pos )
+{
+	VECTOR		Dir;
+	VECTOR		Int_Point;
+	u_int16_t	Int_Group;
+	NORMAL		Int_Normal;
+	VECTOR		TempVector;
+	bool		Clear;
+
+	if( LOSCacheLookup( LOS_Ray, SPos, Group, Pos, 0.0F, &Clear ) ) return Clear;
+
+	Dir.x = ( Pos->x - SPos->x );
+	Dir.y = ( Pos->y - SPos->y );
+	Dir.z = ( Pos->z - SPos->z );
+
+	Clear = !BackgroundCollide( &MCloadheadert0, &Mloadheader, SPos, Group, &Dir,
+						&Int_Point, &Int_Group, &Int_Normal, &TempVector, true, NULL );
+
+	LOSCacheStore( LOS_Ray, SPos, Group, Pos, 0.0F, Clear );
+
+	return Clear;
+}
@@ -0,0 +1,45 @@
+/*==========================================================================
+ *  l o s c a c h e . h
+ *
+ *  Per frame cache of line of sight answers.
+ *
+ *  The AI and the HUD ask the same "can A see B" question about the
+ *  same pairs of entities many times a frame and again every frame.
+ *  Answers are keyed on the two positions asked about, the source group
+ *  and the kind of query, and are reused for a few frames by any query
+ *  whose ends are both within LOSCACHE_TOLERANCE of the ones stored.
+ *  Callers often ask with temporaries on the stack so nothing is keyed
+ *  on where the vectors live.
+ ***************************************************************************/
+#ifndef LOSCACHE_INCLUDED
+#define LOSCACHE_INCLUDED
+
+/*===================================================================
+	Includes
+===================================================================*/
+#include "main.h"
+#include "new3d.h"
+
+/*===================================================================
+	Defines
+===================================================================*/
+#define	LOSCACHE_SIZE		512							// entries, must be a power of 2
+#define	LOSCACHE_MAXAGE		3							// frames an answer may be reused for
+#define	LOSCACHE_TOLERANCE	( 32.0F * GLOBAL_SCALE )	// how far either end may move meanwhile
+
+enum {
+	LOS_Ray,						// zero width ray through the background
+	LOS_Object,						// object of a given radius moving along the ray
+	LOS_Sphere,						// sphere of a given radius moving along the ray
+};
+
+/*===================================================================
+	Prototypes
+===================================================================*/
+void LOSCacheNewFrame( void );
+void LOSCacheFlush( void );
+bool LOSCacheLookup( int Type, VECTOR * SPos, u_int16_t Group, VECTOR * Pos, float Radius, bool * Clear );
+void LOSCacheStore( int Type, VECTOR * SPos, u_int16_t Group, VECTOR * Pos, float Radius, bool Clear );
+bool LOSCacheClearRay( VECTOR * SPos, u_int16_t Group, VECTOR * Pos );
+
+#endif	// LOSCACHE_INCLUDED
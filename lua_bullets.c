@@ -28,6 +28,12 @@
 #include "lua_weapons.h"
 
 extern PRIMARYWEAPONBULLET PrimBulls[MAXPRIMARYWEAPONBULLETS];
+extern u_int16_t PrimBullType[MAXPRIMARYWEAPONBULLETS];
+extern float PrimBullLifeCount[MAXPRIMARYWEAPONBULLETS];
+extern float PrimBullSpeed[MAXPRIMARYWEAPONBULLETS];
+extern VECTOR PrimBullPos[MAXPRIMARYWEAPONBULLETS];
+extern VECTOR PrimBullDir[MAXPRIMARYWEAPONBULLETS];
+extern u_int16_t PrimBullGroup[MAXPRIMARYWEAPONBULLETS];
 extern SECONDARYWEAPONBULLET SecBulls[MAXSECONDARYWEAPONBULLETS];
 
 static void pushprimbull(lua_State *L, u_int16_t index)
@@ -89,6 +95,23 @@ static int pushentity(lua_State *L, u_int16_t type, u_int16_t index)
 		return 1;                      \
 	}                                  \
 } while (0)
+
+/* primary bullet fields kept in the PrimBull* arrays */
+#define ARRAYFIELD(f, a, type) do {     \
+	if (!strcmp(name, #f))              \
+	{                                   \
+		lua_push ## type(L, a[bullidx]); \
+		return 1;                       \
+	}                                   \
+} while (0)
+
+#define ARRAYFIELDPTR(f, a, type) do {   \
+	if (!strcmp(name, #f))               \
+	{                                    \
+		lua_push ## type(L, &a[bullidx]); \
+		return 1;                        \
+	}                                    \
+} while (0)
 static int luaprimbull_index(lua_State *L)
 {
 	PRIMARYWEAPONBULLET *bullet;
@@ -125,7 +148,7 @@ static int luaprimbull_index(lua_State *L)
 	}
 	else if (!strcmp(name, "Type"))
 	{
-		GETTABLEFORPRIM(bullet->Type);
+		GETTABLEFORPRIM(PrimBullType[bullidx]);
 		return 1;
 	}
 	FIELD(OwnerType, integer);
@@ -139,13 +162,13 @@ static int luaprimbull_index(lua_State *L)
 	}
 	FIELD(PowerLevel, integer);
 	FIELD(TrojPower, number);
-	FIELD(LifeCount, number);
-	FIELD(Speed, number);
+	ARRAYFIELD(LifeCount, PrimBullLifeCount, number);
+	ARRAYFIELD(Speed, PrimBullSpeed, number);
 	FIELD(ColRadius, number);
 	FIELD(ColType, integer);
 	FIELDPTR(Offset, vector);
-	FIELDPTR(Pos, vector);
-	FIELDPTR(Dir, vector);
+	ARRAYFIELDPTR(Pos, PrimBullPos, vector);
+	ARRAYFIELDPTR(Dir, PrimBullDir, vector);
 	FIELDPTR(LocalDir, vector);
 	FIELDPTR(UpVector, vector);
 	FIELDPTR(ColStart, vector);
@@ -154,7 +177,7 @@ static int luaprimbull_index(lua_State *L)
 	FIELDPTR(ColPoint, vector); /* VERT */
 	FIELDPTR(ColPointNormal, vector); /* NORMAL */
 	FIELD(ColGroup, integer);
-	FIELD(GroupImIn, integer);
+	ARRAYFIELD(GroupImIn, PrimBullGroup, integer);
 	FIELDPTR(Mat, matrix);
 	FIELD(line, integer);
 	FIELD(fmpoly, integer);
@@ -312,6 +335,8 @@ static int luasecbull_index(lua_State *L)
 	FIELD(FramelagAddition, number);
 	return luaL_argerror(L, 2, "unknown field name");
 }
+#undef ARRAYFIELDPTR
+#undef ARRAYFIELD
 #undef FIELDPTR
 #undef FIELD
 
@@ -30,18 +30,309 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
 #include "lua_common.h"
 #include "luasocket.h"
 #include "mime.h"
 #include "main.h"
 
+#if LUA_VERSION_NUM >= 502
+#define LUA_SEARCHERS "searchers"
+#define lua_tablelen(L,i) lua_rawlen(L,i)
+#else
+#define LUA_SEARCHERS "loaders"
+#define lua_tablelen(L,i) lua_objlen(L,i)
+#endif
+
+#define LUA_CACHE_FOLDER "scripts/cache"
+#define LUA_CACHE_MAGIC "PXLC"
+
 lua_State *L1;
 
+// compiled chunks are cached beside the scripts, a cache entry is only
+// used while the source still has the mtime and size it was built from
+typedef struct
+{
+	char		magic[4];
+	u_int32_t	version;		// LUA_VERSION_NUM it was dumped by
+	int64_t		mtime;			// of the source
+	int64_t		size;			// of the source
+	u_int32_t	length;			// of the bytecode following the header
+	char		source[128];
+} lua_cache_header_t;
+
+typedef struct
+{
+	char *	data;
+	size_t	size;
+	size_t	allocated;
+} lua_cache_buffer_t;
+
+static bool cache_folder_ok = false;
+static bool cache_folder_tried = false;
+
+static bool source_stat( const char * path, int64_t * mtime, int64_t * size )
+{
+	struct stat st;
+	if ( stat( convert_path( (char*) path ), &st ) != 0 )
+		return false;
+	*mtime = (int64_t) st.st_mtime;
+	*size = (int64_t) st.st_size;
+	return true;
+}
+
+// scripts/socket/url.lua -> scripts/cache/socket_url.luac
+static void cache_path( const char * path, char * out, size_t out_size )
+{
+	char name[ 128 ];
+	size_t i;
+
+	if ( strncmp( path, "./", 2 ) == 0 )
+		path += 2;
+	if ( strncmp( path, "scripts/", 8 ) == 0 )
+		path += 8;
+
+	for ( i = 0; path[ i ] && i < sizeof( name ) - 1; i++ )
+		name[ i ] = ( path[ i ] == '/' || path[ i ] == '\\' ) ? '_' : path[ i ];
+	name[ i ] = 0;
+
+	snprintf( out, out_size, "%s/%sc", LUA_CACHE_FOLDER, name );
+}
+
+static void cache_header( lua_cache_header_t * header, const char * path, int64_t mtime, int64_t size )
+{
+	memset( header, 0, sizeof( *header ) );
+	memcpy( header->magic, LUA_CACHE_MAGIC, sizeof( header->magic ) );
+	header->version = LUA_VERSION_NUM;
+	header->mtime = mtime;
+	header->size = size;
+	strncpy( header->source, path, sizeof( header->source ) - 1 );
+}
+
+static int cache_writer( lua_State * state, const void * p, size_t size, void * ud )
+{
+	lua_cache_buffer_t * buffer = ud;
+	char * data;
+
+	if ( buffer->size + size > buffer->allocated )
+	{
+		size_t allocated = buffer->allocated ? buffer->allocated * 2 : 16 * 1024;
+		while ( allocated < buffer->size + size )
+			allocated *= 2;
+		data = realloc( buffer->data, allocated );
+		if ( !data )
+			return 1;
+		buffer->data = data;
+		buffer->allocated = allocated;
+	}
+
+	memcpy( buffer->data + buffer->size, p, size );
+	buffer->size += size;
+	return 0;
+}
+
+// dumps the chunk on top of the stack, a failure only means the next
+// start compiles it again
+static void cache_save( lua_State * state, const char * path, int64_t mtime, int64_t size )
+{
+	lua_cache_buffer_t buffer = { NULL, 0, 0 };
+	lua_cache_header_t header;
+	char cache[ 256 ];
+	int err;
+
+	if ( !cache_folder_tried )
+	{
+		cache_folder_tried = true;
+		cache_folder_ok = folder_exists( LUA_CACHE_FOLDER ) != 0;
+		if ( !cache_folder_ok )
+			DebugPrintf( "lua: couldn't create %s, scripts won't be cached\n", LUA_CACHE_FOLDER );
+	}
+	if ( !cache_folder_ok )
+		return;
+
+	// room for the header, it's filled in once the length is known
+	if ( cache_writer( state, &header, sizeof( header ), &buffer ) )
+		return;
+
+#if LUA_VERSION_NUM >= 503
+	err = lua_dump( state, cache_writer, &buffer, 0 );
+#else
+	err = lua_dump( state, cache_writer, &buffer );
+#endif
+
+	if ( !err )
+	{
+		cache_header( &header, path, mtime, size );
+		header.length = (u_int32_t) ( buffer.size - sizeof( header ) );
+		memcpy( buffer.data, &header, sizeof( header ) );
+
+		cache_path( path, cache, sizeof( cache ) );
+		if ( Write_File( cache, buffer.data, (long) buffer.size ) != (long) buffer.size )
+		{
+			DebugPrintf( "lua: couldn't write %s\n", cache );
+			delete_file( cache );
+		}
+	}
+
+	free( buffer.data );
+}
+
+// pushes the compiled chunk if the cache of path is still fresh
+static bool cache_load( lua_State * state, const char * path, int64_t mtime, int64_t size )
+{
+	lua_cache_header_t expected;
+	lua_cache_header_t * header;
+	char cache[ 256 ];
+	char chunkname[ 140 ];
+	char * data;
+	long length;
+	bool ok = false;
+
+	cache_path( path, cache, sizeof( cache ) );
+	data = load_file_buffer( cache, &length, 0 );
+	if ( !data )
+		return false;
+
+	cache_header( &expected, path, mtime, size );
+	header = (lua_cache_header_t *) data;
+
+	if ( length >= (long) sizeof( *header ) &&
+		 header->length == (u_int32_t) ( length - sizeof( *header ) ) &&
+		 memcmp( header->magic, expected.magic, sizeof( expected.magic ) ) == 0 &&
+		 header->version == expected.version &&
+		 header->mtime == expected.mtime &&
+		 header->size == expected.size &&
+		 strncmp( header->source, expected.source, sizeof( expected.source ) ) == 0 )
+	{
+		// same chunk name as loading the source so errors read the same
+		snprintf( chunkname, sizeof( chunkname ), "@%s", path );
+		if ( luaL_loadbuffer( state, data + sizeof( *header ), header->length, chunkname ) == 0 )
+			ok = true;
+		else
+		{
+			DebugPrintf( "lua: ignoring cache of %s: %s\n", path, lua_tostring( state, -1 ) );
+			lua_pop( state, 1 );
+		}
+	}
+
+	release_file_buffer( data );
+	return ok;
+}
+
+int lua_loadcached(lua_State *L, const char *path)
+{
+	int64_t mtime, size;
+	int err;
+
+	// no source, let lua report it
+	if ( !source_stat( path, &mtime, &size ) )
+		return luaL_loadfile( L, path );
+
+	if ( cache_load( L, path, mtime, size ) )
+		return 0;
+
+	err = luaL_loadfile( L, path );
+	if ( !err )
+		cache_save( L, path, mtime, size );
+	return err;
+}
+
+// loadfile() for scripts, through the cache
+static int lua_loadfile_cached(lua_State *state)
+{
+	const char * path = luaL_checkstring(state, 1);
+	if (lua_loadcached(state, path))
+	{
+		lua_pushnil(state);
+		lua_insert(state, -2);
+		return 2; // nil, error
+	}
+	return 1;
+}
+
+// require() searcher over package.path that loads through the cache,
+// it runs ahead of lua's own so it only gets a module nothing found
+static int lua_search_cached(lua_State *state)
+{
+	const char * name = luaL_checkstring(state, 1);
+	const char * templates;
+	const char * end;
+	char module[ 100 ];
+	char path[ 256 ];
+	size_t i, j, length;
+	FILE * fp;
+
+	for ( i = 0; name[ i ] && i < sizeof( module ) - 1; i++ )
+		module[ i ] = ( name[ i ] == '.' ) ? '/' : name[ i ];
+	module[ i ] = 0;
+
+	lua_getglobal(state, "package");
+	lua_getfield(state, -1, "path");
+	templates = lua_tostring(state, -1);
+
+	for ( ; templates && *templates; templates = *end ? end + 1 : end )
+	{
+		end = strchr( templates, ';' );
+		if ( !end )
+			end = templates + strlen( templates );
+
+		// fill in each ? of the template with the module
+		for ( i = 0, j = 0; templates + i < end && j < sizeof( path ) - 1; i++ )
+		{
+			if ( templates[ i ] != '?' )
+			{
+				path[ j++ ] = templates[ i ];
+				continue;
+			}
+			length = strlen( module );
+			if ( j + length >= sizeof( path ) - 1 )
+				break;
+			memcpy( path + j, module, length );
+			j += length;
+		}
+		path[ j ] = 0;
+
+		fp = fopen( convert_path( path ), "r" );
+		if ( !fp )
+			continue;
+		fclose( fp );
+
+		lua_pop(state, 2);
+		if (lua_loadcached(state, path))
+			return luaL_error(state, "error loading module '%s' from file '%s':\n\t%s",
+				name, path, lua_tostring(state, -1));
+		return 1;
+	}
+
+	lua_pop(state, 2);
+	lua_pushliteral(state, "");
+	return 1;
+}
+
+static void assign_searcher( void )
+{
+	int i, n;
+
+	// table.insert( package.searchers, 2, lua_search_cached )
+	lua_getglobal(L1, "package");
+	lua_getfield(L1, -1, LUA_SEARCHERS);
+	n = (int) lua_tablelen(L1, -1);
+	for ( i = n; i >= 2; i-- )
+	{
+		lua_rawgeti(L1, -1, i);
+		lua_rawseti(L1, -2, i + 1);
+	}
+	lua_pushcfunction(L1, lua_search_cached);
+	lua_rawseti(L1, -2, 2);
+	lua_pop(L1, 2);
+}
+
 int lua_dofile(lua_State *L, const char *name)
 {
 	char path[100];
 	snprintf(path, 100, "scripts/%s", name);
-	if (luaL_dofile(L,path))
+	if (lua_loadcached(L,path) || lua_pcall(L, 0, LUA_MULTRET, 0))
 	{
 		if (lua_isstring(L, -1))
 			DebugPrintf("Error while loading %s: %s\n", path, lua_tostring(L, -1));
@@ -79,6 +370,7 @@ static int lua_register_funcs(void)
 	lua_register(L1,"touch_file",lua_touch_file);
 	lua_register(L1,"debug",lua_debug_str);
 	lua_register(L1,"alert",lua_alert);
+	lua_register(L1,"loadfile",lua_loadfile_cached);
 	return 0;
 }
 
@@ -148,6 +440,7 @@ static int lua_create(void)
 	}
 	luaL_openlibs(L1);
 	assign_loaders();
+	assign_searcher();
 	return 0;
 }
 
@@ -56,6 +56,8 @@
 extern lua_State *L1;
 
 int lua_dofile(lua_State *L, const char *name);
+// luaL_loadfile through the bytecode cache in scripts/cache
+int lua_loadcached(lua_State *L, const char *path);
 int lua_init(void);
 void lua_shutdown(void);
 
@@ -14,6 +14,13 @@
 #include <SDL.h>
 #include "input.h"
 #include "sound.h"
+#include "pool.h"
+#include "texture_cache.h"
+#include "texture_loader.h"
+#include "package.h"
+#include "demobatch.h"
+#include "savefile.h"
+#include "startup.h"
 
 #ifndef WIN32
 #include <unistd.h>
@@ -123,6 +130,7 @@ extern float UV_Fix;
 extern int NetUpdateIntervalCmdLine;
 extern char *config_name;
 extern int cliSleep;
+extern int EnemySwarm;
 extern TEXT local_port_str;
 extern bool SpaceOrbSetup;
 extern TEXT TCPAddress;
@@ -132,6 +140,13 @@ extern bool DebugLog;
 extern u_int8_t QuickStart;
 extern bool IpOnCLI;
 
+// level packages to build instead of starting the game
+static char PackLevel[ 128 ];
+static bool PackLevels = false;
+
+// demos to clean, validate or gather stats from instead of starting the game
+static DEMOBATCH DemoBatch = { DEMOBATCH_None, "", "", 0, -1 };
+
 static bool ParseCommandLine(char* lpCmdLine)
 {
 	
@@ -265,6 +280,59 @@ static bool ParseCommandLine(char* lpCmdLine)
 			strcpy( (char*)TCPAddress.text, address );
 		}
 
+		// ignore the texture cache, every texture is decoded and cached again
+		else if (!strcasecmp(option, "RebuildTextureCache"))
+		{
+			texture_cache_rebuild = true;
+		}
+
+		// build data\levels\<level>.pxp from the level folder and quit
+		else if (!strcasecmp(option, "PackLevel"))
+		{
+	        option = strtok(NULL, " ");
+			if ( option )
+			{
+				strncpy( PackLevel, option, sizeof(PackLevel) - 1 );
+				PackLevel[ sizeof(PackLevel) - 1 ] = 0;
+			}
+		}
+
+		// build a package for every level folder and quit
+		else if (!strcasecmp(option, "PackLevels"))
+		{
+			PackLevels = true;
+		}
+
+		// clean, validate or gather stats from a list of demos and quit
+		else if (!strcasecmp(option, "DemoBatch"))
+		{
+			char * mode = strtok(NULL, " ");
+			char * list = strtok(NULL, " ");
+			char * output = strtok(NULL, " ");
+
+			if ( !mode || !list || !output || !DemoBatchSetup( &DemoBatch, mode, list, output ) )
+			{
+				Msg("usage: -DemoBatch <clean|validate|stats> <list file|all> <output.json>");
+				return false;
+			}
+		}
+
+		// how many worker processes -DemoBatch runs at once
+		else if (!strcasecmp(option, "DemoJobs"))
+		{
+	        option = strtok(NULL, " ");
+			if ( option )
+				DemoBatch.Workers = atoi( option );
+		}
+
+		// a -DemoBatch worker process, runs one entry of the list
+		else if (!strcasecmp(option, "DemoBatchJob"))
+		{
+	        option = strtok(NULL, " ");
+			if ( option )
+				DemoBatch.Job = atoi( option );
+		}
+
 		// supposedly to set wire mode for mxv's...
 		else if (!strcasecmp(option, "wireframe")) 
 		{
@@ -318,6 +386,10 @@ static bool ParseCommandLine(char* lpCmdLine)
 			// default is 90... max is 120...
 			else if ( sscanf( option, "fov:%f", &normal_fov ) ){}
 
+			// clone extra enemies into single player levels
+			// for stress testing enemy movement
+			else if ( sscanf( option, "swarm:%d", &EnemySwarm ) ){}
+
 			//
 			else {
 				DebugPrintf("cli: unknown option: %s\n",option);
@@ -354,6 +426,13 @@ void CleanUpAndPostQuit(void)
 	// stop rendering and destroy objects
 	render_cleanup( &render_info );
 
+	// the texture workers may still be reading from a level package
+	texture_loader_quit();
+	package_quit();
+
+	// finish writing a game that was just saved
+	savefile_flush();
+
 	// destroy the sound
 	DestroySound( DESTROYSOUND_All );
 
@@ -363,6 +442,9 @@ void CleanUpAndPostQuit(void)
 	// release the scene
 	ReleaseScene();
 
+	// free the entity pools
+	PoolReleaseAll();
+
 	// set flag
     QuitRequested = true;
 
@@ -403,6 +485,11 @@ extern void SetSoundLevels( int *dummy );
 extern void GetDefaultPilot(void);
 extern bool InitScene(void);
 extern BYTE MyGameStatus;
+extern bool bSoundEnabled;
+#ifdef DEMO_SUPPORT
+extern bool PlayDemo;
+extern bool DemoShipInit[];
+#endif
 
 #include "mload.h"
 extern RENDEROBJECT Portal_Execs[ MAXGROUPS ];
@@ -415,6 +502,8 @@ static bool AppInit( char * lpCmdLine )
 	_LIB_VERSION = _SVID_; // enable matherr
 #endif
 
+	startup_mark( "start" );
+
 	ZERO_STACK_MEM(render_info);
 	ZERO_STACK_MEM(RenderBufs);
 	ZERO_STACK_MEM(Portal_Execs);
@@ -455,10 +544,17 @@ static bool AppInit( char * lpCmdLine )
 	if(!sdl_init())
 		return false;
 
+	startup_mark( "sdl" );
+
 	// parse chdir from command line first
 	if(!parse_chdir(lpCmdLine))
 		return false;
 
+	// before anything opens a level file
+	package_init();
+
+	startup_mark( "packages" );
+
 	// we are now in the skeleton folder
 	// now we need to see if we are in right place
 
@@ -470,9 +566,13 @@ static bool AppInit( char * lpCmdLine )
 	if( lua_init() != 0 )
 		return false;
 
+	startup_mark( "lua" );
+
 	// copy game settings from config
 	GetGamePrefs();
 
+	startup_mark( "prefs" );
+
 	// our configs are now loaded
 	// now we can check the command line for overrides
 
@@ -480,6 +580,22 @@ static bool AppInit( char * lpCmdLine )
 	if(!ParseCommandLine(lpCmdLine))
 		return false;
 
+	// packing levels doesn't need a window
+	if( PackLevels || PackLevel[ 0 ] )
+	{
+		bool ok = PackLevels ? package_build_all() : package_build( PackLevel );
+		package_quit();
+		exit( ok ? 0 : 1 );
+	}
+
+	// neither does processing demos
+	if( DemoBatch.Mode != DEMOBATCH_None )
+	{
+		bool ok = DemoBatchRun( &DemoBatch );
+		package_quit();
+		exit( ok ? 0 : 1 );
+	}
+
 	//
 	// create and show the window
 	//
@@ -489,6 +605,8 @@ static bool AppInit( char * lpCmdLine )
 		return false;
 	}
 
+	startup_mark( "window" );
+
 	// appears dinput has to be after init window
 
 	// initialize direct input
@@ -504,6 +622,8 @@ static bool AppInit( char * lpCmdLine )
 	// because joysticks_init will wipe the joystick settings
 	GetDefaultPilot();
 
+	startup_mark( "joysticks and pilot" );
+
 // this is where it starts to take so long cause it scans directory for dynamic sound files...
 
 	// start the title scene
@@ -512,6 +632,8 @@ static bool AppInit( char * lpCmdLine )
 	if (!InitScene())
 		return false;
 
+	startup_mark( "scene" );
+
 	// load the view
 	if (!InitView() )
 	{
@@ -526,6 +648,8 @@ static bool AppInit( char * lpCmdLine )
 	//
 	SetSoundLevels( NULL );
 
+	startup_mark( "view" );
+
 	// done
 	DebugPrintf("AppInit finished...\n");
     return true;
@@ -572,6 +696,24 @@ static bool RenderLoop()
 		}
 	}
 
+	// the title's sound was left until its first frame was up
+	if( startup_running() )
+	{
+		startup_mark( "first frame" );
+
+		if( MyGameStatus == STATUS_Title && !bSoundEnabled )
+		{
+			if( !InitializeSound( DESTROYSOUND_All ) )
+			{
+				Msg("RenderLoop: InitializeSound() failed\n");
+				return false;
+			}
+			startup_mark( "title sound" );
+		}
+
+		startup_done();
+	}
+
 	//
     return true;
 }
@@ -147,6 +147,8 @@ typedef uint32_t u_int32_t;
 #else
 // winapi compatibility
 typedef u_int32_t DWORD;
+typedef int64_t LONGLONG;
+typedef union { LONGLONG QuadPart; } LARGE_INTEGER;
 #endif
 typedef u_int8_t  BYTE;
 typedef u_int16_t WORD;
@@ -105,6 +105,7 @@ num_start_points : u_int16_t
 #include "lights.h"
 #include "triggers.h"
 #include "util.h"
+#include "file.h"
 #include "oct2.h"
 #include "render.h"
 
@@ -649,6 +650,9 @@ bool Mload( char * Filename, MLOADHEADER * Mloadheader  )
 				Msg( "Mxload() normal unlock failed in %s\n", Filename );
 				return false ;
 			}
+
+			// one draw for all the tpages where the renderer can
+			FSMergeTextureGroups( (RENDEROBJECT*)&Mloadheader->Group[group].renderObject[execbuf] );
 		}
 	}
 				
@@ -1343,7 +1347,7 @@ ReleaseMloadheader( MLOADHEADER * Mloadheader )
 	
 	if ( Mloadheader->OrgAddr )
 	{
-		free( Mloadheader->OrgAddr );
+		release_file_buffer( Mloadheader->OrgAddr );
 		Mloadheader->OrgAddr = NULL;
 	}
 
@@ -1407,7 +1411,6 @@ extern	int16_t		LevelNum;
 bool PreMload( char * Filename, MLOADHEADER * Mloadheader  )
 {
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	u_int16_t		*	Uint16Pnt;
 	u_int32_t		*	Uint32Pnt;
@@ -1423,27 +1426,12 @@ bool PreMload( char * Filename, MLOADHEADER * Mloadheader  )
 	Mloadheader->state = false;
 	Mloadheader->Buffer = NULL;
 
-	File_Size = Get_File_Size( Filename );
-	
-	if ( !File_Size )
-	{
-	 	Msg( "PreMLoad : File_Size is zero\n" );
-		return false;
-	}
-
-	Buffer = calloc( 1, File_Size + sizeof( int ) );
+	// mapped copy on write, so unscrambling in place is still fine
+	Buffer = load_file_buffer( Filename, &File_Size, sizeof( int ) );
 
 	if( Buffer == NULL )
 	{
-	 	Msg( "PreMLoad : Unable to allocate buffer\n" );
-		return( false );
-	}
-
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size )
-	{
-	 	Msg( "PreMLoad : Didn't read all of file\n" );
+	 	Msg( "PreMLoad : Unable to load %s\n", Filename );
 		return( false );
 	}
 
@@ -1452,7 +1440,7 @@ bool PreMload( char * Filename, MLOADHEADER * Mloadheader  )
 #ifdef UNSCRAMBLE
 	if ( strcasecmp( Filename, "data\\levels\\accworld\\accworld.mxv" ) &&
 		 strcasecmp( Filename, "data\\levels\\probeworld\\probeworld.mxv" ) )
-		Unscramble( Buffer, Read_Size, Filename );
+		Unscramble( Buffer, File_Size, Filename );
 #endif
 
 	Uint32Pnt = (u_int32_t *) Buffer;
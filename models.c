@@ -32,6 +32,7 @@
 #include "local.h"
 #include "util.h"
 #include "oct2.h"
+#include "pool.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -79,8 +80,8 @@ extern	MODELNAME		TitleModelNames[MAXMODELHEADERS];
 extern	float			SoundInfo[MAXGROUPS][MAXGROUPS];
 extern	ENEMY	*		FirstEnemyUsed;
 extern	LINE			Lines[ MAXLINES ];
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
-extern	POLY			Polys[MAXPOLYS];
+extern	FMPOLY			*	FmPolys;
+extern	POLY			*	Polys;
 extern	FRAME_INFO	*	Flare_Header;
 extern	PRIMARYWEAPONBULLET	PrimBulls[MAXPRIMARYWEAPONBULLETS];
 extern	u_int16_t			GlobalPrimBullsID;
@@ -122,9 +123,11 @@ void UpdateTracker( void );
 void CreateTracker( void );
 u_int16_t	Tracker = (u_int16_t) -1;
 u_int16_t	TrackerTarget = (u_int16_t) -1;
-MODEL	Models[MAXNUMOFMODELS];
+MODEL	*	Models = NULL;
 u_int16_t	FirstModelUsed;
 u_int16_t	FirstModelFree;
+u_int32_t	TotalModelsInUse = 0;
+POOLSTATS	ModelPool = { "Models", "ModelBudget", MAXNUMOFMODELS, MAXNUMOFMODELSBUDGET, 0, 0, 0, 0, 0, 0 };
 int16_t	NextNewModel = -1;
 bool	ShowBoundingBoxes = false;
 
@@ -727,17 +730,17 @@ MODELNAME	SplashModelNames[ MAXMODELHEADERS ] ={
 
 
 /*===================================================================
-*		Set up 2d exec buff etc...
+	Procedure	:	Link a range of Models into the free list
+	Input		:	u_int32_t	First Model
+				:	u_int32_t	One past the last Model
+	Output		:	Nothing
 ===================================================================*/
-void OnceOnlyInitModel( void )
+static void LinkFreeModels( u_int32_t Start, u_int32_t End )
 {
-	int i;
-	int	Count;
+	u_int32_t	i;
+	int			Count;
 
-	FirstModelUsed = (u_int16_t) -1;
-	FirstModelFree = 0;
-	
-	for( i=0;i<MAXNUMOFMODELS;i++)
+	for( i = Start; i < End; i++ )
 	{
 		memset( &Models[i], 0, sizeof( MODEL ) );
 		Models[i].Func = MODFUNC_Nothing;
@@ -748,11 +751,28 @@ void OnceOnlyInitModel( void )
 
 		for( Count = 0; Count < 12; Count++ ) Models[i].TempLines[ Count ] = (u_int16_t) -1;
 
-		Models[i].Next = i + 1;
+		Models[i].Next = (u_int16_t) ( i + 1 );
 		Models[i].Prev = (u_int16_t) -1;
 	}
 
-	Models[MAXNUMOFMODELS-1].Next = (u_int16_t) -1;
+	Models[End-1].Next = (u_int16_t) -1;
+
+	FirstModelFree = (u_int16_t) Start;
+}
+
+/*===================================================================
+*		Set up 2d exec buff etc...
+===================================================================*/
+void OnceOnlyInitModel( void )
+{
+	int i;
+
+	PoolInit( &ModelPool, (void **) &Models, sizeof( MODEL ) );
+
+	FirstModelUsed = (u_int16_t) -1;
+	TotalModelsInUse = 0;
+
+	LinkFreeModels( 0, ModelPool.Linked );
 
 	NextNewModel = MODEL_ExtraModels;
 
@@ -906,13 +926,14 @@ bool InitModel( /*LPDIRECT3DDEVICE lpDev,*/ MODELNAME * NamePnt) // bjd
 
 /*===================================================================
 	Procedure	:	Find a free Model and move it from the free list to
-					the used list
+					the used list, growing the pool if needed
 	Input		:	nothing
 	Output		:	u_int16_t number of Model free....
 ===================================================================*/
 u_int16_t	FindFreeModel()
 {
 	u_int16_t i;
+	u_int32_t Start;
 
 #ifdef DEBUG_ON
 	CheckModelLinkList();
@@ -921,7 +942,12 @@ u_int16_t	FindFreeModel()
 	i = FirstModelFree;
 	
 	if ( i == (u_int16_t) -1)
-		return i;
+	{
+		Start = ModelPool.Linked;
+		if( PoolGrow( &ModelPool ) == Start ) return i;
+		LinkFreeModels( Start, ModelPool.Linked );
+		i = FirstModelFree;
+	}
  
 	Models[i].Prev = FirstModelUsed;
 	if ( FirstModelUsed != (u_int16_t) -1)
@@ -944,6 +970,9 @@ u_int16_t	FindFreeModel()
 	FirstModelUsed = i;
 	FirstModelFree = Models[i].Next;
 
+	TotalModelsInUse++;
+	PoolUsed( &ModelPool, TotalModelsInUse );
+
 #ifdef DEBUG_ON
 	CheckModelLinkList();
 #endif
@@ -995,6 +1024,7 @@ void	KillUsedModel( u_int16_t i )
 	Models[i].LifeCount = -1.0F;
 	Models[i].Scale = 1.0F;
 	FirstModelFree	= i;
+	TotalModelsInUse--;
 
 #ifdef DEBUG_ON
 	CheckModelLinkList();
@@ -1120,6 +1150,183 @@ void KillAttachedSpotFX( u_int16_t i )
 	}
 }
 
+/*===================================================================
+	Models that leave the vertices of their header alone ( no lighting
+	and no Func that processes the model ) look the same wherever they
+	are, so ModelDisp queues them and draws every model using the same
+	header in one go once the group is done.
+===================================================================*/
+#ifndef NEW_LIGHTING
+#define INSTANCE_MODELS
+#endif
+
+#ifdef INSTANCE_MODELS
+
+typedef struct MODELINSTANCE
+{
+	u_int16_t		ModelNum;		// ModelHeaders[] index after lod
+	u_int16_t		Model;			// Models[] index
+	RENDERMATRIX	World;
+} MODELINSTANCE;
+
+static MODELINSTANCE	*	ModelInstances = NULL;
+static RENDERMATRIX		*	ModelInstanceWorlds = NULL;
+static u_int16_t		*	ModelInstanceModels = NULL;
+static int					ModelInstancesSize = 0;
+static int					NumModelInstances = 0;
+
+static bool DrawModelInstances( u_int16_t ClipGroup );
+
+/*===================================================================
+	Procedure	:	Can a model be drawn together with the other
+				:	models using its header
+	Input		:	u_int16_t	Models[] Index
+				:	u_int16_t	ModelHeaders[] Index after lod
+	Output		:	bool
+===================================================================*/
+static bool ModelInstanced( u_int16_t i, u_int16_t ModelNum )
+{
+	if( ModelHeaders[ ModelNum ].PerModel )
+		return false;
+
+	if( Models[ i ].Flags & ( MODFLAG_Light | MODFLAG_AmbientLight | MODFLAG_RealLight | MODFLAG_Stealth ) )
+		return false;
+
+	switch( Models[ i ].Func )
+	{
+		case MODFUNC_Explode:
+		case MODFUNC_Scale:
+		case MODFUNC_Scale2:
+		case MODFUNC_Regen:
+		case MODFUNC_OrbitPulsar:
+		case MODFUNC_ScaleDonut:
+		case MODFUNC_RestoreColours:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+/*===================================================================
+	Procedure	:	A model that is not instanced is about to light,
+				:	colour or process the vertices of a header, so
+				:	the header is never instanced again.  Anything
+				:	already queued is drawn first so it keeps the
+				:	colours it was queued with.
+	Input		:	u_int16_t	ModelHeaders[] Index after lod
+				:	u_int16_t	Group the models are clipped to
+	Output		:	bool		false on failure
+===================================================================*/
+static bool ModelHeaderPerModel( u_int16_t ModelNum, u_int16_t ClipGroup )
+{
+	RENDERMATRIX World;
+	bool ok;
+
+	if( ModelHeaders[ ModelNum ].PerModel )
+		return true;
+
+	ModelHeaders[ ModelNum ].PerModel = true;
+	if( !NumModelInstances )
+		return true;
+
+	FSGetWorld( &World );
+	ok = DrawModelInstances( ClipGroup );
+	FSSetWorld( &World );
+	return ok;
+}
+
+/*===================================================================
+	Procedure	:	Queue a model to be drawn with the others
+				:	using the same header
+	Input		:	u_int16_t		ModelHeaders[] Index
+				:	u_int16_t		Models[] Index
+				:	RENDERMATRIX *	World matrix of the model
+	Output		:	bool			false on failure
+===================================================================*/
+static bool QueueModelInstance( u_int16_t ModelNum, u_int16_t i, RENDERMATRIX * World )
+{
+	MODELINSTANCE	*	Instance;
+	RENDERMATRIX	*	Worlds;
+	u_int16_t		*	Indices;
+
+	if( NumModelInstances == ModelInstancesSize )
+	{
+		int size = ModelInstancesSize ? ModelInstancesSize * 2 : 64;
+
+		// the worlds and indices are handed to the renderer per header
+		Instance = (MODELINSTANCE *) realloc( ModelInstances, size * sizeof( MODELINSTANCE ) );
+		if( Instance ) ModelInstances = Instance;
+		Worlds = (RENDERMATRIX *) realloc( ModelInstanceWorlds, size * sizeof( RENDERMATRIX ) );
+		if( Worlds ) ModelInstanceWorlds = Worlds;
+		Indices = (u_int16_t *) realloc( ModelInstanceModels, size * sizeof( u_int16_t ) );
+		if( Indices ) ModelInstanceModels = Indices;
+		if( !Instance || !Worlds || !Indices )
+		{
+			Msg( "Unable to grow the model instances to %d\n", size );
+			return false;
+		}
+		ModelInstancesSize = size;
+	}
+
+	Instance = &ModelInstances[ NumModelInstances++ ];
+	Instance->ModelNum = ModelNum;
+	Instance->Model = i;
+	Instance->World = *World;
+
+	return true;
+}
+
+static int CompareModelInstances( const void * a, const void * b )
+{
+	const MODELINSTANCE * ia = (const MODELINSTANCE *) a;
+	const MODELINSTANCE * ib = (const MODELINSTANCE *) b;
+
+	if( ia->ModelNum != ib->ModelNum )
+		return (int) ia->ModelNum - (int) ib->ModelNum;
+	return (int) ia->Model - (int) ib->Model;
+}
+
+/*===================================================================
+	Procedure	:	Draw the queued models, all the models using
+				:	the same header at once
+	Input		:	u_int16_t	Group the models are clipped to
+	Output		:	bool		false on failure
+===================================================================*/
+static bool DrawModelInstances( u_int16_t ClipGroup )
+{
+	int		First, Count;
+	bool	ok = true;
+
+	qsort( ModelInstances, NumModelInstances, sizeof( MODELINSTANCE ), CompareModelInstances );
+
+	for( First = 0; First < NumModelInstances; First += Count )
+	{
+		for( Count = 0; ( First + Count ) < NumModelInstances; Count++ )
+		{
+			if( ModelInstances[ First + Count ].ModelNum != ModelInstances[ First ].ModelNum )
+				break;
+			ModelInstanceWorlds[ Count ] = ModelInstances[ First + Count ].World;
+			ModelInstanceModels[ Count ] = ModelInstances[ First + Count ].Model;
+		}
+
+		if( !ExecuteMxloadHeaderInstances( &ModelHeaders[ ModelInstances[ First ].ModelNum ],
+			ModelInstanceModels, ModelInstanceWorlds, Count, ClipGroup ) )
+		{
+			Msg( "ModelDisp() ExecuteMxloadHeaderInstances for %s Failed\n",
+				&ModelNames[ Models[ ModelInstances[ First ].Model ].ModelNum ].Name[ 0 ] );
+			ok = false;
+			break;
+		}
+	}
+
+	NumModelInstances = 0;
+
+	return ok;
+}
+
+#endif // INSTANCE_MODELS
+
 /*===================================================================
 *		display all active Models...
 ===================================================================*/
@@ -1143,6 +1350,10 @@ bool ModelDisp( u_int16_t group, /*LPDIRECT3DDEVICE lpDev,*/ MODELNAME * NamePnt
 	if( NamePnt == &ModelNames[0] ) InTitle = false;
 	else InTitle = true;
 
+#ifdef INSTANCE_MODELS
+	NumModelInstances = 0;
+#endif
+
 	i =  FirstModelUsed;
 	while( i != (u_int16_t) -1 )
 	{
@@ -1438,6 +1649,11 @@ bool ModelDisp( u_int16_t group, /*LPDIRECT3DDEVICE lpDev,*/ MODELNAME * NamePnt
 												 &Models[i].TempLines[ 0 ], Models[i].Group );
 #endif
 
+#ifdef INSTANCE_MODELS
+							if( !ModelInstanced( i, ModelNum ) && !ModelHeaderPerModel( ModelNum, group ) )
+								return false;
+#endif
+
 							if( Models[i].Flags & MODFLAG_AmbientLight )
 							{
 								GetRealLightAmbient( &Models[i].Pos , &r , &g , &b );
@@ -1464,6 +1680,11 @@ bool ModelDisp( u_int16_t group, /*LPDIRECT3DDEVICE lpDev,*/ MODELNAME * NamePnt
 									ModelNum += ( ModelHeaders[Models[i].ModelNum].LOD + 1 );
 								}
 
+#ifdef INSTANCE_MODELS
+								if( !ModelHeaderPerModel( ModelNum, group ) )
+									return false;
+#endif
+
 								if( !LightMxModel( ModelNum, &Models[i].Pos, (float) Models[i].Red, (float) Models[i].Green, (float) Models[i].Blue, 255.0F ) ) DoDisplay = false;
 
 							}
@@ -1471,6 +1692,15 @@ bool ModelDisp( u_int16_t group, /*LPDIRECT3DDEVICE lpDev,*/ MODELNAME * NamePnt
 							//DebugPrintf("display = '%d', mip number = '%d', name = '%s'\n",
 							//	DoDisplay, ModelNum, (char*)&ModelNames[ Models[i].ModelNum ].Name[ 0 ]);
 
+#ifdef INSTANCE_MODELS
+							if( DoDisplay && ModelInstanced( i, ModelNum ) )
+							{
+								if( !QueueModelInstance( ModelNum, i, &TempWorld ) )
+									return false;
+								DoDisplay = false;
+							}
+#endif
+
 							if( DoDisplay )
 							{
 								//count++;
@@ -1500,6 +1730,11 @@ bool ModelDisp( u_int16_t group, /*LPDIRECT3DDEVICE lpDev,*/ MODELNAME * NamePnt
 
 	//DebugPrintf("drew %d objects\n", count);
 
+#ifdef INSTANCE_MODELS
+	if( !DrawModelInstances( group ) )
+		return false;
+#endif
+
 	if (!FSSetWorld(&identity))
 	{
 		Msg( "ModelDisp() SetMatrix2 Failed\n" );
@@ -6184,10 +6419,13 @@ FILE * LoadModels( FILE * fp )
 		fread( &FirstModelUsed, sizeof( FirstModelUsed ), 1, fp );
 		fread( &FirstModelFree, sizeof( FirstModelFree ), 1, fp );
 		
+		TotalModelsInUse = 0;
 		i = FirstModelUsed;
 
 		while( i != (u_int16_t) -1 )
 		{
+			if( !PoolLinked( &ModelPool, i ) ) return NULL;
+			TotalModelsInUse++;
 			fread( &Models[ i ].Next, sizeof( u_int16_t ), 1, fp );
 			fread( &Models[ i ].Prev, sizeof( u_int16_t ), 1, fp );
 			fread( &Models[ i ].Type, sizeof( int16_t ), 1, fp );
@@ -6243,6 +6481,7 @@ FILE * LoadModels( FILE * fp )
 
 		while( i != (u_int16_t) -1 )
 		{
+			if( !PoolLinked( &ModelPool, i ) ) return NULL;
 			memset( &Models[ i ], 0, sizeof( MODEL ) );
 			Models[i].Func = MODFUNC_Nothing;
 			Models[i].LifeCount = -1.0F;
@@ -6426,19 +6665,19 @@ void EnableRelavantModels( MODELNAME * ModelNamesPtr )
 
 void CheckModelLinkList( void )
 {
-	u_int16_t i;
+	u_int32_t i;
 	u_int16_t Count;
 
 
 	
 	i = 0;
 	Count = FirstModelFree;
-	while( ( Count != (u_int16_t)-1 ) && i < MAXNUMOFMODELS*2 )
+	while( ( Count != (u_int16_t)-1 ) && i < ( ModelPool.Linked * 2 ) )
 	{
 		Count = Models[Count].Next;
 		i++;
 	}
-	if( i == MAXNUMOFMODELS*2 )
+	if( i == ( ModelPool.Linked * 2 ) )
 	{
 		// oh shit
         DebugPrintf( "Model Free link list Gone up its ass\n" );
@@ -6448,17 +6687,17 @@ void CheckModelLinkList( void )
 	i = 0;
 
 	Count = FirstModelUsed;
-	while( ( Count != (u_int16_t)-1 ) && i < MAXNUMOFMODELS*2 )
+	while( ( Count != (u_int16_t)-1 ) && i < ( ModelPool.Linked * 2 ) )
 	{
 		if( Models[Count].Prev == Models[Count].Next )
 		{
-			i = MAXNUMOFMODELS*2;
+			i = ( ModelPool.Linked * 2 );
 			break;
 		}
 		Count = Models[Count].Prev;
 		i++;
 	}
-	if( i == MAXNUMOFMODELS*2 )
+	if( i == ( ModelPool.Linked * 2 ) )
 	{
 		// oh shit
         DebugPrintf( "Model Used link list Gone up its ass\n" );
@@ -17,7 +17,8 @@
 /*
  * defines
  */
-#define MAXNUMOFMODELS		1024
+#define MAXNUMOFMODELS		1024	// linked in at level start
+#define MAXNUMOFMODELSBUDGET	4096	// most the pool grows to ( "ModelBudget" config )
 #define NUMOFTITLEMODELS	32
 #define NUM_INTERLEVEL_MODELS 17
 #define	MAXMODELHEADERS		1024
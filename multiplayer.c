@@ -4,6 +4,7 @@
 //
 
 #include <stdio.h>
+#include <time.h>
 
 #include "main.h"
 #include "net.h"
@@ -111,8 +112,8 @@ extern	bool	CountDownOn;
 extern	float	GetPlayerNumCount1;
 extern	float	GetPlayerNumCount2;
 extern	int		GetPlayerNumCount;
-extern	FILE	*	DemoFp;
-extern	FILE	*	DemoFpClean;
+extern	DEMOSTREAM *	DemoFp;
+extern	DEMOSTREAM *	DemoFpClean;
 bool ChangeLevel( void );
 bool InitLevels( char *levels_list );
 extern	int16_t		LevelNum;
@@ -123,6 +124,7 @@ extern	LONGLONG	GameElapsedTime;		// when the game started
 extern	LIST	DemoList;
 extern	float Demoframelag;
 extern	LONGLONG	DemoTimeSoFar;
+extern	bool	DemoNameRecorded[ MAX_PLAYERS ];
 #endif
 
 extern	MENUITEM	JoinItem;
@@ -387,6 +389,7 @@ void StartAHostSession ( MENUITEM * Item )
 	{
 		u_int32_t mp_version = MULTIPLAYER_VERSION;
 		u_int32_t flags;
+		u_int32_t PackedInfo[ MAX_PICKUPFLAGS ];
 		time_t now_time;
 		struct tm *now;
 
@@ -408,8 +411,7 @@ void StartAHostSession ( MENUITEM * Item )
 				biker_name );
 		}
 #endif
-		DemoFp = file_open( DemoFileName( DemoGameName.text ) , "wb" );
-		setvbuf( DemoFp, NULL, _IONBF , 0 );		// size of stream buffer...
+		DemoFp = DemoStreamCreate( DemoFileName( DemoGameName.text ) );
 
 		Demo_fwrite( &mp_version, sizeof( mp_version ), 1, DemoFp );
 		flags = 0;
@@ -439,21 +441,8 @@ void StartAHostSession ( MENUITEM * Item )
 			}
 		}
 
-		// Best way I can Think of to send the Host Name to the demo file...
-		Temp = 1;
-		ms = 1;
-		Demo_fwrite( &ms, sizeof(LONGLONG), 1, DemoFp );
-		size = sizeof( NAMEMSG );
-		Demo_fwrite( &size, sizeof(int), 1, DemoFp );
-		Demo_fwrite( &Temp, sizeof(DWORD), 1, DemoFp );
-		msg = MSG_NAME;
-		Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );
-		msg = 0;
-		Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );				// Whos Name it is..
-		Demo_fwrite( &biker_name[0], 7, 1, DemoFp );
-		msg = 0;
-		Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );				// terminator for name..
-
+		// every name goes in the first time its player is recorded
+		memset( DemoNameRecorded, 0, sizeof( DemoNameRecorded ) );
 	}
 #endif
 	
@@ -57,6 +57,7 @@ num_frames : u_int16_t // number of animation frames
 #include "triggers.h"
 #include "pickups.h"
 #include "mxload.h"
+#include "file.h"
 #include "mxaload.h"
 
 #include "sfx.h"
@@ -818,7 +819,7 @@ void ReleaseMxaloadheader( MXALOADHEADER * Mxaloadheader )
 
 	if ( Mxaloadheader->OrgAddr )
 	{
-		free( Mxaloadheader->OrgAddr );
+		release_file_buffer( Mxaloadheader->OrgAddr );
 		Mxaloadheader->OrgAddr = NULL;
 	}
 	
@@ -862,7 +863,6 @@ extern	int16_t		LevelNum;
 bool PreMxaload( char * Filename, MXALOADHEADER * Mxaloadheaders, int header_num, bool LevelSpecific )
 {
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	u_int16_t		*	Uint16Pnt;
 	int			i;
@@ -879,27 +879,11 @@ bool PreMxaload( char * Filename, MXALOADHEADER * Mxaloadheaders, int header_num
 	Mxaloadheader->state = false;
 	Mxaloadheader->Buffer = NULL;
 
-	File_Size = Get_File_Size( Filename );	
-
-	if( !File_Size )
-	{
-		Msg( "PreMxaload() File %s not found\n", Filename );
-		return( false );
-	}
-
-	Buffer = calloc( 1, File_Size + 32 );
+	Buffer = load_file_buffer( Filename, &File_Size, 32 );
 
 	if( Buffer == NULL )
 	{
-		Msg( "PreMxaload() Unable to allocate buffer in %s\n", Filename );
-		return( false );
-	}
-
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size )
-	{
-		Msg( "PreMxaload() Error reading %s\n", Filename );
+		Msg( "PreMxaload() Error loading %s\n", Filename );
 		return( false );
 	}
 
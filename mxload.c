@@ -49,6 +49,7 @@ mxtype : u_int16_t // always 0 for mx format
 #include "sfx.h"
 #include "spotfx.h"
 #include "util.h"
+#include "file.h"
 #include "oct2.h"
 
 /*===================================================================
@@ -66,7 +67,7 @@ extern	DWORD				CurrentDestBlend;
 extern	DWORD				CurrentTextureBlend;
 
 extern	TLOADHEADER Tloadheader;
-extern	MODEL	Models[MAXNUMOFMODELS];
+extern	MODEL	*	Models;
 
 extern	bool	DrawPanel;
 extern	float	framelag;
@@ -164,6 +165,7 @@ bool Mxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool Sto
 
 	// Mxloadheader is not valid until everything has been done..
 	Mxloadheader->state = false;
+	Mxloadheader->PerModel = false;
 
 	if( Panel == true )
 	{
@@ -235,6 +237,10 @@ bool Mxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool Sto
 			/*	record how what type of exec buffer	*/
 			Mxloadheader->Group[group].exec_type[execbuf] = exec_type;
 
+			/*	ENV() rewrites the uvs for every model drawn	*/
+			if( exec_type & HASENVIROMENTMAP )
+				Mxloadheader->PerModel = true;
+
 			/*	record how many verts there are in the exec buffer	*/
 			Mxloadheader->Group[group].num_verts_per_execbuf[execbuf] = num_vertices;
 
@@ -521,6 +527,8 @@ bool Mxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool Sto
 
 			Mxloadheader->Group[group].renderObject[execbuf].numTextureGroups = num_texture_groups;
 
+			// one draw for all the tpages where the renderer can
+			FSMergeTextureGroups( &Mxloadheader->Group[group].renderObject[execbuf] );
 
 			/* update the renderObject */
 //			Mxloadheader->Group[ group ].renderObject[execbuf].numVerts = num_vertices;
@@ -829,18 +837,17 @@ bool Mxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool Sto
 	return( true );
 }
 /*===================================================================
-	Procedure	:		Execute all group buffers for a Mxloadheader
+	Procedure	:		Copy the new frame of every animating poly
+				:		of an execute buffer into its vertices
 	Input		;		MXLOADHEADER *
-				:		u_int16_t		Models[] Index
+				:		int				group
+				:		int				execute buffer
 	Output		:		FLASE/true
 ===================================================================*/
 
-bool ExecuteMxloadHeader( MXLOADHEADER * Mxloadheader, u_int16_t Model  )
+static bool AnimateMxloadPolys( MXLOADHEADER * Mxloadheader, int group, int i )
 {
-	int		i,e,f;
-	int		group;
-	RENDERMATRIX Matrix;
-	bool	Display;
+	int		e,f;
     LPLVERTEX	lpPointer = NULL;
 	LPLVERTEX	lpLVERTEX = NULL;
 	POLYANIM * PolyAnim;
@@ -848,60 +855,80 @@ bool ExecuteMxloadHeader( MXLOADHEADER * Mxloadheader, u_int16_t Model  )
 	TANIMUV * TanimUV;
 	bool	VertBufferLocked;
 
-	ModelTextureAnimation( Mxloadheader );
+	VertBufferLocked = false;
 
-	if (Mxloadheader->state == true )
+	if( Mxloadheader->Group[group].num_animating_polys[i] && Mxloadheader->AnimData.num_animations )
 	{
-		for ( group=0 ; group<Mxloadheader->num_groups ; group++)
+
+		PolyAnim = Mxloadheader->Group[group].polyanim[i];
+
+		for( f = 0 ; f < Mxloadheader->Group[group].num_animating_polys[i] ; f++ )
 		{
-			for ( i=0 ; i<Mxloadheader->Group[group].num_execbufs; i++)
-			{
-				VertBufferLocked = false;
 
-				if( Mxloadheader->Group[group].num_animating_polys[i] && Mxloadheader->AnimData.num_animations )
+			if( PolyAnim->currentframe != PolyAnim->newframe )
+			{
+				// something has changed....
+				if( !VertBufferLocked )
 				{
+					if (!(FSLockVertexBuffer(&Mxloadheader->Group[group].renderObject[i], &lpPointer)))
+					{
+						return false;
+					}
 
-					PolyAnim = Mxloadheader->Group[group].polyanim[i];
+					VertBufferLocked = true;
+				}
 
-					for( f = 0 ; f < Mxloadheader->Group[group].num_animating_polys[i] ; f++ )
-					{
+				u_int32Pnt = (u_int32_t *) PolyAnim->vert;
+				for( e = 0 ; e < PolyAnim->vertices ; e++ )
+				{
 
-						if( PolyAnim->currentframe != PolyAnim->newframe )
-						{
-							// something has changed....
-							if( !VertBufferLocked )
-							{
-								if (!(FSLockVertexBuffer(&Mxloadheader->Group[group].renderObject[i], &lpPointer)))
-								{
-									return false;
-								}
+					lpLVERTEX = lpPointer+ *u_int32Pnt++;
+					TanimUV = PolyAnim->UVs;
+					TanimUV += e + (PolyAnim->vertices * PolyAnim->newframe);
+					lpLVERTEX->tu = TanimUV->u;
+					lpLVERTEX->tv = TanimUV->v;
+				}
+				PolyAnim->currentframe = PolyAnim->newframe;
+			}
+			PolyAnim++;
+		}
+	}
+	if( VertBufferLocked )
+	{
+		// unlock it..
+		if (!(FSUnlockVertexBuffer(&Mxloadheader->Group[group].renderObject[i])))
+		{
+			return false;
+		}
+	}
+	return true;
+}
 
-								VertBufferLocked = true;
-							}
+/*===================================================================
+	Procedure	:		Execute all group buffers for a Mxloadheader
+	Input		;		MXLOADHEADER *
+				:		u_int16_t		Models[] Index
+	Output		:		FLASE/true
+===================================================================*/
 
-							u_int32Pnt = (u_int32_t *) PolyAnim->vert;
-							for( e = 0 ; e < PolyAnim->vertices ; e++ )
-							{
+bool ExecuteMxloadHeader( MXLOADHEADER * Mxloadheader, u_int16_t Model  )
+{
+	int		i;
+	int		group;
+	RENDERMATRIX Matrix;
+	bool	Display;
 
-								lpLVERTEX = lpPointer+ *u_int32Pnt++;
-								TanimUV = PolyAnim->UVs;
-								TanimUV += e + (PolyAnim->vertices * PolyAnim->newframe);
-								lpLVERTEX->tu = TanimUV->u;
-								lpLVERTEX->tv = TanimUV->v;
-							}
-							PolyAnim->currentframe = PolyAnim->newframe;
-						}
-						PolyAnim++;
-					}
-				}
-				if( VertBufferLocked )
+	ModelTextureAnimation( Mxloadheader );
+
+	if (Mxloadheader->state == true )
+	{
+		for ( group=0 ; group<Mxloadheader->num_groups ; group++)
+		{
+			for ( i=0 ; i<Mxloadheader->Group[group].num_execbufs; i++)
+			{
+				if( !AnimateMxloadPolys( Mxloadheader, group, i ) )
 				{
-					// unlock it..
-					if (!(FSUnlockVertexBuffer(&Mxloadheader->Group[group].renderObject[i])))
-					{
-						return false;
-					}
-					VertBufferLocked = false;
+					return false;
 				}
 
 				if( Mxloadheader->Group[group].exec_type[i]&HASTRANSPARENCIES )
@@ -1006,6 +1033,59 @@ bool ExecuteMxloadHeader( MXLOADHEADER * Mxloadheader, u_int16_t Model  )
 	return true;
 }
 
+/*===================================================================
+	Procedure	:		Execute all group buffers for a Mxloadheader
+				:		once for each of several models
+				:		The models may not touch the vertices of the
+				:		header themselves, no lighting and no Func
+				:		that processes the model, and the header may
+				:		not be PerModel ( see ModelDisp )
+	Input		;		MXLOADHEADER *
+				:		u_int16_t	*	Models[] Index of each model
+				:		RENDERMATRIX *	World matrix of each model
+				:		int				Number of models
+				:		u_int16_t		Group the models are clipped to
+	Output		:		FLASE/true
+===================================================================*/
+
+bool ExecuteMxloadHeaderInstances( MXLOADHEADER * Mxloadheader, u_int16_t * Model, RENDERMATRIX * Worlds, int Count, u_int16_t ClipGroup )
+{
+	int		i, m;
+	int		group;
+
+	ModelTextureAnimation( Mxloadheader );
+
+	if (Mxloadheader->state == true )
+	{
+		for ( group=0 ; group<Mxloadheader->num_groups ; group++)
+		{
+			for ( i=0 ; i<Mxloadheader->Group[group].num_execbufs; i++)
+			{
+				if( !AnimateMxloadPolys( Mxloadheader, group, i ) )
+				{
+					return false;
+				}
+
+				if( Mxloadheader->Group[group].exec_type[i]&HASTRANSPARENCIES )
+				{
+					for( m = 0 ; m < Count ; m++ )
+					{
+						AddTransExe( &Worlds[ m ], &Mxloadheader->Group[group].renderObject[i], 0, Model[ m ], ClipGroup, Mxloadheader->Group[ group ].num_verts_per_execbuf[i] );
+					}
+				}
+				else
+				{
+					if (!draw_object_instances( &Mxloadheader->Group[group].renderObject[i], Worlds, Count ))
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
 /*
  * ReleaseMxloadheader
  * Release Execute buffers
@@ -1085,7 +1165,7 @@ ReleaseMxloadheader( MXLOADHEADER * Mxloadheader )
 
 	if ( Mxloadheader->OrgAddr )
 	{
-		free( Mxloadheader->OrgAddr );
+		release_file_buffer( Mxloadheader->OrgAddr );
 		Mxloadheader->OrgAddr = NULL;
 	}
 
@@ -1104,7 +1184,6 @@ extern	int16_t		LevelNum;
 bool PreMxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool LevelSpecific )
 {
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	u_int16_t		*	Uint16Pnt;
 	int			i;
@@ -1128,27 +1207,11 @@ bool PreMxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool
 	}
 
 
-	File_Size = Get_File_Size( Filename );
-
-	if( !File_Size )
-	{
-		Msg( "PreMxload() File %s does not exist\n", Filename );
-		return( false );
-	}
-
-	Buffer = calloc( 1, File_Size + 32 );
+	Buffer = load_file_buffer( Filename, &File_Size, 32 );
 
 	if( Buffer == NULL )
 	{
-		Msg( "PreMxload() Allocate buffer for %s failed\n", Filename );
-		return( false );
-	}
-
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size )
-	{
-		Msg( "PreMxload() Error reading file %s\n", Filename );
+		Msg( "PreMxload() Error loading file %s\n", Filename );
 		return( false );
 	}
 
@@ -105,6 +105,7 @@ typedef struct MXLOADHEADER{
 	int					LOD;
 	VECTOR				Center;								// Center Pos
 	VECTOR				Sizes;								// X,Y,Z Sizes
+	bool				PerModel;							// env mapped or coloured per model, never instanced
 }MXLOADHEADER;
 
 /*
@@ -113,6 +114,7 @@ typedef struct MXLOADHEADER{
 bool PreMxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool LevelSpecific );
 bool Mxload( char * Filename, MXLOADHEADER * Mxloadheader , bool Panel, bool StoreTriangles );
 bool ExecuteMxloadHeader( MXLOADHEADER * Mxloadheader, u_int16_t Model );
+bool ExecuteMxloadHeaderInstances( MXLOADHEADER * Mxloadheader, u_int16_t * Model, RENDERMATRIX * Worlds, int Count, u_int16_t ClipGroup );
 
 void ReleaseMxloadheader( MXLOADHEADER * Mxloadheader );
 
@@ -36,6 +36,7 @@
 #include "net_tracker.h"
 #include "timer.h"
 #include "oct2.h"
+#include "util.h"
 
 
 BYTE WhoIAm = UNASSIGNED_SHIP;
@@ -173,8 +174,8 @@ extern	BYTE *	Buffer2Pnt;
 
 extern	bool	RecordDemo;
 extern	bool	PlayDemo;
-extern	FILE	*	DemoFp;
-extern	FILE	*	DemoFpClean;
+extern	DEMOSTREAM *	DemoFp;
+extern	DEMOSTREAM *	DemoFpClean;
 extern	LIST	DemoList;
 
 #ifdef DEMO_SUPPORT
@@ -224,6 +225,20 @@ extern	LONGLONG	GameStartedTime;
 extern	LONGLONG	GameElapsedTime;
 LONGLONG	TempTime;
 LONGLONG	DemoTimeSoFar = 0;
+LONGLONG	DemoCatchUpTime = 0;		// play without drawing until the demo gets here
+bool		DemoSeeking = false;		// applying the keyframe a seek landed on
+float		DemoKeyframeTimer = 0.0F;
+bool		DemoNameRecorded[ MAX_PLAYERS ];	// cleared when a recording starts
+
+#define	DEMO_KEYFRAME_INTERVAL	( 60.0F * 10.0F )	// every 10 seconds
+
+// who every message played back comes from
+static network_player_t DemoPlayer = { "", "", 0 };
+static BYTE ReceiveCommBuff[ MAX_BUFFER_SIZE ];
+
+extern	BGOBJECT *	FirstBGObjectUsed;
+
+static void DemoApplyKeyframe( BYTE * MsgPnt );
 #endif
 
 extern	u_int16_t		Seed1;
@@ -275,7 +290,7 @@ void SfxForCollectPickup( u_int16_t Owner, u_int16_t ID );
 
 void CreateReGen( u_int16_t ship );
 bool InitLevels( char *levels_list );
-extern	MODEL	Models[MAXNUMOFMODELS];
+extern	MODEL	*	Models;
 
 bool	HostDuties = false;
 bool					IsHost = true;
@@ -721,6 +736,19 @@ void NetworkGameUpdate()
 				}
 			}
 		}
+
+#ifdef DEMO_SUPPORT
+		// so playback can start from here
+		if( RecordDemo && ( MyGameStatus == STATUS_Normal ) )
+		{
+			DemoKeyframeTimer -= framelag;
+			if( DemoKeyframeTimer <= 0.0F )
+			{
+				DemoKeyframeTimer = DEMO_KEYFRAME_INTERVAL;
+				DemoKeyframe();
+			}
+		}
+#endif
 	}
 
 	// The Host can Dynamicaly change settings
@@ -1434,14 +1462,15 @@ void network_event_new_message( network_player_t * from, BYTE * data, int size )
 {
 	//DebugPrintf("network_event_new_message: type = %s\n",msg_to_str(*data));
 #ifdef DEMO_SUPPORT
-	QueryPerformanceCounter((LARGE_INTEGER *) &TempTime);
 	if( RecordDemo && ( MyGameStatus == STATUS_Normal ) )
 	{
+		DPID from_id = DEMO_PLAYER_ID;
+		QueryPerformanceCounter((LARGE_INTEGER *) &TempTime);
 		TempTime -= GameStartedTime;
-		Demo_fwrite( &TempTime, sizeof(LONGLONG), 1, DemoFp );
+		Demo_fwrite_time( &TempTime, DemoFp );
 		Demo_fwrite( &size, sizeof(size), 1, DemoFp );
-		Demo_fwrite( &from_network_id, sizeof(from_network_id), 1, DemoFp );
-		Demo_fwrite( MsgPnt, nBytes , 1, DemoFp );
+		Demo_fwrite( &from_id, sizeof(DPID), 1, DemoFp );
+		Demo_fwrite( data, size, 1, DemoFp );
 	}
 #endif
 	RecPacketSize = size;
@@ -2168,22 +2197,7 @@ void EvaluateMessage( network_player_t * from, DWORD len , BYTE * MsgPnt )
 					OverallGameStatus = lpVeryShortUpdate->ShortGlobalShip.Status;
 				
 #ifdef DEMO_SUPPORT
-					if( CheckForName( lpVeryShortUpdate->WhoIAm ) )
-					{
-						if( RecordDemo )
-						{
-							// Best way I can Think of to send the names to the demo file...
-							TempTime = 1;
-							Demo_fwrite( &TempTime, sizeof(LONGLONG), 1, DemoFp );
-							size = sizeof( NAMEMSG );
-							Demo_fwrite( &size, sizeof(int), 1, DemoFp );
-							Demo_fwrite( &my_network_id, sizeof(DPID), 1, DemoFp );
-							msg = MSG_NAME;
-							Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );
-							Demo_fwrite( &lpVeryShortUpdate->WhoIAm, sizeof(BYTE), 1, DemoFp );
-							Demo_fwrite( &Names[lpVeryShortUpdate->WhoIAm][0], 8, 1, DemoFp );
-						}
-					}
+					DemoRecordName( lpVeryShortUpdate->WhoIAm );
 #endif
 
 				if( ( OldMode == DEATH_MODE ) && ( Ships[lpVeryShortUpdate->WhoIAm].Object.Mode == LIMBO_MODE ) ||
@@ -2267,22 +2281,7 @@ void EvaluateMessage( network_player_t * from, DWORD len , BYTE * MsgPnt )
 					OverallGameStatus = lpUpdate->ShortGlobalShip.Status;
 
 #ifdef DEMO_SUPPORT
-					if( CheckForName( lpUpdate->WhoIAm ) )
-					{
-						if( RecordDemo )
-						{
-							// Best way I can Think of to send the names to the demo file...
-							TempTime = 1;
-							Demo_fwrite( &TempTime, sizeof(LONGLONG), 1, DemoFp );
-							size = sizeof( NAMEMSG );
-							Demo_fwrite( &size, sizeof(int), 1, DemoFp );
-							Demo_fwrite( &my_network_id, sizeof(DPID), 1, DemoFp );
-							msg = MSG_NAME;
-							Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );
-							Demo_fwrite( &lpUpdate->WhoIAm, sizeof(BYTE), 1, DemoFp );
-							Demo_fwrite( &Names[lpUpdate->WhoIAm][0], 8, 1, DemoFp );
-						}
-					}
+					DemoRecordName( lpUpdate->WhoIAm );
 #endif
 
 				if( ( OldMode == DEATH_MODE ) && ( Ships[lpUpdate->WhoIAm].Object.Mode == LIMBO_MODE ) ||
@@ -3001,25 +3000,7 @@ void EvaluateMessage( network_player_t * from, DWORD len , BYTE * MsgPnt )
 			UpdatePlayer( from, lpStatus->WhoIAm );
 
 #ifdef DEMO_SUPPORT
-			if( !PlayDemo )
-			{
-				if( CheckForName( lpStatus->WhoIAm ) )
-				{
-					if( RecordDemo )
-					{
-						// Best way I can Think of to send the names to the demo file...
-						TempTime = 1;
-						Demo_fwrite( &TempTime, sizeof(LONGLONG), 1, DemoFp );
-						size = sizeof( NAMEMSG );
-						Demo_fwrite( &size, sizeof(int), 1, DemoFp );
-						Demo_fwrite( &my_network_id, sizeof(DPID), 1, DemoFp );
-						msg = MSG_NAME;
-						Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );
-						Demo_fwrite( &lpStatus->WhoIAm, sizeof(BYTE), 1, DemoFp );
-						Demo_fwrite( &Names[lpStatus->WhoIAm][0], 8, 1, DemoFp );
-					}
-				}
-			}
+			DemoRecordName( lpStatus->WhoIAm );
 #endif
 		}
 
@@ -3117,25 +3098,7 @@ void EvaluateMessage( network_player_t * from, DWORD len , BYTE * MsgPnt )
 		UpdatePlayer( from, lpLongStatus->WhoIAm );
 
 #ifdef DEMO_SUPPORT
-		if( !PlayDemo )
-		{
-			if( CheckForName( lpLongStatus->WhoIAm ) )
-			{
-				if( RecordDemo )
-				{
-					// Best way I can Think of to send the names to the demo file...
-					TempTime = 1;
-					Demo_fwrite( &TempTime, sizeof(LONGLONG), 1, DemoFp );
-					size = sizeof( NAMEMSG );
-					Demo_fwrite( &size, sizeof(int), 1, DemoFp );
-					Demo_fwrite( &my_network_id, sizeof(DPID), 1, DemoFp );
-					msg = MSG_NAME;
-					Demo_fwrite( &msg, sizeof(BYTE), 1, DemoFp );
-					Demo_fwrite( &lpLongStatus->WhoIAm, sizeof(BYTE), 1, DemoFp );
-					Demo_fwrite( &Names[lpLongStatus->WhoIAm][0], 8, 1, DemoFp );
-				}
-			}
-		}
+		DemoRecordName( lpLongStatus->WhoIAm );
 #endif
 
 		return;
@@ -4228,11 +4191,13 @@ send:
 		&& ( msg != MSG_SHORTTRIGVAR   ) 
 		&& ( msg != MSG_SHORTMINE      ) )
 		{
+			DPID from_id = DEMO_PLAYER_ID;
+			DemoRecordName( WhoIAm );
 			QueryPerformanceCounter((LARGE_INTEGER *) &TempTime);
 			TempTime = TempTime - GameStartedTime;
-			Demo_fwrite( &TempTime, sizeof(LONGLONG), 1, DemoFp );
+			Demo_fwrite_time( &TempTime, DemoFp );
 			Demo_fwrite( &nBytes, sizeof(int), 1, DemoFp );
-			Demo_fwrite( &my_network_id, sizeof(DPID), 1, DemoFp );
+			Demo_fwrite( &from_id, sizeof(DPID), 1, DemoFp );
 			Demo_fwrite( &CommBuff[0], nBytes, 1, DemoFp );
 		}
 	}
@@ -4259,6 +4224,8 @@ void DemoPlayingNetworkGameUpdate()
 {
 #ifdef DEMO_SUPPORT
     DWORD               nBytes;
+	DPID				from;
+	LPDEMONAMEMSG		lpDemoName;
 	int i;
 	size_t	size;
 
@@ -4268,9 +4235,9 @@ void DemoPlayingNetworkGameUpdate()
 		{
 			if( DemoTimeSoFar > GameElapsedTime )
 			{
-			 	if (ferror(DemoFp) || feof(DemoFp) )
+			 	if (DemoStreamEnd( DemoFp ) )
 				{
-					fclose( DemoFp );
+					DemoStreamClose( DemoFp );
 					DemoFp = NULL;
 					SpecialDestroyGame();
 					return;
@@ -4278,8 +4245,8 @@ void DemoPlayingNetworkGameUpdate()
 				return;
 			}
 		}else{
-			size = fread( &DemoTimeSoFar , sizeof(LONGLONG), 1, DemoFp );
-			if( size != 1 || ferror(DemoFp) || feof(DemoFp) ) 
+			size = DemoStreamRead( &DemoTimeSoFar , sizeof(LONGLONG), 1, DemoFp );
+			if( size != 1 || DemoStreamEnd( DemoFp ) ) 
 			{
 				PreDemoEndMyGameStatus = MyGameStatus;
 
@@ -4290,7 +4257,7 @@ void DemoPlayingNetworkGameUpdate()
 								
 				QueryPerformanceCounter((LARGE_INTEGER *) &DemoEndedTime);
 
-				fclose( DemoFp );
+				DemoStreamClose( DemoFp );
 				DemoFp = NULL;
 
 				SpecialDestroyGame();
@@ -4310,12 +4277,44 @@ void DemoPlayingNetworkGameUpdate()
 				return;
 		}
 		
-		fread( &nBytes , sizeof(DWORD), 1, DemoFp );
-		fread( &from_network_id , sizeof(DPID), 1, DemoFp );
-		fread( &ReceiveCommBuff[0] , nBytes , 1, DemoFp );
+		DemoStreamRead( &nBytes , sizeof(DWORD), 1, DemoFp );
+		DemoStreamRead( &from , sizeof(DPID), 1, DemoFp );
+
+		// a size no message can have means the rest can't be trusted
+		if( ( nBytes > sizeof( ReceiveCommBuff ) ) ||
+			( nBytes && ( DemoStreamRead( &ReceiveCommBuff[0] , nBytes , 1, DemoFp ) != 1 ) ) )
+		{
+			DebugPrintf("DemoPlayingNetworkGameUpdate: bad message of %u bytes\n", (unsigned int) nBytes );
+			DemoStreamClose( DemoFp );
+			DemoFp = NULL;
+			SpecialDestroyGame();
+			return;
+		}
 		
-		// During Demo Playback we dont want to interperate any System messages....
-		if ( from_network_id != DPID_SYSMSG ) EvaluateMessage( nBytes , &ReceiveCommBuff[0] );
+		// keyframes only matter when a seek lands on one, otherwise
+		// the world is already in that state
+		if( from == DEMO_KEYFRAME_ID )
+		{
+			if( DemoSeeking )
+				DemoApplyKeyframe( &ReceiveCommBuff[0] );
+		}
+		else
+		{
+			DemoSeeking = false;
+
+			// During Demo Playback we dont want to interperate any System messages....
+			if( ( from != DPID_SYSMSG ) && nBytes )
+			{
+				if( ReceiveCommBuff[0] == MSG_DEMONAME )
+				{
+					lpDemoName = (LPDEMONAMEMSG) &ReceiveCommBuff[0];
+					if( nBytes == sizeof( DEMONAMEMSG ) )
+						set_player_name( lpDemoName->WhoIAm, &lpDemoName->Name[0] );
+				}
+				else
+					EvaluateMessage( &DemoPlayer, nBytes , &ReceiveCommBuff[0] );
+			}
+		}
 		DemoTimeSoFar = 0;
 
   
@@ -4329,14 +4328,15 @@ void DemoPlayingNetworkGameUpdate()
 						scan ahead to find the next one and write in a
 						interpolate msg..
 	Input		:		nothing
-	Output		:		nothing
+	Output		:		int		1 cleaned, 0 it already was, -1 a message was bad
 ===================================================================*/
-void DemoClean( void )
+int DemoClean( void )
 {
 #ifdef DEMO_SUPPORT
     DWORD       nBytes;
+	DPID		from;
 	size_t		size;
-	fpos_t		Currentpos; 
+	int64_t		Currentpos;
 	LONGLONG	DemoTimeSoFar2;
 	DPID		from_dcoID2;
     DWORD       nBytes2;
@@ -4348,15 +4348,30 @@ void DemoClean( void )
 	VERYSHORTINTERPOLATEMSG VeryShortInterpolate;
 	bool		IsShortPackets = false;
 	int			FoundOne;
+	bool		InKeyframe = false;
 
 	while(1)
 	{
-		size = fread( &DemoTimeSoFar , sizeof(LONGLONG), 1, DemoFp );
+		size = DemoStreamRead( &DemoTimeSoFar , sizeof(LONGLONG), 1, DemoFp );
    		// check for end of file...
-		if( !size )	return;
-		fread( &nBytes , sizeof(DWORD), 1, DemoFp );
-		fread( &from_network_id , sizeof(DPID), 1, DemoFp );
-		fread( &CommBuff[0] , nBytes , 1, DemoFp );
+		if( !size )	return 1;
+		DemoStreamRead( &nBytes , sizeof(DWORD), 1, DemoFp );
+		DemoStreamRead( &from , sizeof(DPID), 1, DemoFp );
+		if( !nBytes || ( nBytes > sizeof( CommBuff ) ) ||
+			( DemoStreamRead( &CommBuff[0] , nBytes , 1, DemoFp ) != 1 ) )
+			return -1;
+
+		// keyframes go through untouched and still start their own block
+		if( from == DEMO_KEYFRAME_ID )
+		{
+			if( !InKeyframe )
+				DemoStreamKeyframe( DemoFpClean, DemoTimeSoFar );
+			InKeyframe = true;
+		}
+		else
+		{
+			InKeyframe = false;
+		}
 
 #if 0
 		// Special model num correction stuff...And Power Level Stuff
@@ -4371,19 +4386,21 @@ void DemoClean( void )
 #endif
 		
 		// write out the message..
-		fwrite( &DemoTimeSoFar, sizeof(LONGLONG), 1, DemoFpClean );
-		fwrite( &nBytes, sizeof(int), 1, DemoFpClean );
-		fwrite( &from_network_id, sizeof(DPID), 1, DemoFpClean );
-		fwrite( &CommBuff[0], nBytes, 1, DemoFpClean );
-
-		if ( ( from_network_id != DPID_SYSMSG ) && ( CommBuff[0] == MSG_INTERPOLATE ) )
+		DemoStreamMark( DemoFpClean, DemoTimeSoFar );
+		DemoStreamWrite( &DemoTimeSoFar, sizeof(LONGLONG), 1, DemoFpClean );
+		DemoStreamWrite( &nBytes, sizeof(int), 1, DemoFpClean );
+		DemoStreamWrite( &from, sizeof(DPID), 1, DemoFpClean );
+		DemoStreamWrite( &CommBuff[0], nBytes, 1, DemoFpClean );
+
+		if ( ( from != DPID_SYSMSG ) && ( ( CommBuff[0] == MSG_INTERPOLATE ) ||
+										  ( CommBuff[0] == MSG_VERYSHORTINTERPOLATE ) ) )
 		{
 			// Has allready been cleaned...
-			return;
+			return 0;
 		}
 
 		// check if its an update message....
-		if ( ( from_network_id != DPID_SYSMSG ) && ( ( CommBuff[0] == MSG_UPDATE ) ||
+		if ( ( from != DPID_SYSMSG ) && ( ( CommBuff[0] == MSG_UPDATE ) ||
 												( CommBuff[0] == MSG_FUPDATE ) ||
 												( CommBuff[0] == MSG_VERYSHORTUPDATE ) ||
 												( CommBuff[0] == MSG_VERYSHORTFUPDATE ) ) )
@@ -4412,12 +4429,12 @@ void DemoClean( void )
 				IsShortPackets = true;
 				break;
 			}
-			fgetpos( DemoFp , &Currentpos );	// store the current position..so we can go back to it..
+			Currentpos = DemoStreamTell( DemoFp );	// store the current position..so we can go back to it..
 
 			FoundOne = 0;
 			while( FoundOne == 0 )
 			{
-				size = fread( &DemoTimeSoFar2 , sizeof(LONGLONG), 1, DemoFp );
+				size = DemoStreamRead( &DemoTimeSoFar2 , sizeof(LONGLONG), 1, DemoFp );
 				// check for end of file...
 				if( !size )
 				{
@@ -4425,9 +4442,14 @@ void DemoClean( void )
 					break;
 				}
 
-				fread( &nBytes2 , sizeof(DWORD), 1, DemoFp );
-				fread( &from_dcoID2 , sizeof(DPID), 1, DemoFp );
-				fread( &CommBuff[0] , nBytes2 , 1, DemoFp );
+				DemoStreamRead( &nBytes2 , sizeof(DWORD), 1, DemoFp );
+				DemoStreamRead( &from_dcoID2 , sizeof(DPID), 1, DemoFp );
+				if( !nBytes2 || ( nBytes2 > sizeof( CommBuff ) ) ||
+					( DemoStreamRead( &CommBuff[0] , nBytes2 , 1, DemoFp ) != 1 ) )
+				{
+					FoundOne = -1;
+					break;
+				}
 
 
 				if ( ( from_dcoID2 != DPID_SYSMSG ) && ( ( CommBuff[0] == MSG_UPDATE ) ||
@@ -4500,23 +4522,27 @@ void DemoClean( void )
 			{
 				if( !IsShortPackets )
 				{
-					fwrite( &DemoTimeSoFar, sizeof(LONGLONG), 1, DemoFpClean );
+					DemoStreamMark( DemoFpClean, DemoTimeSoFar );
+					DemoStreamWrite( &DemoTimeSoFar, sizeof(LONGLONG), 1, DemoFpClean );
 					nBytes = sizeof( INTERPOLATEMSG );
-					fwrite( &nBytes, sizeof(int), 1, DemoFpClean );
-					fwrite( &from_network_id, sizeof(DPID), 1, DemoFpClean );
-					fwrite( &Interpolate, nBytes, 1, DemoFpClean );
+					DemoStreamWrite( &nBytes, sizeof(int), 1, DemoFpClean );
+					DemoStreamWrite( &from, sizeof(DPID), 1, DemoFpClean );
+					DemoStreamWrite( &Interpolate, nBytes, 1, DemoFpClean );
 				}else{
-					fwrite( &DemoTimeSoFar, sizeof(LONGLONG), 1, DemoFpClean );
+					DemoStreamMark( DemoFpClean, DemoTimeSoFar );
+					DemoStreamWrite( &DemoTimeSoFar, sizeof(LONGLONG), 1, DemoFpClean );
 					nBytes = sizeof( VERYSHORTINTERPOLATEMSG );
-					fwrite( &nBytes, sizeof(int), 1, DemoFpClean );
-					fwrite( &from_network_id, sizeof(DPID), 1, DemoFpClean );
-					fwrite( &VeryShortInterpolate, nBytes, 1, DemoFpClean );
+					DemoStreamWrite( &nBytes, sizeof(int), 1, DemoFpClean );
+					DemoStreamWrite( &from, sizeof(DPID), 1, DemoFpClean );
+					DemoStreamWrite( &VeryShortInterpolate, nBytes, 1, DemoFpClean );
 				}
 			}
 			// set the position of the file back...
-			fsetpos( DemoFp , &Currentpos );
+			DemoStreamSeek( DemoFp, Currentpos );
 		}
 	}
+#else
+	return -1;
 #endif
 }
 
@@ -4580,11 +4606,375 @@ int FindSameLevel( char * Name )
 	return -1;
 }
 
-void Demo_fwrite( const void *buffer, size_t size, size_t count , FILE *stream )
+void Demo_fwrite( const void *buffer, size_t size, size_t count , DEMOSTREAM *stream )
 {
 	if( !RecordDemo || !DemoFp )
 		return;
-	fwrite( buffer, size , count , stream );
+	DemoStreamWrite( buffer, size , count , stream );
+}
+
+// every record starts with its time, which is where a block can be cut
+void Demo_fwrite_time( int64_t *time, DEMOSTREAM *stream )
+{
+	if( !RecordDemo || !DemoFp )
+		return;
+	DemoStreamMark( stream, *time );
+	DemoStreamWrite( time, sizeof(int64_t), 1, stream );
+}
+
+/*===================================================================
+	Procedure	:		Write a player's name to the demo being recorded
+						the first time anything is recorded about them
+	Input		:		BYTE	Player
+	Output		:		nothing
+===================================================================*/
+void DemoRecordName( BYTE Player )
+{
+#ifdef DEMO_SUPPORT
+	DEMONAMEMSG	Name;
+	DPID		from = DEMO_PLAYER_ID;
+	int			nBytes = sizeof( DEMONAMEMSG );
+	LONGLONG	Time;
+
+	if( !RecordDemo || !DemoFp || ( MyGameStatus != STATUS_Normal ) )
+		return;
+	if( ( Player >= MAX_PLAYERS ) || DemoNameRecorded[ Player ] || !Names[ Player ][ 0 ] )
+		return;
+	DemoNameRecorded[ Player ] = true;
+
+	Name.MsgCode = MSG_DEMONAME;
+	Name.WhoIAm = Player;
+	memcpy( &Name.Name[0], &Names[ Player ][0], MAXSHORTNAME );
+
+	QueryPerformanceCounter((LARGE_INTEGER *) &Time);
+	Time -= GameStartedTime;
+	Demo_fwrite_time( &Time, DemoFp );
+	Demo_fwrite( &nBytes, sizeof(int), 1, DemoFp );
+	Demo_fwrite( &from, sizeof(DPID), 1, DemoFp );
+	Demo_fwrite( &Name, nBytes, 1, DemoFp );
+#endif
+}
+
+#ifdef DEMO_SUPPORT
+// a player's scores and kills, kept here rather than in networking.h
+// as the weapon tables are sized by primary.h and secondary.h
+typedef struct _DEMOSTATSMSG
+{
+    BYTE        MsgCode;
+    BYTE        WhoIAm;
+	int			Bonus;
+	int			KillCounter;
+	int			Kills[MAX_PLAYERS];
+	int			Primary[MAXPRIMARYWEAPONS+1];
+	int			Secondary[TOTALSECONDARYWEAPONS];
+} DEMOSTATSMSG, *LPDEMOSTATSMSG;
+
+/*===================================================================
+	Procedure	:		Write one record of a keyframe
+	Input		:		LONGLONG	*	Time
+				:		void		*	Message
+				:		int				Size of the message
+				:		bool		*	Still to write the first record
+	Output		:		nothing
+===================================================================*/
+static void DemoKeyframeRecord( LONGLONG * Time, void * Msg, int nBytes, bool * First )
+{
+	DPID	from = DEMO_KEYFRAME_ID;
+
+	if( *First )
+	{
+		DemoStreamKeyframe( DemoFp, *Time );
+		*First = false;
+	}
+	Demo_fwrite_time( Time, DemoFp );
+	Demo_fwrite( &nBytes, sizeof(int), 1, DemoFp );
+	Demo_fwrite( &from, sizeof(DPID), 1, DemoFp );
+	Demo_fwrite( Msg, nBytes, 1, DemoFp );
+}
+
+/*===================================================================
+	Procedure	:		Put the world into the state of one keyframe record
+	Input		:		BYTE	*	Message
+	Output		:		nothing
+===================================================================*/
+static void DemoApplyKeyframe( BYTE * MsgPnt )
+{
+	LPDEMOSHIPSTATEMSG		lpShipState;
+	LPDEMOSTATSMSG			lpStats;
+	LPSHORTPICKUPMSG		lpShortPickup;
+	LPSHORTREGENSLOTMSG		lpShortRegenSlot;
+	LPSHORTTRIGGERMSG		lpShortTrigger;
+	LPSHORTTRIGVARMSG		lpShortTrigVar;
+	LPSHORTMINEMSG			lpShortMine;
+	LPBGOUPDATEMSG			lpBGOUpdate;
+	u_int16_t				i;
+
+	switch( *MsgPnt )
+	{
+	case MSG_DEMOSHIPSTATE:
+		lpShipState = (LPDEMOSHIPSTATEMSG) MsgPnt;
+		i = lpShipState->WhoIAm;
+		if( i >= MAX_PLAYERS )
+			return;
+		Ships[i].enable				= lpShipState->enable;
+		GameStatus[i]				= lpShipState->Status;
+		TeamNumber[i]				= lpShipState->Team;
+		Ships[i].Object.Mode		= lpShipState->Mode;
+		Ships[i].Primary			= lpShipState->Primary;
+		Ships[i].Secondary			= lpShipState->Secondary;
+		Ships[i].Object.Group		= lpShipState->Group;
+		Ships[i].Object.Flags		= lpShipState->Flags;
+		Ships[i].Object.Pos			= lpShipState->Pos;
+		Ships[i].Object.Quat		= lpShipState->Quat;
+		Ships[i].Object.Bank		= lpShipState->Bank;
+		Ships[i].Object.Shield		= lpShipState->Shield;
+		Ships[i].Object.Hull		= lpShipState->Hull;
+		Ships[i].PrimPowerLevel		= lpShipState->PrimPowerLevel;
+		Ships[i].DemoInterpolate	= false;
+		if( lpShipState->enable )
+			DemoShipInit[i] = true;
+		return;
+
+	case MSG_DEMOSTATS:
+		lpStats = (LPDEMOSTATSMSG) MsgPnt;
+		if( lpStats->WhoIAm >= MAX_PLAYERS )
+			return;
+		SetPlayerStats( lpStats->WhoIAm, &lpStats->Kills[0], &lpStats->Primary[0], &lpStats->Secondary[0],
+						lpStats->Bonus, lpStats->KillCounter );
+		return;
+
+	case MSG_SHORTPICKUP:
+		lpShortPickup = (LPSHORTPICKUPMSG) MsgPnt;
+		RegenPickupList( &lpShortPickup->ShortPickup[0], lpShortPickup->HowManyPickups );
+		return;
+
+	case MSG_SHORTREGENSLOT:
+		lpShortRegenSlot = (LPSHORTREGENSLOTMSG) MsgPnt;
+		RegenRegenSlotList( &lpShortRegenSlot->ShortRegenSlot[0], lpShortRegenSlot->HowManyRegenSlots );
+		return;
+
+	case MSG_SHORTTRIGGER:
+		lpShortTrigger = (LPSHORTTRIGGERMSG) MsgPnt;
+		RegenTriggerList( &lpShortTrigger->ShortTrigger[0], lpShortTrigger->HowManyTriggers );
+		return;
+
+	case MSG_SHORTTRIGVAR:
+		lpShortTrigVar = (LPSHORTTRIGVARMSG) MsgPnt;
+		RegenTrigVarList( &lpShortTrigVar->ShortTrigVar[0], lpShortTrigVar->HowManyTrigVars );
+		return;
+
+	case MSG_SHORTMINE:
+		lpShortMine = (LPSHORTMINEMSG) MsgPnt;
+		RegenMineList( &lpShortMine->ShortMine[0], lpShortMine->HowManyMines );
+		return;
+
+	case MSG_BGOUPDATE:
+		lpBGOUpdate = (LPBGOUPDATEMSG) MsgPnt;
+		UpdateBGObject( lpBGOUpdate->BGOUpdateInfo.BGObject,
+						lpBGOUpdate->BGOUpdateInfo.State,
+						lpBGOUpdate->BGOUpdateInfo.Time );
+		return;
+	}
+}
+#endif
+
+/*===================================================================
+	Procedure	:		Write a keyframe to the demo being recorded,
+						everything the host sends a joining player,
+						where every ship is and the scores, so playback
+						can start here
+	Input		:		nothing
+	Output		:		nothing
+===================================================================*/
+void DemoKeyframe( void )
+{
+#ifdef DEMO_SUPPORT
+	static DEMOSHIPSTATEMSG		ShipState;
+	static DEMOSTATSMSG			Stats;
+	static SHORTPICKUPMSG		ShortPickup;
+	static SHORTREGENSLOTMSG	ShortRegenSlot;
+	static SHORTTRIGGERMSG		ShortTrigger;
+	static SHORTTRIGVARMSG		ShortTrigVar;
+	static SHORTMINEMSG			ShortMine;
+	BGOUPDATEMSG				BGOUpdate;
+	BGOBJECT				*	Object;
+	LONGLONG					Time;
+	bool						First = true;
+	BYTE						Section;
+	int							i;
+
+	if( !RecordDemo || !DemoFp )
+		return;
+
+	QueryPerformanceCounter((LARGE_INTEGER *) &Time);
+	Time -= GameStartedTime;
+
+	for( i = 0 ; i < MAX_PLAYERS ; i++ )
+	{
+		ShipState.MsgCode			= MSG_DEMOSHIPSTATE;
+		ShipState.WhoIAm			= (BYTE) i;
+		ShipState.enable			= Ships[i].enable;
+		ShipState.Status			= GameStatus[i];
+		ShipState.Team				= TeamNumber[i];
+		ShipState.Mode				= Ships[i].Object.Mode;
+		ShipState.Primary			= Ships[i].Primary;
+		ShipState.Secondary			= Ships[i].Secondary;
+		ShipState.Group				= Ships[i].Object.Group;
+		ShipState.Flags				= Ships[i].Object.Flags;
+		ShipState.Pos				= Ships[i].Object.Pos;
+		ShipState.Quat				= Ships[i].Object.Quat;
+		ShipState.Bank				= Ships[i].Object.Bank;
+		ShipState.Shield			= Ships[i].Object.Shield;
+		ShipState.Hull				= Ships[i].Object.Hull;
+		ShipState.PrimPowerLevel	= Ships[i].PrimPowerLevel;
+		DemoKeyframeRecord( &Time, &ShipState, sizeof( DEMOSHIPSTATEMSG ), &First );
+	}
+
+	// seeking back has to take the scores back too
+	for( i = 0 ; i < MAX_PLAYERS ; i++ )
+	{
+		Stats.MsgCode				= MSG_DEMOSTATS;
+		Stats.WhoIAm				= (BYTE) i;
+		GetPlayerStats( i, &Stats.Kills[0], &Stats.Primary[0], &Stats.Secondary[0],
+						&Stats.Bonus, &Stats.KillCounter );
+		DemoKeyframeRecord( &Time, &Stats, sizeof( DEMOSTATSMSG ), &First );
+	}
+
+	// the lists are built from a copy kept in my own slot,
+	// nobody joining can ever be sent that one
+	CopyPickups(	(u_int16_t) WhoIAm );
+	CopyRegenSlots( (u_int16_t) WhoIAm );
+	CopyTriggers(	(u_int16_t) WhoIAm );
+	CopyTrigVars(	(u_int16_t) WhoIAm );
+	CopyMines(		(u_int16_t) WhoIAm );
+
+	ShortPickup.MsgCode = MSG_SHORTPICKUP;
+	ShortPickup.WhoIAm = WhoIAm;
+	for( Section = ( ( MAXPICKUPS + ( MAXGENPICKUPCOUNT - 1 ) ) / MAXGENPICKUPCOUNT ) ; Section ; Section-- )
+	{
+		ShortPickup.Pickups = Section;
+		GenPickupList( (u_int16_t) WhoIAm, &ShortPickup.ShortPickup[0], &ShortPickup.HowManyPickups, Section );
+		if( ShortPickup.HowManyPickups )
+			DemoKeyframeRecord( &Time, &ShortPickup, sizeof( SHORTPICKUPMSG ), &First );
+	}
+
+	ShortRegenSlot.MsgCode = MSG_SHORTREGENSLOT;
+	ShortRegenSlot.WhoIAm = WhoIAm;
+	for( Section = ( ( NumRegenPoints + ( MAXGENREGENSLOTCOUNT - 1 ) ) / MAXGENREGENSLOTCOUNT ) ; Section ; Section-- )
+	{
+		ShortRegenSlot.RegenSlots = Section;
+		GenRegenSlotList( (u_int16_t) WhoIAm, &ShortRegenSlot.ShortRegenSlot[0], &ShortRegenSlot.HowManyRegenSlots, Section );
+		if( ShortRegenSlot.HowManyRegenSlots )
+			DemoKeyframeRecord( &Time, &ShortRegenSlot, sizeof( SHORTREGENSLOTMSG ), &First );
+	}
+
+	ShortTrigger.MsgCode = MSG_SHORTTRIGGER;
+	ShortTrigger.WhoIAm = WhoIAm;
+	for( Section = ( ( NumOfTriggers + ( MAXGENTRIGGERCOUNT - 1 ) ) / MAXGENTRIGGERCOUNT ) ; Section ; Section-- )
+	{
+		ShortTrigger.Triggers = Section;
+		GenTriggerList( (u_int16_t) WhoIAm, &ShortTrigger.ShortTrigger[0], &ShortTrigger.HowManyTriggers, Section );
+		if( ShortTrigger.HowManyTriggers )
+			DemoKeyframeRecord( &Time, &ShortTrigger, sizeof( SHORTTRIGGERMSG ), &First );
+	}
+
+	ShortTrigVar.MsgCode = MSG_SHORTTRIGVAR;
+	ShortTrigVar.WhoIAm = WhoIAm;
+	for( Section = ( ( NumOfTrigVars + ( MAXGENTRIGVARCOUNT - 1 ) ) / MAXGENTRIGVARCOUNT ) ; Section ; Section-- )
+	{
+		ShortTrigVar.TrigVars = Section;
+		GenTrigVarList( (u_int16_t) WhoIAm, &ShortTrigVar.ShortTrigVar[0], &ShortTrigVar.HowManyTrigVars, Section );
+		if( ShortTrigVar.HowManyTrigVars )
+			DemoKeyframeRecord( &Time, &ShortTrigVar, sizeof( SHORTTRIGVARMSG ), &First );
+	}
+
+	ShortMine.MsgCode = MSG_SHORTMINE;
+	ShortMine.WhoIAm = WhoIAm;
+	for( Section = ( ( MAXSECONDARYWEAPONBULLETS + ( MAXGENMINECOUNT - 1 ) ) / MAXGENMINECOUNT ) ; Section ; Section-- )
+	{
+		ShortMine.Mines = Section;
+		GenMineList( (u_int16_t) WhoIAm, &ShortMine.ShortMine[0], &ShortMine.HowManyMines, Section );
+		if( ShortMine.HowManyMines )
+			DemoKeyframeRecord( &Time, &ShortMine, sizeof( SHORTMINEMSG ), &First );
+	}
+
+	BGOUpdate.MsgCode = MSG_BGOUPDATE;
+	BGOUpdate.WhoIAm = WhoIAm;
+	for( Object = FirstBGObjectUsed ; Object ; Object = Object->NextUsed )
+	{
+		BGOUpdate.BGOUpdateInfo.BGObject = Object->Index;
+		BGOUpdate.BGOUpdateInfo.State = Object->State;
+		BGOUpdate.BGOUpdateInfo.Time = Object->Time;
+		DemoKeyframeRecord( &Time, &BGOUpdate, sizeof( BGOUPDATEMSG ), &First );
+	}
+#endif
+}
+
+/*===================================================================
+	Procedure	:		Jump demo playback to a time, from the last
+						keyframe before it running on undrawn until
+						the demo gets there
+	Input		:		int64_t		Time since the game started
+	Output		:		bool		false if there's nowhere to start from
+===================================================================*/
+bool DemoSeek( int64_t Time )
+{
+#ifdef DEMO_SUPPORT
+	LONGLONG	Found;
+	int			i;
+
+	if( !PlayDemo || !DemoFp )
+		return false;
+
+	if( Time < 0 )
+		Time = 0;
+
+	// going forward with no keyframe in between is quicker played through
+	if( ( Time >= GameElapsedTime ) &&
+		( !DemoStreamFindKeyframe( DemoFp, Time, &Found ) || ( Found <= GameElapsedTime ) || ( Found > Time ) ) )
+	{
+		DemoCatchUpTime = Time;
+		return true;
+	}
+
+	if( !DemoStreamSeekTime( DemoFp, Time, &Found ) )
+		return false;
+
+	// the keyframe brings back everything that lasts, the rest goes
+	KillAllPickups();
+	for( i = 0 ; i < MAX_PLAYERS ; i++ )
+	{
+		KillOwnersSecBulls( (u_int16_t) i );
+		KillPrimBullsByOwner( OWNER_SHIP, (u_int16_t) i );
+	}
+
+	GameElapsedTime = Found;
+	DemoTimeSoFar = 0;
+	DemoSeeking = true;
+	DemoCatchUpTime = Time;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*===================================================================
+	Procedure	:		Skip demo playback forward or back
+	Input		:		float		Seconds
+	Output		:		nothing
+===================================================================*/
+void DemoSkip( float Seconds )
+{
+#ifdef DEMO_SUPPORT
+	LONGLONG	From;
+
+	if( !Freq )
+		QueryPerformanceFrequency((LARGE_INTEGER *) &Freq);
+
+	// keep skipping from where the last skip was going
+	From = ( DemoCatchUpTime > GameElapsedTime ) ? DemoCatchUpTime : GameElapsedTime;
+	DemoSeek( From + (LONGLONG) ( Seconds * (float) Freq ) );
+#endif
 }
 
 
@@ -4597,10 +4987,13 @@ void StopDemoRecording( void )
 {
 	if( DemoFp )	// make sure that changing level stop any demo from recording!!!!
 	{
-		fclose( DemoFp );
+		DemoStreamClose( DemoFp );
 		DemoFp = NULL;
 		RecordDemo = false;
 		PlayDemo = false;
+#ifdef DEMO_SUPPORT
+		DemoKeyframeTimer = 0.0F;
+#endif
 	}
 }
 
@@ -12,6 +12,7 @@ typedef int net_bool_t; // backwards compatibility need bool's in pkt structures
 #include "net.h"
 #include "new3d.h"
 #include "object.h"
+#include "demofile.h"
 
 // game tracker
 char tracker_server[256];
@@ -611,6 +612,16 @@ typedef struct _GROUPONLY_FVERYSHORTGLOBALSHIP
 #define MSG_GROUPONLY_VERYSHORTFUPDATE		0xec
 #define MSG_VERYSHORTDROPPICKUP		0xed
 #define MSG_SHIPHEALTH              0xcc
+#define MSG_DEMOSHIPSTATE           0xcd	// only ever written to demo keyframes
+#define MSG_DEMOSTATS               0xce	// only ever written to demo keyframes
+#define MSG_DEMONAME                0xcb	// only ever written to demos
+
+// who a demo record came from, directplay ids in old demos
+typedef u_int32_t DPID;
+
+#define DPID_SYSMSG					( (DPID) 0 )	// a directplay system message, skipped on playback
+#define DEMO_PLAYER_ID				( (DPID) 1 )	// sender of every player message, enet has no player ids
+#define DEMO_KEYFRAME_ID			( (DPID) -2 )	// sender of the records making up a demo keyframe
 
 typedef struct _SENDBIKENUMMSG
 {
@@ -989,6 +1000,33 @@ typedef struct _SHIPHEALTHMSG
     u_int8_t Shield;
 } SHIPHEALTHMSG, *LPSHIPHEALTHMSG;
 
+typedef struct _DEMOSHIPSTATEMSG
+{
+    BYTE        MsgCode;
+    BYTE        WhoIAm;
+	BYTE		enable;
+	BYTE		Status;
+	BYTE		Team;
+	BYTE		Mode;
+	BYTE		Primary;
+	BYTE		Secondary;
+	u_int16_t	Group;
+	u_int32_t	Flags;
+	VECTOR		Pos;
+	QUAT		Quat;
+	float		Bank;
+	float		Shield;
+	float		Hull;
+	float		PrimPowerLevel;
+} DEMOSHIPSTATEMSG, *LPDEMOSHIPSTATEMSG;
+
+typedef struct _DEMONAMEMSG
+{
+    BYTE        MsgCode;
+    BYTE        WhoIAm;
+	char		Name[MAXSHORTNAME];
+} DEMONAMEMSG, *LPDEMONAMEMSG;
+
 #define MAXLEVELSPERBATCH 8
 
 // expose Names to all that care
@@ -1026,11 +1064,16 @@ void	ShipDiedSend( BYTE WeaponType, BYTE Weapon );
 void	UpdateBGObjectSend( u_int16_t BGObject, int16_t State, float Time );
 void	smallinitShip( u_int16_t i );
 void DemoPlayingNetworkGameUpdate(void);
-void DemoClean( void );
+int DemoClean( void );
 int FindSameLevel( char * Name );
 void	RequestTime( void  );
 void	SetTime( float Time );
-void Demo_fwrite( const void *buffer, size_t size, size_t count , FILE *stream );
+void Demo_fwrite( const void *buffer, size_t size, size_t count , DEMOSTREAM *stream );
+void Demo_fwrite_time( int64_t *time, DEMOSTREAM *stream );
+void DemoRecordName( BYTE Player );
+void DemoKeyframe( void );
+bool DemoSeek( int64_t Time );
+void DemoSkip( float Seconds );
 void StopDemoRecording( void );
 bool UpdateAmmoAndValidateMessage( void * Message );
 bool AutoJoinSession( void );
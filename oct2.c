@@ -58,6 +58,10 @@
 #include "render.h"
 #include "input.h"
 #include "oct2.h"
+#include "pool.h"
+#include "loscache.h"
+#include "loadtask.h"
+#include "startup.h"
 
 #ifdef SHADOWTEST
 #include "triangles.h"
@@ -326,12 +330,13 @@ MENU  MENU_EditMacro1;
 MENU  MENU_EditMacro2;
 MENU  MENU_EditMacro3;
 
-extern  FILE  * DemoFp;
-extern  FILE  * DemoFpClean;
+extern  DEMOSTREAM  * DemoFp;
+extern  DEMOSTREAM  * DemoFpClean;
 extern  bool  PlayDemo;
 extern  bool  PauseDemo;
 extern  bool  RecordDemo;
 extern  SLIDER  DemoSpeed;
+extern  SLIDER  DemoFastForward;
 extern  SLIDER  DemoEyesSelect;
 extern  bool  ShowWeaponKills;
 extern  bool ShowStats; 
@@ -369,6 +374,10 @@ float   DemoTotalTime = 0.0F; // total game time (in seconds)
 int32_t   DemoGameLoops = 0;
 float DemoAvgFps = 0.0F;
 extern  LONGLONG  DemoTimeSoFar;
+extern  LONGLONG  DemoCatchUpTime;
+extern  bool  DemoSeeking;
+
+#define DEMO_MAX_SKIPPED_FRAMES (256)  // drawn frame or not, the menus have to keep up
 #endif
 
 #define MIN_VIEWPORT_WIDTH  (64)
@@ -678,6 +687,9 @@ extern  int16_t         NamesAreLegal;
 extern  SHORTNAMETYPE     Names;  // all the players short Names....
 
 bool MainGame(); // bjd
+#ifdef DEMO_SUPPORT
+void DemoSkipFrames( void );
+#endif
 
 void Build_View();
 bool DispTracker( void ); // bjd
@@ -1855,6 +1867,8 @@ void ReleaseLevel(void)
     ReleaseAllEnemies();
     ReleaseAllRestartPoints();
     DestroySound( DESTROYSOUND_All );
+    PoolLogStats();
+    LOSCacheFlush();
     break;
   }
 
@@ -1932,12 +1946,12 @@ void ReleaseView(void)
     ReleaseModels();
     if ( MCloadheader.Buffer )
     {
-      free( MCloadheader.Buffer );
+      release_file_buffer( MCloadheader.Buffer );
       MCloadheader.Buffer = NULL;
     }
     if ( MCloadheadert0.Buffer )
     {
-      free( MCloadheadert0.Buffer );
+      release_file_buffer( MCloadheadert0.Buffer );
       MCloadheadert0.Buffer = NULL;
     }
 		Free_All_Off_Files( &OffsetFiles[ 0 ] );
@@ -2029,7 +2043,10 @@ bool InitView( void )
 			return false;
 		}
 
-		if ( !bSoundEnabled )
+		startup_mark( "title" );
+
+		// at startup the sound waits for the title's first frame
+		if ( !bSoundEnabled && !startup_running() )
 		{
 			if (! InitializeSound( DESTROYSOUND_All ))
 			{
@@ -2055,12 +2072,16 @@ bool InitView( void )
 		  SeriousError = true;
 		  return false;
 		}
+
+		startup_mark( "title offset files" );
 	    
 		if( !PreLoadFlyGirl() )
 		{
 		  SeriousError = true;
 		  return false;
 		}
+
+		startup_mark( "fly girl" );
 	    
 
 		if( !PreInitModel( TitleModelSet ) ) // bjd
@@ -2068,6 +2089,8 @@ bool InitView( void )
 		  SeriousError = true;
 		  return false;
 		}
+
+		startup_mark( "title model headers" );
 	    
 		//  Load in And if nescessary ReScale Textures...
 		if( !Tload( &Tloadheader ) )
@@ -2076,11 +2099,15 @@ bool InitView( void )
 		  return false;
 		}
 
+		startup_mark( "title textures" );
+
 		if( !InitModel( TitleModelSet ) ) // bjd
 		{
 		  SeriousError = true;
 		  return false;
 		}
+
+		startup_mark( "title models" );
 	      
 		if ( !AllocateCompFlyGirl() )
 		{
@@ -2292,6 +2319,179 @@ float HostMultiPlayerTimeout;
 int colourflash = 0;
 char NodeName[256];
 
+/*===================================================================
+  Level load tasks for InitView...
+  The texture, model and mesh loaders share Tloadheader and the
+  model lists and create gl objects so they stay on the main thread
+  in their old order.  The bsp, collision and text files are only
+  parsed into their own globals and load on the workers meanwhile.
+===================================================================*/
+static bool InitViewInitTload( void )
+{
+  // Init the Texture Handler
+  if( !InitTload( &Tloadheader ) )
+  {
+    Msg( "InitTLoad failed\n" );
+    return false;
+  }
+  return true;
+}
+
+static bool InitViewPreMload( void )
+{
+  //  Prep the Texture Handler.....
+  return PreMload( (char*) &LevelNames[LevelNum][0] , &Mloadheader ); // the model and visipoly data
+}
+
+static bool InitViewPreWaterLoad( void )
+{
+  // Can Cope with no .Wat file!!!
+  PreWaterLoad( (char*) &WaterNames[LevelNum][0] );
+  return true;
+}
+
+static bool InitViewPreLoadOnce( void )
+{
+  if( !OnceOnlyChangeLevel )
+    return true;
+
+  OnceOnlyChangeLevel = false;
+
+  return PreLoadShips() && PreLoadBGOFiles() && PreLoadRestartPoints() && PreLoadEnemies();
+}
+
+static bool InitViewPreInitModel( void )
+{
+  EnableRelavantModels( &ModelNames[0] );
+  return PreInitModel( /*lpDev,*/ &ModelNames[0] ); // bjd
+}
+
+static bool InitViewOffFiles( void )
+{
+  return Load_All_Off_Files( &OffsetFiles[ 0 ] );
+}
+
+static bool InitViewTload( void )
+{
+  //  Load in And if nescessary ReScale Textures... 
+  return Tload( &Tloadheader );
+}
+
+static bool InitViewInitModel( void )
+{
+  return InitModel( &ModelNames[0] ); // all 3d models....
+}
+
+static bool InitViewMload( void )
+{
+  if( !Mload( (char*) &LevelNames[LevelNum][0] , &Mloadheader ) )
+    return false; // the model and visipoly data
+
+  InitVisiStats( &Mloadheader );
+  return true;
+}
+
+static bool InitViewWaterLoad( void )
+{
+  // might not be any water...
+  WaterLoad();
+  return true;
+}
+
+static bool InitViewBspload( void )
+{
+  // Can Cope with no Bsp file!!!
+#ifdef LOAD_ZBSP
+  Bspload( (char*) &BspZNames[LevelNum][0], &Bsp_Header[ 0 ] );
+  Bspload( (char*) &BspNames[LevelNum][0], &Bsp_Header[ 1 ] );
+#else
+#ifdef BSP_ONLY
+  if ( !Bspload( (char*) &BspNames[LevelNum][0], &Bsp_Header[ 0 ] ) )
+  {
+    DebugPrintf( "Bspload failed\n" );
+    return false;   // the collision data
+  }
+#else
+  Bspload( (char*) &BspNames[LevelNum][0], &Bsp_Header[ 0 ] ); // load .BSP file into 0 skin
+#endif
+  Bsp_Header[ 1 ].State = false; // no non-zero .BSP any more
+#endif
+  return true;
+}
+
+static bool InitViewTextFiles( void )
+{
+  ReadTxtFile( (char*) &TextNames[LevelNum][0] );
+  ReadMsgFile( (char*) &MsgNames[LevelNum][0] );
+  return true;
+}
+
+static bool InitViewMCload( void )
+{
+  if( !MCload( (char*) &CollisionNames[LevelNum][0] , &MCloadheader ) )
+  {
+    DebugPrintf( "MCload non zero failed\n" );
+    return false;   // the collision data
+  }
+  return true;
+}
+
+static bool InitViewMCloadt0( void )
+{
+  if( !MCload( (char*) &CollisionZNames[LevelNum][0] , &MCloadheadert0 ) )
+  {
+    DebugPrintf( "MCload zero failed\n" );
+    return false; // the collision data skin thickness 0
+  }
+  return true;
+}
+
+static bool InitViewSetUpShips( void )
+{
+  SetUpShips();
+
+  InitSoundInfo( &Mloadheader );
+
+#ifdef NO_PRECALCULATED_CELL_COLOURS
+  CreateCellColours( &Mloadheader );
+#endif
+
+  InitShipSpeeds();
+  return true;
+}
+
+/*===================================================================
+  Procedure :   Load the level for InitView...
+  Input   :   nothing...
+  Output    :   bool  false if a loader failed
+===================================================================*/
+static bool InitViewLoad( void )
+{
+  int Tl, PreM, PreW, Once, PreIM, Off, T, IM, M, W, Bsp, Txt, MC, MCt0;
+
+  LoadTasksBegin( "InitView" );
+
+  Tl    = LoadTaskAdd( "InitTload",          InitViewInitTload,    true,  0 );
+  PreM  = LoadTaskAdd( "PreMload",           InitViewPreMload,     true,  1, Tl );
+  PreW  = LoadTaskAdd( "PreWaterLoad",       InitViewPreWaterLoad, true,  1, PreM );
+  Once  = LoadTaskAdd( "PreLoadOnce",        InitViewPreLoadOnce,  true,  1, PreW );
+  PreIM = LoadTaskAdd( "PreInitModel",       InitViewPreInitModel, true,  1, Once );
+  Off   = LoadTaskAdd( "Load_All_Off_Files", InitViewOffFiles,     true,  1, PreIM );
+  T     = LoadTaskAdd( "Tload",              InitViewTload,        true,  1, Off );
+  IM    = LoadTaskAdd( "InitModel",          InitViewInitModel,    true,  1, T );
+  M     = LoadTaskAdd( "Mload",              InitViewMload,        true,  1, IM );
+  W     = LoadTaskAdd( "WaterLoad",          InitViewWaterLoad,    true,  1, M );
+
+  Bsp   = LoadTaskAdd( "Bspload",            InitViewBspload,      false, 0 );
+  Txt   = LoadTaskAdd( "ReadTxtFile",        InitViewTextFiles,    false, 0 );
+  MC    = LoadTaskAdd( "MCload",             InitViewMCload,       false, 0 );
+  MCt0  = LoadTaskAdd( "MCload zero",        InitViewMCloadt0,     false, 0 );
+
+  LoadTaskAdd( "SetUpShips", InitViewSetUpShips, true, 5, W, Bsp, Txt, MC, MCt0 );
+
+  return LoadTasksRun();
+}
+
 /*===================================================================
   Procedure :   Game Status Control...
   Input   :   nothing...
@@ -3192,6 +3392,8 @@ bool RenderScene( void )
       framelag *= Demoframelag;
     }
 
+    DemoSkipFrames();
+
     if( MainGame() != true ) // bjd
       return false;
 
@@ -3258,291 +3460,12 @@ bool RenderScene( void )
     InitPortalExecs();
     InitRenderBufs();
 
-    // Init the Texture Handler
-    if( !InitTload( &Tloadheader ) )
+    // textures, models, mesh, bsp and collision for the level
+    if( !InitViewLoad() )
     {
       SeriousError = true;
-      Msg( "InitTLoad failed\n" );
       return false;
     }
-  
-    //  Prep the Texture Handler.....
-    if( !PreMload( (char*) &LevelNames[LevelNum][0] , &Mloadheader ) )
-    {
-      SeriousError = true;
-      return false; // the model and visipoly data
-    }
-
-    // Can Cope with no .Wat file!!!
-    PreWaterLoad( (char*) &WaterNames[LevelNum][0] );
-    
-    if( OnceOnlyChangeLevel )
-    {
-      OnceOnlyChangeLevel = false;
-
-      if( !PreLoadShips() )
-      {
-        SeriousError = true;
-        return false;
-      }
-
-      if( !PreLoadBGOFiles() )
-      {
-        SeriousError = true;
-        return false;
-      }
-
-      if( !PreLoadRestartPoints() )
-      {
-        SeriousError = true;
-        return false;
-      }
-      if( !PreLoadEnemies() )
-      {
-        SeriousError = true;
-        return false;
-      }
-    }
-
-    EnableRelavantModels( &ModelNames[0] );
-
-		if( !PreInitModel( /*lpDev,*/ &ModelNames[0] ) ) // bjd
-		{
-			SeriousError = true;
-			return false;
-		}
-
-		if( !Load_All_Off_Files( &OffsetFiles[ 0 ] ) )
-		{
-			SeriousError = true;
-			return false;
-		}
-
-    //  Load in And if nescessary ReScale Textures... 
-    if( !Tload( &Tloadheader ) )
-    {
-      SeriousError = true;
-      return false;
-    }
-
-/*
-    MyGameStatus = STATUS_InitView_2;
-    PrintInitViewStatus( MyGameStatus );
-    break;
-  
-
-  case STATUS_InitView_2:
-	DebugState("STATUS_InitView_2\n");
-
-    if( IsHost )
-    {
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-    }
-		else
-		{
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-    }
-
-    clear_black();
-
-    ReceiveGameMessages();
-
-    MyGameStatus = STATUS_InitView_3;
-    PrintInitViewStatus( MyGameStatus );
-    break;
-  
-
-  case STATUS_InitView_3:
-	DebugState("STATUS_InitView_3\n");
-
-    if( IsHost )
-    {
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-    }
-		else
-		{
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-    }
-
-    clear_black();
-
-    ReceiveGameMessages();
-*/
-
-    if( !InitModel( &ModelNames[0] ) )
-    {
-       SeriousError = true;
-       return false;               // all 3d models....
-    }
-
-/*
-    MyGameStatus = STATUS_InitView_4;
-    PrintInitViewStatus( MyGameStatus );
-    break;
-  
-
-  case STATUS_InitView_4:
-	DebugState("STATUS_InitView_4\n");
-
-    if( IsHost )
-    {
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-    }
-		else
-		{
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-    }
-
-    clear_black();
-
-    ReceiveGameMessages();
-*/
-
-    if( !Mload( (char*) &LevelNames[LevelNum][0] , &Mloadheader ) )
-    {
-      SeriousError = true;
-      return false; // the model and visipoly data
-    }
-
-    InitVisiStats( &Mloadheader );
-
-/*
-    MyGameStatus = STATUS_InitView_5;
-    PrintInitViewStatus( MyGameStatus );
-    break;
-  
-
-  case STATUS_InitView_5:
-	DebugState("STATUS_InitView_5\n");
-
-    if( IsHost )
-    {
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-    }
-		else
-		{
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-    }
-
-    clear_black();
-    ReceiveGameMessages();
-*/
-
-    // Can Cope with no Bsp file!!!
-#ifdef LOAD_ZBSP
-    Bspload( (char*) &BspZNames[LevelNum][0], &Bsp_Header[ 0 ] );
-    Bspload( (char*) &BspNames[LevelNum][0], &Bsp_Header[ 1 ] );
-#else
-#ifdef BSP_ONLY
-    if ( !Bspload( (char*) &BspNames[LevelNum][0], &Bsp_Header[ 0 ] ) )
-    {
-      SeriousError = true;
-      Msg( "Bspload failed\n" );
-      return false;   // the collision data
-    }
-#else
-    Bspload( (char*) &BspNames[LevelNum][0], &Bsp_Header[ 0 ] ); // load .BSP file into 0 skin
-#endif
-    Bsp_Header[ 1 ].State = false; // no non-zero .BSP any more
-#endif
-	//    if ( !Bsp_Duplicate( &Bsp_Header[ 0 ], &Bsp_Original ) )
-	//    {
-	//		    SeriousError = true;
-	//		    Msg( "Bsp_Duplicate failed\n" );
-	//		    return false;
-	//    }
-    
-    // might not be any water...
-    WaterLoad();
-
-    ReadTxtFile( (char*) &TextNames[LevelNum][0] );
-    
-    ReadMsgFile( (char*) &MsgNames[LevelNum][0] );
-    
-    if( !MCload( (char*) &CollisionNames[LevelNum][0] , &MCloadheader ) )
-    {
-      SeriousError = true;
-      Msg( "MCload non zero failed\n" );
-      return false;   // the collision data
-    }
-    if( !MCload( (char*) &CollisionZNames[LevelNum][0] , &MCloadheadert0 ) )
-    {
-      SeriousError = true;
-      Msg( "MCload zero failed\n" );
-      return false; // the collision data skin thickness 0
-    }
-  
-    SetUpShips();
-
-/*
-    MyGameStatus = STATUS_InitView_6;
-    PrintInitViewStatus( MyGameStatus );
-
-    break;
-
-  case STATUS_InitView_6:
-	DebugState("STATUS_InitView_6\n");
-
-    if( IsHost )
-    {
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-    }
-		else
-		{
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-    }
-
-    clear_black();
-    ReceiveGameMessages();
-*/
-
-    InitSoundInfo( &Mloadheader );
- 
-/*   
-    MyGameStatus = STATUS_InitView_7;
-    PrintInitViewStatus( MyGameStatus );
-    break;
-
-
-  case STATUS_InitView_7:
-	DebugState("STATUS_InitView_7\n");
-
-    if( IsHost )
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-		else
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-
-    clear_black();
-    ReceiveGameMessages();
-*/
-
-#ifdef NO_PRECALCULATED_CELL_COLOURS
-    CreateCellColours( &Mloadheader );
-#endif
-
-/*
-    MyGameStatus = STATUS_InitView_8;
-    PrintInitViewStatus( MyGameStatus );
-    break;
-
-
-  case STATUS_InitView_8:
-	DebugState("STATUS_InitView_8\n");
-
-    if( IsHost )
-      SendGameMessage(MSG_LONGSTATUS, 0, 0, 0, 0);
-		else
-      SendGameMessage(MSG_STATUS, 0, 0, 0, 0);
-
-    clear_black();
-    ReceiveGameMessages();
-
-		DebugState("STATUS_InitView_9\n");
-    MyGameStatus = STATUS_InitView_9;
-    PrintInitViewStatus( MyGameStatus );
-*/
-
-    InitShipSpeeds();
 
     // this will cause a lovely game loop and crash the game
 		// so don't remove this !!!!!!!!!
@@ -3699,7 +3622,10 @@ bool RenderScene( void )
     }
   
     GameElapsedTime = 0;
+    DemoCatchUpTime = 0;
+    DemoSeeking = false;
 
+    QueryPerformanceFrequency((LARGE_INTEGER *) &Freq);
     QueryPerformanceCounter((LARGE_INTEGER *) &GameStartedTime);
     QueryPerformanceCounter((LARGE_INTEGER *) &DemoStartedTime);
     DemoGameLoops = 0;
@@ -3935,6 +3861,8 @@ float Vpos[MAX_PLAYERS][MAX_PLAYERS] = { { 0.0F } ,
 ===================================================================*/
 void MainRoutines( void )
 {
+  LOSCacheNewFrame();
+
   if( PlayDemo )
   {
     DemoPlayingNetworkGameUpdate();
@@ -3989,6 +3917,45 @@ void MainRoutines( void )
 	//DebugPrintf("MainRoutines Finished...\n");
 }
 
+#ifdef DEMO_SUPPORT
+/*===================================================================
+  Procedure :   Run demo frames without drawing them, fast forward
+          :   runs DemoFastForward - 1 of them for every one drawn
+          :   and after a seek they run until the demo catches up
+  Input   :   nothing
+  Output    :   nothing
+===================================================================*/
+void DemoSkipFrames( void )
+{
+  LONGLONG  Step;
+  int   Frames;
+  int   Count;
+
+  // as much demo time as the frame about to be drawn will play
+  Step = (LONGLONG) ( framelag * (float) Freq / 60.0F );
+  if( Step <= 0 )
+    return;
+
+  Frames = DemoFastForward.value - 1;
+
+  for( Count = 0; Count < DEMO_MAX_SKIPPED_FRAMES; Count++ )
+  {
+    if( !PlayDemo || ( MyGameStatus != STATUS_PlayingDemo ) )
+      break;
+
+    if( ( GameElapsedTime + Step ) >= DemoCatchUpTime )
+    {
+      if( Frames <= 0 )
+        break;
+      Frames--;
+    }
+
+    GameElapsedTime += Step;
+    MainRoutines();
+  }
+}
+#endif
+
 void CheckLevelEnd ( void )
 {
 
@@ -5270,6 +5237,8 @@ extern bool ShowFrameRate;
 extern bool ShowInfo;
 extern	u_int16_t		NumGroupsVisible;
 extern u_int16_t	GroupImIn;
+extern u_int32_t	LOSCacheHitsLastFrame;
+extern u_int32_t	LOSCacheMissesLastFrame;
 
 bool Our_CalculateFrameRate(void)
 {
@@ -5316,11 +5285,23 @@ bool Our_CalculateFrameRate(void)
 		sprintf(&buf[0], "Mem %d",(int)MemUsed );
 		CenterPrint4x5Text( (char *) &buf[0], (FontHeight+3)*4, 2 );
 
+		// line of sight cache, last frame
+		sprintf(&buf[0], "LOS Cache Hits %d - Misses %d",
+			(int) LOSCacheHitsLastFrame, (int) LOSCacheMissesLastFrame );
+		CenterPrint4x5Text( (char *) &buf[0], (FontHeight+3)*5, 2 );
+
 		// show polygon information
 		sprintf(&buf[0], "Face Me Polys %d - Dynamic? Polys %d - Screen Polys %d - Verts Touched (lighting?) %d",
 			(int) TotalFmPolysInUse,(int) TotalPolysInUse,(int) TotalScrPolysInUse, NumOfVertsTouched);
 		CenterPrint4x5Text( (char *) &buf[0], (FontHeight+3)*6, 2 );
 
+		// renderer work for the last frame
+		sprintf(&buf[0], "Draw Calls %d - Texture Binds %d - States %d ( %d Filtered ) - Streamed %dK",
+			render_last_stats.draw_calls, render_last_stats.texture_binds,
+			render_last_stats.state_changes, render_last_stats.state_filtered,
+			render_last_stats.stream_bytes / 1024 );
+		CenterPrint4x5Text( (char *) &buf[0], (FontHeight+3)*7, 2 );
+
 		if ( ! ShowWeaponKills ) //ShowNetworkInfo)
 		{
 
@@ -0,0 +1,684 @@
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#include <SDL.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#include "package.h"
+#include "file.h"
+#include "util.h"
+
+#define PACKAGE_FOLDER		"data\\levels\\"
+#define PACKAGE_NAME_LENGTH	64
+#define PACKAGE_ALIGN		16
+#define PACKAGE_COMPRESSED	1
+#define PACKAGE_MAX_ENTRIES	4096
+
+typedef struct
+{
+	char			magic[4];
+	u_int32_t		version;
+	u_int32_t		entries;
+	u_int32_t		toc_offset;
+	u_int32_t		toc_crc;
+} package_header_t;
+
+typedef struct
+{
+	char			name[ PACKAGE_NAME_LENGTH ];
+	u_int32_t		offset;
+	u_int32_t		size;		// bytes in the package
+	u_int32_t		length;		// bytes once inflated
+	u_int32_t		crc;		// of the inflated bytes
+	u_int32_t		flags;
+} package_entry_t;
+
+typedef struct package_s
+{
+	char				level[ PACKAGE_NAME_LENGTH ];
+	bool				present;	// false remembers there is no package
+	u_int32_t			entries;
+	package_entry_t *	toc;
+	char *				data;		// whole package, mapped on first read
+	long				size;
+	struct filetime		time;
+	struct package_s *	next;
+} package_t;
+
+static const char package_magic[4] = { 'P', 'X', 'P', 'K' };
+
+static package_t * packages = NULL;
+static SDL_mutex * lock = NULL;
+
+void package_init( void )
+{
+	if ( !lock )
+		lock = SDL_CreateMutex();
+}
+
+static void unmap_package( package_t * package )
+{
+	if ( !package->data )
+		return;
+#ifdef WIN32
+	UnmapViewOfFile( package->data );
+#else
+	munmap( package->data, package->size );
+#endif
+	package->data = NULL;
+}
+
+static void forget_package( package_t * package )
+{
+	unmap_package( package );
+	free( package->toc );
+	free( package );
+}
+
+void package_quit( void )
+{
+	package_t * package;
+
+	while ( ( package = packages ) )
+	{
+		packages = package->next;
+		forget_package( package );
+	}
+
+	if ( lock )
+		SDL_DestroyMutex( lock );
+	lock = NULL;
+}
+
+// data\levels\Foo\Textures\a.png -> level "foo", entry "textures\a.png"
+
+static bool split_path( const char * path, char * level, char * entry )
+{
+	char flat[ 256 ];
+	char * sep;
+	size_t i;
+
+	for ( i = 0; path[i] && i < sizeof(flat) - 1; i++ )
+		flat[i] = path[i] == '/' ? '\\' : (char) tolower( (unsigned char) path[i] );
+	flat[i] = 0;
+
+	if ( strncmp( flat, PACKAGE_FOLDER, strlen( PACKAGE_FOLDER ) ) )
+		return false;
+
+	path = flat + strlen( PACKAGE_FOLDER );
+	sep = strchr( path, '\\' );
+	if ( !sep || sep == path || sep - path >= PACKAGE_NAME_LENGTH || strlen( sep + 1 ) >= PACKAGE_NAME_LENGTH || !sep[1] )
+		return false;
+
+	memcpy( level, path, sep - path );
+	level[ sep - path ] = 0;
+	strcpy( entry, sep + 1 );
+	return true;
+}
+
+static void package_path( const char * level, char * path, size_t size )
+{
+	snprintf( path, size, "%s%s%s", PACKAGE_FOLDER, level, PACKAGE_EXTENSION );
+}
+
+// reads just the header and table, the data is mapped when it's needed
+
+static bool read_contents( package_t * package )
+{
+	package_header_t header;
+	char path[ 256 ];
+	size_t toc_size;
+	u_int32_t i;
+	FILE * fp;
+
+	package_path( package->level, path, sizeof(path) );
+	fp = fopen( convert_path( path ), "rb" );
+	if ( !fp )
+		return false;
+
+	if ( fread( &header, sizeof(header), 1, fp ) != 1 ||
+		 memcmp( header.magic, package_magic, sizeof(package_magic) ) ||
+		 header.version != PACKAGE_VERSION ||
+		 header.entries > PACKAGE_MAX_ENTRIES )
+	{
+		DebugPrintf( "package: %s is not a version %d package\n", path, PACKAGE_VERSION );
+		fclose( fp );
+		return false;
+	}
+
+	toc_size = header.entries * sizeof(package_entry_t);
+	package->toc = malloc( toc_size ? toc_size : 1 );
+	if ( !package->toc ||
+		 fseek( fp, header.toc_offset, SEEK_SET ) != 0 ||
+		 fread( package->toc, 1, toc_size, fp ) != toc_size ||
+		 crc32( 0L, (const Bytef *) package->toc, toc_size ) != header.toc_crc )
+	{
+		DebugPrintf( "package: %s has a broken table of contents\n", path );
+		free( package->toc );
+		package->toc = NULL;
+		fclose( fp );
+		return false;
+	}
+
+	fseek( fp, 0, SEEK_END );
+	package->size = ftell( fp );
+	fclose( fp );
+
+	// every entry has to lie inside the file or reading it runs off the map
+	for ( i = 0; i < header.entries; i++ )
+	{
+		if ( package->size < 0 ||
+			 package->toc[i].offset > (unsigned long) package->size ||
+			 package->toc[i].size > (unsigned long) package->size - package->toc[i].offset )
+		{
+			DebugPrintf( "package: %s entry %.*s lies outside the package\n", path,
+				PACKAGE_NAME_LENGTH, package->toc[i].name );
+			free( package->toc );
+			package->toc = NULL;
+			return false;
+		}
+	}
+
+	package->entries = header.entries;
+	file_time( path, &package->time );
+
+	DebugPrintf( "package: %s has %u entries, crc %08x\n", path, header.entries, header.toc_crc );
+	return true;
+}
+
+static bool map_package( package_t * package )
+{
+	char path[ 256 ];
+
+	if ( package->data )
+		return true;
+
+	package_path( package->level, path, sizeof(path) );
+
+#ifdef WIN32
+	{
+		HANDLE file, mapping;
+		file = CreateFile( path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+		if ( file == INVALID_HANDLE_VALUE )
+			return false;
+		mapping = CreateFileMapping( file, NULL, PAGE_READONLY, 0, 0, NULL );
+		CloseHandle( file );
+		if ( !mapping )
+			return false;
+		package->data = (char *) MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+		CloseHandle( mapping ); // the view keeps it alive
+	}
+#else
+	{
+		char * address;
+		int handle = open( convert_path( path ), O_RDONLY );
+		if ( handle == -1 )
+			return false;
+		address = mmap( NULL, package->size, PROT_READ, MAP_SHARED, handle, 0 );
+		close( handle );
+		package->data = address == MAP_FAILED ? NULL : address;
+	}
+#endif
+
+	if ( !package->data )
+		DebugPrintf( "package: couldn't map %s\n", path );
+	return package->data != NULL;
+}
+
+static int compare_entry( const void * name, const void * entry )
+{
+	return strcmp( (const char *) name, ( (const package_entry_t *) entry )->name );
+}
+
+// the entry for path and the mapped package holding it, the package
+// never moves or goes away before package_quit so neither needs the
+// lock once found
+
+static package_entry_t * find_entry( const char * path, bool map, package_t ** found )
+{
+	char level[ PACKAGE_NAME_LENGTH ];
+	char name[ PACKAGE_NAME_LENGTH ];
+	package_entry_t * entry = NULL;
+	package_t * package;
+
+	if ( !split_path( path, level, name ) )
+		return NULL;
+
+	SDL_LockMutex( lock );
+
+	for ( package = packages; package; package = package->next )
+		if ( !strcmp( package->level, level ) )
+			break;
+
+	if ( !package )
+	{
+		package = calloc( 1, sizeof(package_t) );
+		if ( package )
+		{
+			strcpy( package->level, level );
+			package->present = read_contents( package );
+			package->next = packages;
+			packages = package;
+		}
+	}
+
+	if ( package && package->present )
+	{
+		entry = bsearch( name, package->toc, package->entries, sizeof(package_entry_t), compare_entry );
+		if ( entry && map && !map_package( package ) )
+			entry = NULL;
+	}
+
+	SDL_UnlockMutex( lock );
+
+	*found = package;
+	return entry;
+}
+
+static bool inflate_entry( package_t * package, package_entry_t * entry, char * buffer )
+{
+	uLongf length = entry->length;
+
+	if ( uncompress( (Bytef *) buffer, &length, (const Bytef *) package->data + entry->offset, entry->size ) != Z_OK ||
+		 length != entry->length ||
+		 crc32( 0L, (const Bytef *) buffer, length ) != entry->crc )
+	{
+		DebugPrintf( "package: %s in %s is corrupt\n", entry->name, package->level );
+		return false;
+	}
+	return true;
+}
+
+long package_size( const char * path )
+{
+	package_t * package;
+	package_entry_t * entry = find_entry( path, false, &package );
+	return entry ? (long) entry->length : -1;
+}
+
+long package_read( const char * path, char * buffer, long size )
+{
+	package_t * package;
+	package_entry_t * entry = find_entry( path, true, &package );
+	char * inflated;
+
+	if ( !entry )
+		return -1;
+
+	if ( size <= 0 || size > (long) entry->length )
+		size = entry->length;
+
+	if ( !( entry->flags & PACKAGE_COMPRESSED ) )
+	{
+		memcpy( buffer, package->data + entry->offset, size );
+		return size;
+	}
+
+	if ( size == (long) entry->length )
+		return inflate_entry( package, entry, buffer ) ? size : 0;
+
+	// only part of it wanted
+	inflated = malloc( entry->length ? entry->length : 1 );
+	if ( !inflated || !inflate_entry( package, entry, inflated ) )
+	{
+		free( inflated );
+		return 0;
+	}
+	memcpy( buffer, inflated, size );
+	free( inflated );
+	return size;
+}
+
+FILE * package_fopen( const char * path )
+{
+	package_t * package;
+	package_entry_t * entry = find_entry( path, true, &package );
+	char * inflated = NULL;
+	const char * data;
+	FILE * fp;
+
+	if ( !entry )
+		return NULL;
+
+	data = package->data + entry->offset;
+
+#ifndef WIN32
+	// straight over the mapping when it's stored as is
+	if ( !( entry->flags & PACKAGE_COMPRESSED ) )
+		return entry->length ? fmemopen( (void *) data, entry->length, "r" ) : fopen( "/dev/null", "r" );
+#endif
+
+	if ( entry->flags & PACKAGE_COMPRESSED )
+	{
+		inflated = malloc( entry->length ? entry->length : 1 );
+		if ( !inflated || !inflate_entry( package, entry, inflated ) )
+		{
+			free( inflated );
+			return NULL;
+		}
+		data = inflated;
+	}
+
+	// a stream with its own copy, freed when it's closed
+#ifdef WIN32
+	fp = tmpfile();
+#else
+	fp = fmemopen( NULL, entry->length ? entry->length : 1, "w+" );
+#endif
+	if ( fp && ( fwrite( data, 1, entry->length, fp ) != entry->length || fseek( fp, 0, SEEK_SET ) != 0 ) )
+	{
+		fclose( fp );
+		fp = NULL;
+	}
+
+	free( inflated );
+	return fp;
+}
+
+bool package_time( const char * path, struct filetime * t )
+{
+	package_t * package;
+	package_entry_t * entry = find_entry( path, false, &package );
+
+	if ( !entry )
+		return false;
+	*t = package->time;
+	return true;
+}
+
+//
+// Packer
+//
+
+typedef struct
+{
+	char name[ PACKAGE_NAME_LENGTH ];
+} pack_name_t;
+
+static int compare_name( const void * a, const void * b )
+{
+	return strcmp( ( (const pack_name_t *) a )->name, ( (const pack_name_t *) b )->name );
+}
+
+static bool is_dir( const char * path )
+{
+	struct stat s;
+	return stat( convert_path( (char *) path ), &s ) == 0 && ( s.st_mode & S_IFDIR );
+}
+
+// every file below the level folder, relative to it and lower case
+
+static int gather_files( const char * level, pack_name_t * names, int max )
+{
+	char dirs[ 32 ][ PACKAGE_NAME_LENGTH ];
+	char pattern[ 256 ];
+	char path[ 256 ];
+	char name[ PACKAGE_NAME_LENGTH ];
+	int num_dirs = 1, dir, count = 0;
+	char * found;
+	size_t i;
+
+	dirs[0][0] = 0;
+
+	for ( dir = 0; dir < num_dirs; dir++ )
+	{
+		snprintf( pattern, sizeof(pattern), "%s%s\\%s*", PACKAGE_FOLDER, level, dirs[ dir ] );
+
+		// find_file only walks one folder at a time so sub folders are
+		// noted and walked afterwards
+		for ( found = find_file( pattern ); found; found = find_next_file() )
+		{
+			if ( !strcmp( found, "." ) || !strcmp( found, ".." ) )
+				continue;
+
+			if ( strlen( dirs[ dir ] ) + strlen( found ) + 1 >= PACKAGE_NAME_LENGTH )
+			{
+				DebugPrintf( "package: %s%s is too long a name, left out\n", dirs[ dir ], found );
+				continue;
+			}
+			snprintf( name, sizeof(name), "%s%s", dirs[ dir ], found );
+			for ( i = 0; name[i]; i++ )
+				name[i] = (char) tolower( (unsigned char) name[i] );
+
+			snprintf( path, sizeof(path), "%s%s\\%s", PACKAGE_FOLDER, level, name );
+			if ( is_dir( path ) )
+			{
+				if ( num_dirs < 32 )
+					snprintf( dirs[ num_dirs++ ], PACKAGE_NAME_LENGTH, "%s\\", name );
+				continue;
+			}
+
+			if ( count >= max )
+			{
+				DebugPrintf( "package: too many files in %s\n", level );
+				break;
+			}
+			strcpy( names[ count++ ].name, name );
+		}
+		find_close();
+	}
+
+	qsort( names, count, sizeof(pack_name_t), compare_name );
+	return count;
+}
+
+static bool pad_to( FILE * fp, long align )
+{
+	static const char zeros[ PACKAGE_ALIGN ];
+	long pos = ftell( fp );
+	long pad = ( align - pos % align ) % align;
+	return pos >= 0 && ( !pad || fwrite( zeros, 1, pad, fp ) == (size_t) pad );
+}
+
+// the loose file as it is on disk, not whatever package holds it
+
+static char * read_loose( const char * path, long * size )
+{
+	char * buffer;
+	FILE * fp = fopen( convert_path( (char *) path ), "rb" );
+
+	if ( !fp )
+		return NULL;
+	fseek( fp, 0, SEEK_END );
+	*size = ftell( fp );
+	fseek( fp, 0, SEEK_SET );
+
+	buffer = *size >= 0 ? malloc( *size ? *size : 1 ) : NULL;
+	if ( buffer && fread( buffer, 1, *size, fp ) != (size_t) *size )
+	{
+		free( buffer );
+		buffer = NULL;
+	}
+	fclose( fp );
+	return buffer;
+}
+
+bool package_build( const char * level )
+{
+	package_header_t header;
+	package_entry_t * toc;
+	pack_name_t * names;
+	char lower[ PACKAGE_NAME_LENGTH ];
+	char path[ 256 ];
+	char temp[ 256 ];
+	char from[ 256 ];
+	char to[ 256 ];
+	char * data;
+	Bytef * packed;
+	uLongf packed_size;
+	long size, stored = 0, total = 0;
+	int count, i;
+	bool ok = true;
+	FILE * fp;
+	package_t ** link;
+
+	for ( i = 0; level[i] && i < PACKAGE_NAME_LENGTH - 1; i++ )
+		lower[i] = (char) tolower( (unsigned char) level[i] );
+	lower[i] = 0;
+
+	snprintf( path, sizeof(path), "%s%s", PACKAGE_FOLDER, lower );
+	if ( !is_dir( path ) )
+	{
+		Msg( "package_build: no level folder %s\n", path );
+		return false;
+	}
+
+	names = malloc( PACKAGE_MAX_ENTRIES * sizeof(pack_name_t) );
+	toc = calloc( PACKAGE_MAX_ENTRIES, sizeof(package_entry_t) );
+	if ( !names || !toc )
+	{
+		free( names );
+		free( toc );
+		return false;
+	}
+	count = gather_files( lower, names, PACKAGE_MAX_ENTRIES );
+
+	package_path( lower, path, sizeof(path) );
+	snprintf( temp, sizeof(temp), "%s.tmp", path );
+
+	fp = fopen( convert_path( temp ), "wb" );
+	if ( !fp )
+	{
+		Msg( "package_build: couldn't create %s\n", temp );
+		free( names );
+		free( toc );
+		return false;
+	}
+
+	// the header goes in again once the table is written
+	memset( &header, 0, sizeof(header) );
+	ok = fwrite( &header, sizeof(header), 1, fp ) == 1;
+
+	for ( i = 0; ok && i < count; i++ )
+	{
+		snprintf( from, sizeof(from), "%s%s\\%s", PACKAGE_FOLDER, lower, names[i].name );
+		data = read_loose( from, &size );
+		if ( !data )
+		{
+			Msg( "package_build: couldn't read %s\n", from );
+			ok = false;
+			break;
+		}
+
+		strcpy( toc[i].name, names[i].name );
+		toc[i].length = size;
+		toc[i].crc = crc32( 0L, (const Bytef *) data, size );
+
+		// only worth inflating at load time when it saves a quarter
+		packed_size = compressBound( size );
+		packed = malloc( packed_size );
+		if ( packed && compress2( packed, &packed_size, (const Bytef *) data, size, Z_BEST_COMPRESSION ) == Z_OK &&
+			 packed_size <= (uLongf) ( size - size / 4 ) )
+		{
+			toc[i].flags = PACKAGE_COMPRESSED;
+			toc[i].size = packed_size;
+		}
+		else
+		{
+			toc[i].flags = 0;
+			toc[i].size = size;
+		}
+
+		ok = pad_to( fp, PACKAGE_ALIGN );
+		toc[i].offset = ftell( fp );
+		if ( ok )
+			ok = fwrite( toc[i].flags ? (char *) packed : data, 1, toc[i].size, fp ) == toc[i].size;
+
+		stored += toc[i].size;
+		total += size;
+		free( packed );
+		free( data );
+	}
+
+	if ( ok )
+	{
+		memcpy( header.magic, package_magic, sizeof(package_magic) );
+		header.version = PACKAGE_VERSION;
+		header.entries = count;
+		ok = pad_to( fp, PACKAGE_ALIGN );
+		header.toc_offset = ftell( fp );
+		header.toc_crc = crc32( 0L, (const Bytef *) toc, count * sizeof(package_entry_t) );
+		ok = ok && fwrite( toc, sizeof(package_entry_t), count, fp ) == (size_t) count &&
+			 fseek( fp, 0, SEEK_SET ) == 0 &&
+			 fwrite( &header, sizeof(header), 1, fp ) == 1;
+	}
+
+	if ( fclose( fp ) != 0 )
+		ok = false;
+
+	strncpy( from, convert_path( temp ), sizeof(from) - 1 );
+	from[ sizeof(from) - 1 ] = 0;
+	strncpy( to, convert_path( path ), sizeof(to) - 1 );
+	to[ sizeof(to) - 1 ] = 0;
+
+	// the package it replaces is read again next time it's asked for
+	SDL_LockMutex( lock );
+	for ( link = &packages; *link; link = &(*link)->next )
+	{
+		if ( !strcmp( (*link)->level, lower ) )
+		{
+			package_t * old = *link;
+			*link = old->next;
+			forget_package( old );
+			break;
+		}
+	}
+
+	if ( ok )
+	{
+#ifdef WIN32
+		// rename won't replace an existing file here
+		remove( to );
+#endif
+		ok = ( rename( from, to ) == 0 );
+	}
+	if ( !ok )
+		remove( from );
+	SDL_UnlockMutex( lock );
+
+	if ( ok )
+		DebugPrintf( "package: %s has %d files, %ld bytes packed into %ld, crc %08x\n",
+			path, count, total, stored, header.toc_crc );
+	else
+		Msg( "package_build: failed to write %s\n", path );
+
+	free( names );
+	free( toc );
+	return ok;
+}
+
+bool package_build_all( void )
+{
+	char levels[ 256 ][ PACKAGE_NAME_LENGTH ];
+	char path[ 256 ];
+	char * found;
+	int count = 0, i;
+	bool ok = true;
+
+	for ( found = find_file( PACKAGE_FOLDER "*" ); found && count < 256; found = find_next_file() )
+	{
+		if ( !strcmp( found, "." ) || !strcmp( found, ".." ) || strlen( found ) >= PACKAGE_NAME_LENGTH )
+			continue;
+		snprintf( path, sizeof(path), "%s%s", PACKAGE_FOLDER, found );
+		if ( is_dir( path ) )
+			strcpy( levels[ count++ ], found );
+	}
+	find_close();
+
+	for ( i = 0; i < count; i++ )
+		if ( !package_build( levels[i] ) )
+			ok = false;
+
+	return ok;
+}
@@ -0,0 +1,59 @@
+#ifndef PACKAGE_H
+#define PACKAGE_H
+
+#include "main.h"
+#include <stdio.h>
+#include "file.h"
+
+//
+// Level Packages
+//
+// Everything under data\levels\<level>\ can be shipped as the single
+// file data\levels\<level>.pxp instead:
+//
+//   header     magic "PXPK", version, entry count, where the table of
+//              contents starts and the crc32 of the table
+//   data       each entry's bytes, 16 byte aligned, zlib compressed
+//              when that saved at least a quarter
+//   contents   one record per entry sorted by name: the name relative
+//              to the level folder ( lower case, '\' separated ),
+//              offset and size in the package, inflated length, crc32
+//              of the inflated bytes and flags
+//
+// The crc of the table covers every entry's crc, so it identifies the
+// whole level.
+//
+// The file functions look in the level's package first and only go to
+// the loose file when the package or the entry isn't there.  A package
+// is mapped the first time one of its entries is read and stays mapped
+// until package_quit, so a FILE handed out over an entry stays good
+// across a level change.
+//
+// Start with -PackLevel <level> or -PackLevels to build packages from
+// the level folders.
+//
+
+#define PACKAGE_EXTENSION	".pxp"
+#define PACKAGE_VERSION		1
+
+// main thread, before any loader threads start
+void package_init( void );
+void package_quit( void );
+
+// -1 when the path isn't in a package
+long package_size( const char * path );
+
+// size 0 reads the whole entry, -1 when the path isn't in a package
+long package_read( const char * path, char * buffer, long size );
+
+// read only stream over an entry, NULL when the path isn't in a package
+FILE * package_fopen( const char * path );
+
+// an entry has the modification time of its package
+bool package_time( const char * path, struct filetime * t );
+
+// pack data\levels\<level>\ into data\levels\<level>.pxp
+bool package_build( const char * level );
+bool package_build_all( void );
+
+#endif // PACKAGE_H
@@ -40,6 +40,7 @@
 #include "goal.h"
 #include "local.h"
 #include "util.h"
+#include "pool.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -79,8 +80,8 @@ extern	VECTOR			SlideDown;
 extern	VECTOR			SlideLeft;
 extern	VECTOR			SlideRight;
 extern	XLIGHT			XLights[ MAXXLIGHTS ];
-extern	FMPOLY			FmPolys[ MAXNUMOF2DPOLYS ];
-extern	MODEL			Models[ MAXNUMOFMODELS ];
+extern	FMPOLY			*	FmPolys;
+extern	MODEL			*	Models;
 extern	float			framelag;
 extern	BYTE			WhoIAm;
 extern	LINE			Lines[ MAXLINES ];
@@ -183,6 +184,8 @@ PICKUP			PickupsCopy[ MAX_PLAYERS ][ MAXPICKUPS ];
 REGENPOINT	*	RegenSlotsCopy[ MAX_PLAYERS ];
 u_int16_t			FirstPickupUsed;
 u_int16_t			FirstPickupFree;
+u_int32_t			TotalPickupsInUse = 0;
+POOLSTATS			PickupPool = { "Pickups", NULL, 0, 0, 0, 0, 0, 0, 0, 0 };
 char			UserMessage[ 256 ];
 int16_t			NumStealths = 0;
 int16_t			NumInvuls = 0;
@@ -829,6 +832,8 @@ void InitPickups( void )
 
 	FirstPickupUsed = (u_int16_t) -1;
 	FirstPickupFree = 0;
+	TotalPickupsInUse = 0;
+	PoolInitFixed( &PickupPool, MAXPICKUPS );
 
 	SetupPickupGroups();
 	ClearPickupsGot();
@@ -2356,7 +2361,11 @@ u_int16_t FindFreePickup( void )
 
 	i = FirstPickupFree;
 	
-	if ( i == (u_int16_t) -1 ) return i;
+	if ( i == (u_int16_t) -1 )
+	{
+		PoolDropped( &PickupPool );
+		return i;
+	}
  
 	Pickups[i].Prev = FirstPickupUsed;
 	if( FirstPickupUsed != (u_int16_t) -1)
@@ -2368,6 +2377,10 @@ u_int16_t FindFreePickup( void )
 
 	FirstPickupUsed = i;
 	FirstPickupFree = Pickups[ i ].Next;
+
+	TotalPickupsInUse++;
+	PoolUsed( &PickupPool, TotalPickupsInUse );
+
 	return i ;
 }
 
@@ -2453,6 +2466,8 @@ void KillUsedPickup( u_int16_t i )
 	Pickups[ i ].Next = FirstPickupFree;
 	FirstPickupFree	= i;
 
+	if( TotalPickupsInUse ) TotalPickupsInUse--;
+
 	RemovePickupFromGroup( i, Pickups[ i ].Group );
 }
 
@@ -18,6 +18,7 @@
 #include "secondary.h"
 #include "main.h"
 #include "util.h"
+#include "pool.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -52,28 +53,28 @@ extern	BYTE			GameStatus[MAX_PLAYERS];
 /*===================================================================
 	Globals
 ===================================================================*/
-POLY		Polys[ MAXPOLYS ];
+POLY	*	Polys = NULL;
 u_int16_t		FirstPolyUsed;
 u_int16_t		FirstPolyFree;
 u_int32_t		TotalPolysInUse = 0;
 TPAGEINFO	PolyTPages[ MAXTPAGESPERTLOAD + 1 ];
 
+POOLSTATS	PolyPool = { "Polys", "PolyBudget", MAXPOLYS, MAXPOLYSBUDGET, 0, 0, 0, 0, 0, 0 };
+
 /*===================================================================
-	Procedure	:	Init poly structures
-	Input		:	Nothing
+	Procedure	:	Link a range of Polys into the free list
+	Input		:	u_int32_t	First Poly
+				:	u_int32_t	One past the last Poly
 	Output		:	Nothing
 ===================================================================*/
-void InitPolys( void )
+static void LinkFreePolys( u_int32_t Start, u_int32_t End )
 {
-	int i;
+	u_int32_t i;
 
-	FirstPolyUsed = (u_int16_t) -1;
-	FirstPolyFree = 0;
-	
-	for( i = 0; i < MAXPOLYS; i++ )
+	for( i = Start; i < End; i++ )
 	{
 		memset( &Polys[ i ], 0, sizeof( POLY ) );
-		Polys[i].Next = i + 1;
+		Polys[i].Next = (u_int16_t) ( i + 1 );
 		Polys[i].Prev = (u_int16_t) -1;
 
 		Polys[i].NextInTPage = (u_int16_t) -1;
@@ -81,23 +82,47 @@ void InitPolys( void )
 
 		Polys[i].Frm_Info = NULL;
 	}
-	Polys[ MAXPOLYS - 1 ].Next = (u_int16_t) -1;
+	Polys[ End - 1 ].Next = (u_int16_t) -1;
+
+	FirstPolyFree = (u_int16_t) Start;
+}
+
+/*===================================================================
+	Procedure	:	Init poly structures
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void InitPolys( void )
+{
+	PoolInit( &PolyPool, (void **) &Polys, sizeof( POLY ) );
+
+	FirstPolyUsed = (u_int16_t) -1;
+	TotalPolysInUse = 0;
+
+	LinkFreePolys( 0, PolyPool.Linked );
 
 	InitPolyTPages();
 }
 
 /*===================================================================
 	Procedure	:	Find a free Poly and move it from the free list
-				:	to the used list
+				:	to the used list, growing the pool if needed
 	Input		:	Nothing
 	Output		:	u_int16_t	Number of the free Poly
 ===================================================================*/
 u_int16_t FindFreePoly( void )
 {
 	u_int16_t i;
+	u_int32_t Start;
 
 	i = FirstPolyFree;
-	if( i == (u_int16_t) -1 ) return i;
+	if( i == (u_int16_t) -1 )
+	{
+		Start = PolyPool.Linked;
+		if( PoolGrow( &PolyPool ) == Start ) return i;
+		LinkFreePolys( Start, PolyPool.Linked );
+		i = FirstPolyFree;
+	}
  
 	Polys[ i ].Prev = FirstPolyUsed;
 
@@ -107,6 +132,7 @@ u_int16_t FindFreePoly( void )
 	FirstPolyFree = Polys[i].Next;
 
 	TotalPolysInUse++;
+	PoolUsed( &PolyPool, TotalPolysInUse );
 
 	return i ;
 }
@@ -1707,6 +1733,7 @@ FILE * LoadPolys( FILE * fp )
 
 		while( i != (u_int16_t) -1 )
 		{
+			if( !PoolLinked( &PolyPool, i ) ) return NULL;
 			fread( &Polys[ i ].Next, sizeof( u_int16_t ), 1, fp );
 			fread( &Polys[ i ].Prev, sizeof( u_int16_t ), 1, fp );
 			fread( &Polys[ i ].NextInTPage, sizeof( u_int16_t ), 1, fp );
@@ -1743,6 +1770,7 @@ FILE * LoadPolys( FILE * fp )
 
 		while( i != (u_int16_t) -1 )
 		{
+			if( !PoolLinked( &PolyPool, i ) ) return NULL;
 			memset( &Polys[ i ], 0, sizeof( POLY ) );
 			Polys[i].Prev = (u_int16_t) -1;
 			Polys[i].NextInTPage = (u_int16_t) -1;
@@ -23,7 +23,8 @@
 /*===================================================================
 	Defines
 ===================================================================*/
-#define MAXPOLYS			2000
+#define MAXPOLYS			2000	// linked in at level start
+#define MAXPOLYSBUDGET		8000	// most the pool grows to ( "PolyBudget" config )
 #define	MAXPOLYVERTS		800
 
 #define	POLY_FLAG_NOTHING	0
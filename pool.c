@@ -0,0 +1,251 @@
+/*===================================================================
+*	p o o l . c
+*	Growth and high-water bookkeeping for the entity pools...
+===================================================================*/
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "pool.h"
+#include "lua_config.h"
+#include "util.h"
+
+/*===================================================================
+	Globals
+===================================================================*/
+static POOLSTATS *	Pools[ MAXPOOLS ];
+static void	**		PoolArenas[ MAXPOOLS ];	// address of each growable pool's array
+static int			NumPools = 0;
+
+/*===================================================================
+	Procedure	:	Remember a pool so it shows up in the level
+				:	end report
+	Input		:	POOLSTATS	*	Pool
+	Output		:	Nothing
+===================================================================*/
+static void RegisterPool( POOLSTATS * Pool )
+{
+	int i;
+
+	for( i = 0; i < NumPools; i++ )
+	{
+		if( Pools[ i ] == Pool ) return;
+	}
+
+	if( NumPools >= MAXPOOLS )
+	{
+		DebugPrintf( "pool: too many pools, %s will not be reported\n", Pool->Name );
+		return;
+	}
+
+	Pools[ NumPools ] = Pool;
+	PoolArenas[ NumPools ] = NULL;
+	NumPools++;
+}
+
+/*===================================================================
+	Procedure	:	Reset the per level counters of a pool
+	Input		:	POOLSTATS	*	Pool
+	Output		:	Nothing
+===================================================================*/
+static void ResetPoolStats( POOLSTATS * Pool )
+{
+	Pool->Peak = 0;
+	Pool->Grows = 0;
+	Pool->Dropped = 0;
+}
+
+/*===================================================================
+	Procedure	:	Set up a growable pool for a new scene
+				:	The arena is sized for the whole budget but
+				:	only Reserve elements are meant to be linked
+				:	in by the caller.  It is only reallocated when
+				:	the budget changes, so nothing may point into
+				:	the pool when this is called.
+	Input		:	POOLSTATS	*	Pool
+				:	void		**	Address of the pool's array
+				:	size_t			Size of one element
+	Output		:	Nothing
+===================================================================*/
+void PoolInit( POOLSTATS * Pool, void ** Arena, size_t ElementSize )
+{
+	u_int32_t	Budget;
+	void	*	NewArena;
+	int			i;
+
+	RegisterPool( Pool );
+
+	Budget = (u_int32_t) config_get_int( Pool->BudgetOpt, (int) Pool->DefaultBudget );
+	if( Budget < Pool->Reserve ) Budget = Pool->Reserve;
+	if( Budget > POOL_MAX_BUDGET ) Budget = POOL_MAX_BUDGET;
+
+	if( !*Arena || ( Budget != Pool->Allocated ) )
+	{
+		NewArena = realloc( *Arena, Budget * ElementSize );
+
+		if( !NewArena && ( Budget > Pool->Reserve ) )
+		{
+			DebugPrintf( "pool: couldn't reserve %d %s, falling back to %d\n",
+				(int) Budget, Pool->Name, (int) Pool->Reserve );
+			Budget = Pool->Reserve;
+			NewArena = realloc( *Arena, Budget * ElementSize );
+		}
+
+		if( !NewArena )
+		{
+			Msg( "Unable to allocate %s pool\n", Pool->Name );
+			exit( 1 );
+		}
+
+		*Arena = NewArena;
+		Pool->Allocated = Budget;
+	}
+
+	Pool->Budget = Budget;
+	Pool->Linked = Pool->Reserve;
+	ResetPoolStats( Pool );
+
+	for( i = 0; i < NumPools; i++ )
+	{
+		if( Pools[ i ] == Pool ) PoolArenas[ i ] = Arena;
+	}
+}
+
+/*===================================================================
+	Procedure	:	Set up a fixed size pool for a new scene
+				:	These only report usage, they never grow
+	Input		:	POOLSTATS	*	Pool
+				:	u_int32_t		Number of elements
+	Output		:	Nothing
+===================================================================*/
+void PoolInitFixed( POOLSTATS * Pool, u_int32_t Size )
+{
+	RegisterPool( Pool );
+
+	Pool->Reserve = Size;
+	Pool->DefaultBudget = Size;
+	Pool->Budget = Size;
+	Pool->Allocated = Size;
+	Pool->Linked = Size;
+	ResetPoolStats( Pool );
+}
+
+/*===================================================================
+	Procedure	:	Make room for more elements in a pool whose
+				:	free list has run dry
+				:	The caller links elements [ old Linked,
+				:	returned Linked ) into its free list.
+	Input		:	POOLSTATS	*	Pool
+	Output		:	u_int32_t		New number of linked elements
+				:					( unchanged if the budget is spent )
+===================================================================*/
+u_int32_t PoolGrow( POOLSTATS * Pool )
+{
+	u_int32_t	Linked;
+
+	if( Pool->Linked >= Pool->Budget )
+	{
+		PoolDropped( Pool );
+		return Pool->Linked;
+	}
+
+	Linked = Pool->Linked + POOL_GROW_CHUNK;
+	if( Linked > Pool->Budget ) Linked = Pool->Budget;
+
+	Pool->Linked = Linked;
+	Pool->Grows++;
+
+	return Linked;
+}
+
+/*===================================================================
+	Procedure	:	Note that an index has been linked from outside
+				:	( loading a saved game ) so growth starts after it
+	Input		:	POOLSTATS	*	Pool
+				:	u_int32_t		Index
+	Output		:	bool			false if the index does not fit
+===================================================================*/
+bool PoolLinked( POOLSTATS * Pool, u_int32_t Index )
+{
+	if( Index >= Pool->Allocated )
+	{
+		DebugPrintf( "pool: %s index %d is outside the budget of %d\n",
+			Pool->Name, (int) Index, (int) Pool->Allocated );
+		return false;
+	}
+
+	if( Index >= Pool->Linked ) Pool->Linked = Index + 1;
+
+	return true;
+}
+
+/*===================================================================
+	Procedure	:	Update the high-water mark of a pool
+	Input		:	POOLSTATS	*	Pool
+				:	u_int32_t		Elements in use now
+	Output		:	Nothing
+===================================================================*/
+void PoolUsed( POOLSTATS * Pool, u_int32_t InUse )
+{
+	if( InUse > Pool->Peak ) Pool->Peak = InUse;
+}
+
+/*===================================================================
+	Procedure	:	Count a request the pool could not satisfy
+	Input		:	POOLSTATS	*	Pool
+	Output		:	Nothing
+===================================================================*/
+void PoolDropped( POOLSTATS * Pool )
+{
+	if( !Pool->Dropped )
+	{
+		DebugPrintf( "pool: %s exhausted at %d\n", Pool->Name, (int) Pool->Linked );
+	}
+
+	Pool->Dropped++;
+}
+
+/*===================================================================
+	Procedure	:	Log the usage of every pool for the level
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void PoolLogStats( void )
+{
+	int i;
+
+	DebugPrintf( "pool: %-12s %8s %8s %8s %8s %8s %8s\n",
+		"name", "peak", "reserve", "linked", "budget", "grows", "dropped" );
+
+	for( i = 0; i < NumPools; i++ )
+	{
+		DebugPrintf( "pool: %-12s %8d %8d %8d %8d %8d %8d\n",
+			Pools[ i ]->Name,
+			(int) Pools[ i ]->Peak,
+			(int) Pools[ i ]->Reserve,
+			(int) Pools[ i ]->Linked,
+			(int) Pools[ i ]->Budget,
+			(int) Pools[ i ]->Grows,
+			(int) Pools[ i ]->Dropped );
+	}
+}
+
+/*===================================================================
+	Procedure	:	Free the arenas of all growable pools
+				:	Only safe once nothing uses the pools anymore
+	Input		:	Nothing
+	Output		:	Nothing
+===================================================================*/
+void PoolReleaseAll( void )
+{
+	int i;
+
+	for( i = 0; i < NumPools; i++ )
+	{
+		if( PoolArenas[ i ] && *PoolArenas[ i ] )
+		{
+			free( *PoolArenas[ i ] );
+			*PoolArenas[ i ] = NULL;
+			Pools[ i ]->Allocated = 0;
+		}
+	}
+}
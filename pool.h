@@ -0,0 +1,62 @@
+/*==========================================================================
+ *  p o o l . h
+ *
+ *  Bookkeeping for the index linked entity pools (polys, fmpolys,
+ *  scrpolys, models, bullets, pickups).
+ *
+ *  A growable pool allocates its whole budget once, but only links
+ *  elements into its free list in chunks as they are needed.  Elements
+ *  never move so indices and pointers stay valid while the pool grows.
+ *  Elements past the linked count are never written, so a large budget
+ *  mostly costs address space where the allocator maps big blocks
+ *  lazily, but that is up to the platform.
+ *
+ *  Every pool tracks its high-water mark, growth and failed requests
+ *  so the initial reservations can be tuned from the level end log.
+ ***************************************************************************/
+#ifndef POOL_INCLUDED
+#define POOL_INCLUDED
+
+/*===================================================================
+	Includes
+===================================================================*/
+#include "main.h"
+
+/*===================================================================
+	Defines
+===================================================================*/
+#define	POOL_GROW_CHUNK		256			// elements linked in per growth step
+#define	POOL_MAX_BUDGET		65535		// indices are u_int16_t, (u_int16_t)-1 ends a list
+#define	MAXPOOLS			16
+
+/*===================================================================
+	Structures
+===================================================================*/
+typedef struct POOLSTATS {
+
+	const char	*	Name;
+	const char	*	BudgetOpt;			// config option overriding the budget
+	u_int32_t		Reserve;			// elements linked in when the pool is initialised
+	u_int32_t		DefaultBudget;		// budget used when the config has none
+	u_int32_t		Budget;				// most elements the pool may grow to
+	u_int32_t		Allocated;			// elements the arena has room for
+	u_int32_t		Linked;				// elements linked into the free/used lists so far
+	u_int32_t		Peak;				// most elements in use at once this level
+	u_int32_t		Grows;				// growth steps taken this level
+	u_int32_t		Dropped;			// requests refused this level
+
+} POOLSTATS;
+
+/*===================================================================
+	Prototypes
+===================================================================*/
+void PoolInit( POOLSTATS * Pool, void ** Arena, size_t ElementSize );
+void PoolInitFixed( POOLSTATS * Pool, u_int32_t Size );
+u_int32_t PoolGrow( POOLSTATS * Pool );
+bool PoolLinked( POOLSTATS * Pool, u_int32_t Index );
+void PoolUsed( POOLSTATS * Pool, u_int32_t InUse );
+void PoolDropped( POOLSTATS * Pool );
+void PoolLogStats( void );
+void PoolReleaseAll( void );
+
+#endif	// POOL_INCLUDED
@@ -39,6 +39,7 @@
 #include "ai.h"
 #include "water.h"
 #include "util.h"
+#include "pool.h"
 
 #ifdef SHADOWTEST
 #include "shadows.h"
@@ -72,12 +73,12 @@ extern	MLOADHEADER		Mloadheader;
 extern	MCLOADHEADER	MCloadheader;
 extern	MCLOADHEADER	MCloadheadert0;
 extern	XLIGHT			XLights[MAXXLIGHTS];
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
-extern	POLY			Polys[MAXPOLYS];
+extern	FMPOLY			*	FmPolys;
+extern	POLY			*	Polys;
 extern	LINE			Lines[ MAXLINES ];
 extern	float			framelag;
 extern	BYTE			WhoIAm;
-extern	MODEL			Models[ MAXNUMOFMODELS ];
+extern	MODEL			*	Models;
 extern	RENDERMATRIX		identity;
 extern	u_int16_t			FirstSecBullUsed;
 extern	SECONDARYWEAPONBULLET SecBulls[MAXSECONDARYWEAPONBULLETS];
@@ -187,8 +188,17 @@ extern	int16_t	TargetingWeaponCheat;
 float	NmeDamageModifier = 0.75F;
 
 PRIMARYWEAPONBULLET	PrimBulls[MAXPRIMARYWEAPONBULLETS];
+u_int16_t	PrimBullType[MAXPRIMARYWEAPONBULLETS];		// which type of bullet am I
+float	PrimBullLifeCount[MAXPRIMARYWEAPONBULLETS];		// how long do I live.....
+float	PrimBullSpeed[MAXPRIMARYWEAPONBULLETS];			// how fast do I move
+VECTOR	PrimBullPos[MAXPRIMARYWEAPONBULLETS];			// where am I
+VECTOR	PrimBullDir[MAXPRIMARYWEAPONBULLETS];			// where am i going
+u_int16_t	PrimBullGroup[MAXPRIMARYWEAPONBULLETS];		// which group am I in...
+static u_int16_t	PrimBullGeneration[MAXPRIMARYWEAPONBULLETS];	// bumped every time the slot is freed
 u_int16_t	FirstPrimBullUsed;
 u_int16_t	FirstPrimBullFree;
+u_int32_t	TotalPrimBullsInUse = 0;
+POOLSTATS	PrimBullPool = { "PrimBulls", NULL, 0, 0, 0, 0, 0, 0, 0, 0 };
 float	PrimaryFireDelay = 0.0F;
 float	OrbitFireDelay = 0.0F;
 float	LaserDiameter = ( 40.0F * GLOBAL_SCALE );
@@ -680,6 +690,21 @@ PRIMARYWEAPONATTRIB	PrimaryWeaponAttribs[ TOTALPRIMARYWEAPONS ] = {
 	},
 };
 
+/*===================================================================
+	Procedure	:	Reset the PrimBull* arrays for one bullet
+	Input		:	u_int16_t	Bullet Index
+	Output		:	nothing
+===================================================================*/
+static void ClearPrimBullMotion( u_int16_t i )
+{
+	PrimBullType[ i ] = (u_int16_t) -1;
+	PrimBullLifeCount[ i ] = 0.0F;
+	PrimBullSpeed[ i ] = 0.0F;
+	PrimBullPos[ i ].x = PrimBullPos[ i ].y = PrimBullPos[ i ].z = 0.0F;
+	PrimBullDir[ i ].x = PrimBullDir[ i ].y = PrimBullDir[ i ].z = 0.0F;
+	PrimBullGroup[ i ] = (u_int16_t) -1;
+}
+
 /*===================================================================
 	Procedure	:	Set up And Init all PrimBulls
 	Input		:	nothing
@@ -690,15 +715,16 @@ void	InitPrimBulls(void)
 	u_int16_t	i;
 	FirstPrimBullUsed = (u_int16_t) -1;
 	FirstPrimBullFree = 0;
+	TotalPrimBullsInUse = 0;
+	PoolInitFixed( &PrimBullPool, MAXPRIMARYWEAPONBULLETS );
 	for( i = 0 ; i < MAXPRIMARYWEAPONBULLETS ; i++ )
 	{
 		memset( &PrimBulls[i], 0, sizeof( PRIMARYWEAPONBULLET ) );
+		ClearPrimBullMotion( i );
 		PrimBulls[i].Used = false;
 		PrimBulls[i].Next = i + 1;
 		PrimBulls[i].Prev = (u_int16_t) -1;
-		PrimBulls[i].Type = (u_int16_t) -1;
 		PrimBulls[i].Owner = (u_int16_t) -1;
-		PrimBulls[i].GroupImIn = (u_int16_t) -1;
 		PrimBulls[i].fmpoly = (u_int16_t) -1;
 		PrimBulls[i].light = (u_int16_t) -1;
 		PrimBulls[i].line = (u_int16_t) -1;
@@ -839,12 +865,15 @@ u_int16_t	FindFreePrimBull(void)
 	i = FirstPrimBullFree;
 	
 	if ( i == (u_int16_t) -1)
+	{
+		PoolDropped( &PrimBullPool );
 		return i;
+	}
  
 	if( PrimBulls[i].Used )
 	{
 		// This Primary Bullet has been Used before....
-		Msg( "%s Bullet has been Used more than once\n",DebugPrimStrings[PrimBulls[i].Type]  );
+		Msg( "%s Bullet has been Used more than once\n",DebugPrimStrings[PrimBullType[i]]  );
 	}
 
 	PrimBulls[i].Prev = FirstPrimBullUsed;
@@ -859,6 +888,9 @@ u_int16_t	FindFreePrimBull(void)
 	PrimBulls[i].TimeCount = 0.0F;
 	PrimBulls[i].Used = true;
 
+	TotalPrimBullsInUse++;
+	PoolUsed( &PrimBullPool, TotalPrimBullsInUse );
+
 	return i ;
 }
 
@@ -876,7 +908,7 @@ void	KillUsedPrimBull( u_int16_t i )
 	if( !PrimBulls[i].Used )
 	{
 		// This Primary Bullet has been Freed before....
-		Msg( "%s Bullet has been Freed more than once\n",DebugPrimStrings[PrimBulls[i].Type]  );
+		Msg( "%s Bullet has been Freed more than once\n",DebugPrimStrings[PrimBullType[i]]  );
 	}
 
 	its_prev = PrimBulls[i].Prev;
@@ -895,6 +927,9 @@ void	KillUsedPrimBull( u_int16_t i )
 	PrimBulls[i].Next = FirstPrimBullFree;
 	FirstPrimBullFree	= i;
 	PrimBulls[i].Used = false;
+	PrimBullGeneration[i]++;
+
+	if( TotalPrimBullsInUse ) TotalPrimBullsInUse--;
 }
 
 /*===================================================================
@@ -1585,8 +1620,58 @@ static int16_t	OnceOnlyFlag = 0;
 	}
 }
 
+/*===================================================================
+	Movement pass of ProcessPrimaryBullets, indexed by slot in
+	PrimBullsMoving rather than by bullet
+===================================================================*/
+static u_int16_t	PrimBullsMoving[ MAXPRIMARYWEAPONBULLETS ];	// bullets to move this frame, in list order
+static int16_t		NumPrimBullsMoving = 0;
+static u_int16_t	MoveGeneration[ MAXPRIMARYWEAPONBULLETS ];	// PrimBullGeneration when it was queued
+static float		MoveStep[ MAXPRIMARYWEAPONBULLETS ];		// Speed * framelag
+static float		MovePosX[ MAXPRIMARYWEAPONBULLETS ];
+static float		MovePosY[ MAXPRIMARYWEAPONBULLETS ];
+static float		MovePosZ[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveDirX[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveDirY[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveDirZ[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveNewPosX[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveNewPosY[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveNewPosZ[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveOffsetX[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveOffsetY[ MAXPRIMARYWEAPONBULLETS ];
+static float		MoveOffsetZ[ MAXPRIMARYWEAPONBULLETS ];
+
+/*===================================================================
+	Procedure	:	Work out where every moving bullet ends up
+				:	this frame.  Only touches the flat Move*
+				:	arrays and has no branches so the compiler
+				:	can vectorise it.
+	Input		:	int16_t		Number of bullets to move
+	Output		:	nothing
+===================================================================*/
+static void IntegratePrimBulls( int16_t Num )
+{
+	int16_t	k;
+
+	for( k = 0; k < Num; k++ )
+	{
+		MoveNewPosX[ k ] = MovePosX[ k ] + ( MoveDirX[ k ] * MoveStep[ k ] );
+		MoveNewPosY[ k ] = MovePosY[ k ] + ( MoveDirY[ k ] * MoveStep[ k ] );
+		MoveNewPosZ[ k ] = MovePosZ[ k ] + ( MoveDirZ[ k ] * MoveStep[ k ] );
+
+		MoveOffsetX[ k ] = ( MoveNewPosX[ k ] - MovePosX[ k ] );		/* Dir Vector to NewPosition */
+		MoveOffsetY[ k ] = ( MoveNewPosY[ k ] - MovePosY[ k ] );
+		MoveOffsetZ[ k ] = ( MoveNewPosZ[ k ] - MovePosZ[ k ] );
+	}
+}
+
 /*===================================================================
 	Procedure	:	Process Primary Bullets
+				:	First pass walks the list, ages the bullets,
+				:	reattaches lasers and retires dead ones.  The
+				:	survivors are then moved as one batch and the
+				:	last pass does the collision checks and the
+				:	per weapon hit behaviour.
 	Input		:	nothing
 	Output		:	nothing
 ===================================================================*/
@@ -1598,7 +1683,6 @@ void ProcessPrimaryBullets( void )
 	u_int16_t			Count;
 	u_int16_t			nextprim;
 	VECTOR			TempVector;
-	float			Speed;
 	VECTOR			temp;
 	VECTOR			NewDir;
 	u_int16_t			fmpoly;
@@ -1636,9 +1720,12 @@ void ProcessPrimaryBullets( void )
 	PVSPOTFX	*	SpotFXPtr;
 	VECTOR			TrigPos;
 	float			NewFramelag = 0.0F;
+	int16_t			Moving;
 
 	PyroCount += framelag;
 
+	NumPrimBullsMoving = 0;
+
 	i = FirstPrimBullUsed;
 	while( i != (u_int16_t) -1 )
 	{
@@ -1650,10 +1737,10 @@ void ProcessPrimaryBullets( void )
 			PrimBulls[i].FramelagAddition = 0.0F;
 		}
 
-		if (PrimBulls[i].LifeCount > 0.0F)
+		if (PrimBullLifeCount[i] > 0.0F)
 		{
-			PrimBulls[i].LifeCount -= NewFramelag; //framelag;
-			if( PrimBulls[i].LifeCount < 0.0F ) PrimBulls[i].LifeCount = 0.0F;
+			PrimBullLifeCount[i] -= NewFramelag; //framelag;
+			if( PrimBullLifeCount[i] < 0.0F ) PrimBullLifeCount[i] = 0.0F;
 
 			switch( PrimBulls[i].Weapon )
 			{
@@ -1665,12 +1752,12 @@ void ProcessPrimaryBullets( void )
 					{
 						case OWNER_SHIP:
 				   			ApplyMatrix( &Ships[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].Offset, &TempVector );
-							PrimBulls[i].GroupImIn = MoveGroup( &Mloadheader, &Ships[ PrimBulls[i].Owner ].Object.Pos, Ships[ PrimBulls[i].Owner ].Object.Group, &TempVector );
+							PrimBullGroup[i] = MoveGroup( &Mloadheader, &Ships[ PrimBulls[i].Owner ].Object.Pos, Ships[ PrimBulls[i].Owner ].Object.Group, &TempVector );
 							ApplyMatrix( &Ships[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].Offset, &TempVector );
-							ApplyMatrix( &Ships[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].LocalDir, &PrimBulls[i].Dir );
-							PrimBulls[i].Pos.x = ( Ships[ PrimBulls[i].Owner ].Object.Pos.x + TempVector.x );
-							PrimBulls[i].Pos.y = ( Ships[ PrimBulls[i].Owner ].Object.Pos.y + TempVector.y );
-							PrimBulls[i].Pos.z = ( Ships[ PrimBulls[i].Owner ].Object.Pos.z + TempVector.z );
+							ApplyMatrix( &Ships[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].LocalDir, &PrimBullDir[i] );
+							PrimBullPos[i].x = ( Ships[ PrimBulls[i].Owner ].Object.Pos.x + TempVector.x );
+							PrimBullPos[i].y = ( Ships[ PrimBulls[i].Owner ].Object.Pos.y + TempVector.y );
+							PrimBullPos[i].z = ( Ships[ PrimBulls[i].Owner ].Object.Pos.z + TempVector.z );
 							PrimBulls[i].ColFlag = 0;
 							break;
 
@@ -1678,12 +1765,12 @@ void ProcessPrimaryBullets( void )
 							if( !Enemies[ PrimBulls[i].Owner ].Object.FirstGun )
 							{
 					   			ApplyMatrix( &Enemies[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].Offset, &TempVector );
-								PrimBulls[i].GroupImIn = MoveGroup( &Mloadheader, &Enemies[ PrimBulls[i].Owner ].Object.Pos, Enemies[ PrimBulls[i].Owner ].Object.Group, &TempVector );
+								PrimBullGroup[i] = MoveGroup( &Mloadheader, &Enemies[ PrimBulls[i].Owner ].Object.Pos, Enemies[ PrimBulls[i].Owner ].Object.Group, &TempVector );
 								ApplyMatrix( &Enemies[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].Offset, &TempVector );
-								ApplyMatrix( &Enemies[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].LocalDir, &PrimBulls[i].Dir );
-								PrimBulls[i].Pos.x = ( Enemies[ PrimBulls[i].Owner ].Object.Pos.x + TempVector.x );
-								PrimBulls[i].Pos.y = ( Enemies[ PrimBulls[i].Owner ].Object.Pos.y + TempVector.y );
-								PrimBulls[i].Pos.z = ( Enemies[ PrimBulls[i].Owner ].Object.Pos.z + TempVector.z );
+								ApplyMatrix( &Enemies[ PrimBulls[i].Owner ].Object.FinalMat, &PrimBulls[i].LocalDir, &PrimBullDir[i] );
+								PrimBullPos[i].x = ( Enemies[ PrimBulls[i].Owner ].Object.Pos.x + TempVector.x );
+								PrimBullPos[i].y = ( Enemies[ PrimBulls[i].Owner ].Object.Pos.y + TempVector.y );
+								PrimBullPos[i].z = ( Enemies[ PrimBulls[i].Owner ].Object.Pos.z + TempVector.z );
 								PrimBulls[i].ColFlag = 0;
 							}
 							else
@@ -1697,12 +1784,12 @@ void ProcessPrimaryBullets( void )
 									TempVector.x += GunPtr->FirePos.x;
 									TempVector.y += GunPtr->FirePos.y;
 									TempVector.z += GunPtr->FirePos.z;
-									PrimBulls[i].Pos = TempVector;
+									PrimBullPos[i] = TempVector;
 									TempVector.x -= Enemies[ PrimBulls[i].Owner ].Object.Pos.x;
 									TempVector.y -= Enemies[ PrimBulls[i].Owner ].Object.Pos.y;
 									TempVector.z -= Enemies[ PrimBulls[i].Owner ].Object.Pos.z;
-									PrimBulls[i].GroupImIn = MoveGroup( &Mloadheader, &Enemies[ PrimBulls[i].Owner ].Object.Pos, Enemies[ PrimBulls[i].Owner ].Object.Group, &TempVector );
-									ApplyMatrix( &GunPtr->Mat, &PrimBulls[i].LocalDir, &PrimBulls[i].Dir );
+									PrimBullGroup[i] = MoveGroup( &Mloadheader, &Enemies[ PrimBulls[i].Owner ].Object.Pos, Enemies[ PrimBulls[i].Owner ].Object.Group, &TempVector );
+									ApplyMatrix( &GunPtr->Mat, &PrimBulls[i].LocalDir, &PrimBullDir[i] );
 									PrimBulls[i].ColFlag = 0;
 								}
 							}
@@ -1723,11 +1810,11 @@ void ProcessPrimaryBullets( void )
 							}
 
 							ApplyMatrix( &Models[ PrimBulls[i].Owner ].Mat, &SpotFXPtr->Pos, &TempVector );
-							PrimBulls[i].Pos.x = ( Models[ PrimBulls[i].Owner ].Pos.x + TempVector.x );
-							PrimBulls[i].Pos.y = ( Models[ PrimBulls[i].Owner ].Pos.y + TempVector.y );
-							PrimBulls[i].Pos.z = ( Models[ PrimBulls[i].Owner ].Pos.z + TempVector.z );
-							PrimBulls[i].GroupImIn = MoveGroup( &Mloadheader, &Models[ PrimBulls[i].Owner ].Pos, Models[ PrimBulls[i].Owner ].Group, &TempVector );
-							ApplyMatrix( &Models[ PrimBulls[i].Owner ].Mat, &SpotFXPtr->DirVector, &PrimBulls[i].Dir );
+							PrimBullPos[i].x = ( Models[ PrimBulls[i].Owner ].Pos.x + TempVector.x );
+							PrimBullPos[i].y = ( Models[ PrimBulls[i].Owner ].Pos.y + TempVector.y );
+							PrimBullPos[i].z = ( Models[ PrimBulls[i].Owner ].Pos.z + TempVector.z );
+							PrimBullGroup[i] = MoveGroup( &Mloadheader, &Models[ PrimBulls[i].Owner ].Pos, Models[ PrimBulls[i].Owner ].Group, &TempVector );
+							ApplyMatrix( &Models[ PrimBulls[i].Owner ].Mat, &SpotFXPtr->DirVector, &PrimBullDir[i] );
 							PrimBulls[i].ColFlag = 0;
 							break;
 
@@ -1739,7 +1826,7 @@ void ProcessPrimaryBullets( void )
 
    	   			case TRANSPULSE_CANNON:
 				case NME_TRANSPULSE:
-					if( IsGroupVisible[ PrimBulls[i].GroupImIn ] )
+					if( IsGroupVisible[ PrimBullGroup[i] ] )
 					{
 						PrimBulls[i].TimeCount += NewFramelag; //framelag;
 		
@@ -1778,22 +1865,71 @@ void ProcessPrimaryBullets( void )
    	   				break;
 			}
 
-			if( AmIOutsideGroup( &Mloadheader, &PrimBulls[i].Pos, PrimBulls[i].GroupImIn ) )
+			if( AmIOutsideGroup( &Mloadheader, &PrimBullPos[i], PrimBullGroup[i] ) )
 			{
 				DebugPrintf( "Killed %s for getting out of group %s\n", DebugPrimStrings[ PrimBulls[i].Weapon ],
 							 (SecBulls[i].GroupImIn == (u_int16_t) -1) ? "(outside)" : Mloadheader.Group[ SecBulls[i].GroupImIn ].name );
 				CleanUpPrimBull( i, true );
-				goto loop;
+				goto next;
 			}
 
-			Speed = ( PrimBulls[ i ].Speed * NewFramelag ); //framelag );
-			NewPos.x = PrimBulls[ i ].Pos.x + ( PrimBulls[ i ].Dir.x * Speed );
-			NewPos.y = PrimBulls[ i ].Pos.y + ( PrimBulls[ i ].Dir.y * Speed );
-			NewPos.z = PrimBulls[ i ].Pos.z + ( PrimBulls[ i ].Dir.z * Speed );
+			Moving = NumPrimBullsMoving++;
+			PrimBullsMoving[ Moving ] = i;
+			MoveGeneration[ Moving ] = PrimBullGeneration[ i ];
+			MoveStep[ Moving ] = ( PrimBullSpeed[ i ] * NewFramelag ); //framelag );
+			MovePosX[ Moving ] = PrimBullPos[ i ].x;
+			MovePosY[ Moving ] = PrimBullPos[ i ].y;
+			MovePosZ[ Moving ] = PrimBullPos[ i ].z;
+			MoveDirX[ Moving ] = PrimBullDir[ i ].x;
+			MoveDirY[ Moving ] = PrimBullDir[ i ].y;
+			MoveDirZ[ Moving ] = PrimBullDir[ i ].z;
+		}
+		else
+		{
+			switch( PrimBulls[ i ].Weapon )
+			{
+				case NME_LIGHTNING:
+				case NME_LASER:
+				case NME_POWERLASER:
+				case LASER:
+					CleanUpPrimBull( i, false );
+					break;
 
-			DirVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-			DirVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-			DirVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+				case NME_SUSS_GUN:
+					CreateNmeShrapnelExplosion( (VECTOR *) &PrimBullPos[i], &PrimBullDir[i], PrimBullGroup[i] );
+					CleanUpPrimBull( i, false );
+					break;
+
+				case SUSS_GUN:
+					CreateShrapnelExplosion( (VECTOR *) &PrimBullPos[i], &PrimBullDir[i], PrimBullGroup[i] );
+					CleanUpPrimBull( i, false );
+					break;
+
+				default:
+					CleanUpPrimBull( i, true );
+					break;
+			}
+		}
+next:;
+		i = nextprim;
+	}
+
+	IntegratePrimBulls( NumPrimBullsMoving );
+
+	for( Moving = 0; Moving < NumPrimBullsMoving; Moving++ )
+	{
+		i = PrimBullsMoving[ Moving ];
+
+		// a slot killed and refired since it was queued is a different bullet
+		if( PrimBulls[i].Used && ( PrimBullGeneration[ i ] == MoveGeneration[ Moving ] ) )
+		{
+			NewPos.x = MoveNewPosX[ Moving ];
+			NewPos.y = MoveNewPosY[ Moving ];
+			NewPos.z = MoveNewPosZ[ Moving ];
+
+			DirVector.x = MoveOffsetX[ Moving ];
+			DirVector.y = MoveOffsetY[ Moving ];
+			DirVector.z = MoveOffsetZ[ Moving ];
 
 			MoveOffsetVector = DirVector;
 
@@ -1806,23 +1942,23 @@ void ProcessPrimaryBullets( void )
 ===================================================================*/
 			if( !PrimBulls[i].ColFlag )
 			{
-				temp.x = ( PrimBulls[i].Dir.x * MaxColDistance);
-				temp.y = ( PrimBulls[i].Dir.y * MaxColDistance);
-				temp.z = ( PrimBulls[i].Dir.z * MaxColDistance);
+				temp.x = ( PrimBullDir[i].x * MaxColDistance);
+				temp.y = ( PrimBullDir[i].y * MaxColDistance);
+				temp.z = ( PrimBullDir[i].z * MaxColDistance);
 
-				if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, &PrimBulls[i].Pos,
-										PrimBulls[i].GroupImIn, &temp, (VECTOR *) &PrimBulls[i].ColPoint,
+				if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, &PrimBullPos[i],
+										PrimBullGroup[i], &temp, (VECTOR *) &PrimBulls[i].ColPoint,
 										&PrimBulls[i].ColGroup, &PrimBulls[i].ColPointNormal, &TempVector, false, NULL ) )
 				{
-					DebugPrintf( "Primary weapon %d didn't collide with backgroup in group %d\n", PrimBulls[i].Weapon, PrimBulls[i].GroupImIn );
-					if( DebugInfo ) CreateDebugLine( &PrimBulls[i].Pos, &temp, PrimBulls[i].GroupImIn, 255, 64, 64 );
+					DebugPrintf( "Primary weapon %d didn't collide with backgroup in group %d\n", PrimBulls[i].Weapon, PrimBullGroup[i] );
+					if( DebugInfo ) CreateDebugLine( &PrimBullPos[i], &temp, PrimBullGroup[i], 255, 64, 64 );
 					CleanUpPrimBull( i, true );
 					goto loop;
 				}
 				else PrimBulls[i].ColFlag = 1;
 
-				PrimBulls[i].ColStart = PrimBulls[i].Pos;
-				PrimBulls[i].ColDist = (float) fabs( DistanceVert2Vector( (VERT*) &PrimBulls[i].ColPoint, &PrimBulls[i].Pos ) );
+				PrimBulls[i].ColStart = PrimBullPos[i];
+				PrimBulls[i].ColDist = (float) fabs( DistanceVert2Vector( (VERT*) &PrimBulls[i].ColPoint, &PrimBullPos[i] ) );
 			}
 
 /**/
@@ -1835,12 +1971,12 @@ void ProcessPrimaryBullets( void )
 			if( PrimBulls[i].ColDist < DistFromStart )
 		   	{
 				HitWall = 0;
-				DistToInt = (float) fabs( DistanceVert2Vector( (VERT*) &PrimBulls[i].ColPoint, &PrimBulls[i].Pos ) );
+				DistToInt = (float) fabs( DistanceVert2Vector( (VERT*) &PrimBulls[i].ColPoint, &PrimBullPos[i] ) );
 
-				if( OneGroupBGObjectCol( DistToInt, 1, PrimBulls[i].GroupImIn, &PrimBulls[i].Pos, &MoveOffsetVector,
+				if( OneGroupBGObjectCol( DistToInt, 1, PrimBullGroup[i], &PrimBullPos[i], &MoveOffsetVector,
 										 (VECTOR *) &BGPoint, &BGNormal, &TempVector, &BGObject, 0.0F ) )
 				{
-					DistToInt = (float) fabs( DistanceVert2Vector( &BGPoint, &PrimBulls[i].Pos ) );
+					DistToInt = (float) fabs( DistanceVert2Vector( &BGPoint, &PrimBullPos[i] ) );
 					PrimBulls[i].ColPoint = BGPoint;
 					PrimBulls[i].ColPointNormal = BGNormal;
 					if( BGObject ) PrimBulls[i].ColGroup = BGObject->Group;
@@ -1856,10 +1992,10 @@ void ProcessPrimaryBullets( void )
    			}
 			else
 			{
-				if( OneGroupBGObjectCol( 0.0F, 0, PrimBulls[i].GroupImIn, &PrimBulls[i].Pos, &MoveOffsetVector,
+				if( OneGroupBGObjectCol( 0.0F, 0, PrimBullGroup[i], &PrimBullPos[i], &MoveOffsetVector,
 										 (VECTOR *) &BGPoint, &BGNormal, &TempVector, &BGObject, 0.0F ) )
 				{
-					DistToInt = (float) fabs( DistanceVert2Vector( &BGPoint, &PrimBulls[i].Pos ) );
+					DistToInt = (float) fabs( DistanceVert2Vector( &BGPoint, &PrimBullPos[i] ) );
 					PrimBulls[i].ColPoint = BGPoint;
 					PrimBulls[i].ColPointNormal = BGNormal;
 					if( BGObject ) PrimBulls[i].ColGroup = BGObject->Group;
@@ -1878,17 +2014,17 @@ void ProcessPrimaryBullets( void )
 /**/
 			Damage = (int16_t) PrimaryWeaponAttribs[ PrimBulls[i].Weapon ].Damage[ PrimBulls[i].PowerLevel ];
 
-			if ( WaterObjectCollide( PrimBulls[i].GroupImIn,&PrimBulls[i].Pos, &MoveOffsetVector, &Int_Point , Damage) )
+			if ( WaterObjectCollide( PrimBullGroup[i],&PrimBullPos[i], &MoveOffsetVector, &Int_Point , Damage) )
 			{
-				CreateSplash( (VECTOR *) &Int_Point, &PrimBulls[i].Dir, PrimBulls[i].GroupImIn );
+				CreateSplash( (VECTOR *) &Int_Point, &PrimBullDir[i], PrimBullGroup[i] );
 			}
 			
 /**/
-			HitTarget = CheckHitShip( PrimBulls[i].OwnerType, PrimBulls[i].Owner, &PrimBulls[i].Pos, PrimBulls[i].GroupImIn, &DirVector, &PrimBulls[i].UpVector, Length, &Int_Point, &Int_Point2, &DistToInt, PrimBulls[i].ColRadius, PrimBulls[i].ColType );
+			HitTarget = CheckHitShip( PrimBulls[i].OwnerType, PrimBulls[i].Owner, &PrimBullPos[i], PrimBullGroup[i], &DirVector, &PrimBulls[i].UpVector, Length, &Int_Point, &Int_Point2, &DistToInt, PrimBulls[i].ColRadius, PrimBulls[i].ColType );
 			if( HitTarget != (u_int16_t) -1 ) HitWall = (u_int16_t) -1;
 
 /**/
-			HitSecondary = CheckHitSecondary( &PrimBulls[i].Pos, PrimBulls[i].GroupImIn, &DirVector, &PrimBulls[i].UpVector, Length, &MInt_Point, &MInt_Point2, &DistToInt, PrimBulls[i].ColRadius, PrimBulls[i].ColType );
+			HitSecondary = CheckHitSecondary( &PrimBullPos[i], PrimBullGroup[i], &DirVector, &PrimBulls[i].UpVector, Length, &MInt_Point, &MInt_Point2, &DistToInt, PrimBulls[i].ColRadius, PrimBulls[i].ColType );
 			if( HitSecondary != (u_int16_t) -1 )
 			{
 				HitWall = (u_int16_t) -1;
@@ -1896,7 +2032,7 @@ void ProcessPrimaryBullets( void )
 			}
 
 /**/
-			HitEnemy = CheckHitEnemy( PrimBulls[i].OwnerType, PrimBulls[i].Owner, &PrimBulls[i].Pos, &DirVector, &PrimBulls[i].UpVector, Length, &EInt_Point, &EInt_Point2, &DistToInt, PrimBulls[i].ColRadius, PrimBulls[i].ColType );
+			HitEnemy = CheckHitEnemy( PrimBulls[i].OwnerType, PrimBulls[i].Owner, &PrimBullPos[i], &DirVector, &PrimBulls[i].UpVector, Length, &EInt_Point, &EInt_Point2, &DistToInt, PrimBulls[i].ColRadius, PrimBulls[i].ColType );
 			if( HitEnemy != NULL )
 			{
 				HitWall = (u_int16_t) -1;
@@ -1919,9 +2055,9 @@ void ProcessPrimaryBullets( void )
 
 			if( ( HitWall != (u_int16_t) -1 ) || ( HitTarget != (u_int16_t) -1 ) || ( HitSecondary != (u_int16_t) -1 ) || ( HitEnemy != NULL ) )
 			{
-				TrigPos.x = PrimBulls[i].Pos.x + ( PrimBulls[i].Dir.x * DistToInt );
-				TrigPos.y = PrimBulls[i].Pos.y + ( PrimBulls[i].Dir.y * DistToInt );
-				TrigPos.z = PrimBulls[i].Pos.z + ( PrimBulls[i].Dir.z * DistToInt );
+				TrigPos.x = PrimBullPos[i].x + ( PrimBullDir[i].x * DistToInt );
+				TrigPos.y = PrimBullPos[i].y + ( PrimBullDir[i].y * DistToInt );
+				TrigPos.z = PrimBullPos[i].z + ( PrimBullDir[i].z * DistToInt );
 			}
 			else
 			{
@@ -1931,11 +2067,11 @@ void ProcessPrimaryBullets( void )
 			switch( PrimBulls[i].OwnerType )
 			{
 				case OWNER_SHIP:
-					TriggerAreaPlayerShootsCheck( &PrimBulls[i].Pos, &TrigPos, PrimBulls[i].GroupImIn, WEPTYPE_Primary, PrimBulls[i].Weapon );
+					TriggerAreaPlayerShootsCheck( &PrimBullPos[i], &TrigPos, PrimBullGroup[i], WEPTYPE_Primary, PrimBulls[i].Weapon );
 					break;
 
 				case OWNER_ENEMY:
-					TriggerAreaEnemyShootsCheck( &PrimBulls[i].Pos, &TrigPos, PrimBulls[i].GroupImIn, WEPTYPE_Primary, PrimBulls[i].Weapon );
+					TriggerAreaEnemyShootsCheck( &PrimBullPos[i], &TrigPos, PrimBullGroup[i], WEPTYPE_Primary, PrimBulls[i].Weapon );
 					break;
 			}
 
@@ -1950,7 +2086,7 @@ void ProcessPrimaryBullets( void )
 				DistToCenter = VectorLength( &TempVector );
 				NormaliseVector( &TempVector );
 
-		  		ReflectVector( &PrimBulls[i].Dir, (NORMAL *) &TempVector, &NewDir );
+		  		ReflectVector( &PrimBullDir[i], (NORMAL *) &TempVector, &NewDir );
 
 				Damage = PrimaryWeaponAttribs[ PrimBulls[i].Weapon ].Damage[ PrimBulls[i].PowerLevel ];
 
@@ -1979,9 +2115,9 @@ void ProcessPrimaryBullets( void )
 	   	   			case NME_LASER:
 	   	   			case NME_LIGHTNING:
 					case NME_POWERLASER:
-						TempVector.x = ( MInt_Point.x - PrimBulls[ i ].Pos.x );
-						TempVector.y = ( MInt_Point.y - PrimBulls[ i ].Pos.y );
-						TempVector.z = ( MInt_Point.z - PrimBulls[ i ].Pos.z );
+						TempVector.x = ( MInt_Point.x - PrimBullPos[ i ].x );
+						TempVector.y = ( MInt_Point.y - PrimBullPos[ i ].y );
+						TempVector.z = ( MInt_Point.z - PrimBullPos[ i ].z );
 						DistToInt = VectorLength( &TempVector );
 						if( DistToInt > LASER_MINDAMAGERANGE ) DistToInt = LASER_MINDAMAGERANGE;
 						Damage = ( Damage * ( 1.25F - ( ( DistToInt / LASER_MINDAMAGERANGE ) / 2.0F ) ) );
@@ -2060,13 +2196,13 @@ void ProcessPrimaryBullets( void )
 						break;
 
 	   	   			case NME_PULSAR:
-						CreateNmePulsarExplosion( &MInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateNmePulsarExplosion( &MInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
 					case PULSAR:
-						CreatePulsarExplosion( &MInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreatePulsarExplosion( &MInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
@@ -2076,11 +2212,11 @@ void ProcessPrimaryBullets( void )
 						NewPos.x = MInt_Point.x;
 						NewPos.y = MInt_Point.y;
 						NewPos.z = MInt_Point.z;
-						MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-						MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-						MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+						MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+						MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+						MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 
-						PrimBulls[i].Dir = NewDir;
+						PrimBullDir[i] = NewDir;
 						PrimBulls[i].ColFlag = 0;
 						break;
 
@@ -2092,7 +2228,7 @@ void ProcessPrimaryBullets( void )
 					case NME_TROJAX:
 						if( DistToCenter < ( SHIP_RADIUS + 1.0F ) )
 						{
-							CreateNmeTrojaxExplosion( &MInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+							CreateNmeTrojaxExplosion( &MInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2100,7 +2236,7 @@ void ProcessPrimaryBullets( void )
 					case TROJAX:
 						if( DistToCenter < ( SHIP_RADIUS + 1.0F ) )
 						{
-							CreateTrojaxExplosion( &MInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+							CreateTrojaxExplosion( &MInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2109,7 +2245,7 @@ void ProcessPrimaryBullets( void )
 					case NME_TRANSPULSE:
 						if( DistToCenter < ( SHIP_RADIUS + 1.0F ) )
 						{
-							CreateNmeArcExplosion( &MInt_Point, &TempVector, PrimBulls[i].GroupImIn );
+							CreateNmeArcExplosion( &MInt_Point, &TempVector, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2117,46 +2253,46 @@ void ProcessPrimaryBullets( void )
 					case TRANSPULSE_CANNON:
 						if( DistToCenter < ( SHIP_RADIUS + 1.0F ) )
 						{
-							CreateArcExplosion( &MInt_Point, &TempVector, PrimBulls[i].GroupImIn );
+							CreateArcExplosion( &MInt_Point, &TempVector, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
 						break;
 
 					case NME_SUSS_GUN:
-						CreateNmeShrapnelExplosion( &MInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateNmeShrapnelExplosion( &MInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
 					case SUSS_GUN:
-						CreateShrapnelExplosion( &MInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateShrapnelExplosion( &MInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
     				case LASER:
-						CreateLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
 					case NME_LASER:
-						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
 					case NME_POWERLASER:
-						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
 					case NME_LIGHTNING:
-						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
 					case ORBITPULSAR:
-						CreatePulsarExplosion( &MInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreatePulsarExplosion( &MInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
@@ -2175,26 +2311,26 @@ void ProcessPrimaryBullets( void )
 ===================================================================*/
 			if( HitWall != (u_int16_t) -1 )
 			{
-		  		ReflectVector( &PrimBulls[i].Dir, &PrimBulls[i].ColPointNormal, &NewDir );
+		  		ReflectVector( &PrimBullDir[i], &PrimBulls[i].ColPointNormal, &NewDir );
 
 				Killed = false;
 
    				switch( PrimBulls[i].Weapon )
    				{
 					case NME_BULLET1:
-						CreateSparks( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].GroupImIn );
+						CreateSparks( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBullGroup[i] );
    						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
    					case NME_PULSAR:
-						CreateNmePulsarExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBulls[i].GroupImIn );
+						CreateNmePulsarExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBullGroup[i] );
    						CleanUpPrimBull( i, false );
 						Killed = true;
    						break;
 
    					case PULSAR:
-						CreatePulsarExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBulls[i].GroupImIn );
+						CreatePulsarExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBullGroup[i] );
    						CleanUpPrimBull( i, false );
 						Killed = true;
    						break;
@@ -2204,10 +2340,10 @@ void ProcessPrimaryBullets( void )
 						NewPos.x = PrimBulls[i].ColPoint.x;
 						NewPos.y = PrimBulls[i].ColPoint.y;
 						NewPos.z = PrimBulls[i].ColPoint.z;
-						MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-						MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-						MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
-						PrimBulls[i].Dir = NewDir;
+						MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+						MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+						MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
+						PrimBullDir[i] = NewDir;
 						PrimBulls[i].ColFlag = 0;
    						break;
 
@@ -2217,26 +2353,26 @@ void ProcessPrimaryBullets( void )
 						break;
 
    					case NME_TROJAX:
-   						CreateNmeTrojaxExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].fmpoly, 0, PrimBulls[i].GroupImIn );
+   						CreateNmeTrojaxExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].fmpoly, 0, PrimBullGroup[i] );
    						CleanUpPrimBull( i, false );
 						Killed = true;
    						break;
 
    					case TROJAX:
-   						CreateTrojaxExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].fmpoly, 0, PrimBulls[i].GroupImIn );
+   						CreateTrojaxExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].fmpoly, 0, PrimBullGroup[i] );
    						CleanUpPrimBull( i, false );
 						Killed = true;
    						break;
 
    					case NME_TRANSPULSE:
-   						CreateNmeArcExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].GroupImIn );
+   						CreateNmeArcExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBullGroup[i] );
 
 						NewPos.x = PrimBulls[i].ColPoint.x;
 						NewPos.y = PrimBulls[i].ColPoint.y;
 						NewPos.z = PrimBulls[i].ColPoint.z;
-						MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-						MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-						MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+						MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+						MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+						MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 
 						if( !ChangeTranspulseDir( i, &NewPos, &MoveOffsetVector, &NewDir ) )
 						{
@@ -2246,14 +2382,14 @@ void ProcessPrimaryBullets( void )
    						break;
 
    					case TRANSPULSE_CANNON:
-   						CreateArcExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBulls[i].GroupImIn );
+   						CreateArcExplosion( (VECTOR *) &PrimBulls[i].ColPoint, (VECTOR *) &PrimBulls[i].ColPointNormal, PrimBullGroup[i] );
 
 						NewPos.x = PrimBulls[i].ColPoint.x;
 						NewPos.y = PrimBulls[i].ColPoint.y;
 						NewPos.z = PrimBulls[i].ColPoint.z;
-						MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-						MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-						MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+						MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+						MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+						MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 
 						if( !ChangeTranspulseDir( i, &NewPos, &MoveOffsetVector, &NewDir ) )
 						{
@@ -2263,7 +2399,7 @@ void ProcessPrimaryBullets( void )
    						break;
 
    					case NME_SUSS_GUN:
-   						CreateNmeShrapnelExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBulls[i].GroupImIn );
+   						CreateNmeShrapnelExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBullGroup[i] );
 						if( !Random_Range( 16 ) )
 						{
 							PlayPannedSfx( SFX_Ric , PrimBulls[i].ColGroup , (VECTOR *) &PrimBulls[i].ColPoint, 0.0F );
@@ -2273,7 +2409,7 @@ void ProcessPrimaryBullets( void )
    						break;
 
    					case SUSS_GUN:
-   						CreateShrapnelExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBulls[i].GroupImIn );
+   						CreateShrapnelExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBullGroup[i] );
 						if( !Random_Range( 16 ) )
 						{
 							PlayPannedSfx( SFX_Ric, PrimBulls[i].ColGroup , (VECTOR *) &PrimBulls[i].ColPoint, 0.0F );
@@ -2283,27 +2419,27 @@ void ProcessPrimaryBullets( void )
    						break;
 
    					case NME_LIGHTNING:
- 						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+ 						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
    						break;
 
    					case NME_LASER:
- 						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+ 						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
    						break;
 
    					case NME_POWERLASER:
-						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
    					case LASER:
- 						CreateLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+ 						CreateLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
    						break;
 
    					case ORBITPULSAR:
-						CreatePulsarExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBulls[i].GroupImIn );
+						CreatePulsarExplosion( (VECTOR *) &PrimBulls[i].ColPoint, &NewDir, PrimBullGroup[i] );
    						CleanUpPrimBull( i, false );
 						Killed = true;
    						break;
@@ -2360,9 +2496,9 @@ void ProcessPrimaryBullets( void )
 					case NME_LASER:
    					case NME_POWERLASER:
    					case LASER:
-   						TempVector.x = ( Int_Point.x - PrimBulls[ i ].Pos.x );
-   						TempVector.y = ( Int_Point.y - PrimBulls[ i ].Pos.y );
-   						TempVector.z = ( Int_Point.z - PrimBulls[ i ].Pos.z );
+   						TempVector.x = ( Int_Point.x - PrimBullPos[ i ].x );
+   						TempVector.y = ( Int_Point.y - PrimBullPos[ i ].y );
+   						TempVector.z = ( Int_Point.z - PrimBullPos[ i ].z );
    						DistToInt = VectorLength( &TempVector );
    						if( DistToInt > LASER_MINDAMAGERANGE ) DistToInt = LASER_MINDAMAGERANGE;
    						Damage =  ( Damage * ( 1.25F - ( ( DistToInt / LASER_MINDAMAGERANGE ) / 2.0F ) ) );
@@ -2384,9 +2520,9 @@ void ProcessPrimaryBullets( void )
 
 							if( PrimBulls[i].OwnerType == OWNER_ENEMY ) Damage *= NmeDamageModifier;
 
-   							Recoil.x = ( PrimBulls[i].Dir.x * ( Damage / 10.0F ) );
-   							Recoil.y = ( PrimBulls[i].Dir.y * ( Damage / 10.0F ) );
-   							Recoil.z = ( PrimBulls[i].Dir.z * ( Damage / 10.0F ) );
+   							Recoil.x = ( PrimBullDir[i].x * ( Damage / 10.0F ) );
+   							Recoil.y = ( PrimBullDir[i].y * ( Damage / 10.0F ) );
+   							Recoil.z = ( PrimBullDir[i].z * ( Damage / 10.0F ) );
 
 							if( HitTarget == WhoIAm )
 							{
@@ -2411,9 +2547,9 @@ void ProcessPrimaryBullets( void )
 
 							if( PrimBulls[i].OwnerType == OWNER_ENEMY ) Damage *= NmeDamageModifier;
 
-   							Recoil.x = ( PrimBulls[i].Dir.x * ( Damage / 10.0F ) );
-   							Recoil.y = ( PrimBulls[i].Dir.y * ( Damage / 10.0F ) );
-   							Recoil.z = ( PrimBulls[i].Dir.z * ( Damage / 10.0F ) );
+   							Recoil.x = ( PrimBullDir[i].x * ( Damage / 10.0F ) );
+   							Recoil.y = ( PrimBullDir[i].y * ( Damage / 10.0F ) );
+   							Recoil.z = ( PrimBullDir[i].z * ( Damage / 10.0F ) );
 
 							HitMe( PrimBulls[i].OwnerType, PrimBulls[i].Owner, Damage, WEPTYPE_Primary, PrimBulls[i].Weapon );
 							ForceExternalOneOff( WhoIAm, &Recoil );
@@ -2504,7 +2640,7 @@ void ProcessPrimaryBullets( void )
 				TempVector.z = ( Int_Point.z - Ships[ HitTarget ].Object.Pos.z );
 				NormaliseVector( &TempVector );
 
-		  		ReflectVector( &PrimBulls[i].Dir, (NORMAL *) &TempVector, &NewDir );
+		  		ReflectVector( &PrimBullDir[i], (NORMAL *) &TempVector, &NewDir );
 	
 				Killed = false;
 
@@ -2514,11 +2650,11 @@ void ProcessPrimaryBullets( void )
 						if( Ships[ HitTarget ].Invul )
 						{
 							NewPos = Int_Point;
-							PrimBulls[i].Dir = NewDir;
+							PrimBullDir[i] = NewDir;
 							PrimBulls[i].ColFlag = 0;
-							MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-							MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-							MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+							MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+							MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+							MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 						}
 						else
 						{
@@ -2532,13 +2668,13 @@ void ProcessPrimaryBullets( void )
 						{
 							ChangePulsarDir( i, &NewDir );
 							NewPos = Int_Point;
-							MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-							MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-							MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+							MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+							MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+							MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 						}
 						else
 						{
-							CreateNmePulsarExplosion( &Int_Point, &NewDir, PrimBulls[i].GroupImIn );
+							CreateNmePulsarExplosion( &Int_Point, &NewDir, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2549,13 +2685,13 @@ void ProcessPrimaryBullets( void )
 						{
 							ChangePulsarDir( i, &NewDir );
 							NewPos = Int_Point;
-							MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-							MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-							MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+							MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+							MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+							MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 						}
 						else
 						{
-							CreatePulsarExplosion( &Int_Point, &NewDir, PrimBulls[i].GroupImIn );
+							CreatePulsarExplosion( &Int_Point, &NewDir, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2564,10 +2700,10 @@ void ProcessPrimaryBullets( void )
 					case NME_PYROLITE:
 					case PYROLITE_RIFLE:
 						NewPos = Int_Point;
-						MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-						MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-						MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
-						PrimBulls[i].Dir = NewDir;
+						MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+						MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+						MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
+						PrimBullDir[i] = NewDir;
 						PrimBulls[i].ColFlag = 0;
 						break;
 
@@ -2581,16 +2717,16 @@ void ProcessPrimaryBullets( void )
 						{
 							if( Ships[ HitTarget ].Invul )
 							{
-								CreateNmeTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+								CreateNmeTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 								ChangeTrojaxDir( i, &NewDir );
 								NewPos = Int_Point;
-								MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-								MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-								MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+								MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+								MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+								MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 							}
 							else
 							{
-								CreateNmeTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+								CreateNmeTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 								CleanUpPrimBull( i, false );
 								Killed = true;
 							}
@@ -2601,16 +2737,16 @@ void ProcessPrimaryBullets( void )
 						{
 							if( Ships[ HitTarget ].Invul )
 							{
-								CreateTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+								CreateTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 								ChangeTrojaxDir( i, &NewDir );
 								NewPos = Int_Point;
-								MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-								MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-								MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+								MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+								MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+								MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 							}
 							else
 							{
-								CreateTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+								CreateTrojaxExplosion( &Int_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 								CleanUpPrimBull( i, false );
 								Killed = true;
 							}
@@ -2620,14 +2756,14 @@ void ProcessPrimaryBullets( void )
 					case NME_TRANSPULSE:
 						if( DistToCenter < ( SHIP_RADIUS + 1.0F ) )
 						{
-							CreateNmeArcExplosion( &Int_Point, &TempVector, PrimBulls[i].GroupImIn );
+							CreateNmeArcExplosion( &Int_Point, &TempVector, PrimBullGroup[i] );
 
 							if( Ships[ HitTarget ].Invul )
  							{
 								NewPos = Int_Point;
-								MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-								MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-								MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+								MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+								MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+								MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 
 								if( !ChangeTranspulseDir( i, &NewPos, &MoveOffsetVector, &NewDir ) )
 								{
@@ -2645,14 +2781,14 @@ void ProcessPrimaryBullets( void )
 					case TRANSPULSE_CANNON:
 						if( DistToCenter < ( SHIP_RADIUS + 1.0F ) )
 						{
-							CreateArcExplosion( &Int_Point, &TempVector, PrimBulls[i].GroupImIn );
+							CreateArcExplosion( &Int_Point, &TempVector, PrimBullGroup[i] );
 
 							if( Ships[ HitTarget ].Invul )
  							{
 								NewPos = Int_Point;
-								MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-								MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-								MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+								MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+								MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+								MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 
 								if( !ChangeTranspulseDir( i, &NewPos, &MoveOffsetVector, &NewDir ) )
 								{
@@ -2673,13 +2809,13 @@ void ProcessPrimaryBullets( void )
 						{
 							ChangeSussgunDir( i, &NewDir );
 							NewPos = Int_Point;
-							MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-							MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-							MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+							MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+							MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+							MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 						}
 						else
 						{
-							CreateNmeShrapnelExplosion( &Int_Point, &NewDir, PrimBulls[i].GroupImIn );
+							CreateNmeShrapnelExplosion( &Int_Point, &NewDir, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2690,35 +2826,35 @@ void ProcessPrimaryBullets( void )
 						{
 							ChangeSussgunDir( i, &NewDir );
 							NewPos = Int_Point;
-							MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-							MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-							MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+							MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+							MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+							MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 						}
 						else
 						{
-							CreateShrapnelExplosion( &Int_Point, &NewDir, PrimBulls[i].GroupImIn );
+							CreateShrapnelExplosion( &Int_Point, &NewDir, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
 						break;
 
     				case NME_LIGHTNING:
-						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
     				case NME_LASER:
-						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
    					case NME_POWERLASER:
-						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
     				case LASER:
-						CreateLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
@@ -2727,13 +2863,13 @@ void ProcessPrimaryBullets( void )
 						{
 							ChangeOrbitPulsarDir( i, &NewDir );
 							NewPos = Int_Point;
-							MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-							MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-							MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+							MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+							MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+							MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 						}
 						else
 						{
-							CreatePulsarExplosion( &Int_Point, &NewDir, PrimBulls[i].GroupImIn );
+							CreatePulsarExplosion( &Int_Point, &NewDir, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2759,7 +2895,7 @@ void ProcessPrimaryBullets( void )
 				DistToCenter = VectorLength( &TempVector );
 				NormaliseVector( &TempVector );
 
-		  		ReflectVector( &PrimBulls[i].Dir, (NORMAL *) &TempVector, &NewDir );
+		  		ReflectVector( &PrimBullDir[i], (NORMAL *) &TempVector, &NewDir );
 
 				Damage = PrimaryWeaponAttribs[ PrimBulls[i].Weapon ].Damage[ PrimBulls[i].PowerLevel ];
 				if( ( PrimBulls[ i ].Weapon == LASER ) ||
@@ -2773,9 +2909,9 @@ void ProcessPrimaryBullets( void )
 
 				if( !( HitEnemy->Object.Flags & SHIP_Invul ) )
 				{
-					if( DamageEnemy( HitEnemy , -Damage , &EInt_Point , &PrimBulls[i].Dir , PrimBulls[ i ].Speed, PrimBulls[ i ].Owner ,PrimBulls[ i ].OwnerType ) )
+					if( DamageEnemy( HitEnemy , -Damage , &EInt_Point , &PrimBullDir[i] , PrimBullSpeed[ i ], PrimBulls[ i ].Owner ,PrimBulls[ i ].OwnerType ) )
 					{
-						CreateNewExplosion( &EInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateNewExplosion( &EInt_Point, &NewDir, PrimBullGroup[i] );
 						KillUsedEnemy( HitEnemy );
 					}
 					else
@@ -2801,13 +2937,13 @@ void ProcessPrimaryBullets( void )
 						break;
 
 					case NME_PULSAR:
-						CreateNmePulsarExplosion( &EInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateNmePulsarExplosion( &EInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
 					case PULSAR:
-						CreatePulsarExplosion( &EInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreatePulsarExplosion( &EInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
@@ -2815,11 +2951,11 @@ void ProcessPrimaryBullets( void )
 					case NME_PYROLITE:
 					case PYROLITE_RIFLE:
 						NewPos = EInt_Point;
-						MoveOffsetVector.x = ( NewPos.x - PrimBulls[ i ].Pos.x );						/* Dir Vector to NewPosition */
-						MoveOffsetVector.y = ( NewPos.y - PrimBulls[ i ].Pos.y );
-						MoveOffsetVector.z = ( NewPos.z - PrimBulls[ i ].Pos.z );
+						MoveOffsetVector.x = ( NewPos.x - PrimBullPos[ i ].x );						/* Dir Vector to NewPosition */
+						MoveOffsetVector.y = ( NewPos.y - PrimBullPos[ i ].y );
+						MoveOffsetVector.z = ( NewPos.z - PrimBullPos[ i ].z );
 
-						PrimBulls[i].Dir = NewDir;
+						PrimBullDir[i] = NewDir;
 						PrimBulls[i].ColFlag = 0;
 						break;
 
@@ -2830,7 +2966,7 @@ void ProcessPrimaryBullets( void )
 					case NME_TROJAX:
 						if( DistToCenter < ( EnemyTypes[ HitEnemy->Type ].Radius + 1.0F ) )
 						{
-							CreateNmeTrojaxExplosion( &EInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+							CreateNmeTrojaxExplosion( &EInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2839,7 +2975,7 @@ void ProcessPrimaryBullets( void )
 					case TROJAX:
 						if( DistToCenter < ( EnemyTypes[ HitEnemy->Type ].Radius + 1.0F ) )
 						{
-							CreateTrojaxExplosion( &EInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBulls[i].GroupImIn );
+							CreateTrojaxExplosion( &EInt_Point, &TempVector, PrimBulls[i].fmpoly, 1, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2847,7 +2983,7 @@ void ProcessPrimaryBullets( void )
 					case NME_TRANSPULSE:
 						if( DistToCenter < ( EnemyTypes[ HitEnemy->Type ].Radius + 1.0F ) )
 						{
-							CreateNmeArcExplosion( &EInt_Point, &TempVector, PrimBulls[i].GroupImIn );
+							CreateNmeArcExplosion( &EInt_Point, &TempVector, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
@@ -2856,46 +2992,46 @@ void ProcessPrimaryBullets( void )
 					case TRANSPULSE_CANNON:
 						if( DistToCenter < ( EnemyTypes[ HitEnemy->Type ].Radius + 1.0F ) )
 						{
-							CreateArcExplosion( &EInt_Point, &TempVector, PrimBulls[i].GroupImIn );
+							CreateArcExplosion( &EInt_Point, &TempVector, PrimBullGroup[i] );
 							CleanUpPrimBull( i, false );
 							Killed = true;
 						}
 						break;
 
 					case NME_SUSS_GUN:
-						CreateNmeShrapnelExplosion( &EInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateNmeShrapnelExplosion( &EInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
 					case SUSS_GUN:
-						CreateShrapnelExplosion( &EInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreateShrapnelExplosion( &EInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
 
     				case NME_LIGHTNING:
-						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmeLightningPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
     				case NME_LASER:
-						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmeLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
    					case NME_POWERLASER:
-						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateNmePowerLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
     				case LASER:
-						CreateLaserPulse( i, DistToInt, &NewDir, PrimBulls[i].GroupImIn, PrimBulls[i].ColGroup );
+						CreateLaserPulse( i, DistToInt, &NewDir, PrimBullGroup[i], PrimBulls[i].ColGroup );
 						Killed = true;
 						break;
 
 					case ORBITPULSAR:
-						CreatePulsarExplosion( &EInt_Point, &NewDir, PrimBulls[i].GroupImIn );
+						CreatePulsarExplosion( &EInt_Point, &NewDir, PrimBullGroup[i] );
 						CleanUpPrimBull( i, false );
 						Killed = true;
 						break;
@@ -2913,21 +3049,21 @@ void ProcessPrimaryBullets( void )
 /*===================================================================
 			Done all collision checks
 ===================================================================*/
-			PrimBulls[i].GroupImIn = MoveGroup( &Mloadheader, &PrimBulls[i].Pos, PrimBulls[i].GroupImIn, &MoveOffsetVector );
+			PrimBullGroup[i] = MoveGroup( &Mloadheader, &PrimBullPos[i], PrimBullGroup[i], &MoveOffsetVector );
 
-			PrimBulls[i].Pos = NewPos;
+			PrimBullPos[i] = NewPos;
 
 			if ( PrimBulls[i].light != (u_int16_t) -1 )
 			{
-				XLights[PrimBulls[i].light].Group = PrimBulls[i].GroupImIn;
-				XLights[PrimBulls[i].light].Pos = PrimBulls[i].Pos;
+				XLights[PrimBulls[i].light].Group = PrimBullGroup[i];
+				XLights[PrimBulls[i].light].Pos = PrimBullPos[i];
 			}
 
 			if( PrimBulls[i].line != (u_int16_t) -1 )
 			{
 				Lines[ PrimBulls[i].line ].EndPos = Lines[ PrimBulls[i].line ].StartPos;
-				Lines[ PrimBulls[i].line ].StartPos = PrimBulls[i].Pos;
-				Lines[ PrimBulls[i].line ].Group = PrimBulls[i].GroupImIn;
+				Lines[ PrimBulls[i].line ].StartPos = PrimBullPos[i];
+				Lines[ PrimBulls[i].line ].Group = PrimBullGroup[i];
 			}
 
 			if ( PrimBulls[i].fmpoly != (u_int16_t) -1 )
@@ -2940,10 +3076,10 @@ void ProcessPrimaryBullets( void )
 			
 					if ( fmpoly != (u_int16_t) -1 )
 					{
-						FmPolys[ fmpoly ].Pos.x += MoveOffsetVector.x; //(PrimBulls[i].Dir.x * Speed);
-						FmPolys[ fmpoly ].Pos.y += MoveOffsetVector.y; //(PrimBulls[i].Dir.y * Speed);
-						FmPolys[ fmpoly ].Pos.z += MoveOffsetVector.z; //(PrimBulls[i].Dir.z * Speed);
-						FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+						FmPolys[ fmpoly ].Pos.x += MoveOffsetVector.x; //(PrimBullDir[i].x * Speed);
+						FmPolys[ fmpoly ].Pos.y += MoveOffsetVector.y; //(PrimBullDir[i].y * Speed);
+						FmPolys[ fmpoly ].Pos.z += MoveOffsetVector.z; //(PrimBullDir[i].z * Speed);
+						FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					}
 			
 					fmpoly = nextfmpoly;
@@ -2976,7 +3112,7 @@ void ProcessPrimaryBullets( void )
 						Polys[ poly ].Pos4.x += MoveOffsetVector.x;
 						Polys[ poly ].Pos4.y += MoveOffsetVector.y;
 						Polys[ poly ].Pos4.z += MoveOffsetVector.z;
-						Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+						Polys[ poly ].Group = PrimBullGroup[i];
 					}
 			
 					poly = nextpoly;
@@ -2984,34 +3120,7 @@ void ProcessPrimaryBullets( void )
 			}
 
 		}
-		else
-		{
-			switch( PrimBulls[ i ].Weapon )
-			{
-				case NME_LIGHTNING:
-				case NME_LASER:
-				case NME_POWERLASER:
-				case LASER:
-					CleanUpPrimBull( i, false );
-					break;
-
-				case NME_SUSS_GUN:
-					CreateNmeShrapnelExplosion( (VECTOR *) &PrimBulls[i].Pos, &PrimBulls[i].Dir, PrimBulls[i].GroupImIn );
-					CleanUpPrimBull( i, false );
-					break;
-
-				case SUSS_GUN:
-					CreateShrapnelExplosion( (VECTOR *) &PrimBulls[i].Pos, &PrimBulls[i].Dir, PrimBulls[i].GroupImIn );
-					CleanUpPrimBull( i, false );
-					break;
-
-				default:
-					CleanUpPrimBull( i, true );
-					break;
-			}
-		}
 loop:;
-		i = nextprim;
 	}
 }
 
@@ -3635,7 +3744,7 @@ void CleanUpPrimBull( u_int16_t i, bool LightFlag  )
 	PrimBulls[i].numpolys = 0;
 	PrimBulls[i].poly = (u_int16_t) -1;
 
-	PrimBulls[i].LifeCount = 0.0F;
+	PrimBullLifeCount[i] = 0.0F;
 
 	KillUsedPrimBull( i );
 }
@@ -3691,10 +3800,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 	if( i != (u_int16_t) -1 )
 	{
 		PrimBulls[i].Offset = *Offset;
-		PrimBulls[i].Pos.x = ( Pos->x + Offset->x );
-		PrimBulls[i].Pos.y = ( Pos->y + Offset->y );
-		PrimBulls[i].Pos.z = ( Pos->z + Offset->z );
-		PrimBulls[i].Dir = *Dir;
+		PrimBullPos[i].x = ( Pos->x + Offset->x );
+		PrimBullPos[i].y = ( Pos->y + Offset->y );
+		PrimBullPos[i].z = ( Pos->z + Offset->z );
+		PrimBullDir[i] = *Dir;
 		PrimBulls[i].UpVector = *Up;
 		PrimBulls[i].OwnerType = OwnerType;
 		PrimBulls[i].Owner = OwnerID;
@@ -3703,13 +3812,13 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 		PrimBulls[i].PowerLevel = PowerLevel;
 		PrimBulls[i].ColRadius = PrimaryWeaponAttribs[ Weapon ].ColRadius[ PowerLevel ];
 		PrimBulls[i].ColType = PrimaryWeaponAttribs[ Weapon ].ColType;
-		PrimBulls[i].Speed =	 PrimaryWeaponAttribs[ Weapon ].Speed[ PowerLevel ];
-		PrimBulls[i].LifeCount = PrimaryWeaponAttribs[ Weapon ].LifeCount;
+		PrimBullSpeed[i] =	 PrimaryWeaponAttribs[ Weapon ].Speed[ PowerLevel ];
+		PrimBullLifeCount[i] = PrimaryWeaponAttribs[ Weapon ].LifeCount;
 		PrimBulls[i].ColFlag = 0;
 		PrimBulls[i].ColPoint.x = MaxColDistance;
 		PrimBulls[i].ColPoint.y = MaxColDistance;
 		PrimBulls[i].ColPoint.z = MaxColDistance;
-		PrimBulls[i].GroupImIn = Group;
+		PrimBullGroup[i] = Group;
 		PrimBulls[i].numfmpolys = 0;
 		PrimBulls[i].numpolys = 0;
 		PrimBulls[i].fmpoly = (u_int16_t) -1;
@@ -3726,7 +3835,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 			( Weapon != NME_POWERLASER ) &&
 			( Weapon != NME_LIGHTNING ) )
 		{
-			PrimBulls[i].GroupImIn = MoveGroup( &Mloadheader, Pos, Group, Offset );
+			PrimBullGroup[i] = MoveGroup( &Mloadheader, Pos, Group, Offset );
 		}
 
 		GetLaserLocalVector( i, &PrimBulls[i].LocalDir );
@@ -3753,30 +3862,30 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					{
 						if( Ships[ OwnerID ].Object.Flags & SHIP_PrimToggle )
 						{
-							PlayPannedSfx( SFX_Pulsar, PrimBulls[i].GroupImIn, Pos, 0.0F );
+							PlayPannedSfx( SFX_Pulsar, PrimBullGroup[i], Pos, 0.0F );
 						}
 					}
 					else
 					{
-						PlayPannedSfx( SFX_Pulsar, PrimBulls[i].GroupImIn, Pos, 0.0F );
+						PlayPannedSfx( SFX_Pulsar, PrimBullGroup[i], Pos, 0.0F );
 					}
 				}
 				else 
 				{
-					PlayPannedSfx( SFX_Pulsar, PrimBulls[i].GroupImIn, &PrimBulls[i].Pos, 0.0F );
+					PlayPannedSfx( SFX_Pulsar, PrimBullGroup[i], &PrimBullPos[i], 0.0F );
 				}
 
 				light = FindFreeXLight();
 
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -3786,14 +3895,14 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
    				if( fmpoly != (u_int16_t ) -1 )
    				{
    					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-   					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+   					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
    					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
    					FmPolys[ fmpoly ].Frame = 0.0F;
    					FmPolys[ fmpoly ].Flags = FM_FLAG_ZERO;
    					FmPolys[ fmpoly ].xsize = PULSAR_FMSIZE;
    					FmPolys[ fmpoly ].ysize = PULSAR_FMSIZE;
    					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 255;
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
@@ -3813,18 +3922,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1.x = PrimBulls[i].Pos.x - ( LeftVector.x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.y = PrimBulls[i].Pos.y - ( LeftVector.y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.z = PrimBulls[i].Pos.z - ( LeftVector.z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.x = PrimBulls[i].Pos.x + ( LeftVector.x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.y = PrimBulls[i].Pos.y + ( LeftVector.y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.z = PrimBulls[i].Pos.z + ( LeftVector.z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos3.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) + ( LeftVector.x * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) + ( LeftVector.y * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) + ( LeftVector.z * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) - ( LeftVector.x * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) - ( LeftVector.y * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) - ( LeftVector.z * PULSAR_TAILEND );
+					Polys[ poly ].Pos1.x = PrimBullPos[i].x - ( LeftVector.x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.y = PrimBullPos[i].y - ( LeftVector.y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.z = PrimBullPos[i].z - ( LeftVector.z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.x = PrimBullPos[i].x + ( LeftVector.x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.y = PrimBullPos[i].y + ( LeftVector.y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.z = PrimBullPos[i].z + ( LeftVector.z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos3.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) + ( LeftVector.x * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) + ( LeftVector.y * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) + ( LeftVector.z * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) - ( LeftVector.x * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) - ( LeftVector.y * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) - ( LeftVector.z * PULSAR_TAILEND );
 					Polys[ poly ].Col1.R = 255;
 					Polys[ poly ].Col1.G = 255;
 					Polys[ poly ].Col1.B = 255;
@@ -3852,7 +3961,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frm_Info = &Pulsar_Trail_Header;
 					Polys[ poly ].Frame = 0.0F;
 					Polys[ poly ].SeqNum = POLY_PULSAR_TRAIL;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -3864,18 +3973,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1.x = PrimBulls[i].Pos.x - ( -Up->x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.y = PrimBulls[i].Pos.y - ( -Up->y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.z = PrimBulls[i].Pos.z - ( -Up->z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.x = PrimBulls[i].Pos.x + ( -Up->x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.y = PrimBulls[i].Pos.y + ( -Up->y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.z = PrimBulls[i].Pos.z + ( -Up->z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos3.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) + ( -Up->x * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) + ( -Up->y * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) + ( -Up->z * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) - ( -Up->x * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) - ( -Up->y * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) - ( -Up->z * PULSAR_TAILEND );
+					Polys[ poly ].Pos1.x = PrimBullPos[i].x - ( -Up->x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.y = PrimBullPos[i].y - ( -Up->y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.z = PrimBullPos[i].z - ( -Up->z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.x = PrimBullPos[i].x + ( -Up->x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.y = PrimBullPos[i].y + ( -Up->y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.z = PrimBullPos[i].z + ( -Up->z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos3.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) + ( -Up->x * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) + ( -Up->y * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) + ( -Up->z * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) - ( -Up->x * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) - ( -Up->y * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) - ( -Up->z * PULSAR_TAILEND );
 					Polys[ poly ].Col1.R = 255;
 					Polys[ poly ].Col1.G = 255;
 					Polys[ poly ].Col1.B = 255;
@@ -3903,7 +4012,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frm_Info = &Pulsar_Trail_Header;
 					Polys[ poly ].Frame = 0.0F;
 					Polys[ poly ].SeqNum = POLY_PULSAR_TRAIL;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -3918,18 +4027,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				PrimBulls[i].PowerLevel = (int16_t) ( ( PLevel + ( 100.0F / ( MAXPOWERLEVELS - 1 ) ) - 1 ) / ( 100.0F / ( MAXPOWERLEVELS - 1 ) ) );
 				PrimBulls[i].ColRadius = ( ( 3.0F + ( PLevel * 0.075F ) ) * GLOBAL_SCALE ) * 30.0F;
 
-				PlayPannedSfx( SFX_Trojax, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_Trojax, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PrimBulls[i].PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PrimBulls[i].PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PrimBulls[i].PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -3937,7 +4046,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].Frame = 0.0F;
 				  	FmPolys[ fmpoly ].Flags = ( FM_FLAG_DIRCONST | FM_FLAG_TWOSIDED );
 					FmPolys[ fmpoly ].DirVector = *Dir;
@@ -3954,7 +4063,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].Trans = (u_int8_t) ( 205 + ( PLevel * 0.5F ) );
 #endif
 
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 	
@@ -3993,7 +4102,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( PyroCount > 60.0F )
 				{
 					PyroCount = FMOD( PyroCount, 60.0F );
-					PlayPannedSfx( SFX_Pyroloop, PrimBulls[i].GroupImIn, Pos, 0.0F );
+					PlayPannedSfx( SFX_Pyroloop, PrimBullGroup[i], Pos, 0.0F );
 				}
 
 				if( PyroLightFlag )
@@ -4003,13 +4112,13 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					light = FindFreeXLight();
 					if( light != (u_int16_t ) -1 )					// Light attached
 					{
-						XLights[ light ].Pos = PrimBulls[i].Pos;
+						XLights[ light ].Pos = PrimBullPos[i];
 						XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 						XLights[ light ].SizeCount = 0.0F;
 						XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 						XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 						XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-						XLights[ light ].Group = PrimBulls[i].GroupImIn;
+						XLights[ light ].Group = PrimBullGroup[i];
 						PrimBulls[i].light = light;
 					}
 				}
@@ -4017,7 +4126,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				fmpoly = FindFreeFmPoly();					// Faceme polygon attached
 				if( fmpoly != (u_int16_t ) -1 )
 				{
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].xsize = ( ( PowerLevel * PYROLITE_POWERMUL ) + PYROLITE_ADDMIN );
@@ -4035,7 +4144,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].R = 128;
 				   	FmPolys[ fmpoly ].G = 128;
 				   	FmPolys[ fmpoly ].B = 128;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -4068,17 +4177,17 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					}
 				}
 
-				PlayPannedSfx(SFX_Transpulse, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx(SFX_Transpulse, PrimBullGroup[i], Pos, 0.0F );
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4086,7 +4195,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].Dir = *Dir;
 					FmPolys[ fmpoly ].Speed = PrimaryWeaponAttribs[ Weapon ].Speed[ PowerLevel ];
 					FmPolys[ fmpoly ].SeqNum = FM_ARC2;
@@ -4095,7 +4204,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					FmPolys[ fmpoly ].xsize = ( ( PowerLevel * TRANSPULSE_POWERMUL ) + TRANSPULSE_ADDMIN );
 					FmPolys[ fmpoly ].ysize = ( ( PowerLevel * TRANSPULSE_POWERMUL ) + TRANSPULSE_ADDMIN );
 					FmPolys[ fmpoly ].Frm_Info = &Flare_Header;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 255;
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
@@ -4113,7 +4222,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = ( FM_FLAG_DIRCONST | FM_FLAG_TWOSIDED );
@@ -4122,7 +4231,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
 					FmPolys[ fmpoly ].DirVector = *Up;
 					FmPolys[ fmpoly ].UpVector = *Dir;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 255;
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
@@ -4151,27 +4260,27 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					}
 				}
 
-				PrimBulls[ i ].LifeCount = ( 30.0F + Random_Range( (u_int16_t) ( ( PowerLevel * SUSSGUNLIFE_POWERMUL ) + SUSSGUNLIFE_ADDMIN ) ) );
+				PrimBullLifeCount[ i ] = ( 30.0F + Random_Range( (u_int16_t) ( ( PowerLevel * SUSSGUNLIFE_POWERMUL ) + SUSSGUNLIFE_ADDMIN ) ) );
 
-				PlayPannedSfx( SFX_Suss_Gun, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_Suss_Gun, PrimBullGroup[i], Pos, 0.0F );
 
 				Size = SussgunTable[ PrimBulls[i].PowerLevel ];
 
 				Half = (float) ( ( 1.0F / ( Size / 5120.0F ) ) / 2.0F );
-		   		PrimBulls[i].Dir.x += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
-		   		PrimBulls[i].Dir.y += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
-		   		PrimBulls[i].Dir.z += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
+		   		PrimBullDir[i].x += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
+		   		PrimBullDir[i].y += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
+		   		PrimBullDir[i].z += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4179,14 +4288,14 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = FM_FLAG_ZERO;
 					FmPolys[ fmpoly ].xsize = ( PowerLevel * SUSSGUN_POWERMUL ) + SUSSGUN_ADDMIN;
 					FmPolys[ fmpoly ].ysize = FmPolys[ fmpoly ].xsize;
 					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 255;
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
@@ -4226,18 +4335,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				LaserDiameter = ( ( PowerLevel * LASER_WIDTH_POWERMUL ) + LASER_WIDTH_ADDMIN );
 
-				PlayPannedSfx( SFX_Laser, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_Laser, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4245,7 +4354,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = FM_ARC2;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = FM_FLAG_MOVEOUT;
@@ -4260,7 +4369,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
 					FmPolys[ fmpoly ].Frm_Info = &Flare_Header;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -4269,10 +4378,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				poly = FindFreePoly();
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos2 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos3 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos4 = PrimBulls[i].Pos;
+					Polys[ poly ].Pos1 = PrimBullPos[i];
+					Polys[ poly ].Pos2 = PrimBullPos[i];
+					Polys[ poly ].Pos3 = PrimBullPos[i];
+					Polys[ poly ].Pos4 = PrimBullPos[i];
 					Polys[ poly ].Col1.R = 255;
 					Polys[ poly ].Col1.G = 255;
 					Polys[ poly ].Col1.B = 255;
@@ -4300,7 +4409,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frm_Info = &Laser_Header;
 					Polys[ poly ].Frame = 0.0F;
 					Polys[ poly ].SeqNum = POLY_LASER;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -4312,10 +4421,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					poly = FindFreePoly();
 					if( poly != (u_int16_t) -1 )
 					{
-						Polys[ poly ].Pos1 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos2 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos3 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos4 = PrimBulls[i].Pos;
+						Polys[ poly ].Pos1 = PrimBullPos[i];
+						Polys[ poly ].Pos2 = PrimBullPos[i];
+						Polys[ poly ].Pos3 = PrimBullPos[i];
+						Polys[ poly ].Pos4 = PrimBullPos[i];
 						Polys[ poly ].Col1.R = 255;
 						Polys[ poly ].Col1.G = 255;
 						Polys[ poly ].Col1.B = 255;
@@ -4343,7 +4452,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 						Polys[ poly ].Frm_Info = &Laser_Header;
 						Polys[ poly ].Frame = 0.0F;
 						Polys[ poly ].SeqNum = POLY_LASER;
-						Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+						Polys[ poly ].Group = PrimBullGroup[i];
 						PrimBulls[i].numpolys++;
 						PrimBulls[i].poly = poly;
 
@@ -4356,18 +4465,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 			ORBIT PULSAR
 ===================================================================*/
 		   	case ORBITPULSAR:
-				//PlayPannedSfxWithVolModify(SFX_Orbit, PrimBulls[i].GroupImIn, Pos, 0.0F, 0.75F );
-				PlayPannedSfx(SFX_Orbit, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				//PlayPannedSfxWithVolModify(SFX_Orbit, PrimBullGroup[i], Pos, 0.0F, 0.75F );
+				PlayPannedSfx(SFX_Orbit, PrimBullGroup[i], Pos, 0.0F );
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4392,14 +4501,14 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].Trans = 255;
 #endif
    					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-   					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+   					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
    					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
    					FmPolys[ fmpoly ].Frame = 0.0F;
    					FmPolys[ fmpoly ].Flags = FM_FLAG_ZERO;
    					FmPolys[ fmpoly ].xsize = ORBITPULSAR_FMSIZE;
    					FmPolys[ fmpoly ].ysize = ORBITPULSAR_FMSIZE;
    					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
    					PrimBulls[i].numfmpolys++;
    					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -4420,20 +4529,20 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					}
 				}
 
-				CreateMuzzleFlash( &PrimBulls[i].Pos, PrimBulls[i].GroupImIn, 5.0F );
+				CreateMuzzleFlash( &PrimBullPos[i], PrimBullGroup[i], 5.0F );
 
-				PlayPannedSfx( SFX_EnemyPulsar, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_EnemyPulsar, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4448,14 +4557,14 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].Trans = 255;
 #endif
    					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-   					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+   					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
    					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
    					FmPolys[ fmpoly ].Frame = 0.0F;
    					FmPolys[ fmpoly ].Flags = FM_FLAG_ZERO;
    					FmPolys[ fmpoly ].xsize = NMEBUL1_FMSIZE;
    					FmPolys[ fmpoly ].ysize = NMEBUL1_FMSIZE;
    					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
    					PrimBulls[i].numfmpolys++;
    					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -4476,19 +4585,19 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					}
 				}
 
-				PlayPannedSfx( SFX_EnemyPulsar, PrimBulls[i].GroupImIn, &PrimBulls[i].Pos, 0.0F );
+				PlayPannedSfx( SFX_EnemyPulsar, PrimBullGroup[i], &PrimBullPos[i], 0.0F );
 
 				light = FindFreeXLight();
 
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4498,14 +4607,14 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
    				if( fmpoly != (u_int16_t ) -1 )
    				{
    					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-   					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+   					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
    					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
    					FmPolys[ fmpoly ].Frame = 0.0F;
    					FmPolys[ fmpoly ].Flags = FM_FLAG_ZERO;
    					FmPolys[ fmpoly ].xsize = PULSAR_FMSIZE;
    					FmPolys[ fmpoly ].ysize = PULSAR_FMSIZE;
    					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 255;
 				   	FmPolys[ fmpoly ].G = 64; //255;
 				   	FmPolys[ fmpoly ].B = 64; //255;
@@ -4525,18 +4634,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1.x = PrimBulls[i].Pos.x - ( LeftVector.x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.y = PrimBulls[i].Pos.y - ( LeftVector.y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.z = PrimBulls[i].Pos.z - ( LeftVector.z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.x = PrimBulls[i].Pos.x + ( LeftVector.x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.y = PrimBulls[i].Pos.y + ( LeftVector.y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.z = PrimBulls[i].Pos.z + ( LeftVector.z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos3.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) + ( LeftVector.x * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) + ( LeftVector.y * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) + ( LeftVector.z * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) - ( LeftVector.x * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) - ( LeftVector.y * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) - ( LeftVector.z * PULSAR_TAILEND );
+					Polys[ poly ].Pos1.x = PrimBullPos[i].x - ( LeftVector.x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.y = PrimBullPos[i].y - ( LeftVector.y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.z = PrimBullPos[i].z - ( LeftVector.z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.x = PrimBullPos[i].x + ( LeftVector.x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.y = PrimBullPos[i].y + ( LeftVector.y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.z = PrimBullPos[i].z + ( LeftVector.z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos3.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) + ( LeftVector.x * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) + ( LeftVector.y * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) + ( LeftVector.z * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) - ( LeftVector.x * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) - ( LeftVector.y * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) - ( LeftVector.z * PULSAR_TAILEND );
 					Polys[ poly ].Col1.R = 255;
 					Polys[ poly ].Col1.G = 64; //255;
 					Polys[ poly ].Col1.B = 64; //255;
@@ -4564,7 +4673,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frm_Info = &Pulsar_Trail_Header;
 					Polys[ poly ].Frame = 0.0F;
 					Polys[ poly ].SeqNum = POLY_PULSAR_TRAIL;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -4576,18 +4685,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1.x = PrimBulls[i].Pos.x - ( -Up->x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.y = PrimBulls[i].Pos.y - ( -Up->y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos1.z = PrimBulls[i].Pos.z - ( -Up->z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.x = PrimBulls[i].Pos.x + ( -Up->x * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.y = PrimBulls[i].Pos.y + ( -Up->y * PULSAR_TAILSTART );
-					Polys[ poly ].Pos2.z = PrimBulls[i].Pos.z + ( -Up->z * PULSAR_TAILSTART );
-					Polys[ poly ].Pos3.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) + ( -Up->x * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) + ( -Up->y * PULSAR_TAILEND );
-					Polys[ poly ].Pos3.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) + ( -Up->z * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.x = PrimBulls[i].Pos.x + ( Dir->x * Trail_Length ) - ( -Up->x * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.y = PrimBulls[i].Pos.y + ( Dir->y * Trail_Length ) - ( -Up->y * PULSAR_TAILEND );
-					Polys[ poly ].Pos4.z = PrimBulls[i].Pos.z + ( Dir->z * Trail_Length ) - ( -Up->z * PULSAR_TAILEND );
+					Polys[ poly ].Pos1.x = PrimBullPos[i].x - ( -Up->x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.y = PrimBullPos[i].y - ( -Up->y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos1.z = PrimBullPos[i].z - ( -Up->z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.x = PrimBullPos[i].x + ( -Up->x * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.y = PrimBullPos[i].y + ( -Up->y * PULSAR_TAILSTART );
+					Polys[ poly ].Pos2.z = PrimBullPos[i].z + ( -Up->z * PULSAR_TAILSTART );
+					Polys[ poly ].Pos3.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) + ( -Up->x * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) + ( -Up->y * PULSAR_TAILEND );
+					Polys[ poly ].Pos3.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) + ( -Up->z * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.x = PrimBullPos[i].x + ( Dir->x * Trail_Length ) - ( -Up->x * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.y = PrimBullPos[i].y + ( Dir->y * Trail_Length ) - ( -Up->y * PULSAR_TAILEND );
+					Polys[ poly ].Pos4.z = PrimBullPos[i].z + ( Dir->z * Trail_Length ) - ( -Up->z * PULSAR_TAILEND );
 					Polys[ poly ].Col1.R = 255;
 					Polys[ poly ].Col1.G = 64; //255;
 					Polys[ poly ].Col1.B = 64; //255;
@@ -4615,7 +4724,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frm_Info = &Pulsar_Trail_Header;
 					Polys[ poly ].Frame = 0.0F;
 					Polys[ poly ].SeqNum = POLY_PULSAR_TRAIL;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -4630,18 +4739,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				PrimBulls[i].PowerLevel = (int16_t) ( ( PLevel + ( 100.0F / ( MAXPOWERLEVELS - 1 ) ) - 1 ) / ( 100.0F / ( MAXPOWERLEVELS - 1 ) ) );
 				PrimBulls[i].ColRadius = ( ( 3.0F + ( PLevel * 0.075F ) ) * GLOBAL_SCALE ) * 30.0F;
 
-				PlayPannedSfx( SFX_Trojax, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_Trojax, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PrimBulls[i].PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PrimBulls[i].PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PrimBulls[i].PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4649,7 +4758,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].Frame = 0.0F;
 				  	FmPolys[ fmpoly ].Flags = ( FM_FLAG_DIRCONST | FM_FLAG_TWOSIDED );
 					FmPolys[ fmpoly ].DirVector = *Dir;
@@ -4666,7 +4775,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].Trans = (u_int8_t) ( 205 + ( PLevel * 0.5F ) );
 #endif
 
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 	
@@ -4709,13 +4818,13 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					light = FindFreeXLight();
 					if( light != (u_int16_t ) -1 )					// Light attached
 					{
-						XLights[ light ].Pos = PrimBulls[i].Pos;
+						XLights[ light ].Pos = PrimBullPos[i];
 						XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 						XLights[ light ].SizeCount = 0.0F;
 						XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 						XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 						XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-						XLights[ light ].Group = PrimBulls[i].GroupImIn;
+						XLights[ light ].Group = PrimBullGroup[i];
 						PrimBulls[i].light = light;
 					}
 				}
@@ -4723,7 +4832,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				fmpoly = FindFreeFmPoly();					// Faceme polygon attached
 				if( fmpoly != (u_int16_t ) -1 )
 				{
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].xsize = ( ( PowerLevel * PYROLITE_POWERMUL ) + PYROLITE_ADDMIN );
@@ -4741,7 +4850,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].R = 32; //128;
 				   	FmPolys[ fmpoly ].G = 32; //128;
 				   	FmPolys[ fmpoly ].B = 255; //128
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -4765,18 +4874,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					}
 				}
 
-				PlayPannedSfx(SFX_Transpulse, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx(SFX_Transpulse, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4784,7 +4893,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].Dir = *Dir;
 					FmPolys[ fmpoly ].Speed = PrimaryWeaponAttribs[ Weapon ].Speed[ PowerLevel ];
 					FmPolys[ fmpoly ].SeqNum = FM_ARC2;
@@ -4793,7 +4902,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					FmPolys[ fmpoly ].xsize = ( ( PowerLevel * TRANSPULSE_POWERMUL ) + TRANSPULSE_ADDMIN );
 					FmPolys[ fmpoly ].ysize = ( ( PowerLevel * TRANSPULSE_POWERMUL ) + TRANSPULSE_ADDMIN );
 					FmPolys[ fmpoly ].Frm_Info = &Flare_Header;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 64; //255;
 				   	FmPolys[ fmpoly ].G = 255; //255;
 				   	FmPolys[ fmpoly ].B = 64;
@@ -4811,7 +4920,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = ( FM_FLAG_DIRCONST | FM_FLAG_TWOSIDED );
@@ -4820,7 +4929,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
 					FmPolys[ fmpoly ].DirVector = *Up;
 					FmPolys[ fmpoly ].UpVector = *Dir;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 64; //255;
 				   	FmPolys[ fmpoly ].G = 255; //255;
 				   	FmPolys[ fmpoly ].B = 64;
@@ -4849,27 +4958,27 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					}
 				}
 
-				PrimBulls[ i ].LifeCount = ( 30.0F + Random_Range( (u_int16_t) ( ( PowerLevel * SUSSGUNLIFE_POWERMUL ) + SUSSGUNLIFE_ADDMIN ) ) );
+				PrimBullLifeCount[ i ] = ( 30.0F + Random_Range( (u_int16_t) ( ( PowerLevel * SUSSGUNLIFE_POWERMUL ) + SUSSGUNLIFE_ADDMIN ) ) );
 
-				PlayPannedSfx( SFX_EnemySussGun, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_EnemySussGun, PrimBullGroup[i], Pos, 0.0F );
 
 				Size = SussgunTable[ PrimBulls[i].PowerLevel ];
 
 				Half = (float) ( ( 1.0F / ( Size / 5120.0F ) ) / 2.0F );
-		   		PrimBulls[i].Dir.x += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
-		   		PrimBulls[i].Dir.y += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
-		   		PrimBulls[i].Dir.z += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
+		   		PrimBullDir[i].x += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
+		   		PrimBullDir[i].y += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
+		   		PrimBullDir[i].z += ( ( ( (float) Random_Range( 5120 ) ) / Size ) - Half );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4877,14 +4986,14 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = FM_FLAG_ZERO;
 					FmPolys[ fmpoly ].xsize = ( PowerLevel * SUSSGUN_POWERMUL ) + SUSSGUN_ADDMIN;
 					FmPolys[ fmpoly ].ysize = FmPolys[ fmpoly ].xsize;
 					FmPolys[ fmpoly ].Frm_Info = PrimaryWeaponAttribs[ Weapon ].FmFrmInfo;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 				   	FmPolys[ fmpoly ].R = 0; //255;
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 0; //255;
@@ -4924,18 +5033,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				LaserDiameter = ( ( PowerLevel * LASER_WIDTH_POWERMUL ) + LASER_WIDTH_ADDMIN );
 
-				PlayPannedSfx( SFX_Laser, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_Laser, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -4943,7 +5052,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = FM_ARC2;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = FM_FLAG_MOVEOUT;
@@ -4958,7 +5067,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].G = 255; //255;
 				   	FmPolys[ fmpoly ].B = 16; //255;
 					FmPolys[ fmpoly ].Frm_Info = &Flare_Header;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -4967,10 +5076,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				poly = FindFreePoly();
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos2 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos3 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos4 = PrimBulls[i].Pos;
+					Polys[ poly ].Pos1 = PrimBullPos[i];
+					Polys[ poly ].Pos2 = PrimBullPos[i];
+					Polys[ poly ].Pos3 = PrimBullPos[i];
+					Polys[ poly ].Pos4 = PrimBullPos[i];
 					Polys[ poly ].Col1.R = 16; //255
 					Polys[ poly ].Col1.G = 255; //255;
 					Polys[ poly ].Col1.B = 16; //255;
@@ -4998,7 +5107,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frm_Info = &Laser_Header;
 					Polys[ poly ].Frame = 0.0F;
 					Polys[ poly ].SeqNum = POLY_LASER;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -5010,10 +5119,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					poly = FindFreePoly();
 					if( poly != (u_int16_t) -1 )
 					{
-						Polys[ poly ].Pos1 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos2 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos3 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos4 = PrimBulls[i].Pos;
+						Polys[ poly ].Pos1 = PrimBullPos[i];
+						Polys[ poly ].Pos2 = PrimBullPos[i];
+						Polys[ poly ].Pos3 = PrimBullPos[i];
+						Polys[ poly ].Pos4 = PrimBullPos[i];
 						Polys[ poly ].Col1.R = 16; //255
 						Polys[ poly ].Col1.G = 255; //255;
 						Polys[ poly ].Col1.B = 16; //255; 
@@ -5041,7 +5150,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 						Polys[ poly ].Frm_Info = &Laser_Header;
 						Polys[ poly ].Frame = 0.0F;
 						Polys[ poly ].SeqNum = POLY_LASER;
-						Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+						Polys[ poly ].Group = PrimBullGroup[i];
 						PrimBulls[i].numpolys++;
 						PrimBulls[i].poly = poly;
 
@@ -5075,18 +5184,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				LaserDiameter = ( ( PowerLevel * PLASER_WIDTH_POWERMUL ) + PLASER_WIDTH_ADDMIN );
 
-				PlayPannedSfx( SFX_PhotonTorpedo, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_PhotonTorpedo, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -5094,7 +5203,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = FM_ARC2;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = FM_FLAG_MOVEOUT;
@@ -5109,7 +5218,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
 					FmPolys[ fmpoly ].Frm_Info = &Flare_Header;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -5118,10 +5227,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				poly = FindFreePoly();
 				if( poly != (u_int16_t) -1 )
 				{
-					Polys[ poly ].Pos1 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos2 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos3 = PrimBulls[i].Pos;
-					Polys[ poly ].Pos4 = PrimBulls[i].Pos;
+					Polys[ poly ].Pos1 = PrimBullPos[i];
+					Polys[ poly ].Pos2 = PrimBullPos[i];
+					Polys[ poly ].Pos3 = PrimBullPos[i];
+					Polys[ poly ].Pos4 = PrimBullPos[i];
 					Polys[ poly ].Col1.R = 255;
 					Polys[ poly ].Col1.G = 255;
 					Polys[ poly ].Col1.B = 255;
@@ -5150,7 +5259,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					Polys[ poly ].Frame = 0.0F;
 			   		Polys[ poly ].AnimSpeed = 48.0F;
 					Polys[ poly ].SeqNum = POLY_POWERLASER;
-					Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+					Polys[ poly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numpolys++;
 					PrimBulls[i].poly = poly;
 
@@ -5162,10 +5271,10 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 					poly = FindFreePoly();
 					if( poly != (u_int16_t) -1 )
 					{
-						Polys[ poly ].Pos1 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos2 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos3 = PrimBulls[i].Pos;
-						Polys[ poly ].Pos4 = PrimBulls[i].Pos;
+						Polys[ poly ].Pos1 = PrimBullPos[i];
+						Polys[ poly ].Pos2 = PrimBullPos[i];
+						Polys[ poly ].Pos3 = PrimBullPos[i];
+						Polys[ poly ].Pos4 = PrimBullPos[i];
 						Polys[ poly ].Col1.R = 255;
 						Polys[ poly ].Col1.G = 255;
 						Polys[ poly ].Col1.B = 255; 
@@ -5194,7 +5303,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 						Polys[ poly ].Frame = 0.0F;
 				   		Polys[ poly ].AnimSpeed = 48.0F;
 						Polys[ poly ].SeqNum = POLY_POWERLASER;
-						Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+						Polys[ poly ].Group = PrimBullGroup[i];
 						PrimBulls[i].numpolys++;
 						PrimBulls[i].poly = poly;
 
@@ -5228,18 +5337,18 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 
 				LaserDiameter = ( ( PowerLevel * LASER_WIDTH_POWERMUL ) + LASER_WIDTH_ADDMIN );
 
-				PlayPannedSfx( SFX_Laser, PrimBulls[i].GroupImIn, Pos, 0.0F );
+				PlayPannedSfx( SFX_Laser, PrimBullGroup[i], Pos, 0.0F );
 
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
@@ -5247,7 +5356,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				if( fmpoly != (u_int16_t ) -1 )
 				{
 					FmPolys[ fmpoly ].LifeCount = 1000.0F;
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = FM_ARC2;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].Flags = FM_FLAG_MOVEOUT;
@@ -5262,7 +5371,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
 					FmPolys[ fmpoly ].Frm_Info = &Flare_Header;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -5286,20 +5395,20 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				light = FindFreeXLight();
 				if( light != (u_int16_t ) -1 )					// Light attached
 				{
-					XLights[ light ].Pos = PrimBulls[i].Pos;
+					XLights[ light ].Pos = PrimBullPos[i];
 					XLights[ light ].Size = PrimaryWeaponAttribs[ Weapon ].lightsize;
 					XLights[ light ].SizeCount = 0.0F;
 					XLights[ light ].r = PrimaryWeaponAttribs[ Weapon ].r[ PowerLevel ];
 					XLights[ light ].g = PrimaryWeaponAttribs[ Weapon ].g[ PowerLevel ];
 					XLights[ light ].b = PrimaryWeaponAttribs[ Weapon ].b[ PowerLevel ];
-					XLights[ light ].Group = PrimBulls[i].GroupImIn;
+					XLights[ light ].Group = PrimBullGroup[i];
 					PrimBulls[i].light = light;
 				}
 
 				fmpoly = FindFreeFmPoly();					// Faceme polygon attached
 				if( fmpoly != (u_int16_t ) -1 )
 				{
-					FmPolys[ fmpoly ].Pos = PrimBulls[i].Pos;
+					FmPolys[ fmpoly ].Pos = PrimBullPos[i];
 					FmPolys[ fmpoly ].SeqNum = PrimaryWeaponAttribs[ Weapon ].FmSeq;
 					FmPolys[ fmpoly ].Frame = 0.0F;
 					FmPolys[ fmpoly ].xsize = ( 16.0F * GLOBAL_SCALE );
@@ -5317,7 +5426,7 @@ u_int16_t InitOnePrimBull( u_int16_t OwnerType, u_int16_t OwnerID, u_int16_t Bul
 				   	FmPolys[ fmpoly ].R = 255;
 				   	FmPolys[ fmpoly ].G = 255;
 				   	FmPolys[ fmpoly ].B = 255;
-					FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+					FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 					PrimBulls[i].numfmpolys++;
 					PrimBulls[i].fmpoly = fmpoly;
 					AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
@@ -5801,7 +5910,7 @@ void CreateLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t Grou
 				SpotFXPtr += PrimBulls[i].SpotFX;
 
 				ApplyMatrix( &Models[ PrimBulls[ i ].Owner ].Mat, &SpotFXPtr->UpVector, &UpVector );
-				CrossProduct( &PrimBulls[i].Dir, &UpVector, &LeftVector );
+				CrossProduct( &PrimBullDir[i], &UpVector, &LeftVector );
 			}
 			else
 			{
@@ -5823,44 +5932,44 @@ void CreateLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t Grou
    	light = PrimBulls[ i ].light;
    	if( light != (u_int16_t) -1 )
    	{
-   		XLights[ light ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-   		XLights[ light ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-   		XLights[ light ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+   		XLights[ light ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+   		XLights[ light ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+   		XLights[ light ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 	}
 
    	poly = PrimBulls[ i ].poly;
    	if( poly != (u_int16_t) -1 )
    	{
-		Polys[ poly ].Pos1.x = PrimBulls[ i ].Pos.x - ( LeftVector.x * LaserDiameter );
-		Polys[ poly ].Pos1.y = PrimBulls[ i ].Pos.y - ( LeftVector.y * LaserDiameter );
-		Polys[ poly ].Pos1.z = PrimBulls[ i ].Pos.z - ( LeftVector.z * LaserDiameter );
-		Polys[ poly ].Pos2.x = PrimBulls[ i ].Pos.x + ( LeftVector.x * LaserDiameter );
-		Polys[ poly ].Pos2.y = PrimBulls[ i ].Pos.y + ( LeftVector.y * LaserDiameter );
-		Polys[ poly ].Pos2.z = PrimBulls[ i ].Pos.z + ( LeftVector.z * LaserDiameter );
-		Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBulls[ i ].Dir.x * Distance );
-		Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBulls[ i ].Dir.y * Distance );
-		Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBulls[ i ].Dir.z * Distance );
-		Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBulls[ i ].Dir.x * Distance );
-		Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBulls[ i ].Dir.y * Distance );
-		Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBulls[ i ].Dir.z * Distance );
+		Polys[ poly ].Pos1.x = PrimBullPos[ i ].x - ( LeftVector.x * LaserDiameter );
+		Polys[ poly ].Pos1.y = PrimBullPos[ i ].y - ( LeftVector.y * LaserDiameter );
+		Polys[ poly ].Pos1.z = PrimBullPos[ i ].z - ( LeftVector.z * LaserDiameter );
+		Polys[ poly ].Pos2.x = PrimBullPos[ i ].x + ( LeftVector.x * LaserDiameter );
+		Polys[ poly ].Pos2.y = PrimBullPos[ i ].y + ( LeftVector.y * LaserDiameter );
+		Polys[ poly ].Pos2.z = PrimBullPos[ i ].z + ( LeftVector.z * LaserDiameter );
+		Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBullDir[ i ].x * Distance );
+		Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBullDir[ i ].y * Distance );
+		Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBullDir[ i ].z * Distance );
+		Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBullDir[ i ].x * Distance );
+		Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBullDir[ i ].y * Distance );
+		Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBullDir[ i ].z * Distance );
 
 		if( !( ( PrimBulls[i].OwnerType == OWNER_SHIP ) && ( PrimBulls[i].Owner == WhoIAm ) ) )	/* only other people see cross */
 		{
 		   	poly = Polys[ poly ].Prev;
 		   	if( poly != (u_int16_t) -1 )
 		   	{
-				Polys[ poly ].Pos1.x = PrimBulls[ i ].Pos.x - ( UpVector.x * LaserDiameter );
-				Polys[ poly ].Pos1.y = PrimBulls[ i ].Pos.y - ( UpVector.y * LaserDiameter );
-				Polys[ poly ].Pos1.z = PrimBulls[ i ].Pos.z - ( UpVector.z * LaserDiameter );
-				Polys[ poly ].Pos2.x = PrimBulls[ i ].Pos.x + ( UpVector.x * LaserDiameter );
-				Polys[ poly ].Pos2.y = PrimBulls[ i ].Pos.y + ( UpVector.y * LaserDiameter );
-				Polys[ poly ].Pos2.z = PrimBulls[ i ].Pos.z + ( UpVector.z * LaserDiameter );
-				Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBulls[ i ].Dir.x * Distance );
-				Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBulls[ i ].Dir.y * Distance );
-				Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBulls[ i ].Dir.z * Distance );
-				Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBulls[ i ].Dir.x * Distance );
-				Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBulls[ i ].Dir.y * Distance );
-				Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBulls[ i ].Dir.z * Distance );
+				Polys[ poly ].Pos1.x = PrimBullPos[ i ].x - ( UpVector.x * LaserDiameter );
+				Polys[ poly ].Pos1.y = PrimBullPos[ i ].y - ( UpVector.y * LaserDiameter );
+				Polys[ poly ].Pos1.z = PrimBullPos[ i ].z - ( UpVector.z * LaserDiameter );
+				Polys[ poly ].Pos2.x = PrimBullPos[ i ].x + ( UpVector.x * LaserDiameter );
+				Polys[ poly ].Pos2.y = PrimBullPos[ i ].y + ( UpVector.y * LaserDiameter );
+				Polys[ poly ].Pos2.z = PrimBullPos[ i ].z + ( UpVector.z * LaserDiameter );
+				Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBullDir[ i ].x * Distance );
+				Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBullDir[ i ].y * Distance );
+				Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBullDir[ i ].z * Distance );
+				Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBullDir[ i ].x * Distance );
+				Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBullDir[ i ].y * Distance );
+				Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBullDir[ i ].z * Distance );
 			}
 		}
 	}
@@ -5870,9 +5979,9 @@ void CreateLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t Grou
 	   	fmpoly = PrimBulls[ i ].fmpoly;
 	   	if( fmpoly != (u_int16_t) -1 )
 	   	{
-	   		FmPolys[ fmpoly ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-	   		FmPolys[ fmpoly ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-	   		FmPolys[ fmpoly ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+	   		FmPolys[ fmpoly ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+	   		FmPolys[ fmpoly ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+	   		FmPolys[ fmpoly ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 			FmPolys[ fmpoly ].Group = EndGroup;
 		}
 
@@ -5888,9 +5997,9 @@ void CreateLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t Grou
 	   	   	if( fmpoly != (u_int16_t ) -1 )
 	   	   	{
 	   			FmPolys[ fmpoly ].LifeCount = 1000.0F;
-	   	   		FmPolys[ fmpoly ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-	   	   		FmPolys[ fmpoly ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-	   	   		FmPolys[ fmpoly ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+	   	   		FmPolys[ fmpoly ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+	   	   		FmPolys[ fmpoly ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+	   	   		FmPolys[ fmpoly ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 	   	   		FmPolys[ fmpoly ].Dir = *Dir;
 	   	   		FmPolys[ fmpoly ].SeqNum = FM_BITS;
 	   	   		FmPolys[ fmpoly ].Frame = 0.0F;
@@ -5983,7 +6092,7 @@ void CreateNmeLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t G
 				SpotFXPtr += PrimBulls[i].SpotFX;
 
 				ApplyMatrix( &Models[ PrimBulls[ i ].Owner ].Mat, &SpotFXPtr->UpVector, &UpVector );
-				CrossProduct( &PrimBulls[i].Dir, &UpVector, &LeftVector );
+				CrossProduct( &PrimBullDir[i], &UpVector, &LeftVector );
 			}
 			else
 			{
@@ -6005,44 +6114,44 @@ void CreateNmeLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t G
    	light = PrimBulls[ i ].light;
    	if( light != (u_int16_t) -1 )
    	{
-   		XLights[ light ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-   		XLights[ light ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-   		XLights[ light ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+   		XLights[ light ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+   		XLights[ light ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+   		XLights[ light ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 	}
 
    	poly = PrimBulls[ i ].poly;
    	if( poly != (u_int16_t) -1 )
    	{
-		Polys[ poly ].Pos1.x = PrimBulls[ i ].Pos.x - ( LeftVector.x * LaserDiameter );
-		Polys[ poly ].Pos1.y = PrimBulls[ i ].Pos.y - ( LeftVector.y * LaserDiameter );
-		Polys[ poly ].Pos1.z = PrimBulls[ i ].Pos.z - ( LeftVector.z * LaserDiameter );
-		Polys[ poly ].Pos2.x = PrimBulls[ i ].Pos.x + ( LeftVector.x * LaserDiameter );
-		Polys[ poly ].Pos2.y = PrimBulls[ i ].Pos.y + ( LeftVector.y * LaserDiameter );
-		Polys[ poly ].Pos2.z = PrimBulls[ i ].Pos.z + ( LeftVector.z * LaserDiameter );
-		Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBulls[ i ].Dir.x * Distance );
-		Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBulls[ i ].Dir.y * Distance );
-		Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBulls[ i ].Dir.z * Distance );
-		Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBulls[ i ].Dir.x * Distance );
-		Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBulls[ i ].Dir.y * Distance );
-		Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBulls[ i ].Dir.z * Distance );
+		Polys[ poly ].Pos1.x = PrimBullPos[ i ].x - ( LeftVector.x * LaserDiameter );
+		Polys[ poly ].Pos1.y = PrimBullPos[ i ].y - ( LeftVector.y * LaserDiameter );
+		Polys[ poly ].Pos1.z = PrimBullPos[ i ].z - ( LeftVector.z * LaserDiameter );
+		Polys[ poly ].Pos2.x = PrimBullPos[ i ].x + ( LeftVector.x * LaserDiameter );
+		Polys[ poly ].Pos2.y = PrimBullPos[ i ].y + ( LeftVector.y * LaserDiameter );
+		Polys[ poly ].Pos2.z = PrimBullPos[ i ].z + ( LeftVector.z * LaserDiameter );
+		Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBullDir[ i ].x * Distance );
+		Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBullDir[ i ].y * Distance );
+		Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBullDir[ i ].z * Distance );
+		Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBullDir[ i ].x * Distance );
+		Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBullDir[ i ].y * Distance );
+		Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBullDir[ i ].z * Distance );
 
 		if( !( ( PrimBulls[i].OwnerType == OWNER_SHIP ) && ( PrimBulls[i].Owner == WhoIAm ) ) )	/* only other people see cross */
 		{
 		   	poly = Polys[ poly ].Prev;
 		   	if( poly != (u_int16_t) -1 )
 		   	{
-				Polys[ poly ].Pos1.x = PrimBulls[ i ].Pos.x - ( UpVector.x * LaserDiameter );
-				Polys[ poly ].Pos1.y = PrimBulls[ i ].Pos.y - ( UpVector.y * LaserDiameter );
-				Polys[ poly ].Pos1.z = PrimBulls[ i ].Pos.z - ( UpVector.z * LaserDiameter );
-				Polys[ poly ].Pos2.x = PrimBulls[ i ].Pos.x + ( UpVector.x * LaserDiameter );
-				Polys[ poly ].Pos2.y = PrimBulls[ i ].Pos.y + ( UpVector.y * LaserDiameter );
-				Polys[ poly ].Pos2.z = PrimBulls[ i ].Pos.z + ( UpVector.z * LaserDiameter );
-				Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBulls[ i ].Dir.x * Distance );
-				Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBulls[ i ].Dir.y * Distance );
-				Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBulls[ i ].Dir.z * Distance );
-				Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBulls[ i ].Dir.x * Distance );
-				Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBulls[ i ].Dir.y * Distance );
-				Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBulls[ i ].Dir.z * Distance );
+				Polys[ poly ].Pos1.x = PrimBullPos[ i ].x - ( UpVector.x * LaserDiameter );
+				Polys[ poly ].Pos1.y = PrimBullPos[ i ].y - ( UpVector.y * LaserDiameter );
+				Polys[ poly ].Pos1.z = PrimBullPos[ i ].z - ( UpVector.z * LaserDiameter );
+				Polys[ poly ].Pos2.x = PrimBullPos[ i ].x + ( UpVector.x * LaserDiameter );
+				Polys[ poly ].Pos2.y = PrimBullPos[ i ].y + ( UpVector.y * LaserDiameter );
+				Polys[ poly ].Pos2.z = PrimBullPos[ i ].z + ( UpVector.z * LaserDiameter );
+				Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBullDir[ i ].x * Distance );
+				Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBullDir[ i ].y * Distance );
+				Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBullDir[ i ].z * Distance );
+				Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBullDir[ i ].x * Distance );
+				Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBullDir[ i ].y * Distance );
+				Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBullDir[ i ].z * Distance );
 			}
 		}
 	}
@@ -6052,9 +6161,9 @@ void CreateNmeLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t G
 	   	fmpoly = PrimBulls[ i ].fmpoly;
 	   	if( fmpoly != (u_int16_t) -1 )
 	   	{
-	   		FmPolys[ fmpoly ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-	   		FmPolys[ fmpoly ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-	   		FmPolys[ fmpoly ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+	   		FmPolys[ fmpoly ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+	   		FmPolys[ fmpoly ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+	   		FmPolys[ fmpoly ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 			FmPolys[ fmpoly ].Group = EndGroup;
 		}
 
@@ -6070,9 +6179,9 @@ void CreateNmeLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16_t G
 	   	   	if( fmpoly != (u_int16_t ) -1 )
 	   	   	{
 	   			FmPolys[ fmpoly ].LifeCount = 1000.0F;
-	   	   		FmPolys[ fmpoly ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-	   	   		FmPolys[ fmpoly ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-	   	   		FmPolys[ fmpoly ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+	   	   		FmPolys[ fmpoly ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+	   	   		FmPolys[ fmpoly ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+	   	   		FmPolys[ fmpoly ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 	   	   		FmPolys[ fmpoly ].Dir = *Dir;
 	   	   		FmPolys[ fmpoly ].SeqNum = FM_BITS;
 	   	   		FmPolys[ fmpoly ].Frame = 0.0F;
@@ -6162,7 +6271,7 @@ void CreateNmePowerLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int1
 				SpotFXPtr += PrimBulls[i].SpotFX;
 
 				ApplyMatrix( &Models[ PrimBulls[ i ].Owner ].Mat, &SpotFXPtr->UpVector, &UpVector );
-				CrossProduct( &PrimBulls[i].Dir, &UpVector, &LeftVector );
+				CrossProduct( &PrimBullDir[i], &UpVector, &LeftVector );
 			}
 			else
 			{
@@ -6181,14 +6290,14 @@ void CreateNmePowerLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int1
 			break;
 	}
 
-	CreatePowerLaserSparks( &PrimBulls[i].Pos, &PrimBulls[i].Dir, PrimBulls[i].GroupImIn, 64, 64, 192 );
+	CreatePowerLaserSparks( &PrimBullPos[i], &PrimBullDir[i], PrimBullGroup[i], 64, 64, 192 );
 
    	light = PrimBulls[ i ].light;
    	if( light != (u_int16_t) -1 )
    	{
-   		XLights[ light ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-   		XLights[ light ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-   		XLights[ light ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+   		XLights[ light ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+   		XLights[ light ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+   		XLights[ light ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 	}
 
    	poly = PrimBulls[ i ].poly;
@@ -6197,41 +6306,41 @@ void CreateNmePowerLaserPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int1
 		StartShipScreenShake( ( Polys[ poly ].Frame * 4.0F ) );
 		LaserDiameter = ( Polys[ poly ].Frame * ( 32.0F * ( PrimBulls[i].PowerLevel + 1 ) ) );
 
-		EndPos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-		EndPos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-		EndPos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+		EndPos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+		EndPos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+		EndPos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 		CreateScaleExplosion( &EndPos, EndGroup, ( Polys[ poly ].Frame * 3.0F ) );
 
-		Polys[ poly ].Pos1.x = PrimBulls[ i ].Pos.x - ( LeftVector.x * LaserDiameter );
-		Polys[ poly ].Pos1.y = PrimBulls[ i ].Pos.y - ( LeftVector.y * LaserDiameter );
-		Polys[ poly ].Pos1.z = PrimBulls[ i ].Pos.z - ( LeftVector.z * LaserDiameter );
-		Polys[ poly ].Pos2.x = PrimBulls[ i ].Pos.x + ( LeftVector.x * LaserDiameter );
-		Polys[ poly ].Pos2.y = PrimBulls[ i ].Pos.y + ( LeftVector.y * LaserDiameter );
-		Polys[ poly ].Pos2.z = PrimBulls[ i ].Pos.z + ( LeftVector.z * LaserDiameter );
-		Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBulls[ i ].Dir.x * Distance );
-		Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBulls[ i ].Dir.y * Distance );
-		Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBulls[ i ].Dir.z * Distance );
-		Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBulls[ i ].Dir.x * Distance );
-		Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBulls[ i ].Dir.y * Distance );
-		Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBulls[ i ].Dir.z * Distance );
+		Polys[ poly ].Pos1.x = PrimBullPos[ i ].x - ( LeftVector.x * LaserDiameter );
+		Polys[ poly ].Pos1.y = PrimBullPos[ i ].y - ( LeftVector.y * LaserDiameter );
+		Polys[ poly ].Pos1.z = PrimBullPos[ i ].z - ( LeftVector.z * LaserDiameter );
+		Polys[ poly ].Pos2.x = PrimBullPos[ i ].x + ( LeftVector.x * LaserDiameter );
+		Polys[ poly ].Pos2.y = PrimBullPos[ i ].y + ( LeftVector.y * LaserDiameter );
+		Polys[ poly ].Pos2.z = PrimBullPos[ i ].z + ( LeftVector.z * LaserDiameter );
+		Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBullDir[ i ].x * Distance );
+		Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBullDir[ i ].y * Distance );
+		Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBullDir[ i ].z * Distance );
+		Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBullDir[ i ].x * Distance );
+		Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBullDir[ i ].y * Distance );
+		Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBullDir[ i ].z * Distance );
 
 		if( !( ( PrimBulls[i].OwnerType == OWNER_SHIP ) && ( PrimBulls[i].Owner == WhoIAm ) ) )	/* only other people see cross */
 		{
 		   	poly = Polys[ poly ].Prev;
 		   	if( poly != (u_int16_t) -1 )
 		   	{
-				Polys[ poly ].Pos1.x = PrimBulls[ i ].Pos.x - ( UpVector.x * LaserDiameter );
-				Polys[ poly ].Pos1.y = PrimBulls[ i ].Pos.y - ( UpVector.y * LaserDiameter );
-				Polys[ poly ].Pos1.z = PrimBulls[ i ].Pos.z - ( UpVector.z * LaserDiameter );
-				Polys[ poly ].Pos2.x = PrimBulls[ i ].Pos.x + ( UpVector.x * LaserDiameter );
-				Polys[ poly ].Pos2.y = PrimBulls[ i ].Pos.y + ( UpVector.y * LaserDiameter );
-				Polys[ poly ].Pos2.z = PrimBulls[ i ].Pos.z + ( UpVector.z * LaserDiameter );
-				Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBulls[ i ].Dir.x * Distance );
-				Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBulls[ i ].Dir.y * Distance );
-				Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBulls[ i ].Dir.z * Distance );
-				Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBulls[ i ].Dir.x * Distance );
-				Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBulls[ i ].Dir.y * Distance );
-				Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBulls[ i ].Dir.z * Distance );
+				Polys[ poly ].Pos1.x = PrimBullPos[ i ].x - ( UpVector.x * LaserDiameter );
+				Polys[ poly ].Pos1.y = PrimBullPos[ i ].y - ( UpVector.y * LaserDiameter );
+				Polys[ poly ].Pos1.z = PrimBullPos[ i ].z - ( UpVector.z * LaserDiameter );
+				Polys[ poly ].Pos2.x = PrimBullPos[ i ].x + ( UpVector.x * LaserDiameter );
+				Polys[ poly ].Pos2.y = PrimBullPos[ i ].y + ( UpVector.y * LaserDiameter );
+				Polys[ poly ].Pos2.z = PrimBullPos[ i ].z + ( UpVector.z * LaserDiameter );
+				Polys[ poly ].Pos3.x = Polys[ poly ].Pos2.x + ( PrimBullDir[ i ].x * Distance );
+				Polys[ poly ].Pos3.y = Polys[ poly ].Pos2.y + ( PrimBullDir[ i ].y * Distance );
+				Polys[ poly ].Pos3.z = Polys[ poly ].Pos2.z + ( PrimBullDir[ i ].z * Distance );
+				Polys[ poly ].Pos4.x = Polys[ poly ].Pos1.x + ( PrimBullDir[ i ].x * Distance );
+				Polys[ poly ].Pos4.y = Polys[ poly ].Pos1.y + ( PrimBullDir[ i ].y * Distance );
+				Polys[ poly ].Pos4.z = Polys[ poly ].Pos1.z + ( PrimBullDir[ i ].z * Distance );
 			}
 		}
 	}
@@ -6275,7 +6384,7 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 	QUAT	TempQuat;
 	MATRIX	TempMat;
 
-	if( PrimBulls[i].LifeCount ) Distance = ( 1.0F - ( PrimBulls[i].LifeCount / 12.0F ) ) * Distance;
+	if( PrimBullLifeCount[i] ) Distance = ( 1.0F - ( PrimBullLifeCount[i] / 12.0F ) ) * Distance;
 
 	switch( PrimBulls[i].OwnerType )
 	{
@@ -6300,7 +6409,7 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 
 		case OWNER_NOBODY:
 			NormUpVector = PrimBulls[i].UpVector;
-			CrossProduct( &PrimBulls[i].Dir, &PrimBulls[i].UpVector, &NormLeftVector );
+			CrossProduct( &PrimBullDir[i], &PrimBulls[i].UpVector, &NormLeftVector );
 			break;
 
 		case OWNER_MODELSPOTFX:
@@ -6318,7 +6427,7 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 				SpotFXPtr += PrimBulls[i].SpotFX;
 
 				ApplyMatrix( &Models[ PrimBulls[ i ].Owner ].Mat, &SpotFXPtr->UpVector, &NormUpVector );
-				CrossProduct( &PrimBulls[i].Dir, &NormUpVector, &NormLeftVector );
+				CrossProduct( &PrimBullDir[i], &NormUpVector, &NormLeftVector );
 			}
 			else
 			{
@@ -6340,9 +6449,9 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
    	light = PrimBulls[ i ].light;
    	if( light != (u_int16_t) -1 )
    	{
-   		XLights[ light ].Pos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-   		XLights[ light ].Pos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-   		XLights[ light ].Pos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+   		XLights[ light ].Pos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+   		XLights[ light ].Pos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+   		XLights[ light ].Pos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 	}
 
 /*===================================================================
@@ -6365,9 +6474,9 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 ===================================================================*/
 	NumSegments = (int16_t) ceil( Distance / SubDivision );
 
-	if( PrimBulls[i].LifeCount < 4.0F )
+	if( PrimBullLifeCount[i] < 4.0F )
 	{
-		Frame = ( 2.9F - PrimBulls[i].LifeCount );
+		Frame = ( 2.9F - PrimBullLifeCount[i] );
 		if( Frame < 0.0F ) Frame = 0.0F;
 	}
 	else
@@ -6382,7 +6491,7 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 	UpVector.y = ( NormUpVector.y * LightningDiameter );
 	UpVector.z = ( NormUpVector.z * LightningDiameter );
 
-	StartPos = PrimBulls[i].Pos;
+	StartPos = PrimBullPos[i];
 
 	for( Count = 0; Count < NumSegments; Count++ )
 	{
@@ -6393,15 +6502,15 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 			RandomX = (float) ( Random_Range( XRange ) - ( XRange >> 1 ) );
 			RandomY = (float) ( Random_Range( YRange ) - ( YRange >> 1 ) );
 
-			EndPos.x = ( PrimBulls[ i ].Pos.x + ( PrimBulls[ i ].Dir.x * CurrentOffset ) + ( RandomY * NormUpVector.x ) + ( RandomX * NormLeftVector.x ));
-			EndPos.y = ( PrimBulls[ i ].Pos.y + ( PrimBulls[ i ].Dir.y * CurrentOffset ) + ( RandomY * NormUpVector.y ) + ( RandomX * NormLeftVector.y ));
-			EndPos.z = ( PrimBulls[ i ].Pos.z + ( PrimBulls[ i ].Dir.z * CurrentOffset ) + ( RandomY * NormUpVector.z ) + ( RandomX * NormLeftVector.z ));
+			EndPos.x = ( PrimBullPos[ i ].x + ( PrimBullDir[ i ].x * CurrentOffset ) + ( RandomY * NormUpVector.x ) + ( RandomX * NormLeftVector.x ));
+			EndPos.y = ( PrimBullPos[ i ].y + ( PrimBullDir[ i ].y * CurrentOffset ) + ( RandomY * NormUpVector.y ) + ( RandomX * NormLeftVector.y ));
+			EndPos.z = ( PrimBullPos[ i ].z + ( PrimBullDir[ i ].z * CurrentOffset ) + ( RandomY * NormUpVector.z ) + ( RandomX * NormLeftVector.z ));
 		}
 		else
 		{
-			EndPos.x = ( PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Distance ) );
-			EndPos.y = ( PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Distance ) );
-			EndPos.z = ( PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Distance ) );
+			EndPos.x = ( PrimBullPos[i].x + ( PrimBullDir[ i ].x * Distance ) );
+			EndPos.y = ( PrimBullPos[i].y + ( PrimBullDir[ i ].y * Distance ) );
+			EndPos.z = ( PrimBullPos[i].z + ( PrimBullDir[ i ].z * Distance ) );
 		}
 
 		poly = FindFreePoly();
@@ -6446,7 +6555,7 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 			Polys[ poly ].Frm_Info = &Laser_Header;
 			Polys[ poly ].Frame = Frame;
 			Polys[ poly ].SeqNum = POLY_NOTHING; //POLY_LASER;
-			Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+			Polys[ poly ].Group = PrimBullGroup[i];
 			PrimBulls[i].numpolys++;
 			PrimBulls[i].poly = poly;
 	
@@ -6495,7 +6604,7 @@ void CreateNmeLightningPulse( u_int16_t i, float Distance, VECTOR * Dir, u_int16
 			Polys[ poly ].Frm_Info = &Laser_Header;
 			Polys[ poly ].Frame = Frame;
 			Polys[ poly ].SeqNum = POLY_NOTHING; //POLY_LASER;
-			Polys[ poly ].Group = PrimBulls[i].GroupImIn;
+			Polys[ poly ].Group = PrimBullGroup[i];
 			PrimBulls[i].numpolys++;
 			PrimBulls[i].poly = poly;
 	
@@ -6573,7 +6682,7 @@ void CreateTransTrail( u_int16_t i )
 	if( i == (u_int16_t) -1 ) return;
 	if( PrimBulls[ i ].numfmpolys == 0 ) return;
 
-	CrossProduct( &PrimBulls[ i ].Dir, &FmPolys[ PrimBulls[i].fmpoly ].DirVector, &Right );
+	CrossProduct( &PrimBullDir[ i ], &FmPolys[ PrimBulls[i].fmpoly ].DirVector, &Right );
 
 	fmpoly = FindFreeFmPoly();
 
@@ -6582,10 +6691,10 @@ void CreateTransTrail( u_int16_t i )
 		Size = (int16_t) ( ( PrimBulls[ i ].PowerLevel * ARCTRAIL_POWERMUL ) + ARCTRAIL_ADDMIN );					// Max 440;
 		Num = ( (float) ( Random_Range( (u_int16_t) ( Size * 2 ) ) - Size ) ) * GLOBAL_SCALE;
 		FmPolys[ fmpoly ].LifeCount = 1000.0F;
-		FmPolys[ fmpoly ].Pos.x = ( PrimBulls[i].Pos.x + ( Right.x * Num ) );
-		FmPolys[ fmpoly ].Pos.y = ( PrimBulls[i].Pos.y + ( Right.y * Num ) );
-		FmPolys[ fmpoly ].Pos.z = ( PrimBulls[i].Pos.z + ( Right.z * Num ) );
-		FmPolys[ fmpoly ].Dir = PrimBulls[ i ].Dir;
+		FmPolys[ fmpoly ].Pos.x = ( PrimBullPos[i].x + ( Right.x * Num ) );
+		FmPolys[ fmpoly ].Pos.y = ( PrimBullPos[i].y + ( Right.y * Num ) );
+		FmPolys[ fmpoly ].Pos.z = ( PrimBullPos[i].z + ( Right.z * Num ) );
+		FmPolys[ fmpoly ].Dir = PrimBullDir[ i ];
 		FmPolys[ fmpoly ].SeqNum = FM_ARC_SPARK;
 		FmPolys[ fmpoly ].Frame = 0.0F;
 		FmPolys[ fmpoly ].Frm_Info = &Bits_Header;
@@ -6602,7 +6711,7 @@ void CreateTransTrail( u_int16_t i )
 		FmPolys[ fmpoly ].Rot = 0.0F;
 		FmPolys[ fmpoly ].xsize = TRANSPULSE_SPARKSIZE;
 		FmPolys[ fmpoly ].ysize = TRANSPULSE_SPARKSIZE;
-		FmPolys[ fmpoly ].Group = PrimBulls[i].GroupImIn;
+		FmPolys[ fmpoly ].Group = PrimBullGroup[i];
 		NormaliseVector( &FmPolys[ fmpoly ].Dir );
 		AddFmPolyToTPage( fmpoly, GetTPage( *FmPolys[ fmpoly ].Frm_Info, 0 ) );
 	}
@@ -8122,12 +8231,12 @@ bool ChangeTranspulseDir( u_int16_t i, VECTOR * Pos, VECTOR * MoveOffset, VECTOR
 	float	ClosestCos = -1.0F;
 	u_int16_t	NewGroup;
 
-	NewGroup = MoveGroup( &Mloadheader, &PrimBulls[i].Pos, PrimBulls[i].GroupImIn, MoveOffset );
+	NewGroup = MoveGroup( &Mloadheader, &PrimBullPos[i], PrimBullGroup[i], MoveOffset );
 
 	if( !PrimBulls[i].Bounces ) return( false );
 	PrimBulls[i].Bounces--;
 
-	PrimBulls[i].Speed *= 0.5F;
+	PrimBullSpeed[i] *= 0.5F;
 
 #ifdef SINT_PEACEFROG_CHEAT
 	TargetingWeaponCheat = -1;
@@ -8212,7 +8321,7 @@ bool ChangeTranspulseDir( u_int16_t i, VECTOR * Pos, VECTOR * MoveOffset, VECTOR
 	}
 
 	PrimBulls[i].ColFlag = 0;
-	PrimBulls[i].Dir = NewDir;
+	PrimBullDir[i] = NewDir;
 
 	fmpoly = PrimBulls[i].fmpoly;					// Faceme polygon attached
 
@@ -8252,7 +8361,7 @@ void ChangePulsarDir( u_int16_t i, VECTOR * Dir )
 	ApplyMatrix( &TempMatrix, &SlideLeft, &LeftVector );
 	
 	PrimBulls[i].ColFlag = 0;
-	PrimBulls[i].Dir = *Dir;
+	PrimBullDir[i] = *Dir;
 
 	Trail_Length = ( (float) -( ( PrimBulls[ i ].PowerLevel * PULSAR_TAILPOWERMUL ) + PULSAR_TAILADDMIN ) );
 	
@@ -8260,35 +8369,35 @@ void ChangePulsarDir( u_int16_t i, VECTOR * Dir )
 	
 	if( poly != (u_int16_t) -1 )
 	{
-		Polys[ poly ].Pos1.x = PrimBulls[i].Pos.x - ( DownVector.x * PULSAR_TAILSTART );
-		Polys[ poly ].Pos1.y = PrimBulls[i].Pos.y - ( DownVector.y * PULSAR_TAILSTART );
-		Polys[ poly ].Pos1.z = PrimBulls[i].Pos.z - ( DownVector.z * PULSAR_TAILSTART );
-		Polys[ poly ].Pos2.x = PrimBulls[i].Pos.x + ( DownVector.x * PULSAR_TAILSTART );
-		Polys[ poly ].Pos2.y = PrimBulls[i].Pos.y + ( DownVector.y * PULSAR_TAILSTART );
-		Polys[ poly ].Pos2.z = PrimBulls[i].Pos.z + ( DownVector.z * PULSAR_TAILSTART );
-		Polys[ poly ].Pos3.x = PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Trail_Length ) + ( DownVector.x * PULSAR_TAILEND );
-		Polys[ poly ].Pos3.y = PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Trail_Length ) + ( DownVector.y * PULSAR_TAILEND );
-		Polys[ poly ].Pos3.z = PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Trail_Length ) + ( DownVector.z * PULSAR_TAILEND );
-		Polys[ poly ].Pos4.x = PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Trail_Length ) - ( DownVector.x * PULSAR_TAILEND );
-		Polys[ poly ].Pos4.y = PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Trail_Length ) - ( DownVector.y * PULSAR_TAILEND );
-		Polys[ poly ].Pos4.z = PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Trail_Length ) - ( DownVector.z * PULSAR_TAILEND );
+		Polys[ poly ].Pos1.x = PrimBullPos[i].x - ( DownVector.x * PULSAR_TAILSTART );
+		Polys[ poly ].Pos1.y = PrimBullPos[i].y - ( DownVector.y * PULSAR_TAILSTART );
+		Polys[ poly ].Pos1.z = PrimBullPos[i].z - ( DownVector.z * PULSAR_TAILSTART );
+		Polys[ poly ].Pos2.x = PrimBullPos[i].x + ( DownVector.x * PULSAR_TAILSTART );
+		Polys[ poly ].Pos2.y = PrimBullPos[i].y + ( DownVector.y * PULSAR_TAILSTART );
+		Polys[ poly ].Pos2.z = PrimBullPos[i].z + ( DownVector.z * PULSAR_TAILSTART );
+		Polys[ poly ].Pos3.x = PrimBullPos[i].x + ( PrimBullDir[ i ].x * Trail_Length ) + ( DownVector.x * PULSAR_TAILEND );
+		Polys[ poly ].Pos3.y = PrimBullPos[i].y + ( PrimBullDir[ i ].y * Trail_Length ) + ( DownVector.y * PULSAR_TAILEND );
+		Polys[ poly ].Pos3.z = PrimBullPos[i].z + ( PrimBullDir[ i ].z * Trail_Length ) + ( DownVector.z * PULSAR_TAILEND );
+		Polys[ poly ].Pos4.x = PrimBullPos[i].x + ( PrimBullDir[ i ].x * Trail_Length ) - ( DownVector.x * PULSAR_TAILEND );
+		Polys[ poly ].Pos4.y = PrimBullPos[i].y + ( PrimBullDir[ i ].y * Trail_Length ) - ( DownVector.y * PULSAR_TAILEND );
+		Polys[ poly ].Pos4.z = PrimBullPos[i].z + ( PrimBullDir[ i ].z * Trail_Length ) - ( DownVector.z * PULSAR_TAILEND );
 		poly = Polys[ poly ].Prev;
 	}
 
 	if( poly != (u_int16_t) -1 )
 	{
-		Polys[ poly ].Pos1.x = PrimBulls[i].Pos.x - ( LeftVector.x * PULSAR_TAILSTART );
-		Polys[ poly ].Pos1.y = PrimBulls[i].Pos.y - ( LeftVector.y * PULSAR_TAILSTART );
-		Polys[ poly ].Pos1.z = PrimBulls[i].Pos.z - ( LeftVector.z * PULSAR_TAILSTART );
-		Polys[ poly ].Pos2.x = PrimBulls[i].Pos.x + ( LeftVector.x * PULSAR_TAILSTART );
-		Polys[ poly ].Pos2.y = PrimBulls[i].Pos.y + ( LeftVector.y * PULSAR_TAILSTART );
-		Polys[ poly ].Pos2.z = PrimBulls[i].Pos.z + ( LeftVector.z * PULSAR_TAILSTART );
-		Polys[ poly ].Pos3.x = PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Trail_Length ) + ( LeftVector.x * PULSAR_TAILEND );
-		Polys[ poly ].Pos3.y = PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Trail_Length ) + ( LeftVector.y * PULSAR_TAILEND );
-		Polys[ poly ].Pos3.z = PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Trail_Length ) + ( LeftVector.z * PULSAR_TAILEND );
-		Polys[ poly ].Pos4.x = PrimBulls[i].Pos.x + ( PrimBulls[ i ].Dir.x * Trail_Length ) - ( LeftVector.x * PULSAR_TAILEND );
-		Polys[ poly ].Pos4.y = PrimBulls[i].Pos.y + ( PrimBulls[ i ].Dir.y * Trail_Length ) - ( LeftVector.y * PULSAR_TAILEND );
-		Polys[ poly ].Pos4.z = PrimBulls[i].Pos.z + ( PrimBulls[ i ].Dir.z * Trail_Length ) - ( LeftVector.z * PULSAR_TAILEND );
+		Polys[ poly ].Pos1.x = PrimBullPos[i].x - ( LeftVector.x * PULSAR_TAILSTART );
+		Polys[ poly ].Pos1.y = PrimBullPos[i].y - ( LeftVector.y * PULSAR_TAILSTART );
+		Polys[ poly ].Pos1.z = PrimBullPos[i].z - ( LeftVector.z * PULSAR_TAILSTART );
+		Polys[ poly ].Pos2.x = PrimBullPos[i].x + ( LeftVector.x * PULSAR_TAILSTART );
+		Polys[ poly ].Pos2.y = PrimBullPos[i].y + ( LeftVector.y * PULSAR_TAILSTART );
+		Polys[ poly ].Pos2.z = PrimBullPos[i].z + ( LeftVector.z * PULSAR_TAILSTART );
+		Polys[ poly ].Pos3.x = PrimBullPos[i].x + ( PrimBullDir[ i ].x * Trail_Length ) + ( LeftVector.x * PULSAR_TAILEND );
+		Polys[ poly ].Pos3.y = PrimBullPos[i].y + ( PrimBullDir[ i ].y * Trail_Length ) + ( LeftVector.y * PULSAR_TAILEND );
+		Polys[ poly ].Pos3.z = PrimBullPos[i].z + ( PrimBullDir[ i ].z * Trail_Length ) + ( LeftVector.z * PULSAR_TAILEND );
+		Polys[ poly ].Pos4.x = PrimBullPos[i].x + ( PrimBullDir[ i ].x * Trail_Length ) - ( LeftVector.x * PULSAR_TAILEND );
+		Polys[ poly ].Pos4.y = PrimBullPos[i].y + ( PrimBullDir[ i ].y * Trail_Length ) - ( LeftVector.y * PULSAR_TAILEND );
+		Polys[ poly ].Pos4.z = PrimBullPos[i].z + ( PrimBullDir[ i ].z * Trail_Length ) - ( LeftVector.z * PULSAR_TAILEND );
 	}
 }
 
@@ -8305,7 +8414,7 @@ void ChangeTrojaxDir( u_int16_t i, VECTOR * Dir )
 	MATRIX	TempMatrix;
 
 	PrimBulls[i].ColFlag = 0;
-	PrimBulls[i].Dir = *Dir;
+	PrimBullDir[i] = *Dir;
 
 	fmpoly = PrimBulls[i].fmpoly;
 
@@ -8327,7 +8436,7 @@ void ChangeTrojaxDir( u_int16_t i, VECTOR * Dir )
 void ChangeSussgunDir( u_int16_t i, VECTOR * Dir )
 {
 	PrimBulls[i].ColFlag = 0;
-	PrimBulls[i].Dir = *Dir;
+	PrimBullDir[i] = *Dir;
 }
 
 /*===================================================================
@@ -8339,7 +8448,7 @@ void ChangeSussgunDir( u_int16_t i, VECTOR * Dir )
 void ChangeOrbitPulsarDir( u_int16_t i, VECTOR * Dir )
 {
 	PrimBulls[i].ColFlag = 0;
-	PrimBulls[i].Dir = *Dir;
+	PrimBullDir[i] = *Dir;
 }
 
 /*===================================================================
@@ -8789,20 +8898,20 @@ void GetLaserLocalVector( u_int16_t i, VECTOR * LocalVector )
 			switch( PrimBulls[i].OwnerType )
 			{
 				case OWNER_SHIP:
-					ApplyMatrix( &Ships[ PrimBulls[i].Owner ].Object.FinalInvMat, &PrimBulls[i].Dir, LocalVector );
+					ApplyMatrix( &Ships[ PrimBulls[i].Owner ].Object.FinalInvMat, &PrimBullDir[i], LocalVector );
 					break;
 
 				case OWNER_ENEMY:
 					if( !Enemies[ PrimBulls[i].Owner ].Object.FirstGun )
 					{
-		   				ApplyMatrix( &Enemies[ PrimBulls[i].Owner ].Object.FinalInvMat, &PrimBulls[i].Dir, LocalVector );
+		   				ApplyMatrix( &Enemies[ PrimBulls[i].Owner ].Object.FinalInvMat, &PrimBullDir[i], LocalVector );
 					}
 					else
 					{
 						GunPtr = PrimBulls[i].EnemyGun;
 						if( GunPtr )
 						{
-							ApplyMatrix( &GunPtr->InvMat, &PrimBulls[i].Dir, LocalVector );
+							ApplyMatrix( &GunPtr->InvMat, &PrimBullDir[i], LocalVector );
 						}
 					}
 					break;
@@ -8817,12 +8926,12 @@ void GetLaserLocalVector( u_int16_t i, VECTOR * LocalVector )
 						SpotFXPtr = ( ModelHeaders[ Models[ PrimBulls[i].Owner ].ModelNum ].SpotFX + PrimBulls[i].SpotFX );
 					}
 
-					ApplyMatrix( &Models[ PrimBulls[i].Owner ].InvMat, &PrimBulls[i].Dir, LocalVector );
+					ApplyMatrix( &Models[ PrimBulls[i].Owner ].InvMat, &PrimBullDir[i], LocalVector );
 					break;
 
 				case OWNER_NOBODY:
 				default:
-					*LocalVector = PrimBulls[i].Dir;
+					*LocalVector = PrimBullDir[i];
 					break;
 
 			}
@@ -8976,7 +9085,7 @@ FILE * SavePrimBulls( FILE * fp )
 			fwrite( &PrimBulls[ i ].Used, sizeof( bool ), 1, fp );
 			fwrite( &PrimBulls[ i ].Next, sizeof( u_int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].Prev, sizeof( u_int16_t ), 1, fp );
-			fwrite( &PrimBulls[ i ].Type, sizeof( u_int16_t ), 1, fp );
+			fwrite( &PrimBullType[ i ], sizeof( u_int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].OwnerType, sizeof( u_int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].Owner, sizeof( u_int16_t ), 1, fp );
 
@@ -8994,13 +9103,13 @@ FILE * SavePrimBulls( FILE * fp )
 			fwrite( &PrimBulls[ i ].Weapon, sizeof( int8_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].PowerLevel, sizeof( int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].TrojPower, sizeof( float ), 1, fp );
-			fwrite( &PrimBulls[ i ].LifeCount, sizeof( float ), 1, fp );
-			fwrite( &PrimBulls[ i ].Speed, sizeof( float ), 1, fp );
+			fwrite( &PrimBullLifeCount[ i ], sizeof( float ), 1, fp );
+			fwrite( &PrimBullSpeed[ i ], sizeof( float ), 1, fp );
 			fwrite( &PrimBulls[ i ].ColRadius, sizeof( float ), 1, fp );
 			fwrite( &PrimBulls[ i ].ColType, sizeof( u_int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].Offset, sizeof( VECTOR ), 1, fp );
-			fwrite( &PrimBulls[ i ].Pos, sizeof( VECTOR ), 1, fp );
-			fwrite( &PrimBulls[ i ].Dir, sizeof( VECTOR ), 1, fp );
+			fwrite( &PrimBullPos[ i ], sizeof( VECTOR ), 1, fp );
+			fwrite( &PrimBullDir[ i ], sizeof( VECTOR ), 1, fp );
 			fwrite( &PrimBulls[ i ].LocalDir, sizeof( VECTOR ), 1, fp );
 			fwrite( &PrimBulls[ i ].UpVector, sizeof( VECTOR ), 1, fp );
 			fwrite( &PrimBulls[ i ].ColStart, sizeof( VECTOR ), 1, fp );
@@ -9009,7 +9118,7 @@ FILE * SavePrimBulls( FILE * fp )
 			fwrite( &PrimBulls[ i ].ColPoint, sizeof( VERT ), 1, fp );
 			fwrite( &PrimBulls[ i ].ColPointNormal, sizeof( NORMAL ), 1, fp );
 			fwrite( &PrimBulls[ i ].ColGroup, sizeof( u_int16_t ), 1, fp );
-			fwrite( &PrimBulls[ i ].GroupImIn, sizeof( u_int16_t ), 1, fp );
+			fwrite( &PrimBullGroup[ i ], sizeof( u_int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].Mat, sizeof( MATRIX ), 1, fp );
 			fwrite( &PrimBulls[ i ].line, sizeof( u_int16_t ), 1, fp );
 			fwrite( &PrimBulls[ i ].fmpoly, sizeof( u_int16_t ), 1, fp );
@@ -9081,7 +9190,7 @@ FILE * LoadPrimBulls( FILE * fp )
 			fread( &PrimBulls[ i ].Used, sizeof( bool ), 1, fp );
 			fread( &PrimBulls[ i ].Next, sizeof( u_int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].Prev, sizeof( u_int16_t ), 1, fp );
-			fread( &PrimBulls[ i ].Type, sizeof( u_int16_t ), 1, fp );
+			fread( &PrimBullType[ i ], sizeof( u_int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].OwnerType, sizeof( u_int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].Owner, sizeof( u_int16_t ), 1, fp );
 
@@ -9099,13 +9208,13 @@ FILE * LoadPrimBulls( FILE * fp )
 			fread( &PrimBulls[ i ].Weapon, sizeof( int8_t ), 1, fp );
 			fread( &PrimBulls[ i ].PowerLevel, sizeof( int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].TrojPower, sizeof( float ), 1, fp );
-			fread( &PrimBulls[ i ].LifeCount, sizeof( float ), 1, fp );
-			fread( &PrimBulls[ i ].Speed, sizeof( float ), 1, fp );
+			fread( &PrimBullLifeCount[ i ], sizeof( float ), 1, fp );
+			fread( &PrimBullSpeed[ i ], sizeof( float ), 1, fp );
 			fread( &PrimBulls[ i ].ColRadius, sizeof( float ), 1, fp );
 			fread( &PrimBulls[ i ].ColType, sizeof( u_int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].Offset, sizeof( VECTOR ), 1, fp );
-			fread( &PrimBulls[ i ].Pos, sizeof( VECTOR ), 1, fp );
-			fread( &PrimBulls[ i ].Dir, sizeof( VECTOR ), 1, fp );
+			fread( &PrimBullPos[ i ], sizeof( VECTOR ), 1, fp );
+			fread( &PrimBullDir[ i ], sizeof( VECTOR ), 1, fp );
 			fread( &PrimBulls[ i ].LocalDir, sizeof( VECTOR ), 1, fp );
 			fread( &PrimBulls[ i ].UpVector, sizeof( VECTOR ), 1, fp );
 			fread( &PrimBulls[ i ].ColStart, sizeof( VECTOR ), 1, fp );
@@ -9114,7 +9223,7 @@ FILE * LoadPrimBulls( FILE * fp )
 			fread( &PrimBulls[ i ].ColPoint, sizeof( VERT ), 1, fp );
 			fread( &PrimBulls[ i ].ColPointNormal, sizeof( NORMAL ), 1, fp );
 			fread( &PrimBulls[ i ].ColGroup, sizeof( u_int16_t ), 1, fp );
-			fread( &PrimBulls[ i ].GroupImIn, sizeof( u_int16_t ), 1, fp );
+			fread( &PrimBullGroup[ i ], sizeof( u_int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].Mat, sizeof( MATRIX ), 1, fp );
 			fread( &PrimBulls[ i ].line, sizeof( u_int16_t ), 1, fp );
 			fread( &PrimBulls[ i ].fmpoly, sizeof( u_int16_t ), 1, fp );
@@ -9139,11 +9248,10 @@ FILE * LoadPrimBulls( FILE * fp )
 		while( i != (u_int16_t) -1 )
 		{
 			memset( &PrimBulls[i], 0, sizeof( PRIMARYWEAPONBULLET ) );
+			ClearPrimBullMotion( i );
 			PrimBulls[i].Used = false;
 			PrimBulls[i].Prev = (u_int16_t) -1;
-			PrimBulls[i].Type = (u_int16_t) -1;
 			PrimBulls[i].Owner = (u_int16_t) -1;
-			PrimBulls[i].GroupImIn = (u_int16_t) -1;
 			PrimBulls[i].fmpoly = (u_int16_t) -1;
 			PrimBulls[i].light = (u_int16_t) -1;
 			PrimBulls[i].line = (u_int16_t) -1;
@@ -178,11 +178,15 @@ typedef struct PRIMARYWEAPONATTRIB {
 
 } PRIMARYWEAPONATTRIB;
 
+/*===================================================================
+	Type, Pos, Dir, Speed, LifeCount and GroupImIn of a bullet live in
+	the parallel PrimBull* arrays in primary.c instead, so the movement
+	pass only streams through the fields it needs.
+===================================================================*/
 typedef struct PRIMARYWEAPONBULLET {
 	bool		Used;
 	u_int16_t		Next;							// link list.....	
 	u_int16_t		Prev;							// link list.....
-	u_int16_t		Type;							// which type of bullet am I
 	u_int16_t		OwnerType;						// who fired me...
 	u_int16_t		Owner;							// who fired me...
 	void *		EnemyGun;						// Only used by enemies.
@@ -190,13 +194,9 @@ typedef struct PRIMARYWEAPONBULLET {
 	int8_t		Weapon;							// Weapon type that fired me..
 	int16_t		PowerLevel;						// Power level the weapon has..
 	float		TrojPower;						// Trojax Power
-	float		LifeCount;						// how long do I live.....
-	float		Speed;							// how fast do I move
 	float		ColRadius;						// how big is my collide sphere
 	u_int16_t		ColType;						// what type of collision
 	VECTOR		Offset;							// offset relative to ship that fired me...
-	VECTOR		Pos;							// where am I
-	VECTOR		Dir;							// where am i going
 	VECTOR		LocalDir;						// Local Direction
 	VECTOR		UpVector;						// UpVector
 	VECTOR		ColStart;						// where I was when started going straight.
@@ -205,7 +205,6 @@ typedef struct PRIMARYWEAPONBULLET {
 	VERT		ColPoint;						// where am I going to collide
 	NORMAL		ColPointNormal;					// if I reflect use this when I do
 	u_int16_t		ColGroup;						// where am I going to collide
-	u_int16_t		GroupImIn;						// which group am I in...
 	MATRIX		Mat;							// and a Matrix for when Im displayed...
 	u_int16_t		line;							// attached line
 	u_int16_t		fmpoly;							// if Im 2D then I need a Face Me Poly..
@@ -57,6 +57,7 @@ typedef struct {
 	float					aspect_ratio;			/* screen aspect ratio */
 	bool					force_accel;			/* force 3d acelleration on gl */
 	bool					wireframe;
+	bool					texture_compression;	/* s3tc level textures when the card has it */
 
 #if SDL_VERSION_ATLEAST(2,0,0)
 	SDL_Window*             window;
@@ -131,6 +132,7 @@ typedef struct TEXTUREGROUP
 typedef void * LPVERTEXBUFFER;
 typedef void * LPARRAYBUFFER;
 typedef void * LPINDEXBUFFER;
+typedef void * LPVERTEXARRAY;
 
 // taken from d3d9
 
@@ -146,7 +148,11 @@ typedef struct RENDEROBJECT
 	LPVERTEXBUFFER	lpVertexBuffer;
 	LPARRAYBUFFER	lpNormalBuffer;
 	LPINDEXBUFFER	lpIndexBuffer;
+	LPVERTEXARRAY	lpVertexArray;	// buffer bindings and layout ( gl3 )
 	bool			vbLocked;
+	bool			vbOriginalColors;	// colors untouched since lights.c last restored them
+	u_int32_t		lights;			// shader lights reaching this object, bit n = light n of FSSetLights
+	int				streamed;		// buffers copied into the renderer's stream when drawn ( gl2/gl3 )
 	int numTextureGroups;
 	TEXTUREGROUP textureGroups[MAX_TEXTURE_GROUPS];
 } RENDEROBJECT;
@@ -156,7 +162,11 @@ typedef struct LEVELRENDEROBJECT
 	LPVERTEXBUFFER	lpVertexBuffer;
 	LPARRAYBUFFER	lpNormalBuffer;
 	LPINDEXBUFFER	lpIndexBuffer;
+	LPVERTEXARRAY	lpVertexArray;	// buffer bindings and layout ( gl3 )
 	bool			vbLocked;
+	bool			vbOriginalColors;	// colors untouched since lights.c last restored them
+	u_int32_t		lights;			// shader lights reaching this object, bit n = light n of FSSetLights
+	int				streamed;		// buffers copied into the renderer's stream when drawn ( gl2/gl3 )
 	int numTextureGroups;
 	TEXTUREGROUP textureGroups[MAX_LEVEL_TEXTURE_GROUPS];
 } LEVELRENDEROBJECT;
@@ -189,6 +199,34 @@ extern float render_lighting_env_water_red;
 extern float render_lighting_env_water_green;
 extern float render_lighting_env_water_blue;
 extern int render_lighting_env_whiteout;
+
+// lights the renderer can evaluate in its vertex shader ( gl2/gl3 )
+// FSSetLights returns false if it can't, lights.c then relights
+// vertex colors on the cpu and leaves every object's lights at 0
+#define MAX_RENDER_LIGHTS 16
+
+typedef struct {
+	VECTOR	pos;
+	float	size;
+	VECTOR	dir;		// spot lights only
+	float	cosarc;		// spot lights only
+	float	r, g, b;	// 0 - 255
+	bool	spot;
+} RENDERLIGHT;
+
+bool FSSetLights( RENDERLIGHT * lights, int num_lights );
+
+// counted by the renderer, render_flip moves them into render_last_stats
+typedef struct {
+	int draw_calls;
+	int texture_binds;
+	int stream_bytes;
+	int state_changes;	// state calls ( and texture binds ) sent to the driver
+	int state_filtered;	// state calls dropped as they changed nothing
+} render_stats_t;
+extern render_stats_t render_stats;
+extern render_stats_t render_last_stats;
+
 bool render_mode_select( render_info_t * info );
 void render_mode_wireframe(void);
 void render_mode_points(void);
@@ -206,6 +244,8 @@ bool FSGetViewPort(render_viewport_t *returnViewPort);
 bool FSBeginScene(void);
 bool FSEndScene(void);
 bool FSSetViewPort(render_viewport_t *newViewPort);
+bool FSSetScissor(render_viewport_t *rect);
+bool FSResetScissor(void);
 bool FSGetWorld(RENDERMATRIX *matrix);
 bool FSSetWorld( RENDERMATRIX *matrix );
 bool FSSetProjection( RENDERMATRIX *matrix );
@@ -227,12 +267,28 @@ bool FSLockPretransformedVertexBuffer(RENDEROBJECT *renderObject, TLVERTEX **ver
 bool FSCreateDynamic2dVertexBuffer(RENDEROBJECT *renderObject, int numVertices);
 
 bool FSCreateTexture(LPTEXTURE *texture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colourkey);
+
+// hands out a placeholder texture at once, sizes and colour key
+// filled in, while the image is decoded on a worker thread and
+// uploaded a few at a time from render_flip
+bool FSCreateTextureAsync(LPTEXTURE *texture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colourkey);
+
+// gl3 copies textures of the same size into array textures, a render
+// object whose texture groups are all in one of them can then be
+// merged into a single group drawn with one call.  Elsewhere these do
+// nothing and FSMergeTextureGroups returns false.
+bool FSCreateTextureArrays(LPTEXTURE *textures, int count);
+void FSReleaseTextureArrays(void);
+bool FSMergeTextureGroups(RENDEROBJECT *renderObject);
 bool update_texture_from_file(LPTEXTURE dstTexture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colourkey);
 void release_texture( LPTEXTURE texture );
 
 bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool orthographic );
+bool draw_render_object_groups( RENDEROBJECT *renderObject, int first_group, int num_groups, int primitive_type, bool orthographic );
 bool draw_line_object(RENDEROBJECT *renderObject);
 bool draw_object(RENDEROBJECT *renderObject);
+bool draw_object_group(RENDEROBJECT *renderObject, int group);
+bool draw_object_instances(RENDEROBJECT *renderObject, RENDERMATRIX *worlds, int count);
 bool draw_2d_object(RENDEROBJECT *renderObject);
 
 void FSReleaseRenderObject(RENDEROBJECT *renderObject);
@@ -67,6 +67,7 @@ bool FSEndScene(){ return true; }
 bool create_texture(LPTEXTURE *t, const char *path, u_int16_t *width, u_int16_t *height, int numMips, bool * colorkey){return true;}
 bool update_texture_from_file(LPTEXTURE dstTexture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colorkey){return true;}
 bool FSCreateTexture(LPTEXTURE *texture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colourkey){return true;}
+bool FSCreateTextureAsync(LPTEXTURE *texture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colourkey){return true;}
 bool render_mode_select( render_info_t * info ){return true;}
 bool render_reset( render_info_t * info ){return true;}
 bool render_flip( render_info_t * info ){return true;}
@@ -75,6 +76,9 @@ bool FSClearBlack(void){return true;}
 bool FSClearDepth(XYRECT * rect){return true;}
 bool FSGetViewPort(render_viewport_t *view){return true;}
 bool FSSetViewPort(render_viewport_t *view){return true;}
+bool FSSetScissor(render_viewport_t *rect){return true;}
+bool FSResetScissor(void){return true;}
+bool FSSetLights( RENDERLIGHT * lights, int num_lights ){return false;}
 bool FSSetProjection( RENDERMATRIX *matrix ){return true;}
 bool FSSetView( RENDERMATRIX *matrix ){return true;}
 bool FSSetWorld( RENDERMATRIX *matrix ){return true;}
@@ -83,6 +87,11 @@ bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject){return true;}
 bool FSUnlockVertexBuffer(RENDEROBJECT *renderObject){return true;}
 bool FSUnlockNormalBuffer(RENDEROBJECT *renderObject){return true;}
 bool draw_object(RENDEROBJECT *renderObject){return true;}
+bool draw_object_group(RENDEROBJECT *renderObject, int group){return true;}
+bool draw_object_instances(RENDEROBJECT *renderObject, RENDERMATRIX *worlds, int count){return true;}
+bool FSCreateTextureArrays(LPTEXTURE *textures, int count){return true;}
+void FSReleaseTextureArrays(void){}
+bool FSMergeTextureGroups(RENDEROBJECT *renderObject){return false;}
 bool draw_2d_object(RENDEROBJECT *renderObject){return true;}
 bool draw_line_object(RENDEROBJECT *renderObject){return true;}
 
@@ -172,6 +181,8 @@ float render_lighting_env_water_red   = 0.0f;
 float render_lighting_env_water_green = 0.0f;
 float render_lighting_env_water_blue  = 0.0f;
 int render_lighting_env_whiteout = 0;
+render_stats_t render_stats;
+render_stats_t render_last_stats;
 
 const char * render_error_description( int e ) { return NULL; }
 
@@ -2,66 +2,239 @@
 #include "render_gl_shared.h"
 #include "new3d.h"
 #include "lights.h"
+#include <stddef.h>
 
 //
-// using the concept of index/vertex buffers in opengl is a bit different
-// so for now I'm just going going to return a pointer to memory
-// then just convert the index/vertex buffer to a pure vertex buffer on draw
+// buffers live in client memory so the game can lock them for free,
+// each one is preceded by a small header (see gl1_buffer_t)
 //
-// the vertex/index pointers could probably end up being the glGen* id
-// then internal display lists can be generated for the non dynamic functions
-// so we can render the static objects as display lists
+// static buffers are mirrored into a vertex buffer object when
+// GL_ARB_vertex_buffer_object is present, the copy is refreshed the
+// next time the buffer is drawn after it was written to.  the level's
+// buffers are locked every frame to relight them and mostly come out
+// as they were, so a lock only counts as a write when a hash of the
+// data differs once it is unlocked
 //
+// dynamic buffers are rewritten many times a frame and only partly
+// used so they are drawn straight from client memory
+//
+
+#ifndef GL_BGRA
+#define GL_BGRA GL_BGRA_EXT
+#endif
+
+typedef struct
+{
+	GLuint	vbo;		// 0 when drawn from client memory
+	GLenum	target;		// GL_ARRAY_BUFFER_ARB or GL_ELEMENT_ARRAY_BUFFER_ARB
+	int		size;		// bytes of data following the header
+	int		uploaded;	// bytes of data the vbo holds
+	bool	dirty;		// changed since the last upload
+	bool	locked;		// locked and not yet unlocked
+	u_int32_t	hash;	// of the data when it was last unlocked
+} gl1_buffer_t;
+
+#define buffer_header( data ) ( ((gl1_buffer_t*)(data)) - 1 )
+#define buffer_data( header ) ( (char*)((header) + 1) )
+
+static PFNGLGENBUFFERSARBPROC		gen_buffers		= NULL;
+static PFNGLDELETEBUFFERSARBPROC	delete_buffers	= NULL;
+static PFNGLBINDBUFFERARBPROC		bind_buffer		= NULL;
+static PFNGLBUFFERDATAARBPROC		buffer_data_arb	= NULL;
+static PFNGLBUFFERSUBDATAARBPROC	buffer_sub_data	= NULL;
+
+bool bind_vbo_funcs( void )
+{
+	gen_buffers		= (PFNGLGENBUFFERSARBPROC)		SDL_GL_GetProcAddress( "glGenBuffersARB" );
+	delete_buffers	= (PFNGLDELETEBUFFERSARBPROC)	SDL_GL_GetProcAddress( "glDeleteBuffersARB" );
+	bind_buffer		= (PFNGLBINDBUFFERARBPROC)		SDL_GL_GetProcAddress( "glBindBufferARB" );
+	buffer_data_arb	= (PFNGLBUFFERDATAARBPROC)		SDL_GL_GetProcAddress( "glBufferDataARB" );
+	buffer_sub_data	= (PFNGLBUFFERSUBDATAARBPROC)	SDL_GL_GetProcAddress( "glBufferSubDataARB" );
+
+	if( !gen_buffers || !delete_buffers || !bind_buffer || !buffer_data_arb || !buffer_sub_data )
+	{
+		DebugPrintf("bind_vbo_funcs: failed to get proc address\n");
+		return false;
+	}
+	return true;
+}
+
+static void * create_buffer( int size, GLenum target, bool static_draw )
+{
+	gl1_buffer_t * buffer = malloc( sizeof(gl1_buffer_t) + size );
+	if(!buffer)
+		return NULL;
+	buffer->vbo = 0;
+	buffer->target = target;
+	buffer->size = size;
+	buffer->uploaded = 0;
+	buffer->dirty = true;
+	buffer->locked = false;
+	buffer->hash = 0;
+	if( static_draw && caps.vbo )
+	{
+		gen_buffers( 1, &buffer->vbo );
+		CHECK_GL_ERRORS;
+	}
+	return buffer_data( buffer );
+}
+
+void delete_buffer( void ** data )
+{
+	gl1_buffer_t * buffer = buffer_header( *data );
+	if( buffer->vbo )
+	{
+		delete_buffers( 1, &buffer->vbo );
+		CHECK_GL_ERRORS;
+	}
+	free( buffer );
+	*data = NULL;
+}
+
+static u_int32_t hash_buffer( gl1_buffer_t * buffer )
+{
+	u_int32_t * words = (u_int32_t *) buffer_data( buffer );
+	u_int8_t * bytes;
+	u_int32_t hash = 2166136261U;
+	int i, count = buffer->size / 4;
+
+	for( i = 0; i < count; i++ )
+		hash = ( hash ^ words[i] ) * 16777619U;
+	bytes = (u_int8_t *) &words[count];
+	for( i = 0; i < ( buffer->size & 3 ); i++ )
+		hash = ( hash ^ bytes[i] ) * 16777619U;
+	return hash;
+}
+
+static void * lock_buffer( void * data )
+{
+	if( data )
+		buffer_header( data )->locked = true;
+	return data;
+}
+
+// only buffers with a vbo care whether a lock changed anything
+
+static void check_buffer( gl1_buffer_t * buffer )
+{
+	u_int32_t hash;
+
+	if( !buffer->vbo )
+		return;
+
+	hash = hash_buffer( buffer );
+	if( hash != buffer->hash )
+	{
+		buffer->hash = hash;
+		buffer->dirty = true;
+	}
+}
+
+static void unlock_buffer( void * data )
+{
+	gl1_buffer_t * buffer;
+
+	if( !data )
+		return;
+	buffer = buffer_header( data );
+	if( !buffer->locked )
+		return;
+	buffer->locked = false;
+	check_buffer( buffer );
+}
+
+// make sure the vbo holds the first size bytes of the buffer
+// and leave it bound to its target
+
+static void upload_buffer( gl1_buffer_t * buffer, int size )
+{
+	if( size > buffer->size )
+		size = buffer->size;
+
+	// drawn while still locked, see what was written so far
+	if( buffer->locked )
+		check_buffer( buffer );
+
+	bind_buffer( buffer->target, buffer->vbo );
+
+	if( buffer->dirty )
+	{
+		// index buffers are only sent up as far as they are drawn
+		if( buffer->target == GL_ARRAY_BUFFER_ARB )
+			size = buffer->size;
+		buffer_data_arb( buffer->target, buffer->size, NULL, GL_STATIC_DRAW_ARB );
+		buffer_sub_data( buffer->target, 0, size, buffer_data( buffer ) );
+		buffer->uploaded = size;
+		buffer->dirty = false;
+	}
+	else if( size > buffer->uploaded )
+	{
+		buffer_sub_data( buffer->target, buffer->uploaded, size - buffer->uploaded,
+			buffer_data( buffer ) + buffer->uploaded );
+		buffer->uploaded = size;
+	}
+
+	CHECK_GL_ERRORS;
+}
 
 bool FSCreateVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
-	renderObject->lpVertexBuffer = malloc( numVertices * sizeof(LVERTEX) );
+	renderObject->lpVertexBuffer = create_buffer( numVertices * sizeof(LVERTEX), GL_ARRAY_BUFFER_ARB, true );
 	return true;
 }
 bool FSCreateDynamicVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
-{FSCreateVertexBuffer(renderObject, numVertices); return true;}
+{
+	renderObject->lpVertexBuffer = create_buffer( numVertices * sizeof(LVERTEX), GL_ARRAY_BUFFER_ARB, false );
+	return true;
+}
 
 bool FSCreateNormalBuffer(RENDEROBJECT *renderObject, int numNormals)
-{ renderObject->lpNormalBuffer = malloc( numNormals * sizeof(NORMAL) ); return true; }
+{ renderObject->lpNormalBuffer = create_buffer( numNormals * sizeof(NORMAL), GL_ARRAY_BUFFER_ARB, false ); return true; }
 
 bool FSCreateDynamicNormalBuffer(RENDEROBJECT *renderObject, int numNormals)
 {FSCreateNormalBuffer(renderObject, numNormals); return true;}
 
 bool FSCreateIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 {
-	renderObject->lpIndexBuffer = malloc( numIndices * 3 * sizeof(WORD) );
+	renderObject->lpIndexBuffer = create_buffer( numIndices * 3 * sizeof(WORD), GL_ELEMENT_ARRAY_BUFFER_ARB, true );
 	return true;
 }
 bool FSCreateDynamicIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
-{return FSCreateIndexBuffer(renderObject,numIndices);}
+{
+	renderObject->lpIndexBuffer = create_buffer( numIndices * 3 * sizeof(WORD), GL_ELEMENT_ARRAY_BUFFER_ARB, false );
+	return true;
+}
 
 bool FSLockIndexBuffer(RENDEROBJECT *renderObject, WORD **indices)
-{(*indices) = renderObject->lpIndexBuffer; return true;}
+{(*indices) = lock_buffer( renderObject->lpIndexBuffer ); return true;}
 
 bool FSLockVertexBuffer(RENDEROBJECT *renderObject, LVERTEX **verts)
-{(*verts) = renderObject->lpVertexBuffer; return true;}
-bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject){return true;}
-bool FSUnlockVertexBuffer(RENDEROBJECT *renderObject){return true;}
+{(*verts) = lock_buffer( renderObject->lpVertexBuffer ); return true;}
+bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject)
+{unlock_buffer( renderObject->lpIndexBuffer ); return true;}
+bool FSUnlockVertexBuffer(RENDEROBJECT *renderObject)
+{unlock_buffer( renderObject->lpVertexBuffer ); return true;}
 
 bool FSLockNormalBuffer(RENDEROBJECT *renderObject, NORMAL **normals)
-{(*normals) = renderObject->lpNormalBuffer; return true;}
-bool FSUnlockNormalBuffer(RENDEROBJECT *renderObject){return true;}
+{(*normals) = lock_buffer( renderObject->lpNormalBuffer ); return true;}
+bool FSUnlockNormalBuffer(RENDEROBJECT *renderObject)
+{unlock_buffer( renderObject->lpNormalBuffer ); return true;}
 
 bool FSCreateDynamic2dVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
-	renderObject->lpVertexBuffer = malloc( numVertices * sizeof(TLVERTEX) ); 
+	renderObject->lpVertexBuffer = create_buffer( numVertices * sizeof(TLVERTEX), GL_ARRAY_BUFFER_ARB, false );
 	return true;
 }
 bool FSLockPretransformedVertexBuffer(RENDEROBJECT *renderObject, TLVERTEX **verts)
-{*verts = (void*)renderObject->lpVertexBuffer; return true;}
+{*verts = lock_buffer( renderObject->lpVertexBuffer ); return true;}
 
-static void set_color( COLOR c )
+static COLOR swap_red_blue( COLOR c )
 {
 	// COLOR is the value loaded from the files
-	// it's packed as uchar[4] (bgra) and glColor expects (rgba)
+	// it's packed as uchar[4] (bgra) and glColorPointer expects (rgba)
+	// unless GL_EXT_vertex_array_bgra is around
 	// so we flip the red/blue values with each other
-	c = (c & 0xff00ff00) | ((c & 0x00ff0000) >> 16) | ((c & 0x000000ff) << 16);
-	glColor4ubv((GLubyte*)&c);
+	return (c & 0xff00ff00) | ((c & 0x00ff0000) >> 16) | ((c & 0x000000ff) << 16);
 }
 
 int render_color_blend_red   = 0;
@@ -103,6 +276,13 @@ void render_reset_lighting_variables( void )
 	render_lighting_env_whiteout = 0;
 }
 
+// no shaders here, lights.c keeps relighting vertex colors itself
+
+bool FSSetLights( RENDERLIGHT * lights, int num_lights )
+{
+	return false;
+}
+
 void do_water_effect( VECTOR * pos, COLOR * color )
 {
 	u_int32_t r,g,b;
@@ -310,28 +490,47 @@ void light_vert( LVERTEX * vert, u_int8_t * color )
 	}
 }
 
-static void draw_vert( void * _vert, bool orthographic )
+// colors for verts that can't be handed to gl as they are
+// either because they need lighting or gl wants them as rgba
+
+static COLOR * color_array = NULL;
+static int color_array_size = 0;
+
+static COLOR * fill_color_array( char * vert, int stride, int count, bool orthographic )
 {
-	LVERTEX * vert = (LVERTEX*) _vert;
-	TLVERTEX * tlvert = (TLVERTEX*) _vert;
-	if(orthographic)
+	int i;
+	if( count > color_array_size )
 	{
-		set_color( tlvert->color );
-		glTexCoord2f( tlvert->tu, tlvert->tv );
-		glVertex2f( tlvert->x, tlvert->y );
+		COLOR * colors = realloc( color_array, count * sizeof(COLOR) );
+		if(!colors)
+		{
+			DebugPrintf("fill_color_array: failed to grow to %d colors\n",count);
+			return NULL;
+		}
+		color_array = colors;
+		color_array_size = count;
 	}
-	else
+	for( i = 0; i < count; i++, vert += stride )
 	{
+		COLOR c = orthographic ? ((TLVERTEX*)vert)->color : ((LVERTEX*)vert)->color;
 #ifdef NEW_LIGHTING
-		COLOR c = vert->color;
-		light_vert( vert, (u_int8_t*) &c );
-		set_color( c );
-#else
-		set_color( vert->color );
+		if(!orthographic)
+			light_vert( (LVERTEX*) vert, (u_int8_t*) &c );
 #endif
-		glTexCoord2f( vert->tu, vert->tv );
-		glVertex3f( vert->x, vert->y, vert->z );
+		color_array[i] = caps.vertex_array_bgra ? c : swap_red_blue( c );
 	}
+	return color_array;
+}
+
+// number of verts an indexed texture group reaches into
+
+static int count_group_verts( WORD * indices, int numIndices )
+{
+	int i, max = -1;
+	for( i = 0; i < numIndices; i++ )
+		if( indices[i] > max )
+			max = indices[i];
+	return max + 1;
 }
 
 // accept fragment if alpha value is greater than x
@@ -343,23 +542,41 @@ static void draw_vert( void * _vert, bool orthographic )
 static void set_alpha_ignore( void )
 {
 	float x = 100.f;
-	glEnable(GL_ALPHA_TEST);
-	glAlphaFunc(GL_GREATER,(x/255.0f));
+	state_enable(GL_ALPHA_TEST, true);
+	state_alpha_func(GL_GREATER,(x/255.0f));
 }
 
 static void unset_alpha_ignore( void )
 {
-	glDisable(GL_ALPHA_TEST);
+	state_enable(GL_ALPHA_TEST, false);
 }
 
-bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool orthographic )
+bool draw_render_object_groups( RENDEROBJECT *renderObject, int first_group, int num_groups, int primitive_type, bool orthographic )
 {
 	int group;
-	LVERTEX * verts = (LVERTEX*) renderObject->lpVertexBuffer;
-	TLVERTEX * tlverts = (TLVERTEX*) renderObject->lpVertexBuffer;
+	gl1_buffer_t * vb;
+	gl1_buffer_t * ib = renderObject->lpIndexBuffer ? buffer_header( renderObject->lpIndexBuffer ) : NULL;
 	WORD * indices = (WORD*) renderObject->lpIndexBuffer;
+	char * verts = (char*) renderObject->lpVertexBuffer;
+	char * vb_base; // what the pointers are relative to
+	char * ib_base = ( ib && ib->vbo ) ? NULL : (char*) indices;
+	int stride = orthographic ? sizeof(TLVERTEX) : sizeof(LVERTEX);
+	int color_offset = orthographic ? offsetof(TLVERTEX,color) : offsetof(LVERTEX,color);
+	int texc_offset = orthographic ? offsetof(TLVERTEX,tu) : offsetof(LVERTEX,tu);
+	bool copy_colors = !caps.vertex_array_bgra;
+
+#ifdef NEW_LIGHTING
+	if(!orthographic)
+		copy_colors = true;
+#endif
 
 	//assert(renderObject->vbLocked == 0);
+
+	if( !verts || num_groups <= 0 )
+		return true;
+
+	vb = buffer_header( verts );
+	vb_base = vb->vbo ? NULL : verts;
 	
 	if(orthographic)
 	{
@@ -376,57 +593,105 @@ bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool or
 		glTranslatef(0.0f, -((float)render_info.ThisMode.h), 0.0f);
 	}
 
-	for (group = 0; group < renderObject->numTextureGroups; group++)
+	if( vb->vbo )
+		upload_buffer( vb, vb->size );
+
+	if( ib && ib->vbo )
+	{
+		int used = 0;
+		for (group = 0; group < renderObject->numTextureGroups; group++)
+		{
+			int end = ( renderObject->textureGroups[group].startIndex +
+				renderObject->textureGroups[group].numTriangles * 3 ) * sizeof(WORD);
+			if( end > used )
+				used = end;
+		}
+		upload_buffer( ib, used );
+	}
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+	for (group = first_group; group < first_group + num_groups; group++)
 	{
-		int i;
 		int startVert  = renderObject->textureGroups[group].startVert;
 		int numVerts   = renderObject->textureGroups[group].numVerts;
+		int startIndex = renderObject->textureGroups[group].startIndex;
+		int numIndices = renderObject->textureGroups[group].numTriangles * 3;
+		int count = 0;
+		char * first = vb_base + startVert * stride;
+
+		// gl1 has no base vertex so the arrays start at the group's
+		// first vert and the group's indices are relative to that
+		if( indices )
+		{
+			if( numIndices <= 0 )
+				continue;
+			if( copy_colors )
+				count = count_group_verts( &indices[startIndex], numIndices );
+		}
+		// the non indexed path has always treated numVerts as the end
+		else
+		{
+			count = numVerts - startVert;
+			if( count <= 0 )
+				continue;
+		}
+
+		if( copy_colors )
+		{
+			COLOR * colors = fill_color_array( verts + startVert * stride, stride, count, orthographic );
+			if(!colors)
+				continue;
+			if( vb->vbo )
+				bind_buffer( GL_ARRAY_BUFFER_ARB, 0 );
+			glColorPointer( caps.vertex_array_bgra ? GL_BGRA : 4, GL_UNSIGNED_BYTE, 0, colors );
+			if( vb->vbo )
+				bind_buffer( GL_ARRAY_BUFFER_ARB, vb->vbo );
+		}
+		else
+		{
+			glColorPointer( GL_BGRA, GL_UNSIGNED_BYTE, stride, first + color_offset );
+		}
 
+		glVertexPointer( orthographic ? 2 : 3, GL_FLOAT, stride, first );
+		glTexCoordPointer( 2, GL_FLOAT, stride, first + texc_offset );
+
+		// both are left as the group wants them, every draw sets
+		// them again so runs of groups sharing them cost nothing
 		if(renderObject->textureGroups[group].colourkey)
 			set_alpha_ignore();
+		else
+			unset_alpha_ignore();
 
 		if( renderObject->textureGroups[group].texture )
 		{
 			GLuint texture = *(GLuint*)renderObject->textureGroups[group].texture;
-			glEnable(GL_TEXTURE_2D);
-			glBindTexture(GL_TEXTURE_2D, texture);
+			state_enable(GL_TEXTURE_2D, true);
+			bind_texture(texture);
 		}
-
-		glBegin(primitive_type);
+		else
+			state_enable(GL_TEXTURE_2D, false);
 
 		// draw vertex list using index list
-		if(renderObject->lpIndexBuffer)
-		{
-			int startIndex = renderObject->textureGroups[group].startIndex;
-			int numIndices = renderObject->textureGroups[group].numTriangles * 3;
-			for( i = 0; i < numIndices; i++ )
-			{
-				int indice = indices[ startIndex + i ];
-				int vert = startVert + indice;
-				if(orthographic)
-					draw_vert( &tlverts[vert], orthographic );
-				else
-					draw_vert( &verts[vert], orthographic );
-			}
-		}
+		if( indices )
+			glDrawElements( primitive_type, numIndices, GL_UNSIGNED_SHORT,
+				ib_base + startIndex * sizeof(WORD) );
 		// draw using only vertex list
 		else
-		{
-			for( i = startVert; i < numVerts; i++ )
-				if(orthographic)
-					draw_vert( &tlverts[i], orthographic );
-				else
-					draw_vert( &verts[i], orthographic );
-		}
-		
-		glEnd();
+			glDrawArrays( primitive_type, 0, count );
+		render_stats.draw_calls++;
+	}
 
-		if( renderObject->textureGroups[group].texture )
-			glDisable(GL_TEXTURE_2D);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
-		if(renderObject->textureGroups[group].colourkey)
-			unset_alpha_ignore();
-	}
+	if( vb->vbo )
+		bind_buffer( GL_ARRAY_BUFFER_ARB, 0 );
+	if( ib && ib->vbo )
+		bind_buffer( GL_ELEMENT_ARRAY_BUFFER_ARB, 0 );
 
 	if(orthographic)
 	{
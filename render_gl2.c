@@ -9,9 +9,9 @@ bool FSCreateVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 }
 bool FSCreateDynamicVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
-	renderObject->lpVertexBuffer = create_buffer( 
-		numVertices * sizeof(LVERTEX), GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
-	return true;
+	renderObject->lpVertexBuffer = create_stream_data( numVertices * sizeof(LVERTEX) );
+	renderObject->streamed |= STREAMED_VERTICES;
+	return renderObject->lpVertexBuffer != NULL;
 }
 
 bool FSCreateNormalBuffer(RENDEROBJECT *renderObject, int numNormals)
@@ -35,9 +35,9 @@ bool FSCreateIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 }
 bool FSCreateDynamicIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 {
-	renderObject->lpIndexBuffer = create_buffer( 
-		numIndices * 3 * sizeof(WORD), GL_ELEMENT_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
-	return true;
+	renderObject->lpIndexBuffer = create_stream_data( numIndices * 3 * sizeof(WORD) );
+	renderObject->streamed |= STREAMED_INDICES;
+	return renderObject->lpIndexBuffer != NULL;
 }
 
 // In OpenGL you can only map buffers currently bound to a predefined
@@ -45,15 +45,22 @@ bool FSCreateDynamicIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 // buffer and restore it on unlock.
 //
 // There is still the restriction that only one buffer of a certain
-// type may be locked at the same time. If this is a problem then this
-// should be rewritten to use a locally malloc'ed buffer and update
-// the real buffer on unlock using glBufferSubData.
+// type may be locked at the same time. Dynamic buffers don't have it,
+// they are filled in memory and streamed (see create_stream_data).
 
 static GLuint old_array_buf = 0;
 static GLuint old_index_buf = 0;
 
 bool FSLockVertexBuffer(RENDEROBJECT *renderObject, LVERTEX **verts)
 {
+	// whoever locks may change the colors, lights.c sets these again
+	renderObject->vbOriginalColors = false;
+	renderObject->lights = 0;
+	if ( renderObject->streamed & STREAMED_VERTICES )
+	{
+		*verts = (LVERTEX *) lock_stream_data( renderObject->lpVertexBuffer );
+		return true;
+	}
 	if ( old_array_buf )
 	{
 		DebugPrintf( "Tried to lock more than one vertex buffer at once\n" );
@@ -73,7 +80,10 @@ bool FSLockVertexBuffer(RENDEROBJECT *renderObject, LVERTEX **verts)
 
 bool FSUnlockVertexBuffer(RENDEROBJECT *renderObject)
 {
-	bool ret = ( glUnmapBuffer( GL_ARRAY_BUFFER ) == GL_TRUE );
+	bool ret;
+	if ( renderObject->streamed & STREAMED_VERTICES )
+		return true;
+	ret = ( glUnmapBuffer( GL_ARRAY_BUFFER ) == GL_TRUE );
 	glBindBuffer( GL_ARRAY_BUFFER, old_array_buf );
 	old_array_buf = 0;
 	CHECK_GL_ERRORS;
@@ -110,6 +120,11 @@ bool FSUnlockNormalBuffer(RENDEROBJECT *renderObject)
 
 bool FSLockIndexBuffer(RENDEROBJECT *renderObject, WORD **indices)
 {
+	if ( renderObject->streamed & STREAMED_INDICES )
+	{
+		*indices = (WORD *) lock_stream_data( renderObject->lpIndexBuffer );
+		return true;
+	}
 	if ( old_index_buf )
 	{
 		DebugPrintf( "Tried to lock more than one index buffer at once\n" );
@@ -129,7 +144,10 @@ bool FSLockIndexBuffer(RENDEROBJECT *renderObject, WORD **indices)
 
 bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject)
 {
-	bool ret = ( glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER ) == GL_TRUE );
+	bool ret;
+	if ( renderObject->streamed & STREAMED_INDICES )
+		return true;
+	ret = ( glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER ) == GL_TRUE );
 	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, old_index_buf );
 	old_index_buf = 0;
 	CHECK_GL_ERRORS;
@@ -138,9 +156,9 @@ bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject)
 
 bool FSCreateDynamic2dVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
-	renderObject->lpVertexBuffer = create_buffer( 
-		numVertices * sizeof(TLVERTEX), GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
-	return true;
+	renderObject->lpVertexBuffer = create_stream_data( numVertices * sizeof(TLVERTEX) );
+	renderObject->streamed |= STREAMED_VERTICES;
+	return renderObject->lpVertexBuffer != NULL;
 }
 
 bool FSLockPretransformedVertexBuffer(RENDEROBJECT *renderObject, TLVERTEX **verts)
@@ -162,81 +180,36 @@ bool FSLockPretransformedVertexBuffer(RENDEROBJECT *renderObject, TLVERTEX **ver
  *   - draw group->numVerts elements starting at group->startVert
  */
 
-bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool orthographic )
+bool draw_render_object_groups( RENDEROBJECT *renderObject, int first_group, int num_groups, int primitive_type, bool orthographic )
 {
-	static const struct
-	{
-		const char *name;
-		int components;
-		GLenum type;
-		GLboolean normalized;
-		int offset;
-	} normal_attr[] =
-	{
-		{ "pos",    3, GL_FLOAT,         GL_FALSE, 0  },
-		{ "vcolor", 4, GL_UNSIGNED_BYTE, GL_TRUE,  12 }, // 3*float
-		{ "vtexc",  2, GL_FLOAT,         GL_FALSE, 16 }, // 3*float + 1*COLOR
-		{ NULL,     0, 0,                0,        0  }
-	}, ortho_attr[] =
-	{
-		{ "tlpos",  4, GL_FLOAT,         GL_FALSE, 0 },
-		{ "vcolor", 4, GL_UNSIGNED_BYTE, GL_TRUE,  16 }, // 4*float
-		{ "vtexc",  2, GL_FLOAT,         GL_FALSE, 20 }, // 4*float + 1*COLOR
-		{ NULL,     0, 0,                0,        0  }
-	}, *attr;
-	//GLuint current_program;
-	GLuint u_ortho;
-	GLuint u_colorkey;
-	GLuint u_enabletex;
 	TEXTUREGROUP *group;
 	texture_t *texdata;
-	int loc;
+	stream_offsets_t offsets;
 	int i;
 
-	glBindBuffer( GL_ARRAY_BUFFER, renderObject->lpVertexBuffer );
+	if ( !stream_render_object( renderObject, orthographic, &offsets ) )
+		return false;
+
+	// GL 2 has no vertex array objects so the layout is given on every
+	// draw, but the attribute locations are fixed at link time
+	if ( renderObject->streamed & STREAMED_VERTICES )
+		glBindBuffer( GL_ARRAY_BUFFER, stream_buffer( STREAM_VERTICES ) );
+	else
+		glBindBuffer( GL_ARRAY_BUFFER, renderObject->lpVertexBuffer );
+	set_vertex_attribs( orthographic );
 
-	if ( renderObject->lpIndexBuffer )
+	if ( renderObject->streamed & STREAMED_INDICES )
+		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, stream_buffer( STREAM_INDICES ) );
+	else if ( renderObject->lpIndexBuffer )
 		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, renderObject->lpIndexBuffer );
 	else
 		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
 
-	//glGetIntegerv( GL_CURRENT_PROGRAM, &current_program );
-	// assert( current_program != 0 );
-
-	CHECK_GL_ERRORS;
-
-	// Tell OpenGL about the buffer data layout
-	// see the LVERTEX and TLVERTEX definitions inside include/new3d.h
-	attr = orthographic ? ortho_attr : normal_attr;
-	for ( i=0; attr[i].name; i++ )
-	{
-		loc = glGetAttribLocation( current_program, attr[i].name );
-		if (loc >= 0)
-		{
-			glVertexAttribPointer(
-				loc,
-				attr[i].components,
-				attr[i].type,
-				attr[i].normalized,
-				orthographic ? sizeof(TLVERTEX) : sizeof(LVERTEX),
-				attr[i].offset
-			);
-			glEnableVertexAttribArray( loc );
-		}
-	}
-
-	CHECK_GL_ERRORS;
-
 	// tell it about the normal buffer
 	if ( renderObject->lpNormalBuffer )
 	{
 		glBindBuffer( GL_ARRAY_BUFFER, renderObject->lpNormalBuffer );
-		loc = glGetAttribLocation( current_program, "vnormal" );
-		if (loc >= 0)
-		{
-			glVertexAttribPointer( loc, 3, GL_FLOAT, GL_FALSE, sizeof(NORMAL), 0 );
-			glEnableVertexAttribArray( loc );
-		}
+		set_normal_attribs();
 	}
 
 	CHECK_GL_ERRORS;
@@ -248,47 +221,34 @@ bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool or
 		mvp_update( current_program );
 
 	// This uniform tells the vertex shader which matrix to use
-	if ((u_ortho = glGetUniformLocation(current_program, "orthographic")) >= 0)
-		glUniform1i( u_ortho, orthographic ? GL_TRUE : GL_FALSE );
+	set_uniform_bool( &uniforms.orthographic, orthographic );
+
+	// and this one which of the lights reach the object
+	lights_update( orthographic ? 0 : renderObject->lights );
 
-	for ( i = 0; i < renderObject->numTextureGroups; i++ )
+	for ( i = first_group; i < first_group + num_groups; i++ )
 	{
 		group = &renderObject->textureGroups[i];
-		if ( (u_colorkey = glGetUniformLocation(current_program, "colorkeying_enabled")) >= 0 )
-			glUniform1i( u_colorkey, group->colourkey ? GL_TRUE : GL_FALSE );
-		if ( (u_enabletex = glGetUniformLocation(current_program, "texturing_enabled")) >= 0 )
+		set_uniform_bool( &uniforms.colorkeying_enabled, group->colourkey );
+		set_uniform_bool( &uniforms.texturing_enabled, group->texture != NULL );
+		if ( group->texture )
 		{
-			glUniform1i( u_enabletex, group->texture ? GL_TRUE : GL_FALSE );
-			if ( group->texture )
-			{
-				texdata = (texture_t *) group->texture;
-				glBindTexture( GL_TEXTURE_2D, texdata->id );
-			}
+			texdata = (texture_t *) group->texture;
+			bind_texture( texdata->id );
 		}
 		glDrawElementsBaseVertex(
 			primitive_type,
 			group->numTriangles * 3,
 			GL_UNSIGNED_SHORT,
-			group->startIndex * sizeof(WORD),
-			group->startVert
+			(void*)( offsets.index_offset + group->startIndex * sizeof(WORD) ),
+			offsets.base_vertex + group->startVert
 		);
+		render_stats.draw_calls++;
 	}
 
 	CHECK_GL_ERRORS;
 
-	for ( i=0; attr[i].name; i++ )
-	{
-		loc = glGetAttribLocation( current_program, attr[i].name );
-		if (loc >= 0)
-			glDisableVertexAttribArray( loc );
-	}
-
-	if ( renderObject->lpNormalBuffer )
-	{
-		loc = glGetAttribLocation( current_program, "vnormal" );
-		if (loc >= 0)
-			glDisableVertexAttribArray( loc );
-	}
+	disable_vertex_attribs();
 
 	CHECK_GL_ERRORS;
 
@@ -1,37 +1,93 @@
 #if GL == 3
 #include "render_gl_shared.h"
 
+// Each render object gets a vertex array object when its vertex
+// buffer is created. The index and normal buffers are attached to it
+// as they are created so drawing only has to bind the array object.
+//
+// The array object is unbound again straight away so later buffer
+// binds (locking) can't change what it records.
+//
+// Dynamic buffers record the stream buffers instead, which never
+// change name, and drawing adds where the data went in the stream.
+
+static void create_vertex_array( RENDEROBJECT *renderObject, GLuint buffer, bool orthographic )
+{
+	GLuint vao;
+	GLuint old_array_buf;
+
+	glGenVertexArrays( 1, &vao );
+	glBindVertexArray( vao );
+	glGetIntegerv( GL_ARRAY_BUFFER_BINDING, &old_array_buf );
+	glBindBuffer( GL_ARRAY_BUFFER, buffer );
+	set_vertex_attribs( orthographic );
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, old_array_buf );
+	CHECK_GL_ERRORS;
+
+	renderObject->lpVertexArray = (LPVERTEXARRAY) vao;
+}
+
+static void attach_index_buffer( RENDEROBJECT *renderObject, GLuint buffer )
+{
+	glBindVertexArray( (GLuint) renderObject->lpVertexArray );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, buffer );
+	glBindVertexArray( 0 );
+	CHECK_GL_ERRORS;
+}
+
+static void attach_normal_buffer( RENDEROBJECT *renderObject )
+{
+	GLuint old_array_buf;
+
+	glBindVertexArray( (GLuint) renderObject->lpVertexArray );
+	glGetIntegerv( GL_ARRAY_BUFFER_BINDING, &old_array_buf );
+	glBindBuffer( GL_ARRAY_BUFFER, (GLuint) renderObject->lpNormalBuffer );
+	set_normal_attribs();
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, old_array_buf );
+	CHECK_GL_ERRORS;
+}
+
 bool FSCreateVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
 	renderObject->lpVertexBuffer = create_buffer( numVertices * sizeof(LVERTEX), GL_ARRAY_BUFFER, GL_STATIC_DRAW );
+	create_vertex_array( renderObject, (GLuint) renderObject->lpVertexBuffer, false );
 	return true;
 }
 bool FSCreateDynamicVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
-	renderObject->lpVertexBuffer = create_buffer( numVertices * sizeof(LVERTEX), GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
-	return true;
+	renderObject->lpVertexBuffer = create_stream_data( numVertices * sizeof(LVERTEX) );
+	renderObject->streamed |= STREAMED_VERTICES;
+	create_vertex_array( renderObject, stream_buffer( STREAM_VERTICES ), false );
+	return renderObject->lpVertexBuffer != NULL;
 }
 
 bool FSCreateNormalBuffer(RENDEROBJECT *renderObject, int numNormals)
 {
 	renderObject->lpNormalBuffer = create_buffer( numNormals * sizeof(NORMAL), GL_ELEMENT_ARRAY_BUFFER, GL_STATIC_DRAW );
+	attach_normal_buffer( renderObject );
 	return true;
 }
 bool FSCreateDynamicNormalBuffer(RENDEROBJECT *renderObject, int numNormals)
 {
 	renderObject->lpNormalBuffer = create_buffer( numNormals * sizeof(NORMAL), GL_ELEMENT_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
+	attach_normal_buffer( renderObject );
 	return true;
 }
 
 bool FSCreateIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 {
 	renderObject->lpIndexBuffer = create_buffer( numIndices * 3 * sizeof(WORD), GL_ELEMENT_ARRAY_BUFFER, GL_STATIC_DRAW );
+	attach_index_buffer( renderObject, (GLuint) renderObject->lpIndexBuffer );
 	return true;
 }
 bool FSCreateDynamicIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 {
-	renderObject->lpIndexBuffer = create_buffer( numIndices * 3 * sizeof(WORD), GL_ELEMENT_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
-	return true;
+	renderObject->lpIndexBuffer = create_stream_data( numIndices * 3 * sizeof(WORD) );
+	renderObject->streamed |= STREAMED_INDICES;
+	attach_index_buffer( renderObject, stream_buffer( STREAM_INDICES ) );
+	return renderObject->lpIndexBuffer != NULL;
 }
 
 // In OpenGL you can only map buffers currently bound to a predefined
@@ -39,15 +95,22 @@ bool FSCreateDynamicIndexBuffer(RENDEROBJECT *renderObject, int numIndices)
 // buffer and restore it on unlock.
 //
 // There is still the restriction that only one buffer of a certain
-// type may be locked at the same time. If this is a problem then this
-// should be rewritten to use a locally malloc'ed buffer and update
-// the real buffer on unlock using glBufferSubData.
+// type may be locked at the same time. Dynamic buffers don't have it,
+// they are filled in memory and streamed (see create_stream_data).
 
 static GLuint old_array_buf = 0;
 static GLuint old_index_buf = 0;
 
 bool FSLockVertexBuffer(RENDEROBJECT *renderObject, LVERTEX **verts)
 {
+	// whoever locks may change the colors, lights.c sets these again
+	renderObject->vbOriginalColors = false;
+	renderObject->lights = 0;
+	if ( renderObject->streamed & STREAMED_VERTICES )
+	{
+		*verts = (LVERTEX *) lock_stream_data( renderObject->lpVertexBuffer );
+		return true;
+	}
 	if ( old_array_buf )
 	{
 		DebugPrintf( "Tried to lock more than one vertex buffer at once\n" );
@@ -67,7 +130,10 @@ bool FSLockVertexBuffer(RENDEROBJECT *renderObject, LVERTEX **verts)
 
 bool FSUnlockVertexBuffer(RENDEROBJECT *renderObject)
 {
-	bool ret = ( glUnmapBuffer( GL_ARRAY_BUFFER ) == GL_TRUE );
+	bool ret;
+	if ( renderObject->streamed & STREAMED_VERTICES )
+		return true;
+	ret = ( glUnmapBuffer( GL_ARRAY_BUFFER ) == GL_TRUE );
 	glBindBuffer( GL_ARRAY_BUFFER, old_array_buf );
 	old_array_buf = 0;
 	CHECK_GL_ERRORS;
@@ -104,6 +170,11 @@ bool FSUnlockNormalBuffer(RENDEROBJECT *renderObject)
 
 bool FSLockIndexBuffer(RENDEROBJECT *renderObject, WORD **indices)
 {
+	if ( renderObject->streamed & STREAMED_INDICES )
+	{
+		*indices = (WORD *) lock_stream_data( renderObject->lpIndexBuffer );
+		return true;
+	}
 	if ( old_index_buf )
 	{
 		DebugPrintf( "Tried to lock more than one index buffer at once\n" );
@@ -123,7 +194,10 @@ bool FSLockIndexBuffer(RENDEROBJECT *renderObject, WORD **indices)
 
 bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject)
 {
-	bool ret = ( glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER ) == GL_TRUE );
+	bool ret;
+	if ( renderObject->streamed & STREAMED_INDICES )
+		return true;
+	ret = ( glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER ) == GL_TRUE );
 	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, old_index_buf );
 	old_index_buf = 0;
 	CHECK_GL_ERRORS;
@@ -132,8 +206,10 @@ bool FSUnlockIndexBuffer(RENDEROBJECT *renderObject)
 
 bool FSCreateDynamic2dVertexBuffer(RENDEROBJECT *renderObject, int numVertices)
 {
-	renderObject->lpVertexBuffer = create_buffer( numVertices * sizeof(TLVERTEX), GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW );
-	return true;
+	renderObject->lpVertexBuffer = create_stream_data( numVertices * sizeof(TLVERTEX) );
+	renderObject->streamed |= STREAMED_VERTICES;
+	create_vertex_array( renderObject, stream_buffer( STREAM_VERTICES ), true );
+	return renderObject->lpVertexBuffer != NULL;
 }
 
 bool FSLockPretransformedVertexBuffer(RENDEROBJECT *renderObject, TLVERTEX **verts)
@@ -141,142 +217,466 @@ bool FSLockPretransformedVertexBuffer(RENDEROBJECT *renderObject, TLVERTEX **ver
 	return FSLockVertexBuffer( renderObject, (LVERTEX **) verts );
 }
 
-/* Draw render object:
- * - if 2D (orthographic), set up appropriately:
- *   - orthographic projection matrix
- *   - ... plus scaling and translation for Y-flipping (T*S*P)
- *   else:
- *   - update mvp if necessary (mvp_needs_update)
- * - for each texture group (renderObject->numTextureGroups)
- *   - group = &renderObject->textureGroups[i]
- *   - if group->colourkey, enable color-keying
- *   - if group->texture, enable texturing and bind
- *     renderObject->textureGroups[group].texture
- *   - draw group->numVerts elements starting at group->startVert
- */
+// Array textures
+//
+// FSCreateTextureArrays copies textures of the same size into the
+// layers of array textures, the 2d textures stay for everything that
+// draws from them directly.  FSMergeTextureGroups turns a render
+// object whose texture groups are all in one array into one group,
+// the layer of each vertex ( and bit 7 for a color-keyed texture )
+// going into a byte per vertex the shader picks the layer with.
 
-bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool orthographic )
+#define MAX_ARRAY_LAYERS 128
+
+typedef struct
+{
+	texture_t * texture;	// NULL until filled, arrays of one aren't
+	GLint width, height;
+	int layers;
+	LPTEXTURE members[ MAX_ARRAY_LAYERS ];
+} texture_array_t;
+
+static texture_array_t * texture_arrays = NULL;
+static int num_texture_arrays = 0;
+
+void FSReleaseTextureArrays( void )
 {
-	static const struct
-	{
-		const char *name;
-		int components;
-		GLenum type;
-		GLboolean normalized;
-		int offset;
-	} normal_attr[] =
-	{
-		{ "pos",    3, GL_FLOAT,         GL_FALSE, 0  },
-		{ "vcolor", 4, GL_UNSIGNED_BYTE, GL_TRUE,  12 }, // 3*float
-		{ "vtexc",  2, GL_FLOAT,         GL_FALSE, 16 }, // 3*float + 1*COLOR
-		{ NULL,     0, 0,                0,        0  }
-	}, ortho_attr[] =
-	{
-		{ "tlpos",  4, GL_FLOAT,         GL_FALSE, 0 },
-		{ "vcolor", 4, GL_UNSIGNED_BYTE, GL_TRUE,  16 }, // 4*float
-		{ "vtexc",  2, GL_FLOAT,         GL_FALSE, 20 }, // 4*float + 1*COLOR
-		{ NULL,     0, 0,                0,        0  }
-	}, *attr;
-	//GLuint current_program;
-	GLuint u_ortho;
-	GLuint u_colorkey;
-	GLuint u_enabletex;
-	TEXTUREGROUP *group;
-	texture_t *texdata;
-	int loc;
 	int i;
+	for ( i = 0; i < num_texture_arrays; i++ )
+		release_texture( texture_arrays[i].texture );
+	free( texture_arrays );
+	texture_arrays = NULL;
+	num_texture_arrays = 0;
+}
 
-	glBindBuffer( GL_ARRAY_BUFFER, renderObject->lpVertexBuffer );
+static bool fill_texture_array( texture_array_t * array )
+{
+	texture_t * texdata;
+	GLubyte * pixels;
+	int i;
 
-	if ( renderObject->lpIndexBuffer )
-		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, renderObject->lpIndexBuffer );
-	else
-		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+	pixels = malloc( array->width * array->height * 4 );
+	texdata = malloc( sizeof(texture_t) );
+	if ( !pixels || !texdata )
+	{
+		free( pixels );
+		free( texdata );
+		return false;
+	}
+
+	glGenTextures( 1, &texdata->id );
+	texdata->layers = array->layers;
+	texdata->w = array->width;
+	texdata->h = array->height;
+	bind_texture_array( texdata->id );
+
+	glActiveTexture( GL_TEXTURE1 );
+	glTexImage3D( GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, array->width, array->height, array->layers,
+		0, GL_RGBA, GL_UNSIGNED_BYTE, NULL );
+	glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
 
-	//glGetIntegerv( GL_CURRENT_PROGRAM, &current_program );
-	// assert( current_program != 0 );
+	// the images only live on the card by now, so read them back
+	for ( i = 0; i < array->layers; i++ )
+	{
+		glActiveTexture( GL_TEXTURE0 );
+		bind_texture( ((texture_t *) array->members[i])->id );
+		glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+		glActiveTexture( GL_TEXTURE1 );
+		glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, array->width, array->height, 1,
+			GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+	}
 
+	// same sampling as create_texture
+	glTexParameterf( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST );
+	glTexParameterf( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexParameterf( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT );
+	glTexParameterf( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT );
+	if ( caps.anisotropic )
+		glTexParameterf( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_ANISOTROPY_EXT, caps.anisotropic );
+	glGenerateMipmap( GL_TEXTURE_2D_ARRAY );
+
+	glActiveTexture( GL_TEXTURE0 );
+	free( pixels );
 	CHECK_GL_ERRORS;
 
-	// Tell OpenGL about the buffer data layout
-	// see the LVERTEX and TLVERTEX definitions inside include/new3d.h
-	attr = orthographic ? ortho_attr : normal_attr;
-	for ( i=0; attr[i].name; i++ )
+	array->texture = texdata;
+	return true;
+}
+
+bool FSCreateTextureArrays( LPTEXTURE *textures, int count )
+{
+	texture_array_t * array;
+	texture_t * texdata;
+	GLint width, height;
+	int i, a, filled = 0, layers = 0;
+
+	FSReleaseTextureArrays();
+
+	// the layers are copied from the textures so they have to be in,
+	// the decoding still ran on the workers in parallel
+	finish_textures();
+
+	if ( count <= 0 )
+		return true;
+
+	texture_arrays = calloc( count, sizeof(texture_array_t) );
+	if ( !texture_arrays )
+		return false;
+
+	for ( i = 0; i < count; i++ )
 	{
-		loc = glGetAttribLocation( current_program, attr[i].name );
-		if (loc >= 0)
+		texdata = (texture_t *) textures[i];
+		if ( !texdata || texdata->layers )
+			continue;
+
+		bind_texture( texdata->id );
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width );
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height );
+
+		for ( a = 0; a < num_texture_arrays; a++ )
 		{
-			glVertexAttribPointer(
-				loc,
-				attr[i].components,
-				attr[i].type,
-				attr[i].normalized,
-				orthographic ? sizeof(TLVERTEX) : sizeof(LVERTEX),
-				attr[i].offset
-			);
-			glEnableVertexAttribArray( loc );
+			array = &texture_arrays[a];
+			if ( array->width == width && array->height == height && array->layers < MAX_ARRAY_LAYERS )
+				break;
 		}
+		if ( a == num_texture_arrays )
+		{
+			array = &texture_arrays[ num_texture_arrays++ ];
+			array->width = width;
+			array->height = height;
+		}
+		array->members[ array->layers++ ] = textures[i];
 	}
 
-	CHECK_GL_ERRORS;
+	for ( a = 0; a < num_texture_arrays; a++ )
+	{
+		array = &texture_arrays[a];
+		if ( array->layers < 2 )
+			continue;
+		if ( !fill_texture_array( array ) )
+		{
+			DebugPrintf( "FSCreateTextureArrays: couldn't fill a %dx%d array\n", array->width, array->height );
+			continue;
+		}
+		filled++;
+		layers += array->layers;
+	}
+
+	DebugPrintf( "FSCreateTextureArrays: %d of %d textures in %d arrays\n", layers, count, filled );
+
+	return true;
+}
 
-	// tell it about the normal buffer
-	if ( renderObject->lpNormalBuffer )
+static bool find_array_layer( LPTEXTURE texture, texture_array_t ** array, int * layer )
+{
+	int a, l;
+	for ( a = 0; a < num_texture_arrays; a++ )
 	{
-		glBindBuffer( GL_ARRAY_BUFFER, renderObject->lpNormalBuffer );
-		loc = glGetAttribLocation( current_program, "vnormal" );
-		if (loc >= 0)
+		if ( !texture_arrays[a].texture )
+			continue;
+		for ( l = 0; l < texture_arrays[a].layers; l++ )
 		{
-			glVertexAttribPointer( loc, 3, GL_FLOAT, GL_FALSE, sizeof(NORMAL), 0 );
-			glEnableVertexAttribArray( loc );
+			if ( texture_arrays[a].members[l] == texture )
+			{
+				*array = &texture_arrays[a];
+				*layer = l;
+				return true;
+			}
 		}
 	}
+	return false;
+}
 
+// A member's 2d texture was rewritten ( a placeholder reload, a new
+// file or gamma ) so copy it into its layer again.  A texture that
+// changed size can't go back in and keeps its old layer.
+
+void refresh_texture_array_layer( texture_t * texdata )
+{
+	texture_array_t * array;
+	GLubyte * pixels;
+	int layer;
+
+	if ( !num_texture_arrays || texdata->layers ||
+		 !find_array_layer( (LPTEXTURE) texdata, &array, &layer ) )
+		return;
+
+	if ( texdata->w != array->width || texdata->h != array->height )
+	{
+		DebugPrintf( "refresh_texture_array_layer: a %dx%d texture no longer fits its %dx%d array\n",
+			texdata->w, texdata->h, array->width, array->height );
+		return;
+	}
+
+	pixels = malloc( array->width * array->height * 4 );
+	if ( !pixels )
+		return;
+
+	glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	glActiveTexture( GL_TEXTURE0 );
+	bind_texture( texdata->id );
+	glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+
+	bind_texture_array( array->texture->id );
+	glActiveTexture( GL_TEXTURE1 );
+	glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, array->width, array->height, 1,
+		GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+	glGenerateMipmap( GL_TEXTURE_2D_ARRAY );
+	glActiveTexture( GL_TEXTURE0 );
+
+	free( pixels );
 	CHECK_GL_ERRORS;
+}
 
-	// Update and use the appropriate model/view/projection matrix
-	if ( orthographic )
-		ortho_update( current_program );
-	else
-		mvp_update( current_program );
+// Only works if every group is in the same array, the groups follow
+// each other in the index buffer and no vertex is used by two groups
+// with different textures.  The layer buffer is attached to the array
+// object and deleted straight away, the array object keeps it alive
+// until it goes itself.  Streamed vertices are left alone as their
+// base vertex would move the layers too.
 
-	// This uniform tells the vertex shader which matrix to use
-	if ((u_ortho = glGetUniformLocation(current_program, "orthographic")) >= 0)
-		glUniform1i( u_ortho, orthographic ? GL_TRUE : GL_FALSE );
+bool FSMergeTextureGroups( RENDEROBJECT *renderObject )
+{
+	texture_array_t * array = NULL;
+	texture_array_t * group_array;
+	TEXTUREGROUP * first = &renderObject->textureGroups[0];
+	TEXTUREGROUP * group;
+	WORD * indices;
+	int * vertex_layers;
+	GLubyte * bytes;
+	GLuint buffer;
+	GLint old_buf;
+	int num_indices = 0;
+	int num_verts = 0;
+	int i, j, v, layer;
+	bool ok = true;
+
+	if ( renderObject->numTextureGroups < 2 || !renderObject->lpIndexBuffer ||
+		 ( renderObject->streamed & STREAMED_VERTICES ) )
+		return false;
 
 	for ( i = 0; i < renderObject->numTextureGroups; i++ )
 	{
 		group = &renderObject->textureGroups[i];
-		if ( (u_colorkey = glGetUniformLocation(current_program, "colorkeying_enabled")) >= 0 )
-			glUniform1i( u_colorkey, group->colourkey ? GL_TRUE : GL_FALSE );
-		if ( (u_enabletex = glGetUniformLocation(current_program, "texturing_enabled")) >= 0 )
+		if ( !find_array_layer( group->texture, &group_array, &layer ) )
+			return false;
+		if ( i == 0 )
+			array = group_array;
+		else if ( group_array != array ||
+				  group->startVert != first->startVert ||
+				  group->startIndex != first->startIndex + num_indices )
+			return false;
+		num_indices += group->numTriangles * 3;
+	}
+
+	indices = malloc( num_indices * sizeof(WORD) );
+	if ( !indices )
+		return false;
+	if ( renderObject->streamed & STREAMED_INDICES )
+	{
+		memcpy( indices, (WORD *) lock_stream_data( renderObject->lpIndexBuffer ) + first->startIndex,
+			num_indices * sizeof(WORD) );
+	}
+	else
+	{
+		glGetIntegerv( GL_COPY_READ_BUFFER_BINDING, &old_buf );
+		glBindBuffer( GL_COPY_READ_BUFFER, (GLuint) renderObject->lpIndexBuffer );
+		glGetBufferSubData( GL_COPY_READ_BUFFER, first->startIndex * sizeof(WORD),
+			num_indices * sizeof(WORD), indices );
+		glBindBuffer( GL_COPY_READ_BUFFER, old_buf );
+	}
+
+	for ( i = 0; i < num_indices; i++ )
+		if ( first->startVert + indices[i] >= num_verts )
+			num_verts = first->startVert + indices[i] + 1;
+
+	vertex_layers = malloc( num_verts * sizeof(int) );
+	bytes = malloc( num_verts );
+	if ( !vertex_layers || !bytes )
+		ok = false;
+	else
+	{
+		for ( v = 0; v < num_verts; v++ )
+			vertex_layers[v] = -1;
+
+		for ( i = 0, j = 0; i < renderObject->numTextureGroups && ok; i++ )
 		{
-			glUniform1i( u_enabletex, group->texture ? GL_TRUE : GL_FALSE );
-			if ( group->texture )
+			int value;
+			group = &renderObject->textureGroups[i];
+			find_array_layer( group->texture, &group_array, &layer );
+			value = layer | ( group->colourkey ? 128 : 0 );
+			for ( num_indices = j + group->numTriangles * 3; j < num_indices; j++ )
 			{
-				texdata = (texture_t *) group->texture;
-				glBindTexture( GL_TEXTURE_2D, texdata->id );
+				v = first->startVert + indices[j];
+				if ( vertex_layers[v] >= 0 && vertex_layers[v] != value )
+				{
+					ok = false;
+					break;
+				}
+				vertex_layers[v] = value;
 			}
 		}
-		glDrawElementsBaseVertex( primitive_type, group->numTriangles * 3, GL_UNSIGNED_SHORT, group->startIndex * sizeof(WORD), group->startVert );
 	}
 
+	if ( ok )
+	{
+		for ( v = 0; v < num_verts; v++ )
+			bytes[v] = (GLubyte)( vertex_layers[v] < 0 ? 0 : vertex_layers[v] );
+
+		glGenBuffers( 1, &buffer );
+		glBindVertexArray( (GLuint) renderObject->lpVertexArray );
+		glGetIntegerv( GL_ARRAY_BUFFER_BINDING, &old_buf );
+		glBindBuffer( GL_ARRAY_BUFFER, buffer );
+		glBufferData( GL_ARRAY_BUFFER, num_verts, bytes, GL_STATIC_DRAW );
+		glVertexAttribIPointer( ATTR_VLAYER, 1, GL_UNSIGNED_BYTE, 0, (void*) 0 );
+		glEnableVertexAttribArray( ATTR_VLAYER );
+		glBindVertexArray( 0 );
+		glBindBuffer( GL_ARRAY_BUFFER, old_buf );
+		glDeleteBuffers( 1, &buffer );
+		CHECK_GL_ERRORS;
+
+		first->numTriangles = j / 3;
+		first->numVerts = num_verts - first->startVert;
+		first->colourkey = false;	// per vertex now
+		first->texture = (LPTEXTURE) array->texture;
+		renderObject->numTextureGroups = 1;
+	}
+
+	free( indices );
+	free( vertex_layers );
+	free( bytes );
+
+	return ok;
+}
+
+// texture and color keying of a group, array textures sit on unit 1
+
+static void set_group_texture( TEXTUREGROUP *group )
+{
+	texture_t *texdata = (texture_t *) group->texture;
+	set_uniform_bool( &uniforms.colorkeying_enabled, group->colourkey );
+	set_uniform_bool( &uniforms.texturing_enabled, texdata != NULL );
+	if ( !texdata )
+		return;
+	set_uniform_bool( &uniforms.texture_array_enabled, texdata->layers > 0 );
+	if ( texdata->layers )
+		bind_texture_array( texdata->id );
+	else
+		bind_texture( texdata->id );
+}
+
+/* Draw render object:
+ * - if 2D (orthographic), set up appropriately:
+ *   - orthographic projection matrix
+ *   - ... plus scaling and translation for Y-flipping (T*S*P)
+ *   else:
+ *   - update mvp if necessary (mvp_needs_update)
+ * - bind the vertex array object built when the buffers were created
+ * - for each texture group (renderObject->numTextureGroups)
+ *   - group = &renderObject->textureGroups[i]
+ *   - if group->colourkey, enable color-keying
+ *   - if group->texture, enable texturing and bind
+ *     renderObject->textureGroups[group].texture ( or the array
+ *     texture of a merged object, see FSMergeTextureGroups )
+ *   - draw group->numVerts elements starting at group->startVert
+ * - uniforms are only sent when their value changes
+ */
+
+bool draw_render_object_groups( RENDEROBJECT *renderObject, int first_group, int num_groups, int primitive_type, bool orthographic )
+{
+	TEXTUREGROUP *group;
+	stream_offsets_t offsets;
+	int i;
+
+	// dynamic data goes into the stream before the array object is bound
+	if ( !stream_render_object( renderObject, orthographic, &offsets ) )
+		return false;
+
+	glBindVertexArray( (GLuint) renderObject->lpVertexArray );
+
 	CHECK_GL_ERRORS;
 
-	for ( i=0; attr[i].name; i++ )
+	// Update and use the appropriate model/view/projection matrix
+	if ( orthographic )
+		ortho_update( current_program );
+	else
+		mvp_update( current_program );
+
+	// These uniforms tell the vertex shader which matrix to use
+	set_uniform_bool( &uniforms.orthographic, orthographic );
+	set_uniform_bool( &uniforms.instanced, false );
+
+	// and this one which of the lights reach the object
+	lights_update( orthographic ? 0 : renderObject->lights );
+
+	for ( i = first_group; i < first_group + num_groups; i++ )
 	{
-		loc = glGetAttribLocation( current_program, attr[i].name );
-		if (loc >= 0)
-			glDisableVertexAttribArray( loc );
+		group = &renderObject->textureGroups[i];
+		set_group_texture( group );
+		glDrawElementsBaseVertex( primitive_type, group->numTriangles * 3, GL_UNSIGNED_SHORT, (void*)( offsets.index_offset + group->startIndex * sizeof(WORD) ), offsets.base_vertex + group->startVert );
+		render_stats.draw_calls++;
 	}
 
-	if ( renderObject->lpNormalBuffer )
+	glBindVertexArray( 0 );
+
+	CHECK_GL_ERRORS;
+
+	return true;
+}
+
+/* Draw a render object once for each of the world matrices:
+ * - the matrices go to the "instance_world" uniform array
+ *   MAX_INSTANCES at a time and the vertex shader picks its own
+ *   with gl_InstanceID, so each texture group is one draw call
+ *   per MAX_INSTANCES instances
+ * - view * projection is premultiplied into "view_proj"
+ * - the lights reaching the render object light every instance,
+ *   the shader moves them with the instance's own world matrix
+ */
+
+bool draw_object_instances( RENDEROBJECT *renderObject, RENDERMATRIX *worlds, int count )
+{
+	TEXTUREGROUP *group;
+	stream_offsets_t offsets;
+	MATRIX view_proj;
+	int first, num, i;
+
+	if ( uniforms.instance_world < 0 || uniforms.view_proj < 0 )
+		return draw_object_instances_each( renderObject, worlds, count );
+
+	if ( !stream_render_object( renderObject, false, &offsets ) )
+		return false;
+
+	glBindVertexArray( (GLuint) renderObject->lpVertexArray );
+
+	MatrixMultiply( &view_matrix, &proj_matrix, &view_proj );
+	glUniformMatrix4fv( uniforms.view_proj, 1, GL_FALSE, (GLfloat *) &view_proj );
+
+	set_uniform_bool( &uniforms.orthographic, false );
+	set_uniform_bool( &uniforms.instanced, true );
+	lights_update( renderObject->lights );
+
+	for ( first = 0; first < count; first += num )
 	{
-		loc = glGetAttribLocation( current_program, "vnormal" );
-		if (loc >= 0)
-			glDisableVertexAttribArray( loc );
+		num = count - first;
+		if ( num > MAX_INSTANCES )
+			num = MAX_INSTANCES;
+
+		glUniformMatrix4fv( uniforms.instance_world, num, GL_FALSE, (GLfloat *) &worlds[ first ].m );
+
+		for ( i = 0; i < renderObject->numTextureGroups; i++ )
+		{
+			group = &renderObject->textureGroups[i];
+			set_group_texture( group );
+			glDrawElementsInstancedBaseVertex( GL_TRIANGLES, group->numTriangles * 3, GL_UNSIGNED_SHORT, (void*)( offsets.index_offset + group->startIndex * sizeof(WORD) ), num, offsets.base_vertex + group->startVert );
+			render_stats.draw_calls++;
+		}
 	}
 
+	glBindVertexArray( 0 );
+
 	CHECK_GL_ERRORS;
 
 	return true;
@@ -1,5 +1,8 @@
 #ifdef GL
 #include "render_gl_shared.h"
+#include "texture_loader.h"
+#include "texture_cache.h"
+#include "lights.h"
 
 // windows needs explicit retrieval of newer GL functions...
 /*
@@ -86,6 +89,9 @@ void build_gamma_table( double gamma )
 		gamma = 1.0;
 #endif
 
+	// cached textures are stored gamma corrected
+	texture_cache_set_gamma( gamma );
+
 	k = 255.0/pow(255.0, 1.0/gamma);
 	
 	for (i = 0; i <= 255; i++)
@@ -96,85 +102,281 @@ void build_gamma_table( double gamma )
 	}
 }
 
-void release_texture( LPTEXTURE texture )
+render_stats_t render_stats;
+render_stats_t render_last_stats;
+
+// Shadow copies of the state the helpers below keep setting around
+// every pass.  A call that would not change anything is counted and
+// dropped, everything starts out unknown so the first call of each
+// always goes through.
+
+enum
 {
-	if(!texture) return;
-	texture_t *texdata = (texture_t *) texture;
-	glDeleteTextures( 1, &texdata->id );
-	CHECK_GL_ERRORS;
-	free(texture);
+	CAP_BLEND,
+	CAP_DEPTH_TEST,
+	CAP_CULL_FACE,
+	CAP_SCISSOR_TEST,
+#if GL == 1
+	CAP_ALPHA_TEST,
+	CAP_TEXTURE_2D,
+#endif
+	CAP_COUNT
+};
+
+#define STATE_UNKNOWN ((GLenum) -1)
+
+static struct
+{
+	int enabled[ CAP_COUNT ];	// -1 when unknown
+	int depth_mask;				// -1 when unknown
+	GLenum blend_src, blend_dst;
+	GLenum depth_func;
+	GLenum cull_face;
+	GLenum front_face;
+#if GL == 1
+	GLenum alpha_func;
+	GLfloat alpha_ref;
+#endif
+} state;
+
+// the texture bound to GL_TEXTURE_2D ( and GL_TEXTURE_2D_ARRAY on unit 1 )
+
+static GLuint bound_texture = 0;
+#if GL >= 3
+static GLuint bound_texture_array = 0;
+#endif
+
+static bool state_changed( bool changed )
+{
+	if ( changed )
+		render_stats.state_changes++;
+	else
+		render_stats.state_filtered++;
+	return changed;
 }
 
-static bool create_texture(LPTEXTURE *t, const char *path, u_int16_t *width, u_int16_t *height, int numMips, bool * colorkey)
+void reset_state_cache( void )
 {
-	texture_t *texdata;
-	texture_image_t image;
+	int i;
+	for ( i = 0; i < CAP_COUNT; i++ )
+		state.enabled[i] = -1;
+	state.depth_mask = -1;
+	state.blend_src = state.blend_dst = STATE_UNKNOWN;
+	state.depth_func = STATE_UNKNOWN;
+	state.cull_face = STATE_UNKNOWN;
+	state.front_face = STATE_UNKNOWN;
+#if GL == 1
+	state.alpha_func = STATE_UNKNOWN;
+#endif
+	bound_texture = 0;
+#if GL >= 3
+	bound_texture_array = 0;
+#endif
+}
 
-	Change_Ext( path, image.path, ".PNG" );
-	if( ! File_Exists( (char*) image.path ) )
+static int cap_index( GLenum cap )
+{
+	switch ( cap )
 	{
-		DebugPrintf("Could not find texture file: %s\n",path);
-		return true;
+	case GL_BLEND:			return CAP_BLEND;
+	case GL_DEPTH_TEST:		return CAP_DEPTH_TEST;
+	case GL_CULL_FACE:		return CAP_CULL_FACE;
+	case GL_SCISSOR_TEST:	return CAP_SCISSOR_TEST;
+#if GL == 1
+	case GL_ALPHA_TEST:		return CAP_ALPHA_TEST;
+	case GL_TEXTURE_2D:		return CAP_TEXTURE_2D;
+#endif
 	}
+	return -1;
+}
 
-	if(load_image( &image, numMips )!=0)
+// caps that aren't tracked are always sent
+
+void state_enable( GLenum cap, bool on )
+{
+	int i = cap_index( cap );
+	if ( i >= 0 )
 	{
-		DebugPrintf("couldn't load image\n");
-		return false;
+		if ( !state_changed( state.enabled[i] != (int) on ) )
+			return;
+		state.enabled[i] = (int) on;
 	}
+	if ( on )
+		glEnable( cap );
+	else
+		glDisable( cap );
+}
 
-	// return values
-	*width  = (u_int16_t) image.w;
-	*height = (u_int16_t) image.h;
-	(*colorkey) = (bool) image.colorkey;
+void state_blend_func( GLenum src, GLenum dst )
+{
+	if ( !state_changed( state.blend_src != src || state.blend_dst != dst ) )
+		return;
+	glBlendFunc( src, dst );
+	state.blend_src = src;
+	state.blend_dst = dst;
+}
+
+void state_depth_func( GLenum func )
+{
+	if ( !state_changed( state.depth_func != func ) )
+		return;
+	glDepthFunc( func );
+	state.depth_func = func;
+}
+
+void state_depth_mask( bool write )
+{
+	if ( !state_changed( state.depth_mask != (int) write ) )
+		return;
+	glDepthMask( write ? GL_TRUE : GL_FALSE );
+	state.depth_mask = (int) write;
+}
+
+void state_cull_face( GLenum mode )
+{
+	if ( !state_changed( state.cull_face != mode ) )
+		return;
+	glCullFace( mode );
+	state.cull_face = mode;
+}
+
+void state_front_face( GLenum mode )
+{
+	if ( !state_changed( state.front_face != mode ) )
+		return;
+	glFrontFace( mode );
+	state.front_face = mode;
+}
+
+#if GL == 1
+void state_alpha_func( GLenum func, GLfloat ref )
+{
+	if ( !state_changed( state.alpha_func != func || state.alpha_ref != ref ) )
+		return;
+	glAlphaFunc( func, ref );
+	state.alpha_func = func;
+	state.alpha_ref = ref;
+}
+#endif
+
+void bind_texture( GLuint id )
+{
+	if ( !state_changed( id != bound_texture ) )
+		return;
+	glBindTexture( GL_TEXTURE_2D, id );
+	bound_texture = id;
+	render_stats.texture_binds++;
+}
 
-	// employ colour key and gamma correction
+#if GL >= 3
+void bind_texture_array( GLuint id )
+{
+	if ( !state_changed( id != bound_texture_array ) )
+		return;
+	glActiveTexture( GL_TEXTURE1 );
+	glBindTexture( GL_TEXTURE_2D_ARRAY, id );
+	glActiveTexture( GL_TEXTURE0 );
+	bound_texture_array = id;
+	render_stats.texture_binds++;
+}
+#endif
+
+void release_texture( LPTEXTURE texture )
+{
+	if(!texture) return;
+	texture_t *texdata = (texture_t *) texture;
+	// a load still on its way must not land in whatever reuses this
+	texture_loader_cancel( texture );
+	if( texdata->id == bound_texture )
+		bound_texture = 0;
+#if GL >= 3
+	if( texdata->layers && texdata->id == bound_texture_array )
+		bound_texture_array = 0;
+#endif
+	glDeleteTextures( 1, &texdata->id );
+	CHECK_GL_ERRORS;
+	free(texture);
+}
+
+// employ colour key and gamma correction
+// the texture workers run this too, each with its own copy of the table
+
+static void prepare_image( texture_image_t * image, const u_int8_t * gamma )
+{
+	int y, x;
+	int size = 4;
+	int pitch = size*image->w;
+	for (y = 0; y < image->h; y++)
 	{
-		int y, x;
-		int size = 4;
-		int pitch = size*image.w;
-		for (y = 0; y < image.h; y++)
+		for (x = 0; x < image->w; x++)
 		{
-			for (x = 0; x < image.w; x++)
-			{
-				// move to the correct offset in the data
-				// y is the row and pitch is the size of a row
-				// (x*size) is the length of each pixel data (column)
-				DWORD index = (y*pitch)+(x*size);
+			// move to the correct offset in the data
+			// y is the row and pitch is the size of a row
+			// (x*size) is the length of each pixel data (column)
+			DWORD index = (y*pitch)+(x*size);
 
-				// image.data is packed in rgba
-				image.data[index]   = (char) gamma_table[ (u_int8_t) image.data[index]];	   // red
-				image.data[index+1] = (char) gamma_table[ (u_int8_t) image.data[index+1]];  // green
-				image.data[index+2] = (char) gamma_table[ (u_int8_t) image.data[index+2]];  // blue
-				image.data[index+3] = (char) gamma_table[ (u_int8_t) image.data[index+3]];  // alpha
+			// image->data is packed in rgba
+			image->data[index]   = (char) gamma[ (u_int8_t) image->data[index]];	   // red
+			image->data[index+1] = (char) gamma[ (u_int8_t) image->data[index+1]];  // green
+			image->data[index+2] = (char) gamma[ (u_int8_t) image->data[index+2]];  // blue
+			image->data[index+3] = (char) gamma[ (u_int8_t) image->data[index+3]];  // alpha
 
-				// colour key
-				if( image.colorkey && (image.data[index] + image.data[index+1] + image.data[index+2]) == 0 )
-					image.data[index+3] = 0; // alpha - pixel will not be rendered do to alpha value tests
+			// colour key
+			if( image->colorkey && (image->data[index] + image->data[index+1] + image->data[index+2]) == 0 )
+				image->data[index+3] = 0; // alpha - pixel will not be rendered do to alpha value tests
 
-			}
 		}
 	}
+}
+
+static texture_t * new_texture( void )
+{
+	texture_t *texdata = malloc(sizeof(texture_t));
+	if( !texdata )
+		return NULL;
+	texdata->layers = 0;
+	texdata->w = 0;
+	texdata->h = 0;
+	glGenTextures(1, &texdata->id);
+	return texdata;
+}
+
+// mips are the levels below the image when a worker built them or
+// they came out of the texture cache.  internal is GL_RGBA or the
+// compressed format to keep the texture in, compressed says the
+// levels already are in it.
+
+static bool upload_image( texture_t *texdata, texture_image_t *image, texture_mip_t *mips, int num_mips, GLenum internal, bool compressed )
+{
+	int i;
 
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-	// create a new opengl texture
-	if( ! *t )
+	bind_texture(texdata->id);
+
+	if( compressed )
 	{
-		texdata = malloc(sizeof(texture_t));
-		glGenTextures(1, &texdata->id);
-		glBindTexture(GL_TEXTURE_2D, texdata->id);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.w, image.h, 0, GL_RGBA, GL_UNSIGNED_BYTE, image.data);
-		CHECK_GL_ERRORS;
+#if GL > 1
+		glCompressedTexImage2D(GL_TEXTURE_2D, 0, internal, image->w, image->h, 0, image->size, image->data);
+		for( i = 0; i < num_mips; i++ )
+			glCompressedTexImage2D(GL_TEXTURE_2D, i + 1, internal, mips[i].w, mips[i].h, 0, mips[i].size, mips[i].data);
+#endif
+		texdata->w = image->w;
+		texdata->h = image->h;
 	}
 	// updates an existing texture
+	else if( internal == GL_RGBA && texdata->w == image->w && texdata->h == image->h )
+	{
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, image->w, image->h, GL_RGBA, GL_UNSIGNED_BYTE, image->data);
+	}
+	// a new texture or one that was a placeholder
 	else
 	{
-		texdata = (texture_t *) *t;
-		glBindTexture(GL_TEXTURE_2D, texdata->id);
-		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, image.w, image.h, GL_RGBA, GL_UNSIGNED_BYTE, image.data);
-		CHECK_GL_ERRORS;
+		glTexImage2D(GL_TEXTURE_2D, 0, internal, image->w, image->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, image->data);
+		texdata->w = image->w;
+		texdata->h = image->h;
 	}
+	CHECK_GL_ERRORS;
 
 	// when texture area is small, bilinear filter the closest mipmap
 	glTexParameterf( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST );
@@ -188,11 +390,19 @@ static bool create_texture(LPTEXTURE *t, const char *path, u_int16_t *width, u_i
 	if(caps.anisotropic)
 		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, caps.anisotropic);
 
+	if( compressed )
+		;
+	else if( num_mips )
+	{
+		for( i = 0; i < num_mips; i++ )
+			glTexImage2D(GL_TEXTURE_2D, i + 1, internal, mips[i].w, mips[i].h, 0, GL_RGBA, GL_UNSIGNED_BYTE, mips[i].data);
+	}
 #if GL > 1
-	glGenerateMipmap( GL_TEXTURE_2D );
+	else
+		glGenerateMipmap( GL_TEXTURE_2D );
 #else
 	// generates full range of mipmaps and scales to nearest power of 2
-	if(gluBuild2DMipmaps(GL_TEXTURE_2D, GL_RGBA, image.w, image.h, GL_RGBA, GL_UNSIGNED_BYTE, image.data) != 0)
+	else if(gluBuild2DMipmaps(GL_TEXTURE_2D, GL_RGBA, image->w, image->h, GL_RGBA, GL_UNSIGNED_BYTE, image->data) != 0)
 	{
 		CHECK_GL_ERRORS;
 		return false;
@@ -202,6 +412,64 @@ static bool create_texture(LPTEXTURE *t, const char *path, u_int16_t *width, u_i
 	if ( render_error_description(0) )
 		return false;
 
+#if GL >= 3
+	// the arrays hold copies of the textures packed into them
+	refresh_texture_array_layer( texdata );
+#endif
+
+	return true;
+}
+
+static bool create_texture(LPTEXTURE *t, const char *path, u_int16_t *width, u_int16_t *height, int numMips, bool * colorkey)
+{
+	texture_t *texdata;
+	texture_image_t image;
+
+	Change_Ext( path, image.path, ".PNG" );
+	if( ! File_Exists( (char*) image.path ) )
+	{
+		DebugPrintf("Could not find texture file: %s\n",path);
+		return true;
+	}
+
+	if(load_image( &image, numMips )!=0)
+	{
+		DebugPrintf("couldn't load image\n");
+		return false;
+	}
+
+	// return values
+	*width  = (u_int16_t) image.w;
+	*height = (u_int16_t) image.h;
+	(*colorkey) = (bool) image.colorkey;
+
+	prepare_image( &image, gamma_table );
+
+	// create a new opengl texture
+	if( ! *t )
+	{
+		texdata = new_texture();
+		if( !texdata )
+		{
+			destroy_image( &image );
+			return false;
+		}
+	}
+	// updates an existing texture, whatever it was still loading is stale
+	else
+	{
+		texdata = (texture_t *) *t;
+		texture_loader_cancel( texdata );
+	}
+
+	if( !upload_image( texdata, &image, NULL, 0, GL_RGBA, false ) )
+	{
+		if( ! *t )
+			release_texture( texdata );
+		destroy_image( &image );
+		return false;
+	}
+
 	*t = (LPTEXTURE) texdata;
 
 	DebugPrintf( "Created texture: file=%s, width=%d, height=%d, colorkey=%s\n", 
@@ -223,6 +491,179 @@ bool FSCreateTexture(LPTEXTURE *texture, const char *fileName, u_int16_t *width,
 	return create_texture(texture, fileName, width, height, numMips, colourkey);
 }
 
+//
+// Asynchronous textures
+//
+// The size and colour key come from the file's header straight away,
+// the texture itself starts as one white texel.  A worker reads the
+// texture cache or decodes the file and builds the mips, render_flip
+// uploads what has arrived, a few milliseconds worth a frame.
+//
+// With TextureCompression on ( and s3tc there ) power of two textures
+// are kept compressed on the card.  The first time the driver does
+// the compressing and the result is read back into the cache, after
+// that the compressed levels go straight up.
+//
+
+#define TEXTURE_UPLOAD_MS 4
+
+#if GL > 1
+static void cache_compressed_texture( texture_load_t * load )
+{
+	texture_image_t image;
+	texture_mip_t mips[ TEXTURE_MAX_MIPS ];
+	GLint compressed = 0, format = 0, w, h, size;
+	int level, levels = 0;
+	char * data;
+
+	// the texture is still bound from upload_image
+	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed );
+	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format );
+	if( !compressed || (GLenum) format != load->compress )
+		return;
+
+	for( level = 0; level <= load->num_mips; level++ )
+	{
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &w );
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, level, GL_TEXTURE_HEIGHT, &h );
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size );
+		if( size <= 0 || !( data = malloc( size ) ) )
+			break;
+		glGetCompressedTexImage( GL_TEXTURE_2D, level, data );
+		if( level == 0 )
+		{
+			image = load->image;
+			image.size = size;
+			image.data = data;
+		}
+		else
+		{
+			mips[ level - 1 ].w = w;
+			mips[ level - 1 ].h = h;
+			mips[ level - 1 ].size = size;
+			mips[ level - 1 ].data = data;
+		}
+		levels++;
+	}
+	CHECK_GL_ERRORS;
+
+	if( levels == load->num_mips + 1 )
+		texture_cache_write( load->image.path, load->compress, load->cache_gamma, &image, mips, load->num_mips );
+
+	for( level = 0; level < levels; level++ )
+		free( level ? mips[ level - 1 ].data : image.data );
+}
+#endif
+
+static bool upload_loaded_textures( u_int32_t budget_ms )
+{
+	texture_load_t * load;
+	u_int32_t start = SDL_GetTicks();
+	bool ok = true;
+
+	while( ( load = texture_loader_next() ) )
+	{
+		if( !load->ok )
+		{
+			DebugPrintf( "couldn't load image: %s\n", load->image.path );
+			ok = false;
+		}
+		else if( upload_image( (texture_t *) load->user, &load->image, load->mips, load->num_mips,
+					load->compress ? load->compress : GL_RGBA, load->format != 0 ) )
+		{
+#if GL > 1
+			if( load->compress && !load->cached )
+				cache_compressed_texture( load );
+#endif
+			DebugPrintf( "Created texture: file=%s, width=%d, height=%d, colorkey=%s, cached=%s\n",
+				load->image.path, load->image.w, load->image.h, (load->image.colorkey ? "true" : "false"),
+				(load->cached ? "true" : "false") );
+		}
+		else
+			ok = false;
+
+		texture_loader_free( load );
+
+		if( budget_ms && SDL_GetTicks() - start >= budget_ms )
+			break;
+	}
+
+	return ok;
+}
+
+void finish_textures( void )
+{
+	while( texture_loader_pending() )
+	{
+		upload_loaded_textures( 0 );
+		if( texture_loader_pending() )
+			SDL_Delay( 1 );
+	}
+}
+
+bool FSCreateTextureAsync(LPTEXTURE *texture, const char *fileName, u_int16_t *width, u_int16_t *height, int numMips, bool * colourkey)
+{
+	static char white[4] = { (char) 255, (char) 255, (char) 255, (char) 255 };
+	texture_t *texdata;
+	texture_image_t image;
+	texture_image_t placeholder;
+	GLenum compress = 0;
+
+	// no workers or reloading an existing texture, do it now
+	if( *texture || !texture_loader_init( prepare_image ) )
+		return create_texture(texture, fileName, width, height, numMips, colourkey);
+
+	Change_Ext( fileName, image.path, ".PNG" );
+	if( ! File_Exists( (char*) image.path ) )
+	{
+		DebugPrintf("Could not find texture file: %s\n",fileName);
+		return true;
+	}
+
+	if( load_image_info( &image ) != 0 )
+	{
+		DebugPrintf("couldn't load image\n");
+		return false;
+	}
+
+	// return values
+	*width  = (u_int16_t) image.w;
+	*height = (u_int16_t) image.h;
+	(*colourkey) = (bool) image.colorkey;
+
+	texdata = new_texture();
+	if( !texdata )
+		return false;
+
+	memset( &placeholder, 0, sizeof(placeholder) );
+	placeholder.w = 1;
+	placeholder.h = 1;
+	placeholder.data = white;
+	if( !upload_image( texdata, &placeholder, NULL, 0, GL_RGBA, false ) )
+	{
+		release_texture( texdata );
+		return false;
+	}
+
+#if GL > 1
+	// s3tc works in 4x4 blocks
+	if( render_info.texture_compression && caps.s3tc &&
+		image.w >= 4 && image.h >= 4 &&
+		!( image.w & ( image.w - 1 ) ) && !( image.h & ( image.h - 1 ) ) )
+		compress = image.colorkey ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+#endif
+
+	// the mips are built on the worker so the cache gets the whole chain
+	if( !texture_loader_queue( image.path, true, compress, gamma_table, texdata ) )
+	{
+		release_texture( texdata );
+		return create_texture(texture, fileName, width, height, numMips, colourkey);
+	}
+
+	*texture = (LPTEXTURE) texdata;
+	return true;
+}
+
 static void print_info( void )
 {
 	GLboolean b;
@@ -264,6 +705,16 @@ static void print_info( void )
 //   - "ortho_proj" uniform matrix
 //   - different vertex layout (LVERTEX vs TLVERTEX)
 // - vertex colors are in BGRA format, not RGBA
+// - lights (see FSSetLights), added to the vertex color the same way
+//   lights.c would have relit it on the cpu
+//   - "light_mask" uniform int, bit n set if light n reaches the object
+//   - "light_*" uniform arrays, "world" uniform matrix
+// - instanced draws ( GL 3, see draw_object_instances ):
+//   - "instanced" uniform var
+//   - "view_proj" uniform matrix, "instance_world" uniform matrix array
+//     indexed by gl_InstanceID
+// - array textures ( GL 3, see FSMergeTextureGroups ):
+//   - "vlayer" int attribute passed on flat as "layer"
 
 #if   GL == 2
 	#define GLSL_VERSION   "120"
@@ -279,6 +730,9 @@ static void print_info( void )
 	#define GLSL_VERT_OUT  "out"
 #endif
 
+#define GLSL_STRING( x ) #x
+#define GLSL_INT( x ) GLSL_STRING( x )
+
 static const char *default_vertex_shader =
 	"#version " GLSL_VERSION "\n"
 	"\n"
@@ -286,6 +740,21 @@ static const char *default_vertex_shader =
 	"\n"
 	"uniform mat4 mvp;\n"
 	"uniform mat4 ortho_proj;\n"
+	"uniform mat4 world;\n"
+	"\n"
+#if GL >= 3
+	"#define MAX_INSTANCES " GLSL_INT( MAX_INSTANCES ) "\n"
+	"uniform bool instanced;\n"
+	"uniform mat4 view_proj;\n"
+	"uniform mat4 instance_world[MAX_INSTANCES];\n"
+	"\n"
+#endif
+	"#define MAX_LIGHTS " GLSL_INT( MAX_RENDER_LIGHTS ) "\n"
+	"uniform int light_mask;\n"
+	"uniform vec4 light_pos[MAX_LIGHTS];   // xyz, w = size\n"
+	"uniform vec4 light_color[MAX_LIGHTS]; // rgb, w = 1 for spot lights\n"
+	"uniform vec4 light_dir[MAX_LIGHTS];   // xyz, w = cos of the spot arc\n"
+	"uniform float light_min_size;\n"
 	"\n"
 	GLSL_VERT_IN " vec3 pos;\n"
 	GLSL_VERT_IN " vec4 tlpos;\n"
@@ -294,6 +763,62 @@ static const char *default_vertex_shader =
 	"\n"
 	GLSL_VERT_OUT " vec4 color;\n"
 	GLSL_VERT_OUT " vec2 texc;\n"
+#if GL >= 3
+	"\n"
+	"in int vlayer;\n"
+	"flat out int layer;\n"
+#endif
+	"\n"
+	"float light_intensity(int i, vec3 p)\n"
+	"{\n"
+	"    vec3 ray = p - light_pos[i].xyz;\n"
+	"    float size = light_pos[i].w;\n"
+	"    float dist2 = dot(ray, ray);\n"
+	"    if (dist2 >= size * size)\n"
+	"        return 0.0;\n"
+	"    if (light_color[i].w < 0.5)\n"
+	"        return 1.0 - dist2 / (size * size);\n"
+	"    float dist = sqrt(dist2);\n"
+	"    if (dist > 0.0)\n"
+	"        ray /= dist;\n"
+	"    float cosa = dot(ray, light_dir[i].xyz);\n"
+	"    float cosarc = light_dir[i].w;\n"
+	"    if (dist > 0.5 * size)\n"
+	"        return cosa > cosarc ? ((size - dist) / (0.75 * size)) * ((cosa - cosarc) / (1.0 - cosarc)) : 0.0;\n"
+	"    if (dist > light_min_size)\n"
+	"    {\n"
+	"        float cosarc2 = cosarc * (1.0 - (size * 0.5 - dist) / (size * 0.5 - light_min_size));\n"
+	"        return cosa > cosarc2 ? ((size - dist) / (size - light_min_size)) * ((cosa - cosarc2) / (1.0 - cosarc2)) : 0.0;\n"
+	"    }\n"
+	"    return cosa > 0.0 ? 1.0 : 1.0 + cosa;\n"
+	"}\n"
+	"\n"
+	"vec3 lighting(vec3 p)\n"
+	"{\n"
+	"    vec3 sum = vec3(0.0);\n"
+#if GL >= 3
+	"    int mask = light_mask;\n"
+#else
+	"    float mask = float(light_mask); // no bit operations in glsl 1.20\n"
+#endif
+	"    for (int i = 0; i < MAX_LIGHTS; i++)\n"
+	"    {\n"
+#if GL >= 3
+	"        if (mask == 0)\n"
+	"            break;\n"
+	"        bool on = (mask & 1) != 0;\n"
+	"        mask >>= 1;\n"
+#else
+	"        if (mask < 1.0)\n"
+	"            break;\n"
+	"        bool on = mod(mask, 2.0) >= 1.0;\n"
+	"        mask = floor(mask * 0.5);\n"
+#endif
+	"        if (on)\n"
+	"            sum += light_color[i].rgb * light_intensity(i, p);\n"
+	"    }\n"
+	"    return sum;\n"
+	"}\n"
 	"\n"
 	"void main(void)\n"
 	"{\n"
@@ -304,12 +829,27 @@ static const char *default_vertex_shader =
 	"        gl_Position = ortho_proj * tlpos;\n"
 #endif
 	"    }\n"
+#if GL >= 3
+	"    else if (instanced)\n"
+	"    {\n"
+	"        gl_Position = view_proj * (instance_world[gl_InstanceID] * vec4(pos, 1.0));\n"
+	"    }\n"
+#endif
 	"    else\n"
 	"    {\n"
 	"        gl_Position = mvp * vec4(pos, 1.0);\n"
 	"    }\n"
 	"    color = vcolor.bgra;\n"
+	"    if (!orthographic && light_mask != 0)\n"
+#if GL >= 3
+	"        color.rgb = min(color.rgb + lighting(((instanced ? instance_world[gl_InstanceID] : world) * vec4(pos, 1.0)).xyz), 1.0);\n"
+#else
+	"        color.rgb = min(color.rgb + lighting((world * vec4(pos, 1.0)).xyz), 1.0);\n"
+#endif
 	"    texc = vtexc;\n"
+#if GL >= 3
+	"    layer = vlayer;\n"
+#endif
 	"}\n"
 ;
 
@@ -318,6 +858,10 @@ static const char *default_vertex_shader =
 //   - "colorkeying_enabled" uniform var
 // - texturing (possibly disabled)
 //   - "texturing_enabled" uniform var
+// - array textures ( GL 3 )
+//   - "texture_array_enabled" uniform var, "tex_array" on unit 1
+//   - the layer comes from the vertex, bit 7 of it turns on
+//     color-keying for the vertex's texture
 
 static const char *default_fragment_shader =
 	"#version " GLSL_VERSION "\n"
@@ -325,9 +869,16 @@ static const char *default_fragment_shader =
 	"uniform bool colorkeying_enabled;\n"
 	"uniform bool texturing_enabled;\n"
 	"uniform sampler2D tex;\n"
+#if GL >= 3
+	"uniform bool texture_array_enabled;\n"
+	"uniform sampler2DArray tex_array;\n"
+#endif
 	"\n"
 	GLSL_FRAG_IN " vec4 color;\n"
 	GLSL_FRAG_IN " vec2 texc;\n"
+#if GL >= 3
+	"flat in int layer;\n"
+#endif
 	"\n"
 	GLSL_FRAG_OUT " vec4 fcolor;\n"
 	"\n"
@@ -346,13 +897,23 @@ static const char *default_fragment_shader =
 #endif
 	"    if ( texturing_enabled )\n"
 #if GL >= 3
-	"        fcolor = textureGrad(tex, texc, dx, dy) * color;\n"
+	"    {\n"
+	"        if ( texture_array_enabled )\n"
+	"            fcolor = textureGrad(tex_array, vec3(texc, float(layer & 127)), dx, dy) * color;\n"
+	"        else\n"
+	"            fcolor = textureGrad(tex, texc, dx, dy) * color;\n"
+	"    }\n"
 #else
 	"        fcolor = texture2D(tex, vec2(texc.s,texc.t)) * color;\n"
 #endif
 	"    else\n"
 	"        fcolor = color;\n"
+#if GL >= 3
+	"    if ( ( colorkeying_enabled || ( texturing_enabled && texture_array_enabled && layer >= 128 ) ) &&\n"
+	"         fcolor.a <= (100.0/255.0) )\n"
+#else
 	"    if ( colorkeying_enabled && fcolor.a <= (100.0/255.0) )\n"
+#endif
 	"        discard;\n"
 #if GL < 3
         "    gl_FragColor = fcolor;\n"
@@ -364,6 +925,18 @@ GLuint vertex_shader = 0;
 GLuint fragment_shader = 0;
 GLuint current_program = 0;
 
+static const char *attrib_names[ ATTR_COUNT ] =
+{
+	"pos",     // ATTR_POS
+	"tlpos",   // ATTR_TLPOS
+	"vcolor",  // ATTR_VCOLOR
+	"vtexc",   // ATTR_VTEXC
+	"vnormal", // ATTR_VNORMAL
+	"vlayer",  // ATTR_VLAYER
+};
+
+static void program_linked( void );
+
 static GLuint new_shader( GLenum type, const char *src, char **log )
 {
 	GLuint shader;
@@ -400,6 +973,7 @@ static GLuint new_shader( GLenum type, const char *src, char **log )
 
 static bool update_shader_program( char **log )
 {
+	int i;
 	int link_ok;
 	GLsizei log_size;
 	static char *info_log = NULL;
@@ -422,6 +996,8 @@ static bool update_shader_program( char **log )
 
 	glAttachShader( current_program, vertex_shader );
 	glAttachShader( current_program, fragment_shader );
+	for ( i = 0; i < ATTR_COUNT; i++ )
+		glBindAttribLocation( current_program, i, attrib_names[i] );
 	glLinkProgram( current_program );
 	glGetProgramiv( current_program, GL_LINK_STATUS, &link_ok );
 	if ( link_ok == GL_FALSE )
@@ -437,6 +1013,7 @@ static bool update_shader_program( char **log )
 	}
 
 	glUseProgram( current_program );
+	program_linked();
 	CHECK_GL_ERRORS;
 
 	if ( log )
@@ -491,6 +1068,7 @@ static bool set_default_shaders( void )
 static bool set_defaults( void )
 {
 	build_gamma_table(1.0f); // 1.0f means no gamma change
+	reset_state_cache();
 #if GL == 1
 	glShadeModel(GL_SMOOTH); // TODO - is there gouraud ?
 	glDisable(GL_LIGHTING); // we light our own verts
@@ -548,8 +1126,39 @@ static void detect_caps( void )
   #endif
 #endif
 
+	caps.s3tc = false;
+#if GL == 2
+	caps.s3tc = strstr((char*)glGetString(GL_EXTENSIONS), "GL_EXT_texture_compression_s3tc") != NULL;
+#elif GL >= 3
+	glGetIntegerv(GL_NUM_EXTENSIONS,&max);
+	for(i = 0; i < max; i++ )
+	{
+		const GLubyte* extension = glGetStringi(GL_EXTENSIONS,i);
+		if(extension && !strcmp((const char*)extension, "GL_EXT_texture_compression_s3tc"))
+			caps.s3tc = true;
+	}
+#endif
+	DebugPrintf("render: s3tc texture compression = %s\n",
+		caps.s3tc?"true":"false");
+
 	DebugPrintf("render: anisotropic filtering support = %s\n",
 		caps.anisotropic?"true":"false");
+
+#if GL == 1
+	// level and model geometry is kept on the card when possible
+	caps.vbo = (
+		strstr((char*)glGetString(GL_EXTENSIONS), "GL_ARB_vertex_buffer_object") &&
+		bind_vbo_funcs()
+	);
+	caps.vertex_array_bgra = (
+		strstr((char*)glGetString(GL_EXTENSIONS), "GL_ARB_vertex_array_bgra") ||
+		strstr((char*)glGetString(GL_EXTENSIONS), "GL_EXT_vertex_array_bgra")
+	);
+
+	DebugPrintf("render: vertex buffer objects = %s, bgra vertex colors = %s\n",
+		caps.vbo?"true":"false",
+		caps.vertex_array_bgra?"true":"false");
+#endif
 }
 
 bool render_init( render_info_t * info )
@@ -603,49 +1212,55 @@ void render_set_filter( bool red, bool green, bool blue )
 
 bool render_flip( render_info_t * info )
 {
+	render_last_stats = render_stats;
+	memset( &render_stats, 0, sizeof(render_stats) );
 	sdl_render_present(info);
+#if GL > 1
+	stream_next_frame();
+#endif
+	upload_loaded_textures( TEXTURE_UPLOAD_MS );
 	CHECK_GL_ERRORS;
 	return true;
 }
 
 void reset_trans( void )
 {
-	glDisable(GL_BLEND);
-	glBlendFunc(GL_ONE,GL_ZERO); // src, dest
+	state_enable(GL_BLEND, false);
+	state_blend_func(GL_ONE,GL_ZERO); // src, dest
 }
 
 void reset_zbuff( void )
 {
-	glEnable(GL_DEPTH_TEST);
-	glDepthFunc(GL_LESS);
-	glDepthMask(GL_TRUE); // depth write
+	state_enable(GL_DEPTH_TEST, true);
+	state_depth_func(GL_LESS);
+	state_depth_mask(true); // depth write
 }
 
 void disable_zbuff_write( void )
 {
-	glDepthMask(GL_FALSE); // depth write
+	state_depth_mask(false); // depth write
 }
 
 void disable_zbuff( void )
 {
-	glDisable(GL_DEPTH_TEST);
+	state_enable(GL_DEPTH_TEST, false);
 }
 
 void cull_none( void )
 {
-	glDisable(GL_CULL_FACE);
+	state_enable(GL_CULL_FACE, false);
 }
 
 void cull_cw( void )
 {
-	glCullFace(GL_FRONT); // cw is the front for us
+	state_cull_face(GL_FRONT); // cw is the front for us
 }
 
 void reset_cull( void )
 {	
-	glEnable(GL_CULL_FACE);
-	glFrontFace(GL_CW);
-	glCullFace(GL_BACK);
+	state_enable(GL_CULL_FACE, true);
+	state_front_face(GL_CW);
+	state_cull_face(GL_BACK);
 }
 
 void set_normal_states( void )
@@ -656,13 +1271,13 @@ void set_normal_states( void )
 
 static void set_trans_state_9()
 {
-	glBlendFunc(GL_SRC_ALPHA,GL_ONE); // src, dest
+	state_blend_func(GL_SRC_ALPHA,GL_ONE); // src, dest
 }
 
 void set_alpha_states( void )
 {
 	disable_zbuff_write();
-	glEnable(GL_BLEND);
+	state_enable(GL_BLEND, true);
 	set_trans_state_9();
 }
 
@@ -677,8 +1292,8 @@ void set_whiteout_state( void )
 // was going really slow in gl1 for some reason so using this instead
 #if GL == 1
 	disable_zbuff_write();
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA,GL_ONE); // src, dest
+	state_enable(GL_BLEND, true);
+	state_blend_func(GL_SRC_ALPHA,GL_ONE); // src, dest
 #else
 	// higher = more white; < 1.0 makes it darker
 	float whiteness = 5.0f;
@@ -686,8 +1301,8 @@ void set_whiteout_state( void )
 	float src_a = framelag / 16.7f;
 	float dst_a = src_a / whiteness;
 
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_CONSTANT_ALPHA,GL_ONE_MINUS_CONSTANT_COLOR); // src, dest
+	state_enable(GL_BLEND, true);
+	state_blend_func(GL_CONSTANT_ALPHA,GL_ONE_MINUS_CONSTANT_COLOR); // src, dest
 	glBlendColor(dst_a, dst_a, dst_a, src_a); // src, dest
 #endif // GL == 1
 }
@@ -706,14 +1321,31 @@ bool FSClear(XYRECT * rect)
 	int y = render_info.ThisMode.h - rect->y1 - height;
 	// here we employ a stencil buffer so that we
 	// only clear the desired part of the screen
-	glEnable(GL_SCISSOR_TEST);
+	state_enable(GL_SCISSOR_TEST, true);
 	glScissor(x, y, width, height);
 	//
 	glClearDepth(1.0f);
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 	glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
 	//
-	glDisable(GL_SCISSOR_TEST);
+	state_enable(GL_SCISSOR_TEST, false);
+	return true;
+}
+
+// limit drawing to part of the viewport
+// render_viewport_t x/y starts top/left like FSSetViewPort
+
+bool FSSetScissor(render_viewport_t *rect)
+{
+	state_enable(GL_SCISSOR_TEST, true);
+	glScissor(rect->X, render_info.ThisMode.h - (rect->Y + rect->Height),
+		(GLsizei) rect->Width, (GLsizei) rect->Height);
+	return true;
+}
+
+bool FSResetScissor(void)
+{
+	state_enable(GL_SCISSOR_TEST, false);
 	return true;
 }
 
@@ -789,9 +1421,8 @@ void ortho_update ( GLuint current_program )
 {
 	MATRIX m;
 	float left, right, bottom, top, near, far;
-	GLuint u_ortho_matrix;
 
-	if ( ortho_matrix_needs_update && ( u_ortho_matrix = glGetUniformLocation( current_program, "ortho_proj" ) ) >= 0 )
+	if ( ortho_matrix_needs_update && uniforms.ortho_proj >= 0 )
 	{
 		left = 0.0f;
 		right = render_info.ThisMode.w;
@@ -809,7 +1440,7 @@ void ortho_update ( GLuint current_program )
 		m._24 = -(top+bottom)/(top-bottom) + 2.0f;
 		m._34 = -(far+near)/(far-near);
 		m._44 = 1.0f;
-		glUniformMatrix4fv( u_ortho_matrix, 1, GL_TRUE, &m );
+		glUniformMatrix4fv( uniforms.ortho_proj, 1, GL_TRUE, &m );
 		CHECK_GL_ERRORS;
 		ortho_matrix_needs_update = false;
 	}
@@ -838,17 +1469,166 @@ bool mvp_needs_update;
 void mvp_update( GLuint current_program )
 {
 	MATRIX mvp;
-	GLuint u_mvp;
 
-	if ( mvp_needs_update && ( u_mvp = glGetUniformLocation( current_program, "mvp" ) ) >= 0 )
+	if ( mvp_needs_update && uniforms.mvp >= 0 )
 	{
 		MatrixMultiply( &world_matrix, &view_matrix, &mvp );
 		MatrixMultiply( &mvp,          &proj_matrix, &mvp );
-		glUniformMatrix4fv( u_mvp, 1, GL_FALSE, &mvp );
+		glUniformMatrix4fv( uniforms.mvp, 1, GL_FALSE, &mvp );
+		if ( uniforms.world >= 0 )
+			glUniformMatrix4fv( uniforms.world, 1, GL_FALSE, &world_matrix );
 		CHECK_GL_ERRORS;
 		mvp_needs_update = false;
 	}
 }
+
+program_uniforms_t uniforms;
+
+static void find_uniform( uniform_int_t * uniform, const char * name )
+{
+	uniform->location = glGetUniformLocation( current_program, name );
+	uniform->value = -1;
+}
+
+static RENDERLIGHT lights[ MAX_RENDER_LIGHTS ];
+static int num_lights = 0;
+static bool lights_need_update = false;
+
+// A freshly linked program has lost every uniform value we sent
+// to the last one, so look the uniforms up and send them all again.
+
+static void program_linked( void )
+{
+	uniforms.mvp = glGetUniformLocation( current_program, "mvp" );
+	uniforms.ortho_proj = glGetUniformLocation( current_program, "ortho_proj" );
+	find_uniform( &uniforms.orthographic, "orthographic" );
+	find_uniform( &uniforms.colorkeying_enabled, "colorkeying_enabled" );
+	find_uniform( &uniforms.texturing_enabled, "texturing_enabled" );
+	uniforms.world = glGetUniformLocation( current_program, "world" );
+	find_uniform( &uniforms.light_mask, "light_mask" );
+	uniforms.light_pos = glGetUniformLocation( current_program, "light_pos" );
+	uniforms.light_color = glGetUniformLocation( current_program, "light_color" );
+	uniforms.light_dir = glGetUniformLocation( current_program, "light_dir" );
+	uniforms.light_min_size = glGetUniformLocation( current_program, "light_min_size" );
+	find_uniform( &uniforms.instanced, "instanced" );
+	find_uniform( &uniforms.texture_array_enabled, "texture_array_enabled" );
+	// array textures are bound to unit 1 so they never share a unit
+	// with the 2d textures "tex" samples
+	if ( glGetUniformLocation( current_program, "tex_array" ) >= 0 )
+		glUniform1i( glGetUniformLocation( current_program, "tex_array" ), 1 );
+	uniforms.view_proj = glGetUniformLocation( current_program, "view_proj" );
+	uniforms.instance_world = glGetUniformLocation( current_program, "instance_world" );
+	mvp_needs_update = true;
+	ortho_matrix_needs_update = true;
+	lights_need_update = true;
+}
+
+void set_uniform_bool( uniform_int_t * uniform, bool value )
+{
+	if ( uniform->location < 0 || uniform->value == (int) value )
+		return;
+	glUniform1i( uniform->location, value ? GL_TRUE : GL_FALSE );
+	uniform->value = (int) value;
+}
+
+void set_uniform_int( uniform_int_t * uniform, int value )
+{
+	if ( uniform->location < 0 || uniform->value == value )
+		return;
+	glUniform1i( uniform->location, value );
+	uniform->value = value;
+}
+
+// The whole light list only goes over once each time lights.c hands
+// us a new one, after that drawing an object just sends which of the
+// lights reach it.
+
+bool FSSetLights( RENDERLIGHT * new_lights, int count )
+{
+	if ( uniforms.light_mask.location < 0 || uniforms.light_pos < 0 ||
+		 count > MAX_RENDER_LIGHTS )
+		return false;
+	memcpy( lights, new_lights, count * sizeof(RENDERLIGHT) );
+	num_lights = count;
+	lights_need_update = true;
+	return true;
+}
+
+void lights_update( u_int32_t mask )
+{
+	GLfloat pos[ MAX_RENDER_LIGHTS ][4];
+	GLfloat color[ MAX_RENDER_LIGHTS ][4];
+	GLfloat dir[ MAX_RENDER_LIGHTS ][4];
+	int i;
+
+	if ( lights_need_update && mask && num_lights )
+	{
+		for ( i = 0; i < num_lights; i++ )
+		{
+			pos[i][0] = lights[i].pos.x;
+			pos[i][1] = lights[i].pos.y;
+			pos[i][2] = lights[i].pos.z;
+			pos[i][3] = lights[i].size;
+			color[i][0] = lights[i].r / 255.0f;
+			color[i][1] = lights[i].g / 255.0f;
+			color[i][2] = lights[i].b / 255.0f;
+			color[i][3] = lights[i].spot ? 1.0f : 0.0f;
+			dir[i][0] = lights[i].dir.x;
+			dir[i][1] = lights[i].dir.y;
+			dir[i][2] = lights[i].dir.z;
+			dir[i][3] = lights[i].cosarc;
+		}
+		glUniform4fv( uniforms.light_pos, num_lights, &pos[0][0] );
+		glUniform4fv( uniforms.light_color, num_lights, &color[0][0] );
+		glUniform4fv( uniforms.light_dir, num_lights, &dir[0][0] );
+		glUniform1f( uniforms.light_min_size, MIN_LIGHT_SIZE );
+		CHECK_GL_ERRORS;
+		lights_need_update = false;
+	}
+
+	set_uniform_int( &uniforms.light_mask, (int) mask );
+}
+
+// Tell OpenGL about the data layout of the bound vertex buffer
+// see the LVERTEX and TLVERTEX definitions inside include/new3d.h
+
+void set_vertex_attribs( bool orthographic )
+{
+	GLsizei stride = orthographic ? sizeof(TLVERTEX) : sizeof(LVERTEX);
+	if ( orthographic )
+	{
+		glVertexAttribPointer( ATTR_TLPOS,  4, GL_FLOAT,         GL_FALSE, stride, (void*) 0  );
+		glVertexAttribPointer( ATTR_VCOLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE,  stride, (void*) 16 ); // 4*float
+		glVertexAttribPointer( ATTR_VTEXC,  2, GL_FLOAT,         GL_FALSE, stride, (void*) 20 ); // 4*float + 1*COLOR
+		glEnableVertexAttribArray( ATTR_TLPOS );
+	}
+	else
+	{
+		glVertexAttribPointer( ATTR_POS,    3, GL_FLOAT,         GL_FALSE, stride, (void*) 0  );
+		glVertexAttribPointer( ATTR_VCOLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE,  stride, (void*) 12 ); // 3*float
+		glVertexAttribPointer( ATTR_VTEXC,  2, GL_FLOAT,         GL_FALSE, stride, (void*) 16 ); // 3*float + 1*COLOR
+		glEnableVertexAttribArray( ATTR_POS );
+	}
+	glEnableVertexAttribArray( ATTR_VCOLOR );
+	glEnableVertexAttribArray( ATTR_VTEXC );
+	CHECK_GL_ERRORS;
+}
+
+// Same for the bound normal buffer
+
+void set_normal_attribs( void )
+{
+	glVertexAttribPointer( ATTR_VNORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(NORMAL), (void*) 0 );
+	glEnableVertexAttribArray( ATTR_VNORMAL );
+	CHECK_GL_ERRORS;
+}
+
+void disable_vertex_attribs( void )
+{
+	int i;
+	for ( i = 0; i < ATTR_COUNT; i++ )
+		glDisableVertexAttribArray( i );
+}
 #endif
 
 static void reset_modelview( void )
@@ -924,15 +1704,302 @@ LPVERTEXBUFFER _create_buffer( int size, GLenum type, GLenum gettype, GLenum usa
 
 	return (LPVERTEXBUFFER) vbo;
 }
+
+// Dynamic buffers used to be mapped with glMapBuffer every time they
+// were refilled, which stalls while the gpu still draws the old
+// contents and only allowed one of each type to be locked at a time.
+//
+// Now they are plain memory, so any number can be locked at once and
+// filled from any thread as locking makes no gl calls. The first draw
+// after a lock copies the part the texture groups use into this frame's
+// region of a stream buffer. There are STREAM_FRAMES regions used in
+// turn, so the gpu is done with a region by the time it comes round
+// again. A frame that fills its region orphans the buffer and starts
+// on fresh storage, the driver keeps the old one for pending draws.
+
+#define STREAM_FRAMES 3
+
+typedef struct
+{
+	int size;			// bytes the caller may fill in
+	int generation;		// stream generation of offset, -1 since the last lock
+	GLintptr offset;	// where the data was copied into the stream
+} stream_data_t;
+
+#define stream_header( data ) ( (stream_data_t *)( data ) - 1 )
+
+typedef struct
+{
+	GLenum target;
+	GLsizeiptr region_size;	// bytes per frame
+	GLuint vbo;
+	GLsizeiptr used;		// bytes used of this frame's region
+	int generation;			// bumped when earlier copies can't be drawn again
+} stream_t;
+
+static stream_t streams[ STREAM_COUNT ] =
+{
+	{ GL_ARRAY_BUFFER,         4 * 1024 * 1024 },
+	{ GL_ELEMENT_ARRAY_BUFFER, 2 * 1024 * 1024 },
+};
+
+static int stream_frame = 0;
+
+// gl3 writes to the streams unsynchronized, fences make sure the gpu
+// really is done with a region, gl2 lets glBufferSubData handle it.
+// The copy-write binding leaves the bound vertex array object alone.
+
+#if GL >= 3
+static GLsync stream_fences[ STREAM_FRAMES ];
+#define stream_target( s ) GL_COPY_WRITE_BUFFER
+#else
+#define stream_target( s ) ( (s)->target )
 #endif
 
+void * create_stream_data( int size )
+{
+	stream_data_t * data = malloc( sizeof(stream_data_t) + size );
+	if ( !data )
+		return NULL;
+	data->size = size;
+	data->generation = -1;
+	data->offset = 0;
+	return data + 1;
+}
+
+void release_stream_data( void * data )
+{
+	free( stream_header( data ) );
+}
+
+void * lock_stream_data( void * data )
+{
+	stream_header( data )->generation = -1;
+	return data;
+}
+
+GLuint stream_buffer( int stream )
+{
+	stream_t * s = &streams[ stream ];
+	if ( !s->vbo )
+	{
+		glGenBuffers( 1, &s->vbo );
+		glBindBuffer( stream_target( s ), s->vbo );
+		glBufferData( stream_target( s ), s->region_size * STREAM_FRAMES, NULL, GL_STREAM_DRAW );
+		CHECK_GL_ERRORS;
+	}
+	return s->vbo;
+}
+
+// returns the offset of size bytes aligned to align in the stream,
+// which has to be bound to stream_target() already
+
+static GLintptr stream_alloc( stream_t * s, GLsizeiptr size, int align )
+{
+	GLintptr base = stream_frame * s->region_size;
+	GLintptr offset = ( base + s->used + align - 1 ) / align * align;
+
+	if ( offset + size > base + s->region_size )
+	{
+		glBufferData( stream_target( s ), s->region_size * STREAM_FRAMES, NULL, GL_STREAM_DRAW );
+		s->generation++;
+		offset = ( base + align - 1 ) / align * align;
+		if ( offset + size > base + s->region_size )
+			return -1;
+	}
+
+	s->used = offset + size - base;
+	return offset;
+}
+
+static bool stream_upload( int stream, stream_data_t * data, GLsizeiptr size, int align )
+{
+	stream_t * s = &streams[ stream ];
+	GLintptr offset;
+	void * dst;
+
+	if ( size <= 0 )
+	{
+		data->offset = 0;
+		return true;
+	}
+
+	glBindBuffer( stream_target( s ), stream_buffer( stream ) );
+
+	offset = stream_alloc( s, size, align );
+	if ( offset < 0 )
+	{
+		DebugPrintf( "stream_upload: %d bytes don't fit a stream region\n", (int) size );
+		return false;
+	}
+
+#if GL >= 3
+	dst = glMapBufferRange( stream_target( s ), offset, size,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+	if ( !dst )
+	{
+		DebugPrintf( "stream_upload: glMapBufferRange returned NULL\n" );
+		return false;
+	}
+	memcpy( dst, data + 1, size );
+	glUnmapBuffer( stream_target( s ) );
+#else
+	dst = data + 1;
+	glBufferSubData( stream_target( s ), offset, size, dst );
+#endif
+	CHECK_GL_ERRORS;
+
+	data->offset = offset;
+	data->generation = s->generation;
+	render_stats.stream_bytes += size;
+	return true;
+}
+
+// Copy the streamed buffers of a render object if they aren't already
+// in the stream, covering every texture group so drawing the groups one
+// at a time only copies once.
+
+bool stream_render_object( RENDEROBJECT *renderObject, bool orthographic, stream_offsets_t *offsets )
+{
+	stream_data_t * vertices = NULL;
+	stream_data_t * indices = NULL;
+	TEXTUREGROUP * group;
+	WORD * index;
+	int stride = orthographic ? sizeof(TLVERTEX) : sizeof(LVERTEX);
+	int num_verts = 0;
+	int num_indices = 0;
+	int i, j;
+
+	offsets->base_vertex = 0;
+	offsets->index_offset = 0;
+
+	if ( !renderObject->streamed )
+		return true;
+
+	if ( renderObject->streamed & STREAMED_INDICES )
+		indices = stream_header( renderObject->lpIndexBuffer );
+	if ( renderObject->streamed & STREAMED_VERTICES )
+		vertices = stream_header( renderObject->lpVertexBuffer );
+
+	if ( indices && indices->generation != streams[ STREAM_INDICES ].generation )
+	{
+		for ( i = 0; i < renderObject->numTextureGroups; i++ )
+		{
+			group = &renderObject->textureGroups[i];
+			if ( group->startIndex + group->numTriangles * 3 > num_indices )
+				num_indices = group->startIndex + group->numTriangles * 3;
+		}
+		if ( num_indices * (int) sizeof(WORD) > indices->size )
+			num_indices = indices->size / sizeof(WORD);
+		if ( !stream_upload( STREAM_INDICES, indices, num_indices * sizeof(WORD), sizeof(WORD) ) )
+			return false;
+	}
+
+	if ( vertices && vertices->generation != streams[ STREAM_VERTICES ].generation )
+	{
+		// the highest index drawn says how many vertices are in use,
+		// unindexed groups give their count ( or end, see gl1 ) and
+		// with the indices on the card all of them might be
+		for ( i = 0; i < renderObject->numTextureGroups; i++ )
+		{
+			group = &renderObject->textureGroups[i];
+			if ( indices )
+			{
+				index = (WORD *)( indices + 1 ) + group->startIndex;
+				for ( j = 0; j < group->numTriangles * 3; j++ )
+					if ( group->startVert + index[j] >= num_verts )
+						num_verts = group->startVert + index[j] + 1;
+			}
+			else if ( group->startVert + group->numVerts > num_verts )
+				num_verts = group->startVert + group->numVerts;
+		}
+		if ( ( renderObject->lpIndexBuffer && !indices ) || num_verts * stride > vertices->size )
+			num_verts = vertices->size / stride;
+		if ( !stream_upload( STREAM_VERTICES, vertices, num_verts * stride, stride ) )
+			return false;
+	}
+
+	if ( indices )
+		offsets->index_offset = indices->offset;
+	if ( vertices )
+		offsets->base_vertex = vertices->offset / stride;
+
+	return true;
+}
+
+void stream_next_frame( void )
+{
+	int i;
+
+#if GL >= 3
+	// the frame just finished may still be drawing from its regions
+	if ( stream_fences[ stream_frame ] )
+		glDeleteSync( stream_fences[ stream_frame ] );
+	stream_fences[ stream_frame ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+#endif
+
+	stream_frame = ( stream_frame + 1 ) % STREAM_FRAMES;
+
+#if GL >= 3
+	// normally long signalled, a few frames have gone by since
+	if ( stream_fences[ stream_frame ] )
+	{
+		glClientWaitSync( stream_fences[ stream_frame ], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 );
+		glDeleteSync( stream_fences[ stream_frame ] );
+		stream_fences[ stream_frame ] = 0;
+	}
+#endif
+
+	for ( i = 0; i < STREAM_COUNT; i++ )
+	{
+		streams[i].used = 0;
+		streams[i].generation++;
+	}
+}
+#endif
+
+bool draw_render_object( RENDEROBJECT *renderObject, int primitive_type, bool orthographic )
+{return draw_render_object_groups(renderObject,0,renderObject->numTextureGroups,primitive_type,orthographic);}
+
 bool draw_object(RENDEROBJECT *renderObject){return draw_render_object(renderObject,GL_TRIANGLES,false);}
+bool draw_object_group(RENDEROBJECT *renderObject, int group){return draw_render_object_groups(renderObject,group,1,GL_TRIANGLES,false);}
+
+// Without instancing every world matrix is still a draw of its own,
+// but each texture group is drawn for all the instances before moving
+// on to the next so its texture and state are only set once.
+
+bool draw_object_instances_each( RENDEROBJECT *renderObject, RENDERMATRIX *worlds, int count )
+{
+	RENDERMATRIX old_world;
+	int g, i;
+	bool ok = true;
+
+	FSGetWorld( &old_world );
+	for ( g = 0; g < renderObject->numTextureGroups && ok; g++ )
+		for ( i = 0; i < count && ok; i++ )
+		{
+			FSSetWorld( &worlds[i] );
+			ok = draw_object_group( renderObject, g );
+		}
+	FSSetWorld( &old_world );
+	return ok;
+}
+
+#if GL < 3
+bool draw_object_instances( RENDEROBJECT *renderObject, RENDERMATRIX *worlds, int count )
+{return draw_object_instances_each(renderObject,worlds,count);}
+
+// level uvs wrap, which an atlas can't do without shader help, so
+// before gl3 every texture group keeps its own draw
+
+bool FSCreateTextureArrays( LPTEXTURE *textures, int count ){return true;}
+void FSReleaseTextureArrays( void ){}
+bool FSMergeTextureGroups( RENDEROBJECT *renderObject ){return false;}
+#endif
 bool draw_2d_object(RENDEROBJECT *renderObject){return draw_render_object(renderObject,GL_TRIANGLES,true);}
 bool draw_line_object(RENDEROBJECT *renderObject){return draw_render_object(renderObject,GL_LINES,false);}
 
-#if GL == 1
-	#define delete_buffer(b) free( b )
-#else
+#if GL > 1
 	#define delete_buffer(b) glDeleteBuffers( 1, b )
 #endif
 
@@ -941,6 +2008,11 @@ void FSReleaseRenderObject(RENDEROBJECT *renderObject)
 	int i;
 	if (renderObject->lpVertexBuffer)
 	{
+#if GL > 1
+		if ( renderObject->streamed & STREAMED_VERTICES )
+			release_stream_data( renderObject->lpVertexBuffer );
+		else
+#endif
 		delete_buffer( &renderObject->lpVertexBuffer );
 		renderObject->lpVertexBuffer = NULL;
 	}
@@ -951,9 +2023,25 @@ void FSReleaseRenderObject(RENDEROBJECT *renderObject)
 	}
 	if (renderObject->lpIndexBuffer)
 	{
+#if GL > 1
+		if ( renderObject->streamed & STREAMED_INDICES )
+			release_stream_data( renderObject->lpIndexBuffer );
+		else
+#endif
 		delete_buffer( &renderObject->lpIndexBuffer );
 		renderObject->lpIndexBuffer = NULL;
 	}
+#if GL >= 3
+	if (renderObject->lpVertexArray)
+	{
+		GLuint vao = (GLuint) renderObject->lpVertexArray;
+		glDeleteVertexArrays( 1, &vao );
+		renderObject->lpVertexArray = NULL;
+	}
+#endif
+	renderObject->vbOriginalColors = false;
+	renderObject->lights = 0;
+	renderObject->streamed = 0;
 	for (i = 0; i < renderObject->numTextureGroups; i++)
 	{
 		renderObject->textureGroups[i].numVerts = 0;
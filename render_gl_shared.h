@@ -49,10 +49,46 @@ const char * render_error_description( int e );
 	} while (0)
 
 
-typedef struct { float anisotropic; } gl_caps_t;
+typedef struct
+{
+	float anisotropic;
+	bool vbo;				// gl1: GL_ARB_vertex_buffer_object
+	bool vertex_array_bgra;	// gl1: colors can be handed over as bgra
+	bool s3tc;				// gl2+: GL_EXT_texture_compression_s3tc
+} gl_caps_t;
 extern gl_caps_t caps;
 
-typedef struct { GLuint id; } texture_t; // Possibly later: GLuint bump_id;
+typedef struct
+{
+	GLuint id;
+	int layers;	// > 0 for array textures ( gl3, see FSCreateTextureArrays )
+	int w, h;	// 1x1 while a FSCreateTextureAsync load is on its way
+} texture_t; // Possibly later: GLuint bump_id;
+
+void bind_texture( GLuint id );
+
+// uploads every texture the workers are still loading, for when
+// all of them are needed at once
+void finish_textures( void );
+#if GL >= 3
+void bind_texture_array( GLuint id );
+// copy a rewritten 2d texture into its array layer again, if it has one
+void refresh_texture_array_layer( texture_t * texdata );
+#endif
+
+// state changes go through these so calls that wouldn't change
+// anything never reach the driver, see render_stats.state_filtered
+
+void reset_state_cache( void );
+void state_enable( GLenum cap, bool on );
+void state_blend_func( GLenum src, GLenum dst );
+void state_depth_func( GLenum func );
+void state_depth_mask( bool write );
+void state_cull_face( GLenum mode );
+void state_front_face( GLenum mode );
+#if GL == 1
+void state_alpha_func( GLenum func, GLfloat ref );
+#endif
 
 //
 // d3d stored the world/view matrixes
@@ -70,6 +106,59 @@ extern MATRIX world_matrix;
 #if GL != 1
 
 void mvp_update( GLuint current_program );
+void ortho_update( GLuint current_program );
+
+// attribute locations are bound before the program is linked
+// so vertex layouts ( and vertex array objects ) never need to
+// ask the program where its inputs are
+
+enum
+{
+	ATTR_POS,
+	ATTR_TLPOS,
+	ATTR_VCOLOR,
+	ATTR_VTEXC,
+	ATTR_VNORMAL,
+	ATTR_VLAYER,	// gl3 array textures
+	ATTR_COUNT
+};
+
+// uniform locations are looked up once per link and the last
+// value sent is kept so unchanged values are not sent again
+
+typedef struct
+{
+	GLint location;
+	int value; // -1 until first set
+} uniform_int_t;
+
+typedef struct
+{
+	GLint mvp;
+	GLint ortho_proj;
+	GLint world;
+	uniform_int_t orthographic;
+	uniform_int_t colorkeying_enabled;
+	uniform_int_t texturing_enabled;
+	uniform_int_t light_mask;
+	GLint light_pos;
+	GLint light_color;
+	GLint light_dir;
+	GLint light_min_size;
+	uniform_int_t instanced;
+	uniform_int_t texture_array_enabled;
+	GLint view_proj;
+	GLint instance_world;
+} program_uniforms_t;
+
+extern program_uniforms_t uniforms;
+
+void set_uniform_bool( uniform_int_t * uniform, bool value );
+void set_uniform_int( uniform_int_t * uniform, int value );
+void lights_update( u_int32_t mask );
+void set_vertex_attribs( bool orthographic );
+void set_normal_attribs( void );
+void disable_vertex_attribs( void );
 
 extern GLuint vertex_shader;
 extern GLuint fragment_shader;
@@ -77,11 +166,47 @@ extern GLuint current_program;
 
 LPVERTEXBUFFER _create_buffer( int size, GLenum type, GLenum gettype, GLenum usage );
 
+// dynamic vertex and index data ( FSCreateDynamic* ) is filled in on
+// the cpu and copied into a stream buffer the first time it is drawn
+
+enum
+{
+	STREAM_VERTICES,
+	STREAM_INDICES,
+	STREAM_COUNT
+};
+
+#define STREAMED_VERTICES	( 1 << STREAM_VERTICES )
+#define STREAMED_INDICES	( 1 << STREAM_INDICES )
+
+typedef struct
+{
+	GLint base_vertex;		// added to the startVert of every group
+	GLintptr index_offset;	// bytes added to the startIndex of every group
+} stream_offsets_t;
+
+void * create_stream_data( int size );
+void release_stream_data( void * data );
+void * lock_stream_data( void * data );
+GLuint stream_buffer( int stream );
+bool stream_render_object( RENDEROBJECT *renderObject, bool orthographic, stream_offsets_t *offsets );
+void stream_next_frame( void );
+
 #define create_buffer( size, type, usage ) \
         _create_buffer( size, type, type ## _BINDING, usage )
 
+#else // GL == 1
+
+bool bind_vbo_funcs( void );
+void delete_buffer( void ** data );
+
 #endif // GL != 1
 
+// world matrices sent to the shader per instanced draw call
+#define MAX_INSTANCES 32
+
+bool draw_object_instances_each( RENDEROBJECT *renderObject, RENDERMATRIX *worlds, int count );
+
 void FSReleaseRenderObject(RENDEROBJECT *renderObject);
 
 #endif // RENDER_GL_SHARED_INCLUDED
@@ -46,7 +46,7 @@ extern	BYTE			MyGameStatus;
 extern	MATRIX			MATRIX_Identity;
 extern	u_int16_t			num_start_positions;
 extern	GAMESTARTPOS	StartPositions[ MAXSTARTPOSITIONS ];
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
+extern	FMPOLY			*	FmPolys;
 extern	FRAME_INFO	*	Restart_Header;
 extern	u_int16_t			last_start_position;
 extern	MODELNAME	*	ModNames;
@@ -0,0 +1,313 @@
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include <SDL.h>
+
+#include "savefile.h"
+#include "file.h"
+#include "util.h"
+
+#define SAVEFILE_MAGIC	"PXSZ"
+
+typedef struct
+{
+	char			magic[4];
+	u_int32_t		length;
+} savefile_header_t;
+
+// the save being built
+static FILE * build_fp = NULL;
+#ifndef WIN32
+static char * build_data = NULL;
+static size_t build_size = 0;
+#endif
+
+// the save being written
+static SDL_Thread * writer = NULL;
+static char * write_data = NULL;
+static size_t write_size = 0;
+static char write_path[ 256 ];
+static bool write_ok = false;
+
+// what the last stream opened for reading is over
+static char * read_data = NULL;
+
+#ifndef WIN32
+// open_memstream's buffer comes from libc, not through xmem's malloc
+static void free_build( char * data )
+{
+	(free)( data );
+}
+#endif
+
+FILE * savefile_create( void )
+{
+	if ( build_fp )
+		savefile_abort( build_fp );
+
+#ifdef WIN32
+	build_fp = tmpfile();
+#else
+	build_data = NULL;
+	build_size = 0;
+	build_fp = open_memstream( &build_data, &build_size );
+#endif
+	if ( !build_fp )
+		DebugPrintf( "savefile: couldn't create a stream to save to\n" );
+	return build_fp;
+}
+
+void savefile_abort( FILE * fp )
+{
+	if ( fp )
+		fclose( fp );
+#ifndef WIN32
+	free_build( build_data );
+	build_data = NULL;
+	build_size = 0;
+#endif
+	build_fp = NULL;
+}
+
+// closes the stream being built and keeps what was written to it
+static char * take_build( FILE * fp, size_t * size )
+{
+	char * data;
+
+#ifdef WIN32
+	long length;
+
+	data = NULL;
+	*size = 0;
+	if ( fflush( fp ) == 0 && ( length = ftell( fp ) ) >= 0 && fseek( fp, 0, SEEK_SET ) == 0 )
+	{
+		data = malloc( length ? length : 1 );
+		if ( data && fread( data, 1, length, fp ) != (size_t) length )
+		{
+			free( data );
+			data = NULL;
+		}
+		*size = length;
+	}
+	fclose( fp );
+#else
+	data = NULL;
+	if ( fclose( fp ) == 0 )
+	{
+		// copied so it's freed like any other block
+		data = malloc( build_size ? build_size : 1 );
+		if ( data )
+			memcpy( data, build_data, build_size );
+		*size = build_size;
+	}
+	free_build( build_data );
+	build_data = NULL;
+	build_size = 0;
+#endif
+
+	build_fp = NULL;
+	return data;
+}
+
+static int write_save( void * unused )
+{
+	savefile_header_t header;
+	uLongf packed_size;
+	Bytef * packed;
+	char temp[ 256 + 4 ];
+	char from[ 256 + 4 ];
+	char to[ 256 ];
+	FILE * fp;
+	bool ok;
+
+	write_ok = false;
+
+	packed_size = compressBound( write_size );
+	packed = malloc( packed_size );
+	if ( !packed || compress( packed, &packed_size, (Bytef *) write_data, write_size ) != Z_OK )
+	{
+		DebugPrintf( "savefile: couldn't compress %s\n", write_path );
+		free( packed );
+		free( write_data );
+		write_data = NULL;
+		return 0;
+	}
+
+	memcpy( header.magic, SAVEFILE_MAGIC, sizeof( header.magic ) );
+	header.length = (u_int32_t) write_size;
+
+	// written beside the old save and swapped in once it's complete
+	snprintf( temp, sizeof( temp ), "%s.tmp", write_path );
+	fp = file_open( temp, "wb" );
+	if ( fp )
+	{
+		ok = fwrite( &header, sizeof( header ), 1, fp ) == 1 &&
+			 fwrite( packed, packed_size, 1, fp ) == 1;
+		if ( fclose( fp ) != 0 )
+			ok = false;
+
+		strncpy( from, convert_path( temp ), sizeof( from ) - 1 );
+		from[ sizeof( from ) - 1 ] = 0;
+		strncpy( to, convert_path( write_path ), sizeof( to ) - 1 );
+		to[ sizeof( to ) - 1 ] = 0;
+
+		if ( ok )
+		{
+#ifdef WIN32
+			// rename won't replace an existing file here
+			remove( to );
+#endif
+			ok = ( rename( from, to ) == 0 );
+		}
+		if ( !ok )
+			remove( from );
+
+		write_ok = ok;
+	}
+
+	DebugPrintf( "savefile: %s %lu bytes packed into %lu%s\n", write_path,
+		(unsigned long) write_size, (unsigned long) packed_size, write_ok ? "" : ", failed to write" );
+
+	free( packed );
+	free( write_data );
+	write_data = NULL;
+	return 0;
+}
+
+bool savefile_commit( FILE * fp, const char * path )
+{
+	savefile_flush();
+
+	write_data = take_build( fp, &write_size );
+	if ( !write_data )
+	{
+		DebugPrintf( "savefile: couldn't build %s\n", path );
+		return false;
+	}
+
+	strncpy( write_path, path, sizeof( write_path ) - 1 );
+	write_path[ sizeof( write_path ) - 1 ] = 0;
+
+	writer = NULL;
+#ifdef DEBUG_ON
+	// the writer allocates, so the debug allocator has to be shared
+	if ( XMem_ThreadSafe() )
+#endif
+#if SDL_VERSION_ATLEAST(2,0,0)
+	writer = SDL_CreateThread( write_save, "save_writer", NULL );
+#else
+	writer = SDL_CreateThread( write_save, NULL );
+#endif
+
+	// no thread, write it now
+	if ( !writer )
+	{
+		write_save( NULL );
+		return write_ok;
+	}
+	return true;
+}
+
+void savefile_flush( void )
+{
+	if ( !writer )
+		return;
+
+	SDL_WaitThread( writer, NULL );
+	writer = NULL;
+
+	if ( !write_ok )
+		Msg( "Couldn't write the saved game %s\n", write_path );
+}
+
+FILE * savefile_open( const char * path, long limit )
+{
+	savefile_header_t * header;
+	z_stream stream;
+	char * file;
+	char * data;
+	long size;
+	long inflated;
+	long length;
+	int result;
+	FILE * fp;
+
+	savefile_flush();
+
+	// the Load functions close the stream themselves when they fail
+	// so what it was over is let go here instead
+	free( read_data );
+	read_data = NULL;
+
+	file = load_file_buffer( (char *) path, &size, 0 );
+	if ( !file )
+		return NULL;
+
+	header = (savefile_header_t *) file;
+	if ( size < (long) sizeof( *header ) || memcmp( header->magic, SAVEFILE_MAGIC, sizeof( header->magic ) ) )
+	{
+		// saved before saves were compressed
+		release_file_buffer( file );
+		return file_open( (char *) path, "rb" );
+	}
+
+	inflated = header->length;
+	length = inflated;
+	if ( limit && limit < length )
+		length = limit;
+
+	data = malloc( length ? length : 1 );
+	if ( !data )
+	{
+		release_file_buffer( file );
+		return NULL;
+	}
+
+	memset( &stream, 0, sizeof( stream ) );
+	stream.next_in = (Bytef *) ( file + sizeof( *header ) );
+	stream.avail_in = size - sizeof( *header );
+	stream.next_out = (Bytef *) data;
+	stream.avail_out = length;
+
+	result = inflateInit( &stream );
+	if ( result == Z_OK )
+	{
+		result = inflate( &stream, Z_FINISH );
+		inflateEnd( &stream );
+	}
+	release_file_buffer( file );
+
+	// a limited read stops with the output full
+	if ( stream.total_out != (uLong) length || ( result != Z_STREAM_END && length == inflated ) )
+	{
+		DebugPrintf( "savefile: %s is corrupt\n", path );
+		free( data );
+		return NULL;
+	}
+
+#ifdef WIN32
+	fp = tmpfile();
+	if ( fp && ( fwrite( data, 1, length, fp ) != (size_t) length || fseek( fp, 0, SEEK_SET ) != 0 ) )
+	{
+		fclose( fp );
+		fp = NULL;
+	}
+	free( data );
+#else
+	fp = fmemopen( data, length ? length : 1, "rb" );
+	if ( fp )
+		read_data = data;
+	else
+		free( data );
+#endif
+	return fp;
+}
+
+void savefile_close( FILE * fp )
+{
+	fclose( fp );
+	free( read_data );
+	read_data = NULL;
+}
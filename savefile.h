@@ -0,0 +1,45 @@
+#ifndef SAVEFILE_H
+#define SAVEFILE_H
+
+#include "main.h"
+#include <stdio.h>
+
+//
+// Save Game Files
+//
+// A save is built in memory: savefile_create hands out a stream over a
+// growing buffer for the Save functions to write to and
+// savefile_commit passes the buffer to a thread that compresses it and
+// writes it out, so saving mid level doesn't wait on zlib or the disk.
+//
+//   header     magic "PXSZ", inflated length
+//   data       the save, zlib compressed
+//
+// savefile_open reads the whole file at once, inflates it and hands
+// out a stream over the result for the Load functions.  Saves from
+// before they were compressed are read as they are.
+//
+// Only one save is written at a time.  Anything that lists, deletes or
+// checks the time of a save has to savefile_flush first, savefile_open
+// does it itself.
+//
+
+// enough of a save for the details at its start
+#define SAVEFILE_INFO_SIZE	1024
+
+FILE * savefile_create( void );
+
+// closes the stream and starts writing it to path
+bool savefile_commit( FILE * fp, const char * path );
+
+// drops what was built, fp is NULL when a Save function already closed it
+void savefile_abort( FILE * fp );
+
+// waits for the save being written
+void savefile_flush( void );
+
+// limit 0 inflates the whole save, otherwise at most limit bytes of it
+FILE * savefile_open( const char * path, long limit );
+void savefile_close( FILE * fp );
+
+#endif // SAVEFILE_H
@@ -24,6 +24,7 @@
 #include "util.h"
 #include "timer.h"
 #include "oct2.h"
+#include "pool.h"
 
 #ifdef OPT_ON
 #pragma optimize( "gty", on )
@@ -69,7 +70,7 @@ extern	DWORD			CurrentTextureBlend;
 extern	SECONDARYWEAPONBULLET	SecBulls[MAXSECONDARYWEAPONBULLETS];
 extern	u_int16_t		FirstSecBullUsed;
 extern	int16_t			NumLevels;
-extern	MODEL		Models[ MAXNUMOFMODELS ];
+extern	MODEL		*	Models;
 extern	int				FontWidth;
 extern	int				FontHeight;
 extern	float			SoundInfo[MAXGROUPS][MAXGROUPS];
@@ -118,9 +119,10 @@ int		SinglePlayerTimeLimit = 0;
 u_int16_t	ThermoScrPoly = (u_int16_t) -1;
 u_int16_t	FlashScreenPoly	= (u_int16_t) -1;
 u_int32_t	TotalScrPolysInUse = 0;
-SCRPOLY	ScrPolys[ MAXNUMOFSCRPOLYS ];
+SCRPOLY	*	ScrPolys = NULL;
 u_int16_t	FirstScrPolyUsed;
 u_int16_t	FirstScrPolyFree;
+POOLSTATS	ScrPolyPool = { "ScrPolys", "ScrPolyBudget", MAXNUMOFSCRPOLYS, MAXNUMOFSCRPOLYSBUDGET, 0, 0, 0, 0, 0, 0 };
 float	Countdown_Float = 3000.0F;	// 30 Seconds
 float	ZValue;
 float	RHWValue;
@@ -219,6 +221,28 @@ void InitScrPoly( u_int16_t i )
 		
 }
 
+/*===================================================================
+	Procedure	:	Link a range of ScrPolys into the free list
+	Input		:	u_int32_t	First ScrPoly
+				:	u_int32_t	One past the last ScrPoly
+	Output		:	Nothing
+===================================================================*/
+static void LinkFreeScrPolys( u_int32_t Start, u_int32_t End )
+{
+	u_int32_t	i;
+
+	for( i = Start; i < End; i++ )
+	{
+		ScrPolys[i].Next = (u_int16_t) ( i + 1 );
+		ScrPolys[i].Prev = (u_int16_t) -1;
+		InitScrPoly( (u_int16_t) i );
+	}
+
+	ScrPolys[ End-1 ].Next = (u_int16_t) -1;
+
+	FirstScrPolyFree = (u_int16_t) Start;
+}
+
 void InitScrPolys( void )
 {
 	u_int16_t	i;
@@ -229,17 +253,12 @@ void InitScrPolys( void )
 	for( i = 0; i < MAXMULTIPLES; i++ ) ScreenMultiples[ i ] = (u_int16_t) -1;
 	ClearCountdownBuffers();
 
+	PoolInit( &ScrPolyPool, (void **) &ScrPolys, sizeof( SCRPOLY ) );
+
 	FirstScrPolyUsed = (u_int16_t) -1;
-	FirstScrPolyFree = 0;
-	
-	for( i = 0; i < MAXNUMOFSCRPOLYS; i++ )
-	{
-		ScrPolys[i].Next = i + 1;
-		ScrPolys[i].Prev = (u_int16_t) -1;
-		InitScrPoly(i);
-	}
+	TotalScrPolysInUse = 0;
 
-	ScrPolys[ MAXNUMOFSCRPOLYS-1 ].Next = (u_int16_t) -1;
+	LinkFreeScrPolys( 0, ScrPolyPool.Linked );
 
 	InitScrPolyTPages();
 
@@ -248,16 +267,23 @@ void InitScrPolys( void )
 
 /*===================================================================
 	Procedure	:	Find a free ScrPoly and move it from the free
-				:	list to	the used list
+				:	list to	the used list, growing the pool if needed
 	Input		:	Nothing
 	Output		:	u_int16_t	Number of the free ScrPoly
 ===================================================================*/
 u_int16_t FindFreeScrPoly( void )
 {
 	u_int16_t i;
+	u_int32_t Start;
 
 	i = FirstScrPolyFree;
-	if( i == (u_int16_t) -1 ) return i;
+	if( i == (u_int16_t) -1 )
+	{
+		Start = ScrPolyPool.Linked;
+		if( PoolGrow( &ScrPolyPool ) == Start ) return i;
+		LinkFreeScrPolys( Start, ScrPolyPool.Linked );
+		i = FirstScrPolyFree;
+	}
  
 	ScrPolys[i].Prev = FirstScrPolyUsed;
 							 
@@ -270,6 +296,7 @@ u_int16_t FindFreeScrPoly( void )
 	FirstScrPolyFree = ScrPolys[i].Next;
 
 	TotalScrPolysInUse++;
+	PoolUsed( &ScrPolyPool, TotalScrPolysInUse );
 
 	return i ;
 }
@@ -2744,7 +2771,7 @@ bool ScrPolyDispNonSolid( RENDEROBJECT *renderObject, int16_t * TPage, u_int16_t
 			if( Count == *TPage ) i = *NextScrPoly;
 			else i = ScrPolyTPages[ Count ].FirstPoly;
 	
-			while( ( i != (u_int16_t) -1 ) && ( i < MAXNUMOFSCRPOLYS ) && ( StartVert < MAXSCREENPOLYVERTS ) )
+			while( ( i != (u_int16_t) -1 ) && ( i < ScrPolyPool.Linked ) && ( StartVert < MAXSCREENPOLYVERTS ) )
 			{
 				if( !( ScrPolys[ i ].Flags & SCRFLAG_Solid ) )
 				{
@@ -27,7 +27,8 @@
 /*===================================================================
 	Defines
 ===================================================================*/
-#define MAXNUMOFSCRPOLYS	1000
+#define MAXNUMOFSCRPOLYS	1000	// linked in at level start
+#define MAXNUMOFSCRPOLYSBUDGET	4000	// most the pool grows to ( "ScrPolyBudget" config )
 #define	MAXSCREENPOLYVERTS	800
 #define	TIMERSTARTSCREENX	( 320.0F - 64.0F )
 #define	TIMERSTARTSCREENY	( 240.0F - 36.0F )
@@ -37,6 +37,8 @@
 #include "local.h"
 #include "util.h"
 #include "timer.h"
+#include "pool.h"
+#include "loscache.h"
 
 #define	SCATTER_TEST	0
 
@@ -78,9 +80,9 @@ extern	MLOADHEADER		Mloadheader;
 extern	MCLOADHEADER	MCloadheader;
 extern	MCLOADHEADER	MCloadheadert0;
 extern	XLIGHT			XLights[MAXXLIGHTS];
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
-extern	POLY			Polys[MAXPOLYS];
-extern	MODEL			Models[MAXNUMOFMODELS];
+extern	FMPOLY			*	FmPolys;
+extern	POLY			*	Polys;
+extern	MODEL			*	Models;
 extern	float			framelag;
 extern	BYTE			WhoIAm;
 extern	bool            bSoundEnabled;
@@ -123,7 +125,7 @@ extern	int16_t			NumPowerPods;
 extern	BYTE			GameStatus[MAX_PLAYERS];	// Game Status for every Ship...
 																	// this tells the drones what status the host thinks hes in..
 
-extern	SCRPOLY			ScrPolys[ MAXNUMOFSCRPOLYS ];
+extern	SCRPOLY			*	ScrPolys;
 extern	PRIMARYWEAPONATTRIB PrimaryWeaponAttribs[ TOTALPRIMARYWEAPONS ];
 extern	bool			TeamGame;
 extern	BYTE			TeamNumber[MAX_PLAYERS];
@@ -246,6 +248,8 @@ SECONDARYWEAPONBULLET	SecBulls[MAXSECONDARYWEAPONBULLETS];
 SHORTMINE	MinesCopy[ MAX_PLAYERS ][ MAXSECONDARYWEAPONBULLETS ];
 u_int16_t		FirstSecBullUsed;
 u_int16_t		FirstSecBullFree;
+u_int32_t		TotalSecBullsInUse = 0;
+POOLSTATS		SecBullPool = { "SecBulls", NULL, 0, 0, 0, 0, 0, 0, 0, 0 };
 float		SecondaryFireDelay = 0.0F;
 
 int16_t		SecondaryWeaponsGot[ MAXSECONDARYWEAPONS ];
@@ -858,6 +862,8 @@ void	InitSecBulls(void)
 
 	FirstSecBullUsed = (u_int16_t) -1;
 	FirstSecBullFree = 0;
+	TotalSecBullsInUse = 0;
+	PoolInitFixed( &SecBullPool, MAXSECONDARYWEAPONBULLETS );
 
 	SetupSecBullGroups();
 
@@ -915,7 +921,10 @@ u_int16_t	FindFreeSecBull(void)
 	i = FirstSecBullFree;
 	
 	if ( i == (u_int16_t) -1)
+	{
+		PoolDropped( &SecBullPool );
 		return i;
+	}
 
 	if( SecBulls[i].Used )
 	{
@@ -932,6 +941,10 @@ u_int16_t	FindFreeSecBull(void)
 	FirstSecBullUsed = i;
 	FirstSecBullFree = SecBulls[i].Next;
 	SecBulls[i].Used = true;
+
+	TotalSecBullsInUse++;
+	PoolUsed( &SecBullPool, TotalSecBullsInUse );
+
 	return i ;
 }
 
@@ -970,6 +983,7 @@ void	KillUsedSecBull( u_int16_t i )
 	FirstSecBullFree	= i;
 	SecBulls[i].Used = false;
 
+	if( TotalSecBullsInUse ) TotalSecBullsInUse--;
 }
 
 /*===================================================================
@@ -6454,8 +6468,7 @@ void HUDNames( void )
 					
 					if( Cos > 0.0F )
 					{
-						if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, &CurrentCamera.Pos, CurrentCamera.GroupImIn,
-										&DirVector, &Int_Point, &EndGroup, &Int_Normal, &TempVector, true, NULL )  || outside_map )
+						if( LOSCacheClearRay( &CurrentCamera.Pos, CurrentCamera.GroupImIn, &Ships[ Count ].Object.Pos ) || outside_map )
 						{
 							if( ValidGroupCollision( &Ships[ Count ].Object.Pos, Ships[ Count ].Object.Group, &Ships[ Count ].Object.Pos, &CurrentCamera.Pos, CurrentCamera.GroupImIn ) || outside_map )
 							{
@@ -6722,12 +6735,8 @@ u_int16_t TargetClosestShip( VECTOR * Pos, VECTOR * Dir, u_int16_t Group, u_int1
 	int16_t	Count;
 	float	Cos;
 	u_int16_t	ClosestShip = (u_int16_t) -1;
-	VECTOR	TempVector;
 	VECTOR	DirVector;
 	VECTOR	NormVector;
-	VECTOR	Int_Point;
-	NORMAL	Int_Normal;
-	u_int16_t	Int_Group;
 	BYTE	MyTeam = 0;
 	BYTE	ShipsTeam = 1;
 
@@ -6761,8 +6770,7 @@ u_int16_t TargetClosestShip( VECTOR * Pos, VECTOR * Dir, u_int16_t Group, u_int1
 				
 							if( ( Cos >= ViewConeCos ) && ( Cos > *ClosestCos ) )
 							{
-								if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, Pos, Group, &DirVector,
-												&Int_Point, &Int_Group, &Int_Normal, &TempVector, true, NULL ) )
+								if( LOSCacheClearRay( Pos, Group, &Ships[ Count ].Object.Pos ) )
 								{
 									*ClosestCos = Cos;
 									ClosestShip = Count;
@@ -6783,8 +6791,7 @@ u_int16_t TargetClosestShip( VECTOR * Pos, VECTOR * Dir, u_int16_t Group, u_int1
 			
 						if( ( Cos >= ViewConeCos ) && ( Cos > *ClosestCos ) )
 						{
-							if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, Pos, Group, &DirVector,
-											&Int_Point, &Int_Group, &Int_Normal, &TempVector, true, NULL ) )
+							if( LOSCacheClearRay( Pos, Group, &Ships[ Count ].Object.Pos ) )
 							{
 								*ClosestCos = Cos;
 								ClosestShip = Count;
@@ -6836,8 +6843,7 @@ bool StillGotTarget( VECTOR * Pos, VECTOR * Dir, u_int16_t Group, u_int16_t Targ
 				
 					if( Cos >= ViewConeCos )
 					{
-						if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, Pos, Group, &DirVector,
-										&Int_Point, &Int_Group, &Int_Normal, &TempVector, true, NULL ) )
+						if( LOSCacheClearRay( Pos, Group, &Ships[ Target ].Object.Pos ) )
 						{
 							return( true );
 						}
@@ -6890,8 +6896,7 @@ bool StillGotTarget( VECTOR * Pos, VECTOR * Dir, u_int16_t Group, u_int16_t Targ
 				
 				if( Cos >= ViewConeCos )
 				{
-					if( !BackgroundCollide( &MCloadheadert0, &Mloadheader, Pos, Group, &DirVector,
-									&Int_Point, &Int_Group, &Int_Normal, &TempVector, true, NULL ) )
+					if( LOSCacheClearRay( Pos, Group, &SecBulls[ Target ].Pos ) )
 					{
 						return( true );
 					}
@@ -207,7 +207,7 @@ SFXNAME	Sfx_Filenames[MAX_SFX] =
 	//{ "chaosact", SFX_Looping, 0, -1 },  // chaos shield active loop
 	{ "cheer", 0, 0, -1 },  // crowd cheer, your side scores a goal (in teamplay)
 	//{ "collide", 0, 0, -1 },  // bike collides with another vehicle (when shields depleted) #1
-	{ "compsel", SFX_Title, 0, -1 },  // select click on selection stack ONLY
+	{ "compsel", SFX_Title | SFX_TitleRoom, 0, -1 },  // select click on selection stack ONLY
 	{ "compwrk", SFX_Looping | SFX_Title | SFX_InGame, 0, -1 },  // screen ambience for green side VDU screen
 	{ "cryspkup", 0, 0, -1 },  // pickup crystal
 	//{ "dbhitwat", 0, 0, -1 },  // enemy /hull debris hits water surface
@@ -245,7 +245,7 @@ SFXNAME	Sfx_Filenames[MAX_SFX] =
 	//{ "gravghit", 0, 0, -1 },  // gravgon misile impacts/detonates anywhere
 	//{ "gravgln", 0, 0, -1 },  // gravgon missile launch
 	{ "guts", 0, 0, -1 },  // guts impact #1
-	{ "holochng", SFX_Title, 0, -1 },  // biker holograph changes on VDU select screen
+	{ "holochng", SFX_Title | SFX_TitleRoom, 0, -1 },  // biker holograph changes on VDU select screen
 	{ "hullbump", 0, 0, -1 },  // bike (with shields depleted)bumps wall(only at high velocity)
 	//{ "hullhit", 0, 0, -1 },  // generic biker/enemy hull damage (shields depleted) #1
 	//{ "hullscrp", 0, 0, -1 },  // bike scrapes walls/ceiling (shields depleted)
@@ -261,7 +261,7 @@ SFXNAME	Sfx_Filenames[MAX_SFX] =
 	{ "minelay", 0, 0, -1 },  // drop any other mine apart from quantum and pine
 	//{ "misltrav", SFX_Looping, 0, -1 },  // missile travelling loop. -25% pitch for titan, +25% for MFRL
 	{ "mnacthum", SFX_Looping, 0, -1 },  // any mine (except quantum) active
-	{ "movesel", SFX_Title, 0, -1 },  // move cursor on selection stack ONLY
+	{ "movesel", SFX_Title | SFX_TitleRoom, 0, -1 },  // move cursor on selection stack ONLY
 	{ "mslaun2", 0, 0, -1 },  // launch mug/solaris missile
 	{ "mslhitwl", 0, 0, -1 },  // missile (except gravgon and titan) hit wall/environment
 	{ "mslhitwt", 0, 0, -1 },  // missile (except gravgon and titan) hit water
@@ -291,11 +291,11 @@ SFXNAME	Sfx_Filenames[MAX_SFX] =
 	{ "secret", SFX_Title | SFX_InGame, 0, -1 },  // secret area found
 	{ "select", SFX_Title, 0, -1 },  // positive select beep for green screens
 	{ "shieldht", 0, 0, -1 },  // shield hit (new one, with more of a punch to it)
-	{ "shipamb", SFX_Looping | SFX_Title, 0, -1 },  // ambience for menu select room on front end
+	{ "shipamb", SFX_Looping | SFX_Title | SFX_TitleRoom, 0, -1 },  // ambience for menu select room on front end
 	{ "shldknck", 0, 0, -1 },  // bike knocks against wall with shields on
 	{ "sonar", SFX_Looping, 0, -1 },  // sonar ping loop for big geek. If you have time, vary pitch according to his depth/distance from you? (maybe I'm asking too much)
-	{ "stakdown", SFX_Title, 0, -1 },  // selection stack comes down on menu screen
-	{ "stakmove", SFX_Title, 0, -1 },  // stack movement (now boosted and brightened)
+	{ "stakdown", SFX_Title | SFX_TitleRoom, 0, -1 },  // selection stack comes down on menu screen
+	{ "stakmove", SFX_Title | SFX_TitleRoom, 0, -1 },  // stack movement (now boosted and brightened)
 	{ "steammcn", SFX_Looping, 0, -1 },  // continuous steam loop - volume varies depending on use
 	{ "stmantof", 0, 0, -1 },  // stealth mantle off
 	{ "stmanton", 0, 0, -1 },  // stealth mantle on
@@ -533,6 +533,7 @@ extern USERCONFIG *player_config;
 extern float framelag;	
 extern LEVEL_LOOKUP LevelLookup[];
 extern LIST	BikeList;
+extern u_int8_t QuickStart;
 extern LIST BikeComputerList;
 
 /****************************************
@@ -1683,64 +1684,70 @@ void GetBikeCompVariants( void )
 	}
 }
 
-void PreProcessSfx( void )
+static void FindSfxFiles( int i )
 {
-	int i, j;
+	int j;
 	char filename[256];
 	char fullpath[256];
 
-	DebugPrintf("Detecting valid sound files.\n");
+	SndLookup[ i ].Num_Variants = 0; 
 
-	memset( SfxFullPath, 0, sizeof( SfxFullPath ) );
+	GetSfxFileNamePrefix( i, filename );
 
-	for ( i = 0; i < MAX_SFX; i++ )
-	{
-		if ( ( i >= SFX_LEVELSPEC_Start ) && !Sfx_Filenames[ i ].Name )
-			break;
-		
-		if ( ! SndLookup[ i ].Requested )
-			continue;
+	// if no filename given, sound is left marked with zero variants
+	if ( !filename[0] )
+		return;
 
-		SndLookup[ i ].Num_Variants = 0; 
+	// try filename with no num extension
+	GetFullSfxPath( fullpath, i, 1, 0 );
 
-		GetSfxFileNamePrefix( i, filename );
-	
-		// if no filename given, sound is left marked with zero variants
-		if ( !filename[0] )
-			continue;
+	if ( File_Exists ( fullpath ) )
+	{
+		SndLookup[ i ].Num_Variants++;
+		SfxFullPath[ i ][ 0 ] = (char *)malloc( strlen( fullpath ) + 1 );
+		strcpy( SfxFullPath[ i ][ 0 ], fullpath );
+		return;
+	}
 
-		// try filename with no num extension
-		GetFullSfxPath( fullpath, i, 1, 0 );
+	// try filename for variants
+	j = 0;
+	while( 1 )
+	{
+		if ( SndLookup[ i ].Num_Variants < 2 )
+			GetFullSfxPath( fullpath, i, j, 2 );
+		else
+			GetFullSfxPath( fullpath, i, j, SndLookup[ i ].Num_Variants );
 
-		if ( File_Exists ( fullpath ) )
+		if ( File_Exists( fullpath ) )
 		{
-			SndLookup[ i ].Num_Variants++;
-			SfxFullPath[ i ][ 0 ] = (char *)malloc( strlen( fullpath ) + 1 );
-			strcpy( SfxFullPath[ i ][ 0 ], fullpath );
-			continue;
+			SndLookup[ i ].Num_Variants++; 
+
+			SfxFullPath[ i ][ j ] = (char *)malloc( strlen( fullpath ) + 1 );
+			strcpy( SfxFullPath[ i ][ j ], fullpath );
+			j++;
 		}
+		else
+			break;
+	}
+}
 
-		// try filename for variants
-		j = 0;
-		while( 1 )
-		{
-			if ( SndLookup[ i ].Num_Variants < 2 )
-				GetFullSfxPath( fullpath, i, j, 2 );
-			else
-				GetFullSfxPath( fullpath, i, j, SndLookup[ i ].Num_Variants );
+void PreProcessSfx( void )
+{
+	int i;
 
-			if ( File_Exists( fullpath ) )
-			{
-				SndLookup[ i ].Num_Variants++; 
+	DebugPrintf("Detecting valid sound files.\n");
 
-				SfxFullPath[ i ][ j ] = (char *)malloc( strlen( fullpath ) + 1 );
-				strcpy( SfxFullPath[ i ][ j ], fullpath );
-				j++;
-			}
-			else
-				break;
-		}
+	memset( SfxFullPath, 0, sizeof( SfxFullPath ) );
 
+	for ( i = 0; i < MAX_SFX; i++ )
+	{
+		if ( ( i >= SFX_LEVELSPEC_Start ) && !Sfx_Filenames[ i ].Name )
+			break;
+		
+		if ( ! SndLookup[ i ].Requested )
+			continue;
+
+		FindSfxFiles( i );
 	}
 
 	GetBikeVariants();
@@ -1768,8 +1775,34 @@ void RequestTitleSfx( void )
 {
 	u_int16_t i;
 	for ( i = 0; i < MAX_SFX; i++ )
+	{
+		// a quick host or join goes straight to the session screens,
+		// the title room's own sounds aren't wanted unless it fails
+		if( ( QuickStart == QUICKSTART_Start || QuickStart == QUICKSTART_Join ) &&
+			( Sfx_Filenames[ i ].Flags & SFX_TitleRoom ) )
+			continue;
 		if( Sfx_Filenames[ i ].Flags & SFX_Title )
 			RequestSfx( i );
+	}
+}
+
+// a quick host or join that ends up back on the title needs the
+// title room sounds RequestTitleSfx left out
+void RequestTitleRoomSfx( void )
+{
+	u_int16_t i;
+
+	if ( !bSoundEnabled )
+		return;
+
+	for ( i = 0; i < MAX_SFX; i++ )
+	{
+		if( ( Sfx_Filenames[ i ].Flags & SFX_TitleRoom ) && !SndLookup[ i ].Requested )
+		{
+			RequestSfx( i );
+			FindSfxFiles( i );
+		}
+	}
 }
 
 /****************************************
@@ -7,6 +7,7 @@
 #define SFX_Biker			4	// biker speech
 #define SFX_Title	64	// use when biker speech must play ( will cut off any existing speech )
 #define SFX_InGame	256	// sfx must be loaded in game, regardless of whether or not SFX_Title is set
+#define SFX_TitleRoom	1024	// only heard in the title room and on the selection stack, never on the session screens
 
 #define SPOT_SFX_TYPE_Normal 0
 #define SPOT_SFX_TYPE_NoPan 1
@@ -295,6 +296,7 @@ bool RestoreSfxData( u_int32_t id, VECTOR *pos, u_int16_t *group );
 void RequestSfx( int16_t sfxnum );
 void RequestMainSfx( void );
 void RequestTitleSfx( void );
+void RequestTitleRoomSfx( void );
 void PreInitSfx( void );
 void UpdateSfxForBiker( u_int16_t biker );
 void UpdateSfxForBikeComputer( u_int16_t bikecomp );
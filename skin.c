@@ -41,12 +41,13 @@ extern	bool		Inside;
 extern	float		CollisionRadius;
 extern	bool		ShowColZones;
 
-extern	MODEL		Models[MAXNUMOFMODELS];
+extern	MODEL		*	Models;
 extern	MATRIX		MATRIX_Identity;
 
 #define	BOXSIZE		96.0F
 #define	NODECUBE_Branch	false
 #define	NODECUBE_Array	true
+#define	MAXSPHEREZONES	MAXNUMOFMODELS	// debug zone models shown at once, the Model pool can grow past this
 
 /*===================================================================
 	Globals variables and structures
@@ -80,7 +81,7 @@ extern	MATRIX		MATRIX_Identity;
 	u_int16_t					NodeCubeLines[ MAXLINES ];
 
 	VECTOR					TempVerts[ 64 ];
-	u_int16_t					SphereZones[ MAXNUMOFMODELS ];
+	u_int16_t					SphereZones[ MAXSPHEREZONES ];
 	int16_t					NumSphereZones = 0;
 
 
@@ -649,6 +650,8 @@ void DisplaySphereZone( VECTOR * Pos, float Radius, u_int16_t Group,
 	float	Scale;
 	u_int16_t	Model;
 
+	if( NumSphereZones >= MAXSPHEREZONES ) return;
+
 	Model =	FindFreeModel();
 
 	if( Model != (u_int16_t ) -1 )
@@ -695,6 +698,8 @@ void DisplayZoneDirection( VECTOR * Pos, VECTOR * Dir, u_int16_t Group )
 	TempDir.y = -Dir->y;
 	TempDir.z = -Dir->z;
 
+	if( NumSphereZones >= MAXSPHEREZONES ) return;
+
 	Model =	FindFreeModel();
 
 	if( Model != (u_int16_t ) -1 )
@@ -738,6 +743,8 @@ void DisplayDirAndUp( VECTOR * Pos, VECTOR * Dir, VECTOR *Up, u_int16_t Group )
 	TempDir.y = -Dir->y;
 	TempDir.z = -Dir->z;
 
+	if( NumSphereZones >= MAXSPHEREZONES ) return;
+
 	Model =	FindFreeModel();
 
 	if( Model != (u_int16_t ) -1 )
@@ -0,0 +1,529 @@
+/*===================================================================
+*	s n a p s h o t . c
+*	In memory snapshot and restore of the world...
+===================================================================*/
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SDL.h>
+#include "new3d.h"
+#include "quat.h"
+#include "compobjects.h"
+#include "bgobjects.h"
+#include "object.h"
+#include "networking.h"
+#include "triggers.h"
+#include "pickups.h"
+#include "enemies.h"
+#include "mload.h"
+#include "ships.h"
+#include "2dpolys.h"
+#include "polys.h"
+#include "screenpolys.h"
+#include "primary.h"
+#include "secondary.h"
+#include "spotfx.h"
+#include "lights.h"
+#include "models.h"
+#include "pool.h"
+#include "trigarea.h"
+#include "extforce.h"
+#include "teleport.h"
+#include "rtlight.h"
+#include "restart.h"
+#include "text.h"
+#include "util.h"
+#include "snapshot.h"
+
+/*===================================================================
+	External Variables
+===================================================================*/
+extern	int16_t			LevelNum;
+extern	float			LevelTimeTaken;
+extern	u_int16_t		Seed1;
+extern	u_int16_t		Seed2;
+extern	int				SystemMessageColour;
+
+extern	PRIMARYWEAPONBULLET	PrimBulls[ MAXPRIMARYWEAPONBULLETS ];
+extern	u_int16_t		PrimBullType[ MAXPRIMARYWEAPONBULLETS ];
+extern	float			PrimBullLifeCount[ MAXPRIMARYWEAPONBULLETS ];
+extern	float			PrimBullSpeed[ MAXPRIMARYWEAPONBULLETS ];
+extern	VECTOR			PrimBullPos[ MAXPRIMARYWEAPONBULLETS ];
+extern	VECTOR			PrimBullDir[ MAXPRIMARYWEAPONBULLETS ];
+extern	u_int16_t		PrimBullGroup[ MAXPRIMARYWEAPONBULLETS ];
+extern	u_int16_t		FirstPrimBullUsed;
+extern	u_int16_t		FirstPrimBullFree;
+extern	u_int32_t		TotalPrimBullsInUse;
+extern	u_int16_t		GlobalPrimBullsID;
+extern	int16_t			PrimaryWeaponsGot[ MAXPRIMARYWEAPONS ];
+extern	float			PyroliteAmmo;
+extern	float			SussGunAmmo;
+extern	float			GeneralAmmo;
+
+extern	SECONDARYWEAPONBULLET	SecBulls[ MAXSECONDARYWEAPONBULLETS ];
+extern	u_int16_t		FirstSecBullUsed;
+extern	u_int16_t		FirstSecBullFree;
+extern	u_int32_t		TotalSecBullsInUse;
+extern	int16_t			NumSecBullsPerGroup[ MAXGROUPS ];
+extern	SECONDARYWEAPONBULLET *	SecBullGroups[ MAXGROUPS ];
+extern	u_int16_t		GlobalSecBullsID;
+extern	ENTRY			EntryList[ MAX_ENTRYS ];
+extern	ENTRY		*	FirstFree;
+extern	ENTRY		*	FirstUsed;
+extern	int16_t			SecondaryWeaponsGot[ MAXSECONDARYWEAPONS ];
+extern	int16_t			SecondaryAmmo[ MAXSECONDARYWEAPONS ];
+
+extern	PICKUP			Pickups[ MAXPICKUPS ];
+extern	PICKUP		*	PickupGroups[ MAXGROUPS ];
+extern	int16_t			NumPickupsPerGroup[ MAXGROUPS ];
+extern	int16_t			NumPickupType[ MAXPICKUPTYPES ];
+extern	u_int16_t		FirstPickupUsed;
+extern	u_int16_t		FirstPickupFree;
+extern	u_int32_t		TotalPickupsInUse;
+extern	REGENPOINT	*	RegenPoints;
+extern	int16_t			NumRegenPoints;
+
+extern	ENEMY			Enemies[ MAXENEMIES ];
+extern	ENEMY		*	EnemyGroups[ MAXGROUPS ];
+extern	u_int16_t		NumEnemiesPerGroup[ MAXGROUPS ];
+extern	ENEMY		*	FirstEnemyUsed;
+extern	ENEMY		*	FirstEnemyFree;
+extern	int16_t			NumKilledEnemies;
+extern	int				EnemiesActive;
+extern	float			FleshMorphTimer;
+
+extern	BGOBJECT		BGObjects[ MAXBGOBJECTS ];
+extern	BGOBJECT	*	FirstBGObjectUsed;
+extern	BGOBJECT	*	FirstBGObjectFree;
+
+extern	SPOTFX			SpotFX[ MAXSPOTFX ];
+extern	SPOTFX		*	SpotFXGroups[ MAXGROUPS ];
+extern	u_int16_t		NumSpotFXPerGroup[ MAXGROUPS ];
+extern	SPOTFX		*	FirstSpotFXUsed;
+extern	SPOTFX		*	FirstSpotFXFree;
+
+extern	TRIGGERVAR	*	TrigVars;
+extern	int				NumOfTrigVars;
+extern	TRIGGER		*	Triggers;
+extern	int				NumOfTriggers;
+extern	TRIGGERMODQUE *	TrigModQue;
+extern	int				NumOfTrigModQues;
+extern	CONDITION	*	Conditions;
+extern	int				NumOfConditions;
+extern	CONDITION	**	ActiveConditions;
+extern	int				NumOfActiveConditions;
+
+extern	TRIGGER_AREA *	Zones;
+extern	u_int16_t		NumZones;
+extern	TRIGGER_AREA *	GroupTriggerArea_player[ MAXGROUPS ];
+extern	TRIGGER_AREA *	GroupTriggerArea_player_shoots[ MAXGROUPS ];
+extern	TRIGGER_AREA *	GroupTriggerArea_enemy[ MAXGROUPS ];
+extern	TRIGGER_AREA *	GroupTriggerArea_enemy_shoots[ MAXGROUPS ];
+extern	EXTERNALFORCE *	ExternalForces;
+extern	int32_t			NumOfExternalForces;
+extern	EXTERNALFORCE *	ExternalForcesGroupLink[ MAXGROUPS ];
+extern	TELEPORT	*	Teleports;
+extern	int16_t			NumOfTeleports;
+extern	TELEPORT	*	TeleportsGroupLink[ MAXGROUPS ];
+extern	RT_LIGHT	*	rt_light;
+extern	u_int16_t		rt_lights;
+extern	RESTART			RestartPoints[ MAXRESTARTPOINTS ];
+extern	RESTART		*	RestartPointGroups[ MAXGROUPS ];
+extern	int16_t			NumRestartPointsPerGroup[ MAXGROUPS ];
+extern	RESTART		*	FirstRestartUsed;
+extern	RESTART		*	FirstRestartFree;
+extern	u_int16_t		last_start_position;
+
+extern	XLIGHT			XLights[ MAXXLIGHTS ];
+extern	u_int16_t		FirstXLightUsed;
+extern	u_int16_t		FirstXLightFree;
+
+extern	MODEL		*	Models;
+extern	u_int16_t		FirstModelUsed;
+extern	u_int16_t		FirstModelFree;
+extern	u_int32_t		TotalModelsInUse;
+
+extern	POLY		*	Polys;
+extern	u_int16_t		FirstPolyUsed;
+extern	u_int16_t		FirstPolyFree;
+extern	u_int32_t		TotalPolysInUse;
+
+extern	FMPOLY		*	FmPolys;
+extern	u_int16_t		FirstFmPolyUsed;
+extern	u_int16_t		FirstFmPolyFree;
+extern	u_int32_t		TotalFmPolysInUse;
+
+extern	SCRPOLY		*	ScrPolys;
+extern	u_int16_t		FirstScrPolyUsed;
+extern	u_int16_t		FirstScrPolyFree;
+extern	u_int32_t		TotalScrPolysInUse;
+
+extern	POOLSTATS		PrimBullPool;
+extern	POOLSTATS		SecBullPool;
+extern	POOLSTATS		PickupPool;
+extern	POOLSTATS		ModelPool;
+extern	POOLSTATS		PolyPool;
+extern	POOLSTATS		FmPolyPool;
+extern	POOLSTATS		ScrPolyPool;
+
+/*===================================================================
+	Defines
+===================================================================*/
+#define	REGION( Var )					AddRegion( Regions, &Num, #Var, &( Var ), sizeof( Var ) )
+#define	REGION_ARRAY( Array, Count )	AddRegion( Regions, &Num, #Array, ( Array ), ( Array ) ? (size_t) ( Count ) * sizeof( *( Array ) ) : 0 )
+#define	REGION_POOL( Array, Pool )		REGION_ARRAY( Array, Budget ? ( Pool ).Allocated : ( Pool ).Linked ); REGION( ( Pool ).Linked )
+
+/*===================================================================
+	Procedure	:	Add a block of memory to a region table
+	Input		:	SNAPREGION	*	Regions
+				:	int			*	Number of regions so far
+				:	const char	*	Name
+				:	void		*	Address
+				:	size_t			Size
+	Output		:	Nothing
+===================================================================*/
+static void AddRegion( SNAPREGION * Regions, int * Num, const char * Name, void * Address, size_t Size )
+{
+	if( *Num >= MAXSNAPREGIONS )
+	{
+		DebugPrintf( "snapshot: too many regions, %s is left out\n", Name );
+		return;
+	}
+
+	Regions[ *Num ].Name = Name;
+	Regions[ *Num ].Address = Address;
+	Regions[ *Num ].Size = Size;
+	( *Num )++;
+}
+
+/*===================================================================
+	Procedure	:	Fill in where the world state lives right now
+				:	Heap arrays and pool sizes change from level
+				:	to level so this is redone for every snapshot.
+	Input		:	SNAPREGION	*	Regions
+				:	bool			true for the most every pool
+				:					could grow to this level
+	Output		:	int				Number of regions
+===================================================================*/
+static int GetRegions( SNAPREGION * Regions, bool Budget )
+{
+	int	Num = 0;
+
+	REGION( LevelTimeTaken );
+	REGION( Seed1 );
+	REGION( Seed2 );
+
+	REGION( Ships );
+
+	REGION( PrimBulls );
+	REGION( PrimBullType );
+	REGION( PrimBullLifeCount );
+	REGION( PrimBullSpeed );
+	REGION( PrimBullPos );
+	REGION( PrimBullDir );
+	REGION( PrimBullGroup );
+	REGION( FirstPrimBullUsed );
+	REGION( FirstPrimBullFree );
+	REGION( TotalPrimBullsInUse );
+	REGION( GlobalPrimBullsID );
+	REGION( PrimaryWeaponsGot );
+	REGION( PyroliteAmmo );
+	REGION( SussGunAmmo );
+	REGION( GeneralAmmo );
+
+	REGION( SecBulls );
+	REGION( FirstSecBullUsed );
+	REGION( FirstSecBullFree );
+	REGION( TotalSecBullsInUse );
+	REGION( NumSecBullsPerGroup );
+	REGION( SecBullGroups );
+	REGION( GlobalSecBullsID );
+	REGION( EntryList );
+	REGION( FirstFree );
+	REGION( FirstUsed );
+	REGION( SecondaryWeaponsGot );
+	REGION( SecondaryAmmo );
+
+	REGION( Pickups );
+	REGION( PickupGroups );
+	REGION( NumPickupsPerGroup );
+	REGION( NumPickupType );
+	REGION( FirstPickupUsed );
+	REGION( FirstPickupFree );
+	REGION( TotalPickupsInUse );
+	REGION_ARRAY( RegenPoints, NumRegenPoints );
+
+	REGION( Enemies );
+	REGION( EnemyGroups );
+	REGION( NumEnemiesPerGroup );
+	REGION( FirstEnemyUsed );
+	REGION( FirstEnemyFree );
+	REGION( NumKilledEnemies );
+	REGION( EnemiesActive );
+	REGION( FleshMorphTimer );
+
+	REGION( BGObjects );
+	REGION( FirstBGObjectUsed );
+	REGION( FirstBGObjectFree );
+
+	REGION( SpotFX );
+	REGION( SpotFXGroups );
+	REGION( NumSpotFXPerGroup );
+	REGION( FirstSpotFXUsed );
+	REGION( FirstSpotFXFree );
+
+	REGION_ARRAY( TrigVars, NumOfTrigVars );
+	REGION_ARRAY( Triggers, NumOfTriggers );
+	REGION_ARRAY( TrigModQue, NumOfTrigModQues );
+	REGION_ARRAY( Conditions, NumOfConditions );
+	REGION_ARRAY( ActiveConditions, NumOfConditions );
+	REGION( NumOfActiveConditions );
+
+	REGION_ARRAY( Zones, NumZones );
+	REGION( GroupTriggerArea_player );
+	REGION( GroupTriggerArea_player_shoots );
+	REGION( GroupTriggerArea_enemy );
+	REGION( GroupTriggerArea_enemy_shoots );
+
+	REGION_ARRAY( ExternalForces, NumOfExternalForces );
+	REGION( ExternalForcesGroupLink );
+
+	REGION_ARRAY( Teleports, NumOfTeleports );
+	REGION( TeleportsGroupLink );
+
+	REGION_ARRAY( rt_light, rt_lights );
+
+	REGION( RestartPoints );
+	REGION( RestartPointGroups );
+	REGION( NumRestartPointsPerGroup );
+	REGION( FirstRestartUsed );
+	REGION( FirstRestartFree );
+	REGION( last_start_position );
+
+	REGION( XLights );
+	REGION( FirstXLightUsed );
+	REGION( FirstXLightFree );
+
+	REGION_POOL( Models, ModelPool );
+	REGION( FirstModelUsed );
+	REGION( FirstModelFree );
+	REGION( TotalModelsInUse );
+
+	REGION_POOL( Polys, PolyPool );
+	REGION( FirstPolyUsed );
+	REGION( FirstPolyFree );
+	REGION( TotalPolysInUse );
+
+	REGION_POOL( FmPolys, FmPolyPool );
+	REGION( FirstFmPolyUsed );
+	REGION( FirstFmPolyFree );
+	REGION( TotalFmPolysInUse );
+
+	REGION_POOL( ScrPolys, ScrPolyPool );
+	REGION( FirstScrPolyUsed );
+	REGION( FirstScrPolyFree );
+	REGION( TotalScrPolysInUse );
+
+	return Num;
+}
+
+/*===================================================================
+	Procedure	:	Total size of a region table
+	Input		:	SNAPREGION	*	Regions
+				:	int				Number of regions
+	Output		:	size_t			Bytes
+===================================================================*/
+static size_t RegionsSize( SNAPREGION * Regions, int Num )
+{
+	size_t	Size = 0;
+	int		i;
+
+	for( i = 0; i < Num; i++ ) Size += Regions[ i ].Size;
+
+	return Size;
+}
+
+/*===================================================================
+	Procedure	:	Create a snapshot with an arena big enough
+				:	for the level as it is now
+	Input		:	Nothing
+	Output		:	SNAPSHOT	*	NULL if it couldn't be allocated
+===================================================================*/
+SNAPSHOT * SnapshotCreate( void )
+{
+	SNAPSHOT	*	Snapshot;
+	SNAPREGION		Regions[ MAXSNAPREGIONS ];
+
+	Snapshot = (SNAPSHOT *) calloc( 1, sizeof( SNAPSHOT ) );
+	if( !Snapshot ) return NULL;
+
+	Snapshot->Allocated = RegionsSize( Regions, GetRegions( Regions, true ) );
+	Snapshot->Arena = (char *) malloc( Snapshot->Allocated ? Snapshot->Allocated : 1 );
+	if( !Snapshot->Arena )
+	{
+		DebugPrintf( "snapshot: couldn't allocate %d bytes\n", (int) Snapshot->Allocated );
+		free( Snapshot );
+		return NULL;
+	}
+
+	Snapshot->Level = -1;
+
+	return Snapshot;
+}
+
+/*===================================================================
+	Procedure	:	Free a snapshot and its arena
+	Input		:	SNAPSHOT	*	Snapshot
+	Output		:	Nothing
+===================================================================*/
+void SnapshotFree( SNAPSHOT * Snapshot )
+{
+	if( !Snapshot ) return;
+
+	free( Snapshot->Arena );
+	free( Snapshot );
+}
+
+/*===================================================================
+	Procedure	:	Copy the world into a snapshot
+	Input		:	SNAPSHOT	*	Snapshot
+	Output		:	bool			false if it doesn't fit, the
+				:					snapshot is left empty
+===================================================================*/
+bool SnapshotTake( SNAPSHOT * Snapshot )
+{
+	SNAPREGION	*	Region;
+	char		*	Pos;
+	size_t			Size;
+	int				Num;
+	int				i;
+
+	Num = GetRegions( Snapshot->Regions, false );
+	Size = RegionsSize( Snapshot->Regions, Num );
+
+	if( Size > Snapshot->Allocated )
+	{
+		DebugPrintf( "snapshot: world is %d bytes, the arena only has room for %d\n",
+			(int) Size, (int) Snapshot->Allocated );
+		Snapshot->NumRegions = 0;
+		Snapshot->Level = -1;
+		return false;
+	}
+
+	Pos = Snapshot->Arena;
+	Region = Snapshot->Regions;
+	for( i = 0; i < Num; i++, Region++ )
+	{
+		memcpy( Pos, Region->Address, Region->Size );
+		Pos += Region->Size;
+	}
+
+	Snapshot->NumRegions = Num;
+	Snapshot->Used = Size;
+	Snapshot->Level = LevelNum;
+
+	return true;
+}
+
+/*===================================================================
+	Procedure	:	Put the world back the way it was when the
+				:	snapshot was taken
+				:	Everything has to still be where it was, so
+				:	nothing changes unless the whole snapshot fits.
+	Input		:	SNAPSHOT	*	Snapshot
+	Output		:	bool			false if it isn't from this level
+===================================================================*/
+bool SnapshotRestore( SNAPSHOT * Snapshot )
+{
+	SNAPREGION		Regions[ MAXSNAPREGIONS ];
+	SNAPREGION	*	Region;
+	char		*	Pos;
+	int				Num;
+	int				i;
+
+	if( Snapshot->Level == -1 || Snapshot->Level != LevelNum ) return false;
+
+	Num = GetRegions( Regions, true );
+	if( Num != Snapshot->NumRegions ) return false;
+
+	Region = Snapshot->Regions;
+	for( i = 0; i < Num; i++, Region++ )
+	{
+		if( ( Region->Address != Regions[ i ].Address ) || ( Region->Size > Regions[ i ].Size ) )
+		{
+			DebugPrintf( "snapshot: %s has moved since the snapshot was taken\n", Region->Name );
+			return false;
+		}
+	}
+
+	Pos = Snapshot->Arena;
+	Region = Snapshot->Regions;
+	for( i = 0; i < Num; i++, Region++ )
+	{
+		memcpy( Region->Address, Pos, Region->Size );
+		Pos += Region->Size;
+	}
+
+	return true;
+}
+
+/*===================================================================
+	Procedure	:	Seconds from a fixed point, as finely as the
+				:	platform allows
+	Input		:	Nothing
+	Output		:	double
+===================================================================*/
+static double SnapshotClock( void )
+{
+#if SDL_VERSION_ATLEAST(2,0,0)
+	return (double) SDL_GetPerformanceCounter() / (double) SDL_GetPerformanceFrequency();
+#else
+	return (double) SDL_GetTicks() / 1000.0;
+#endif
+}
+
+/*===================================================================
+	Procedure	:	Time taking and restoring snapshots of the
+				:	level as it is now
+	Input		:	int				Number of each to time
+	Output		:	Nothing
+===================================================================*/
+void SnapshotBenchmark( int Runs )
+{
+	SNAPSHOT	*	Snapshot;
+	double			Start;
+	double			TakeTime;
+	double			RestoreTime;
+	bool			Ok = true;
+	int				i;
+
+	if( Runs < 1 ) Runs = 1;
+
+	Snapshot = SnapshotCreate();
+	if( !Snapshot )
+	{
+		AddColourMessageToQue( SystemMessageColour, "SNAPSHOT BENCHMARK COULDN'T ALLOCATE" );
+		return;
+	}
+
+	Start = SnapshotClock();
+	for( i = 0; i < Runs; i++ ) Ok &= SnapshotTake( Snapshot );
+	TakeTime = ( SnapshotClock() - Start ) * 1000.0 / Runs;
+
+	Start = SnapshotClock();
+	for( i = 0; i < Runs; i++ ) Ok &= SnapshotRestore( Snapshot );
+	RestoreTime = ( SnapshotClock() - Start ) * 1000.0 / Runs;
+
+	DebugPrintf( "snapshot: %d regions, %d of %d bytes, take %.4f ms, restore %.4f ms over %d runs%s\n",
+		Snapshot->NumRegions, (int) Snapshot->Used, (int) Snapshot->Allocated,
+		TakeTime, RestoreTime, Runs, Ok ? "" : ", some failed" );
+	DebugPrintf( "snapshot: with %d primary, %d secondary, %d pickups, %d enemies, %d models, %d polys, %d fmpolys\n",
+		(int) TotalPrimBullsInUse, (int) TotalSecBullsInUse, (int) TotalPickupsInUse, EnemiesActive,
+		(int) TotalModelsInUse, (int) TotalPolysInUse, (int) TotalFmPolysInUse );
+
+	AddColourMessageToQue( SystemMessageColour, "SNAPSHOT %dK TAKE %.3f MS RESTORE %.3f MS%s",
+		(int) ( Snapshot->Used / 1024 ), TakeTime, RestoreTime, Ok ? "" : " FAILED" );
+
+	SnapshotFree( Snapshot );
+}
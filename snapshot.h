@@ -0,0 +1,67 @@
+/*==========================================================================
+ *  s n a p s h o t . h
+ *
+ *  In memory snapshots of the world for instant rollback.
+ *
+ *  A snapshot copies the simulation state ( ships, bullets, pickups,
+ *  enemies, bgobjects, triggers and their conditions, trigger areas,
+ *  external forces, teleports, real time lights, restart points,
+ *  spotfx, the polys, models and lights they own and the random
+ *  seeds ) into an arena allocated once when
+ *  the snapshot is created, and restoring copies it straight back.
+ *  Nothing is walked or rebuilt, the lists are restored as they were
+ *  because every array stays where it is for the whole level.
+ *
+ *  Growable pools only copy the elements linked in so far.  The arena
+ *  is sized for every pool's whole budget so taking a snapshot never
+ *  allocates.
+ *
+ *  A snapshot only restores on the level it was taken on.  Sound,
+ *  texture animation, cameras and rand() are not part of it.
+ ***************************************************************************/
+#ifndef SNAPSHOT_INCLUDED
+#define SNAPSHOT_INCLUDED
+
+/*===================================================================
+	Includes
+===================================================================*/
+#include "main.h"
+
+/*===================================================================
+	Defines
+===================================================================*/
+#define	MAXSNAPREGIONS				128
+#define	SNAPSHOT_BENCHMARK_RUNS		1000
+
+/*===================================================================
+	Structures
+===================================================================*/
+typedef struct SNAPREGION {
+
+	const char	*	Name;
+	void		*	Address;
+	size_t			Size;
+
+} SNAPREGION;
+
+typedef struct SNAPSHOT {
+
+	char		*	Arena;
+	size_t			Allocated;			// bytes the arena has room for
+	size_t			Used;				// bytes the last snapshot took
+	int16_t			Level;				// level it was taken on, -1 if none was taken
+	int				NumRegions;
+	SNAPREGION		Regions[ MAXSNAPREGIONS ];	// what was copied, in arena order
+
+} SNAPSHOT;
+
+/*===================================================================
+	Prototypes
+===================================================================*/
+SNAPSHOT * SnapshotCreate( void );
+void SnapshotFree( SNAPSHOT * Snapshot );
+bool SnapshotTake( SNAPSHOT * Snapshot );
+bool SnapshotRestore( SNAPSHOT * Snapshot );
+void SnapshotBenchmark( int Runs );
+
+#endif	// SNAPSHOT_INCLUDED
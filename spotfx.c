@@ -36,7 +36,7 @@
 ===================================================================*/
 extern	int16_t			LevelNum;
 extern	char			LevelNames[MAXLEVELS][128];
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
+extern	FMPOLY			*	FmPolys;
 extern	FRAME_INFO	*	NewTrail_Header;
 extern	FRAME_INFO	*	Bits_Header;
 extern	FRAME_INFO	*	Exp_Header;
@@ -54,7 +54,7 @@ extern	VECTOR			SlideUp;
 extern	VECTOR			SlideDown;
 extern	VECTOR			SlideLeft;
 extern	VECTOR			SlideRight;
-extern	MODEL			Models[MAXNUMOFMODELS];
+extern	MODEL			*	Models;
 extern	MATRIX			MATRIX_Identity;
 extern	u_int16_t			IsGroupVisible[MAXGROUPS];
 extern	u_int16_t			GlobalPrimBullsID;
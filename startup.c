@@ -0,0 +1,90 @@
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include "startup.h"
+#include "file.h"
+#include "util.h"
+
+#define MAX_STARTUP_MARKS	64
+
+typedef struct
+{
+	const char *	phase;
+	double			time;
+} startup_mark_t;
+
+static startup_mark_t marks[ MAX_STARTUP_MARKS ];
+static int num_marks = 0;
+static double start_time = -1.0;
+static bool done = false;
+
+// wall clock seconds, sdl isn't up for the first phases
+static double startup_clock( void )
+{
+#ifdef WIN32
+	return GetTickCount() / 1000.0;
+#else
+	struct timeval now;
+	gettimeofday( &now, NULL );
+	return now.tv_sec + now.tv_usec / 1000000.0;
+#endif
+}
+
+bool startup_running( void )
+{
+	return !done;
+}
+
+void startup_mark( const char * phase )
+{
+	double now;
+
+	if ( done )
+		return;
+
+	now = startup_clock();
+	if ( start_time < 0.0 )
+		start_time = now;
+
+	if ( num_marks >= MAX_STARTUP_MARKS )
+		return;
+
+	marks[ num_marks ].phase = phase;
+	marks[ num_marks ].time = now - start_time;
+	num_marks++;
+}
+
+void startup_done( void )
+{
+	char log[ MAX_STARTUP_MARKS * 64 + 128 ];
+	size_t length = 0;
+	double last = 0.0;
+	int i;
+
+	if ( done )
+		return;
+	done = true;
+
+	length += snprintf( log + length, sizeof( log ) - length,
+		"%-24s %10s %10s\n", "phase", "took ms", "at ms" );
+
+	for ( i = 0; i < num_marks && length < sizeof( log ); i++ )
+	{
+		length += snprintf( log + length, sizeof( log ) - length,
+			"%-24s %10.1f %10.1f\n", marks[ i ].phase,
+			( marks[ i ].time - last ) * 1000.0, marks[ i ].time * 1000.0 );
+		last = marks[ i ].time;
+	}
+
+	if ( length > sizeof( log ) - 1 )
+		length = sizeof( log ) - 1;
+
+	DebugPrintf( "startup timeline:\n%s", log );
+	Write_File( "Logs/startup.txt", log, (long) length );
+}
@@ -0,0 +1,22 @@
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include "main.h"
+
+//
+// Startup Timeline
+//
+// startup_mark notes that a phase of starting the game has finished.
+// Once the first frame is on screen startup_done logs every phase with
+// how long it took and when it finished, to the debug log and to
+// Logs/startup.txt.  Marks made after that are ignored so code shared
+// with later loads can mark its phases freely.
+//
+
+void startup_mark( const char * phase );
+void startup_done( void );
+
+// true until startup_done
+bool startup_running( void );
+
+#endif // STARTUP_H
@@ -168,6 +168,54 @@ void ResetIndividualStats(int Player)
 	// reset player's sequential kill counter
 	KillCounter[Player] = 0;
 }
+
+/*===================================================================
+  Procedure :   Copy out one player's statistics...
+  Input   :   player id, kills[MAX_PLAYERS], primary[MAXPRIMARYWEAPONS+1],
+          :   secondary[TOTALSECONDARYWEAPONS], bonus, kill counter
+  Output    :   nothing
+===================================================================*/
+/* Copy One Player's Statistics (demo keyframes) */
+void GetPlayerStats(int Player, int * Kills, int * Primary, int * Secondary, int * Bonus, int * KillCount)
+{
+	int z;
+
+	for(z = 0; z < MAX_PLAYERS; z++)
+		Kills[z] = KillStats[Player][z];
+
+	for(z = 0; z < MAXPRIMARYWEAPONS+1; z++)
+		Primary[z] = PrimaryStats[Player][z];
+
+	for(z= 0; z < TOTALSECONDARYWEAPONS; z++)
+		Secondary[z] = SecondaryStats[Player][z];
+
+	*Bonus = BonusStats[Player];
+	*KillCount = KillCounter[Player];
+}
+
+/*===================================================================
+  Procedure :   Put back one player's statistics...
+  Input   :   player id, kills[MAX_PLAYERS], primary[MAXPRIMARYWEAPONS+1],
+          :   secondary[TOTALSECONDARYWEAPONS], bonus, kill counter
+  Output    :   nothing
+===================================================================*/
+/* Restore One Player's Statistics (demo keyframes) */
+void SetPlayerStats(int Player, int * Kills, int * Primary, int * Secondary, int Bonus, int KillCount)
+{
+	int z;
+
+	for(z = 0; z < MAX_PLAYERS; z++)
+		KillStats[Player][z] = Kills[z];
+
+	for(z = 0; z < MAXPRIMARYWEAPONS+1; z++)
+		PrimaryStats[Player][z] = Primary[z];
+
+	for(z= 0; z < TOTALSECONDARYWEAPONS; z++)
+		SecondaryStats[Player][z] = Secondary[z];
+
+	BonusStats[Player] = Bonus;
+	KillCounter[Player] = KillCount;
+}
 /*===================================================================
   Procedure :   Update Kill Statistics...
   Input   :   killer id, victim id, weapon type, weapon used
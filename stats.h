@@ -16,6 +16,8 @@ void UpdateBonusStats(int Player, int Points);										// update the bonus stat
 void UpdateKillCount(int Killer);															// updates player's kill counter for this life
 void ResetAllStats();																			// Resets all statistics
 void ResetIndividualStats(int Player);													// Resets one player's statistics
+void GetPlayerStats(int Player, int * Kills, int * Primary, int * Secondary, int * Bonus, int * KillCount);	// Copy one player's statistics
+void SetPlayerStats(int Player, int * Kills, int * Primary, int * Secondary, int Bonus, int KillCount);		// Put back one player's statistics
 void ScoreSort();																				// Sorts player's score from highest to lowest
 void InitScoreSortTab(int Player);														// Initiate Score Sort Tab player IDs
 int GetTotalKills(int Killer);																	// Get total number of kills (not including suicides)
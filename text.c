@@ -901,13 +901,13 @@ bool ReadTxtFile( char *Filename )
 	Buffer = calloc( File_Size+1 , 1 );
 	if( !Buffer )
 	{
-		Msg( "ReadTxtFile : Unable to allocate file buffer\n", Filename );
+		DebugPrintf( "ReadTxtFile : Unable to allocate file buffer\n", Filename );
 		return( false );
 	}
 	Read_Size = Read_File( Filename, Buffer, File_Size );
 	if( Read_Size != File_Size )
 	{
-		Msg( "ReadTxtFile Load Error reading %s\n", Filename );
+		DebugPrintf( "ReadTxtFile Load Error reading %s\n", Filename );
 		return( false );
 	}
 	TextMessages = Buffer;
@@ -1175,13 +1175,13 @@ bool ReadMsgFile( char *Filename )
 	Buffer = calloc( File_Size+1 , 1 );
 	if( !Buffer )
 	{
-		Msg( "ReadMsgFile : Unable to allocate file buffer\n", Filename );
+		DebugPrintf( "ReadMsgFile : Unable to allocate file buffer\n", Filename );
 		return( false );
 	}
 	Read_Size = Read_File( Filename, Buffer, File_Size );
 	if( Read_Size != File_Size )
 	{
-		Msg( "ReadMsgFile Load Error reading %s\n", Filename );
+		DebugPrintf( "ReadMsgFile Load Error reading %s\n", Filename );
 		return( false );
 	}
 	OrgBuffer = Buffer;
@@ -1192,7 +1192,7 @@ bool ReadMsgFile( char *Filename )
 
 	if( ( MagicNumber != MAGIC_NUMBER ) || ( VersionNumber != MSG_VERSION_NUMBER  ) )
 	{
-		Msg( "ReadMsgFile() Incompatible msg file %s", Filename );
+		DebugPrintf( "ReadMsgFile() Incompatible msg file %s\n", Filename );
 		free( OrgBuffer );
 		return( false );
 	}
@@ -1200,7 +1200,7 @@ bool ReadMsgFile( char *Filename )
 	int16Pnt = (int16_t*) u_int32Pnt;
 	if( *int16Pnt++ != NumOfTextMessages )
 	{
-		Msg( "ReadMsgFile : .Msg not compatible with .Txt\n" );
+		DebugPrintf( "ReadMsgFile : .Msg not compatible with .Txt\n" );
 		return( false );
 	}
 #ifdef DEBUG_TEXT_MESSAGES
@@ -1210,7 +1210,7 @@ bool ReadMsgFile( char *Filename )
 #endif
 	if( !TextMsgInfo )
 	{
-		Msg( "ReadMsgFile : Unable to allocate memory buffer\n", Filename );
+		DebugPrintf( "ReadMsgFile : Unable to allocate memory buffer\n", Filename );
 		return( false );
 	}
 	Tmi = TextMsgInfo;
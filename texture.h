@@ -11,7 +11,16 @@ typedef struct {
 	char * data;	// image data (bytes)
 } texture_image_t;
 
+// a mip level below an image, or a level read back from the card
+typedef struct {
+	int w;
+	int h;
+	int size;		// bytes
+	char * data;	// rgba unless it was compressed
+} texture_mip_t;
+
 int load_image( texture_image_t * image, int mipmap ); //, float gamma );
+int load_image_info( texture_image_t * image ); // only w, h and colorkey
 void destroy_image( texture_image_t * image );
 
 #endif
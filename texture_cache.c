@@ -0,0 +1,243 @@
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "texture_cache.h"
+#include "file.h"
+#include "util.h"
+
+bool texture_cache_rebuild = false;
+
+static int32_t cache_gamma = 1000;	// gamma * 1000
+
+typedef struct
+{
+	char			magic[4];
+	u_int32_t		version;
+	int32_t			source_size;
+	struct filetime	source_time;
+	int32_t			gamma;
+	int32_t			w;
+	int32_t			h;
+	int32_t			colorkey;
+	u_int32_t		format;
+	int32_t			levels;		// including the image itself
+} texture_cache_header_t;
+
+typedef struct
+{
+	int32_t w;
+	int32_t h;
+	int32_t size;
+} texture_cache_level_t;
+
+static const char cache_magic[4] = { 'P', 'X', 'T', 'C' };
+
+void texture_cache_init( void )
+{
+	folder_exists( TEXTURE_CACHE_FOLDER );
+}
+
+void texture_cache_set_gamma( double gamma )
+{
+	cache_gamma = (int32_t)( gamma * 1000.0 + 0.5 );
+}
+
+int32_t texture_cache_gamma( void )
+{
+	return cache_gamma;
+}
+
+// data\textures\foo.png -> TextureCache\data_textures_foo.png.ptc
+
+static void cache_name( const char * path, char * name, size_t size )
+{
+	char flat[ 256 ];
+	size_t i;
+
+	for ( i = 0; path[i] && i < sizeof(flat) - 1; i++ )
+	{
+		if ( path[i] == '\\' || path[i] == '/' || path[i] == ':' )
+			flat[i] = '_';
+		else
+			flat[i] = (char) tolower( (unsigned char) path[i] );
+	}
+	flat[i] = 0;
+
+	snprintf( name, size, "%s\\%s%s", TEXTURE_CACHE_FOLDER, flat, TEXTURE_CACHE_EXTENSION );
+}
+
+static bool source_stamp( const char * path, texture_cache_header_t * header )
+{
+	memset( &header->source_time, 0, sizeof(header->source_time) );
+	if ( !file_time( path, &header->source_time ) )
+		return false;
+	header->source_size = (int32_t) Get_File_Size( (char *) path );
+	return header->source_size > 0;
+}
+
+static bool read_level( FILE * fp, texture_cache_level_t * level, char ** data )
+{
+	int w, h;
+
+	*data = NULL;
+	if ( fread( level, sizeof(*level), 1, fp ) != 1 )
+		return false;
+	if ( level->w <= 0 || level->h <= 0 || level->w > 16384 || level->h > 16384 )
+		return false;
+
+	// compressed levels round up to 4x4 blocks
+	w = level->w < 4 ? 4 : level->w;
+	h = level->h < 4 ? 4 : level->h;
+	if ( level->size <= 0 || level->size > w * h * 4 )
+		return false;
+	*data = malloc( level->size );
+	if ( !*data )
+		return false;
+	if ( fread( *data, level->size, 1, fp ) != 1 )
+	{
+		free( *data );
+		*data = NULL;
+		return false;
+	}
+	return true;
+}
+
+bool texture_cache_read( const char * path, u_int32_t format, int32_t gamma, texture_image_t * image, texture_mip_t * mips, int max_mips, int * num_mips )
+{
+	texture_cache_header_t stamp, header;
+	texture_cache_level_t level;
+	char name[ 256 ];
+	char * data;
+	FILE * fp;
+	int i;
+
+	*num_mips = 0;
+
+	if ( texture_cache_rebuild )
+		return false;
+
+	cache_name( path, name, sizeof(name) );
+	fp = file_open( name, "rb" );
+	if ( !fp )
+		return false;
+
+	if ( fread( &header, sizeof(header), 1, fp ) != 1 ||
+		 memcmp( header.magic, cache_magic, sizeof(cache_magic) ) ||
+		 header.version != TEXTURE_CACHE_VERSION ||
+		 header.gamma != gamma ||
+		 header.format != format ||
+		 header.levels < 1 || header.levels > max_mips + 1 ||
+		 !source_stamp( path, &stamp ) ||
+		 header.source_size != stamp.source_size ||
+		 memcmp( &header.source_time, &stamp.source_time, sizeof(stamp.source_time) ) )
+	{
+		fclose( fp );
+		return false;
+	}
+
+	if ( !read_level( fp, &level, &data ) )
+	{
+		fclose( fp );
+		return false;
+	}
+
+	image->w = level.w;
+	image->h = level.h;
+	image->size = level.size;
+	image->colorkey = header.colorkey;
+	image->data = data;
+
+	for ( i = 1; i < header.levels; i++ )
+	{
+		if ( !read_level( fp, &level, &data ) )
+		{
+			while ( *num_mips > 0 )
+				free( mips[ --(*num_mips) ].data );
+			free( image->data );
+			image->data = NULL;
+			fclose( fp );
+			return false;
+		}
+		mips[ i - 1 ].w = level.w;
+		mips[ i - 1 ].h = level.h;
+		mips[ i - 1 ].size = level.size;
+		mips[ i - 1 ].data = data;
+		*num_mips = i;
+	}
+
+	fclose( fp );
+	return true;
+}
+
+static bool write_level( FILE * fp, int w, int h, int size, const char * data )
+{
+	texture_cache_level_t level;
+	level.w = w;
+	level.h = h;
+	level.size = size;
+	return fwrite( &level, sizeof(level), 1, fp ) == 1 &&
+		   fwrite( data, size, 1, fp ) == 1;
+}
+
+// written to a temporary file first so a reader never sees half an entry
+
+bool texture_cache_write( const char * path, u_int32_t format, int32_t gamma, texture_image_t * image, texture_mip_t * mips, int num_mips )
+{
+	texture_cache_header_t header;
+	char name[ 256 ];
+	char temp[ 256 ];
+	char from[ 256 ];
+	char to[ 256 ];
+	bool ok;
+	FILE * fp;
+	int i;
+
+	memset( &header, 0, sizeof(header) );
+	if ( !source_stamp( path, &header ) )
+		return false;
+
+	memcpy( header.magic, cache_magic, sizeof(cache_magic) );
+	header.version = TEXTURE_CACHE_VERSION;
+	header.gamma = gamma;
+	header.w = image->w;
+	header.h = image->h;
+	header.colorkey = image->colorkey;
+	header.format = format;
+	header.levels = num_mips + 1;
+
+	cache_name( path, name, sizeof(name) );
+	snprintf( temp, sizeof(temp), "%s.tmp", name );
+
+	fp = file_open( temp, "wb" );
+	if ( !fp )
+		return false;
+
+	ok = fwrite( &header, sizeof(header), 1, fp ) == 1 &&
+		 write_level( fp, image->w, image->h, image->size, image->data );
+	for ( i = 0; ok && i < num_mips; i++ )
+		ok = write_level( fp, mips[i].w, mips[i].h, mips[i].size, mips[i].data );
+
+	if ( fclose( fp ) != 0 )
+		ok = false;
+
+	strncpy( from, convert_path( temp ), sizeof(from) - 1 );
+	from[ sizeof(from) - 1 ] = 0;
+	strncpy( to, convert_path( name ), sizeof(to) - 1 );
+	to[ sizeof(to) - 1 ] = 0;
+
+	if ( ok )
+	{
+#ifdef WIN32
+		// rename won't replace an existing file here
+		remove( to );
+#endif
+		ok = ( rename( from, to ) == 0 );
+	}
+	if ( !ok )
+		remove( from );
+
+	return ok;
+}
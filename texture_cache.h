@@ -0,0 +1,38 @@
+#ifndef TEXTURE_CACHE_INCLUDED
+#define TEXTURE_CACHE_INCLUDED
+
+#include "main.h"
+#include "texture.h"
+
+//
+// Decoded textures kept on disk with their whole mip chain, gamma and
+// colour key already applied, optionally in a compressed format the
+// card read back to us.  An entry is only used while the source file
+// still has the same size and modification time and the gamma is the
+// same, anything else decodes the source again and rewrites it.
+//
+// Start with -RebuildTextureCache to ignore every entry, each texture
+// is then decoded and written out afresh as it loads.
+//
+
+#define TEXTURE_CACHE_FOLDER	"TextureCache"
+#define TEXTURE_CACHE_EXTENSION	".ptc"
+#define TEXTURE_CACHE_VERSION	1
+
+extern bool texture_cache_rebuild;
+
+// main thread, before any worker touches the cache
+void texture_cache_init( void );
+void texture_cache_set_gamma( double gamma );
+
+// main thread, the gamma entries are written with now ( gamma * 1000 )
+// the workers are handed it with each load rather than reading it
+int32_t texture_cache_gamma( void );
+
+// format is 0 for rgba or the gl compressed format of the levels,
+// gamma is what the image was prepared with, image->size and
+// mips[].size say how many bytes each holds
+bool texture_cache_read( const char * path, u_int32_t format, int32_t gamma, texture_image_t * image, texture_mip_t * mips, int max_mips, int * num_mips );
+bool texture_cache_write( const char * path, u_int32_t format, int32_t gamma, texture_image_t * image, texture_mip_t * mips, int num_mips );
+
+#endif
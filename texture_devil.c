@@ -67,4 +67,19 @@ int load_image( texture_image_t * image, int mipmaps ) //, float gamma )
 	return 0;
 }
 
+// no cheap header read here, decode it and keep the numbers
+
+int load_image_info( texture_image_t * image )
+{
+	texture_image_t full = *image;
+	if( load_image( &full, 1 ) != 0 )
+		return -1;
+	image->w = full.w;
+	image->h = full.h;
+	image->colorkey = full.colorkey;
+	image->data = NULL;
+	destroy_image( &full );
+	return 0;
+}
+
 #endif
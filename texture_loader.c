@@ -0,0 +1,358 @@
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <SDL.h>
+
+#include "texture_loader.h"
+#include "texture_cache.h"
+#include "util.h"
+
+static texture_prepare_t prepare_image = NULL;
+
+static SDL_Thread * workers[ TEXTURE_MAX_WORKERS ];
+static texture_load_t * decoding[ TEXTURE_MAX_WORKERS ];	// what each worker has in hand
+static int num_workers = 0;
+
+static SDL_mutex * lock = NULL;
+static SDL_sem * queued_sem = NULL;		// one post per queued load ( or per worker to quit )
+static bool quitting = false;
+
+// first in first out, the renderer queues in the order tload wants them
+static texture_load_t * queued = NULL;
+static texture_load_t * queued_tail = NULL;
+static texture_load_t * done = NULL;
+static texture_load_t * done_tail = NULL;
+static int pending = 0;
+
+static void append( texture_load_t ** head, texture_load_t ** tail, texture_load_t * load )
+{
+	load->next = NULL;
+	if ( *tail )
+		(*tail)->next = load;
+	else
+		*head = load;
+	*tail = load;
+}
+
+static texture_load_t * pop( texture_load_t ** head, texture_load_t ** tail )
+{
+	texture_load_t * load = *head;
+	if ( load )
+	{
+		*head = load->next;
+		if ( !*head )
+			*tail = NULL;
+		load->next = NULL;
+	}
+	return load;
+}
+
+static bool power_of_two( int n )
+{
+	return n > 0 && ( n & ( n - 1 ) ) == 0;
+}
+
+// box filter down to 1x1, only for power of two images since the
+// renderer lets glu scale anything else
+
+static void build_mips( texture_load_t * load )
+{
+	int level, x, y, w, h, nw, nh;
+	const u_int8_t * src;
+	u_int8_t * dst;
+
+	w = load->image.w;
+	h = load->image.h;
+	src = (const u_int8_t *) load->image.data;
+	load->num_mips = 0;
+
+	if ( !power_of_two( w ) || !power_of_two( h ) )
+		return;
+
+	for ( level = 0; ( w > 1 || h > 1 ) && level < TEXTURE_MAX_MIPS; level++ )
+	{
+		nw = w > 1 ? w / 2 : 1;
+		nh = h > 1 ? h / 2 : 1;
+		dst = malloc( nw * nh * 4 );
+		if ( !dst )
+			return;
+
+		for ( y = 0; y < nh; y++ )
+		{
+			const u_int8_t * row0 = src + ( y * ( h / nh ) ) * w * 4;
+			const u_int8_t * row1 = h > 1 ? row0 + w * 4 : row0;
+			for ( x = 0; x < nw; x++ )
+			{
+				int x0 = x * ( w / nw ) * 4;
+				int x1 = w > 1 ? x0 + 4 : x0;
+				int c;
+				for ( c = 0; c < 4; c++ )
+					dst[ ( y * nw + x ) * 4 + c ] = (u_int8_t)
+						(( row0[x0+c] + row0[x1+c] + row1[x0+c] + row1[x1+c] + 2 ) / 4);
+			}
+		}
+
+		load->mips[level].w = nw;
+		load->mips[level].h = nh;
+		load->mips[level].size = nw * nh * 4;
+		load->mips[level].data = (char *) dst;
+		load->num_mips = level + 1;
+
+		src = dst;
+		w = nw;
+		h = nh;
+	}
+}
+
+static int texture_worker( void * data )
+{
+	int n = (int) (intptr_t) data;
+	texture_load_t * load;
+	bool cancelled;
+
+	for (;;)
+	{
+		SDL_SemWait( queued_sem );
+
+		SDL_LockMutex( lock );
+		if ( quitting )
+		{
+			SDL_UnlockMutex( lock );
+			break;
+		}
+		load = pop( &queued, &queued_tail );
+		decoding[n] = load;
+		cancelled = load ? load->cancelled : false;
+		SDL_UnlockMutex( lock );
+
+		if ( !load )
+			continue;
+
+		// a cache hit is a straight read, compressed entries the renderer
+		// writes itself once the card has compressed the image
+		if ( !cancelled && texture_cache_read( load->image.path, load->compress, load->cache_gamma,
+				&load->image, load->mips, TEXTURE_MAX_MIPS, &load->num_mips ) )
+		{
+			load->format = load->compress;
+			load->cached = true;
+			load->ok = true;
+		}
+		else if ( !cancelled )
+		{
+			load->ok = ( load_image( &load->image, load->build_mips ? 0 : 1 ) == 0 );
+			if ( load->ok )
+			{
+				load->image.size = load->image.w * load->image.h * 4;
+				if ( prepare_image )
+					prepare_image( &load->image, load->gamma );
+				if ( load->build_mips )
+					build_mips( load );
+				if ( !load->compress )
+					texture_cache_write( load->image.path, 0, load->cache_gamma, &load->image, load->mips, load->num_mips );
+			}
+		}
+
+		SDL_LockMutex( lock );
+		decoding[n] = NULL;
+		append( &done, &done_tail, load );
+		SDL_UnlockMutex( lock );
+	}
+
+	return 0;
+}
+
+bool texture_loader_init( texture_prepare_t prepare )
+{
+	int i, count = 2;
+
+	if ( num_workers )
+		return true;
+
+#ifdef DEBUG_ON
+	// the workers allocate, so the debug allocator has to be shared
+	if ( !XMem_ThreadSafe() )
+		return false;
+#endif
+
+	prepare_image = prepare;
+	texture_cache_init();
+
+#if SDL_VERSION_ATLEAST(2,0,0)
+	// leave a core for the main thread
+	count = SDL_GetCPUCount() - 1;
+	if ( count < 1 )
+		count = 1;
+	if ( count > TEXTURE_MAX_WORKERS )
+		count = TEXTURE_MAX_WORKERS;
+#endif
+
+	lock = SDL_CreateMutex();
+	queued_sem = SDL_CreateSemaphore( 0 );
+	if ( !lock || !queued_sem )
+	{
+		DebugPrintf( "texture_loader: couldn't create locks: %s\n", SDL_GetError() );
+		texture_loader_quit();
+		return false;
+	}
+
+	quitting = false;
+	for ( i = 0; i < count; i++ )
+	{
+		decoding[i] = NULL;
+#if SDL_VERSION_ATLEAST(2,0,0)
+		workers[i] = SDL_CreateThread( texture_worker, "texture_worker", (void *) (intptr_t) i );
+#else
+		workers[i] = SDL_CreateThread( texture_worker, (void *) (intptr_t) i );
+#endif
+		if ( !workers[i] )
+		{
+			DebugPrintf( "texture_loader: couldn't create worker: %s\n", SDL_GetError() );
+			break;
+		}
+		num_workers++;
+	}
+
+	DebugPrintf( "texture_loader: %d workers\n", num_workers );
+
+	if ( !num_workers )
+	{
+		texture_loader_quit();
+		return false;
+	}
+	return true;
+}
+
+void texture_loader_quit( void )
+{
+	int i;
+	texture_load_t * load;
+
+	if ( lock )
+	{
+		SDL_LockMutex( lock );
+		quitting = true;
+		SDL_UnlockMutex( lock );
+	}
+	for ( i = 0; i < num_workers; i++ )
+		SDL_SemPost( queued_sem );
+	for ( i = 0; i < num_workers; i++ )
+		SDL_WaitThread( workers[i], NULL );
+	num_workers = 0;
+
+	while ( ( load = pop( &queued, &queued_tail ) ) )
+		texture_loader_free( load );
+	while ( ( load = pop( &done, &done_tail ) ) )
+		texture_loader_free( load );
+	pending = 0;
+
+	if ( queued_sem )
+		SDL_DestroySemaphore( queued_sem );
+	if ( lock )
+		SDL_DestroyMutex( lock );
+	queued_sem = NULL;
+	lock = NULL;
+}
+
+bool texture_loader_queue( const char * path, bool build_mips, u_int32_t compress, const u_int8_t * gamma, void * user )
+{
+	texture_load_t * load;
+
+	if ( !num_workers )
+		return false;
+
+	load = calloc( 1, sizeof(texture_load_t) );
+	if ( !load )
+		return false;
+
+	strncpy( load->image.path, path, sizeof(load->image.path) - 1 );
+	load->build_mips = build_mips;
+	load->compress = compress;
+	load->user = user;
+	memcpy( load->gamma, gamma, sizeof(load->gamma) );
+	load->cache_gamma = texture_cache_gamma();
+
+	SDL_LockMutex( lock );
+	append( &queued, &queued_tail, load );
+	pending++;
+	SDL_UnlockMutex( lock );
+
+	SDL_SemPost( queued_sem );
+	return true;
+}
+
+void texture_loader_cancel( void * user )
+{
+	texture_load_t * load;
+	int i;
+
+	if ( !num_workers || !user )
+		return;
+
+	SDL_LockMutex( lock );
+	for ( load = queued; load; load = load->next )
+		if ( load->user == user )
+			load->cancelled = true;
+	for ( load = done; load; load = load->next )
+		if ( load->user == user )
+			load->cancelled = true;
+	for ( i = 0; i < num_workers; i++ )
+		if ( decoding[i] && decoding[i]->user == user )
+			decoding[i]->cancelled = true;
+	SDL_UnlockMutex( lock );
+}
+
+texture_load_t * texture_loader_next( void )
+{
+	texture_load_t * load;
+
+	if ( !num_workers )
+		return NULL;
+
+	for (;;)
+	{
+		SDL_LockMutex( lock );
+		load = pop( &done, &done_tail );
+		SDL_UnlockMutex( lock );
+
+		if ( !load || !load->cancelled )
+			return load;
+
+		texture_loader_free( load );
+	}
+}
+
+void texture_loader_free( texture_load_t * load )
+{
+	int i;
+
+	if ( !load )
+		return;
+
+	for ( i = 0; i < load->num_mips; i++ )
+		free( load->mips[i].data );
+	if ( load->image.data )
+		destroy_image( &load->image );
+	free( load );
+
+	if ( lock )
+		SDL_LockMutex( lock );
+	if ( pending > 0 )
+		pending--;
+	if ( lock )
+		SDL_UnlockMutex( lock );
+}
+
+int texture_loader_pending( void )
+{
+	int count;
+
+	if ( !num_workers )
+		return 0;
+
+	SDL_LockMutex( lock );
+	count = pending;
+	SDL_UnlockMutex( lock );
+	return count;
+}
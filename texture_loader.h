@@ -0,0 +1,58 @@
+#ifndef TEXTURE_LOADER_INCLUDED
+#define TEXTURE_LOADER_INCLUDED
+
+#include "main.h"
+#include "texture.h"
+
+//
+// A small pool of worker threads that decode texture files off the
+// main thread.  The renderer queues a file for a texture it has
+// already handed out ( drawing a placeholder meanwhile ), the workers
+// decode it, run the renderer's prepare step over the pixels ( gamma
+// and colour key ) and optionally build the mip chain, and the main
+// thread collects finished loads and does the uploads itself since
+// only it owns the gl context.
+//
+
+#define TEXTURE_MAX_MIPS 16
+#define TEXTURE_MAX_WORKERS 4
+
+typedef struct texture_load_s
+{
+	texture_image_t image;
+	int num_mips;		// levels below the image, 0 if none were built
+	texture_mip_t mips[ TEXTURE_MAX_MIPS ];
+	void * user;		// what the image is for, the renderer's texture
+	bool build_mips;
+	u_int32_t compress;	// gl compressed format the renderer wants, 0 for rgba
+	u_int32_t format;	// what the levels hold, compress if they came from the cache
+	bool cached;		// read from the texture cache rather than decoded
+	bool ok;			// decoded fine
+	bool cancelled;		// user went away, the load is just freed
+	u_int8_t gamma[256];	// the renderer's gamma table when it was queued
+	int32_t cache_gamma;	// and the gamma the cache entry is for
+	struct texture_load_s * next;
+} texture_load_t;
+
+// runs on a worker for every decoded image, with the load's own copy
+// of the gamma table since the main thread may rebuild it meanwhile
+typedef void (*texture_prepare_t)( texture_image_t * image, const u_int8_t * gamma );
+
+bool texture_loader_init( texture_prepare_t prepare );
+void texture_loader_quit( void );
+
+// false when there are no workers, load it yourself then
+bool texture_loader_queue( const char * path, bool build_mips, u_int32_t compress, const u_int8_t * gamma, void * user );
+
+// drop any load for user still queued or not yet collected
+void texture_loader_cancel( void * user );
+
+// main thread: the next finished load or NULL, hand it back to
+// texture_loader_free once uploaded
+texture_load_t * texture_loader_next( void );
+void texture_loader_free( texture_load_t * load );
+
+// loads queued, being decoded or waiting to be collected
+int texture_loader_pending( void );
+
+#endif
@@ -14,6 +14,80 @@ void destroy_image( texture_image_t * image )
 	memset(image,0,sizeof(image));
 }
 
+// reads just the header, for when the pixels get decoded later
+
+int load_image_info( texture_image_t * image )
+{
+  png_byte magic[8];
+  png_structp png_ptr;
+  png_infop info_ptr;
+  int color_type;
+  FILE *fp = NULL;
+
+  fp = file_open (image->path, "rb");
+  if (!fp)
+    {
+      fprintf (stderr, "error: couldn't open \"%s\"!\n", image->path);
+      return -1;
+    }
+
+  if (fread (magic, 1, sizeof (magic), fp) != sizeof (magic) ||
+      !png_check_sig (magic, sizeof (magic)))
+    {
+      fprintf (stderr, "error: \"%s\" is not a valid PNG image!\n",
+	       image->path);
+      fclose (fp);
+      return -1;
+    }
+
+  png_ptr = png_create_read_struct
+    (PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+  if (!png_ptr)
+    {
+      fclose (fp);
+      return -1;
+    }
+
+  info_ptr = png_create_info_struct (png_ptr);
+  if (!info_ptr)
+    {
+      fclose (fp);
+      png_destroy_read_struct (&png_ptr, NULL, NULL);
+      return -1;
+    }
+
+  if (setjmp (png_jmpbuf (png_ptr)))
+    {
+      fclose (fp);
+      png_destroy_read_struct (&png_ptr, &info_ptr, NULL);
+      return -1;
+    }
+
+  png_init_io (png_ptr, fp);
+  png_set_sig_bytes (png_ptr, sizeof (magic));
+  png_read_info (png_ptr, info_ptr);
+
+  color_type = png_get_color_type (png_ptr, info_ptr);
+
+  /* same checks as load_image */
+  if (png_get_bit_depth (png_ptr, info_ptr) != 8 ||
+      !(color_type & PNG_COLOR_MASK_COLOR))
+    {
+      fclose (fp);
+      png_destroy_read_struct (&png_ptr, &info_ptr, NULL);
+      return -1;
+    }
+
+  image->w = (int) png_get_image_width (png_ptr, info_ptr);
+  image->h = (int) png_get_image_height (png_ptr, info_ptr);
+  image->colorkey = (color_type & PNG_COLOR_MASK_ALPHA);
+  image->data = NULL;
+
+  png_destroy_read_struct (&png_ptr, &info_ptr, NULL);
+  fclose (fp);
+  return 0;
+}
+
 int load_image( texture_image_t * image, int mipmap )
 {
   png_byte magic[8];
@@ -72,4 +72,19 @@ void destroy_image( texture_image_t * image )
 	memset(image,0,sizeof(image));
 }
 
+// no cheap header read here, decode it and keep the numbers
+
+int load_image_info( texture_image_t * image )
+{
+	texture_image_t full = *image;
+	if( load_image( &full, 1 ) != 0 )
+		return -1;
+	image->w = full.w;
+	image->h = full.h;
+	image->colorkey = full.colorkey;
+	image->data = NULL;
+	destroy_image( &full );
+	return 0;
+}
+
 #endif // TEXTURE_SDL
@@ -42,6 +42,8 @@
 #include "local.h"
 #include "lines.h"
 #include "loadsave.h"
+#include "savefile.h"
+#include "snapshot.h"
 
 #include "net.h"
 #include "restart.h"
@@ -201,9 +203,9 @@ extern TLOADHEADER	Tloadheader;
 extern int	TeamMembers[MAX_TEAMS];
 extern	int16_t	ShowPortal;
 extern float VduScaleX, VduScaleY;
-extern	FMPOLY			FmPolys[MAXNUMOF2DPOLYS];
-extern	POLY   			Polys[MAXPOLYS];
-extern  SCRPOLY			ScrPolys[ MAXNUMOFSCRPOLYS ];
+extern	FMPOLY			*	FmPolys;
+extern	POLY   			*	Polys;
+extern  SCRPOLY			*	ScrPolys;
 extern	LINE			Lines[ MAXLINES ];
 extern	MXALOADHEADER	MxaModelHeaders[ MAXMXAMODELHEADERS ];
 extern	FRAME_INFO	*	Title_Fonts_Header;
@@ -253,7 +255,7 @@ extern	RENDERMATRIX view;
 extern	bool ClearBuffers( void );
 extern	MATRIX	MATRIX_Identity;
 extern	render_viewport_t viewport;
-extern	MODEL	Models[];
+extern	MODEL	*	Models;
 u_int16_t	BackgroundModel[NUMOFTITLEMODELS];
 extern	TLOADHEADER Tloadheader;
 extern	float	LastDistance[];
@@ -397,6 +399,7 @@ void DebugModeChanged( MENUITEM *item );
 void SavePickups( MENUITEM *item );
 void ShowNodeToggle( MENUITEM *item );
 void ShowStartPointsToggle( MENUITEM *item );
+void RunSnapshotBenchmark( MENUITEM *item );
 void InitDemoList( MENU * Menu );
 void GetGamePrefs( void );
 void SetGamePrefs( void );
@@ -405,6 +408,8 @@ void WatchPlayerSelected( MENUITEM *Item);
 
 char *SearchKey( char c );
 void PauseDemoToggle( MENUITEM *Item );
+void DemoSkipBack( MENUITEM *Item );
+void DemoSkipForward( MENUITEM *Item );
 
 bool InitLevels( char *levels_list );
 void InitLevelSelect( MENU *Menu );
@@ -795,6 +800,7 @@ SLIDER GoalScoreSlider					= { 1, 10, 1, 5, 0, 0.0F };
 SLIDER BountyBonusSlider				= { 1, 30, 1, 10, 0, 0.0F };
 SLIDER CTFSlider							= { 0, CTF_MAX - 1, 1, CTF_STANDARD, -1, 0.0F, 0.0F, 0, false, CTF_Type };
 SLIDER DemoSpeed						= { 1, 16, 1, 8, 0, 0.0F };
+SLIDER DemoFastForward					= { 1, 16, 1, 1, 0, 0.0F };
 SLIDER SfxSlider							= { 0, 10, 1, 10, 0, 0.0F };
 SLIDER BikerSpeechSlider				= { 0, 10, 1, 8, 0, 0.0F };
 SLIDER BikeCompSpeechSlider			= { 0, 10, 1, 8, 0, 0.0F };
@@ -2808,6 +2814,7 @@ MENU	MENU_DebugMode = {
 		
 		{ 200, 336, 0, 0, 0, "Show Nodes", 0, 0, &ShowNode, ShowNodeToggle, SelectToggle, DrawToggle, NULL, 0 },
 		{ 200, 352, 0, 0, 0, "Show Startpoints", 0, 0, &ShowStartPoints, ShowStartPointsToggle, SelectToggle, DrawToggle, NULL, 0 },
+		{ 200, 368, 0, 0, 0, "Snapshot Benchmark", 0, 0, NULL, NULL, RunSnapshotBenchmark, MenuItemDrawName, NULL, 0 },
 
 		{ -1 , -1, 0, 0, 0, "" , 0, 0, NULL, NULL , NULL , NULL, NULL, 0 }
 	}
@@ -2903,13 +2910,16 @@ MENU	MENU_DemoPlaying = {
 	LT_MENU_DemoPlaying0 /*"Demo Playing"*/ , NULL, NULL, NULL, 0,
 	{
 		{ 200 , 128           , 0, 0, 0, LT_MENU_DemoPlaying1 /*"Pause Demo "*/, 0, 0,	&PauseDemo,	NULL, PauseDemoToggle,	DrawToggle, NULL, 0 },
-		{ 200 , 128 + ( 2*16 ), 0, 0, 0, LT_MENU_DemoPlaying7 /*"Playback Speed"*/, 0, 0,	&DemoSpeed,		NULL,	SelectSlider,	DrawSlider, NULL, 0 },
-		{ 200 , 128 + ( 4*16 ), 0, 0, 0, LT_MENU_DemoPlaying8 /*"Watch Player"*/, 0, 0,		&DemoEyesSelect,		NULL,	SelectSlider,	DrawSlider, NULL, 0 },
-		{ 200 , 128 + ( 5*16 ), 0, 0, 0, LT_MENU_DemoPlaying9 /*"Options"*/ , 0, 0, NULL, &MENU_Options , MenuChange , MenuItemDrawName, NULL, 0 } ,
+		{ 200 , 128 + ( 1*16 ), 0, 0, 0, "Skip Back"/*"Skip Back"*/ , 0, 0, NULL, NULL, DemoSkipBack , MenuItemDrawName, NULL, 0 } ,
+		{ 200 , 128 + ( 2*16 ), 0, 0, 0, "Skip Forward"/*"Skip Forward"*/ , 0, 0, NULL, NULL, DemoSkipForward , MenuItemDrawName, NULL, 0 } ,
+		{ 200 , 128 + ( 3*16 ), 0, 0, 0, LT_MENU_DemoPlaying7 /*"Playback Speed"*/, 0, 0,	&DemoSpeed,		NULL,	SelectSlider,	DrawSlider, NULL, 0 },
+		{ 200 , 128 + ( 4*16 ), 0, 0, 0, "Fast Forward"/*"Fast Forward"*/, 0, 0,	&DemoFastForward,		NULL,	SelectSlider,	DrawSlider, NULL, 0 },
+		{ 200 , 128 + ( 5*16 ), 0, 0, 0, LT_MENU_DemoPlaying8 /*"Watch Player"*/, 0, 0,		&DemoEyesSelect,		NULL,	SelectSlider,	DrawSlider, NULL, 0 },
+		{ 200 , 128 + ( 6*16 ), 0, 0, 0, LT_MENU_DemoPlaying9 /*"Options"*/ , 0, 0, NULL, &MENU_Options , MenuChange , MenuItemDrawName, NULL, 0 } ,
 #ifdef DEBUG_ON
-		{ 200 , 128 + ( 6*16 ), 0, 0, 0, LT_MENU_DemoPlaying10 /*"Debugging"*/, 0, 0,	&DebugInfo,	DebugModeChanged, SelectToggle,	DrawToggle, NULL, 0 },
+		{ 200 , 128 + ( 7*16 ), 0, 0, 0, LT_MENU_DemoPlaying10 /*"Debugging"*/, 0, 0,	&DebugInfo,	DebugModeChanged, SelectToggle,	DrawToggle, NULL, 0 },
 #endif
-		{ 200 , 128 + ( 7*16 ), 0, 0, 0, LT_MENU_DemoPlaying11 /*"Quit to Title Screen"*/ , 0, 0, NULL, NULL, SelectQuitCurrentGame , MenuItemDrawName, NULL, 0 } ,
+		{ 200 , 128 + ( 8*16 ), 0, 0, 0, LT_MENU_DemoPlaying11 /*"Quit to Title Screen"*/ , 0, 0, NULL, NULL, SelectQuitCurrentGame , MenuItemDrawName, NULL, 0 } ,
 		{ -1 , -1, 0, 0, 0, "" , 0, 0, NULL, NULL , NULL , NULL, NULL, 0 }
 	}
 };
@@ -3325,7 +3335,8 @@ int Current2dBox;
 bool DrawTextItemBox;
 float VDUoffsetX = 105.0F;
 float VDUoffsetY = 15.0F;
-u_int16_t screenpoly[MAXNUMOFSCRPOLYS];
+#define	MAXVDUBOXPOLYS	MAXNUMOFSCRPOLYS	// the ScrPoly pool can grow past this
+u_int16_t screenpoly[MAXVDUBOXPOLYS];
 int CurrentScreenPoly;
 float	TEXTINFO_currentx;					
 float	TEXTINFO_currenty;					
@@ -3352,12 +3363,13 @@ int SelectedBikeFrame;
 u_int16_t SelectedBikeModel;
 u_int16_t OldBikeModel;
 float BikeRot = 0.0F;
-u_int16_t BikeLine[MAXNUMOF2DPOLYS];
+#define	MAXHOLOLINES	MAXPOLYS	// the Poly pool can grow past this
+u_int16_t BikeLine[MAXHOLOLINES];
 u_int16_t CurrentHoloModel = (u_int16_t)-1;
 bool LinesActive;
 int CurrentLine;
 VECTOR BikePos;
-SCANLINES scanline[MAXNUMOF2DPOLYS];
+SCANLINES scanline[MAXHOLOLINES];
 bool KnowExtremeVerts, BikeLoaded;
 float CurrentOffset;
 bool BikeOnSwap, OnBikeShrink, LoadNewBike;
@@ -3930,7 +3942,7 @@ bool LoadTitleModels(void)
 	CurrentHoloModel = (u_int16_t)-1;
 
 	// scan lines...
-	for ( i = 0; i < MAXNUMOF2DPOLYS; i++ )
+	for ( i = 0; i < MAXHOLOLINES; i++ )
 	{
 		BikeLine[ i ] = (u_int16_t)-1;
 	}
@@ -4107,12 +4119,12 @@ bool SetUpLines (u_int16_t Model, PLANE plane, VECTOR *rot)
 					
 					scanline[scanlinenum].poly = *poly_ptr;
 					
-					if ((startset) && (endset))
+					if ((startset) && (endset) && (scanlinenum < MAXHOLOLINES - 1))
 						scanlinenum++;
 
 					poly_ptr++;
 				}
-				for (i=0; i<scanlinenum; i++)
+				for (i=0; (i<scanlinenum) && (CurrentLine < MAXHOLOLINES); i++)
 				{
 
 					BikeLine[CurrentLine] = FindFreePoly();
@@ -4285,12 +4297,12 @@ bool SetUpLines (u_int16_t Model, PLANE plane, VECTOR *rot)
 					
 					scanline[scanlinenum].poly = *poly_ptr;
 					
-					if ((startset) && (endset))
+					if ((startset) && (endset) && (scanlinenum < MAXHOLOLINES - 1))
 						scanlinenum++;
 
 					poly_ptr++;
 				}
-				for (i=0; i<scanlinenum; i++)
+				for (i=0; (i<scanlinenum) && (CurrentLine < MAXHOLOLINES); i++)
 				{
 
 					BikeLine[CurrentLine] = FindFreePoly();
@@ -7189,57 +7201,23 @@ static int compare( const void *arg1, const void *arg2 )
 
 #ifdef DEMO_SUPPORT
 
-static int
-_cdecl CompareDemoDate( const void *arg1, const void *arg2 )
+// when a demo was last written, as a number that sorts
+static LONGLONG DemoDate( const void *arg )
 {
-	FILETIME date;
-	HANDLE hfile;
-	char *demo;	 
-	LONGLONG longdate1, longdate2;
+	struct filetime t;
 
-	// get creation date of file 1
-	demo = DemoFileName( (char *)arg1 );
-	hfile = CreateFile( demo,	// pointer to name of the file 
-						GENERIC_READ,	// read mode 
-						FILE_SHARE_READ,	// share mode 
-						NULL,	// pointer to security descriptor 
-						OPEN_EXISTING,	// how to create 
-						FILE_ATTRIBUTE_NORMAL,	// file attributes 
-						NULL 	// handle to file with attributes to copy  
-						);
-	if ( hfile != INVALID_HANDLE_VALUE )
-	{
-		GetFileTime( hfile,	NULL,  NULL, &date );
-		longdate1 = ( LONGLONG )date.dwHighDateTime;
-		longdate1 <<= 32;
-		longdate1 |= ( LONGLONG )date.dwLowDateTime;
-	}else
-	{
+	if ( !file_time( DemoFileName( (char *)arg ), &t ) )
 		return 0;
-	}
-	CloseHandle(hfile);
-
-	// get creation date of file 1
-	demo = DemoFileName( (char *)arg2 );
-	hfile = CreateFile( demo,	// pointer to name of the file 
-						GENERIC_READ,	// read mode 
-						FILE_SHARE_READ,	// share mode 
-						NULL,	// pointer to security descriptor 
-						OPEN_EXISTING,	// how to create 
-						FILE_ATTRIBUTE_NORMAL,	// file attributes 
-						NULL 	// handle to file with attributes to copy  
-						);
-	if ( hfile != INVALID_HANDLE_VALUE )
-	{
-		GetFileTime( hfile,	NULL,  NULL, &date );
-		longdate2 = ( LONGLONG )date.dwHighDateTime;
-		longdate2 <<= 32;
-		longdate2 |= ( LONGLONG )date.dwLowDateTime;
-	}else
-	{
-		return 0;
-	}
-	CloseHandle(hfile);
+	return ( ( ( ( (LONGLONG) t.year * 12 + t.month ) * 31 + t.day ) * 24 + t.hour ) * 60 + t.minute ) * 60 + t.second;
+}
+
+// newest demos first
+static int CompareDemoDate( const void *arg1, const void *arg2 )
+{
+	LONGLONG longdate1, longdate2;
+
+	longdate1 = DemoDate( arg1 );
+	longdate2 = DemoDate( arg2 );
 
 	if ( longdate1 < longdate2 )
 		return 1;
@@ -8491,6 +8469,7 @@ void GetSavedGameData( void )
 	sprintf(filename, "savegame\\%s", LoadSavedGameList.item[ LoadSavedGameList.selected_item ] ); 
 #endif
 
+	savefile_flush();
 	if ( file_time( filename, &ftime ) )
 		sprintf( CurrentSavedGameDate, "saved %d-%d-%d at %2d:%02d", ftime.month, ftime.day, ftime.year, ftime.hour, ftime.minute );
 	else
@@ -8503,7 +8482,7 @@ void GetSavedGameData( void )
 #endif
 	}
 
-	fp = file_open( filename, "r" );
+	fp = savefile_open( filename, SAVEFILE_INFO_SIZE );
 
 	if( fp )
 	{
@@ -8546,7 +8525,7 @@ void GetSavedGameData( void )
 		fread( &InitEnemiesNum, sizeof( InitEnemiesNum ), 1, fp );
 		fread( &KilledEnemiesNum, sizeof( KilledEnemiesNum ), 1, fp );
 
-		fclose( fp );
+		savefile_close( fp );
 
 		sprintf( CurrentSavedGameLevel, LT_LevelName/*"level name: %s"*/, GetMissionName( buf ) );
 		if ( strcasecmp( biker, DEFAULT_PLAYER_NAME ) )
@@ -8979,6 +8958,11 @@ void ShowStartPointsToggle( MENUITEM *item )
 	}
 }
 
+void RunSnapshotBenchmark( MENUITEM *item )
+{
+	SnapshotBenchmark( SNAPSHOT_BENCHMARK_RUNS );
+}
+
 #ifdef DEMO_SUPPORT
 
 void InitAvgFrameRateGlobals( MENU *Menu )
@@ -8993,6 +8977,7 @@ void RestoreDemoSettings( void )
 {
 	PauseDemo = false;
 	DemoSpeed.value = 8;
+	DemoFastForward.value = 1;
 	DemoEyesSelect.value = 0;
 	ShowNamesAnyway = false;
 }
@@ -9004,11 +8989,9 @@ void RestoreDemoSettings( void )
 ===================================================================*/
 void InitDemoList( MENU * Menu )
 {
-	HANDLE h;
-	WIN32_FIND_DATA DemoFiles;
+	char *fname;
 	int j;
-//	char *fname, *bname;
-	FILE *DemoFp;
+	DEMOSTREAM *DemoFp;
 
 	RestoreDemoSettings();
 
@@ -9027,26 +9010,21 @@ void InitDemoList( MENU * Menu )
 
 	DemoList.selected_item = 0;
 	DemoList.item[0][0] = 0;
-	h = FindFirstFile( DEMOFILE_SEARCHPATH,	// pointer to name of file to search for  
-						(LPWIN32_FIND_DATA) &DemoFiles );	// pointer to returned information 
-
-	if ( h == INVALID_HANDLE_VALUE )
-	{
+	if ( !( fname = find_file( DEMOFILE_SEARCHPATH ) ) )
 		return;
-	}
 
 	do{
-		strncpy( DemoList.item[ DemoList.items ], DemoName( DemoFiles.cFileName ), sizeof( DemoList.item[ 0 ] ) - 1 );
+		strncpy( DemoList.item[ DemoList.items ], DemoName( fname ), sizeof( DemoList.item[ 0 ] ) - 1 );
 		DemoList.item[ DemoList.items ][ sizeof( DemoList.item[ 0 ] ) - 1 ] = 0;
 
-		DemoFp = file_open( DemoFileName( DemoList.item[ DemoList.items ] ), "rb" );
+		DemoFp = DemoStreamOpen( DemoFileName( DemoList.item[ DemoList.items ] ) );
 
 		if ( DemoFp )
 		{
 			u_int32_t mp_version;
 
 			mp_version = ~MULTIPLAYER_VERSION;
-			fread( &mp_version, sizeof( mp_version ), 1, DemoFp );
+			DemoStreamRead( &mp_version, sizeof( mp_version ), 1, DemoFp );
 			if ( (mp_version <= MULTIPLAYER_VERSION) && (mp_version >= DEMO_MULTIPLAYER_VERSION) )
 			{
 				u_int16_t CopyOfSeed1;
@@ -9058,18 +9036,18 @@ void InitDemoList( MENU * Menu )
 				static char buf[ 256 ];
 				int i;
 
-				fread( &CopyOfSeed1, sizeof( CopyOfSeed1 ), 1, DemoFp );
-				fread( &CopyOfSeed2, sizeof( CopyOfSeed2 ), 1, DemoFp );
-				fread( &RandomPickups, sizeof( RandomPickups ), 1, DemoFp );
-				fread( &PackedInfo[ 0 ], sizeof( PackedInfo ), 1, DemoFp );
+				DemoStreamRead( &CopyOfSeed1, sizeof( CopyOfSeed1 ), 1, DemoFp );
+				DemoStreamRead( &CopyOfSeed2, sizeof( CopyOfSeed2 ), 1, DemoFp );
+				DemoStreamRead( &RandomPickups, sizeof( RandomPickups ), 1, DemoFp );
+				DemoStreamRead( &PackedInfo[ 0 ], sizeof( PackedInfo ), 1, DemoFp );
 				
-				fread( &flags, sizeof( flags ), 1, DemoFp );
+				DemoStreamRead( &flags, sizeof( flags ), 1, DemoFp );
 				
-				fread( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFp );
+				DemoStreamRead( &RandomStartPosModify, sizeof( RandomStartPosModify ), 1, DemoFp );
 				
 				for( i = 0 ; i < 256 ; i++ )
 				{
-					fread( &buf[i], sizeof(char), 1, DemoFp );
+					DemoStreamRead( &buf[i], sizeof(char), 1, DemoFp );
 					if( buf[i] == 0 )
 					{
 						break;
@@ -9090,9 +9068,9 @@ void InitDemoList( MENU * Menu )
 					DemoList.items++;
 				}
 			}
-			fclose( DemoFp );
+			DemoStreamClose( DemoFp );
 		}
-	}while(	FindNextFile( h , (LPWIN32_FIND_DATA) &DemoFiles ) && DemoList.items < MAXLISTITEMS );
+	}while(	( fname = find_next_file() ) && DemoList.items < MAXLISTITEMS );
 
 	qsort( (void *)DemoList.item, (size_t) DemoList.items, sizeof( DemoList.item[ 0 ] ), CompareDemoDate );
 
@@ -9104,7 +9082,7 @@ void InitDemoList( MENU * Menu )
 	if ( DemoList.selected_item >= DemoList.top_item + DemoList.display_items )
 		DemoList.top_item = DemoList.selected_item - DemoList.display_items + 1;
 
-	FindClose(h);
+	find_close();
 
 	InitAvgFrameRateGlobals( NULL );
 	DemoList.FuncDelete = ( DemoList.items > 0 ) ? DeleteDemo : NULL;
@@ -9169,6 +9147,7 @@ void InitLoadSavedGameList( MENU * Menu )
 			LoadSavedGameList.top_item = LoadSavedGameList.selected_item;
 	}
 #else
+	savefile_flush();
 	fname = find_file( SAVEGAME_FOLDER "\\" SAVEGAME_FILESPEC SAVEGAME_EXTENSION );
 
 	do
@@ -9210,6 +9189,24 @@ void PauseDemoToggle( MENUITEM *Item )
 	SelectToggle( Item );
 }
 
+#define DEMO_SKIP_SECONDS	(30.0F)
+
+/*===================================================================
+	Procedure	:		Demo Skip Back / Forward
+	Input		:		MENUITEM	*	Item
+	Output		:		Nothing
+===================================================================*/
+
+void DemoSkipBack( MENUITEM *Item )
+{
+	DemoSkip( -DEMO_SKIP_SECONDS );
+}
+
+void DemoSkipForward( MENUITEM *Item )
+{
+	DemoSkip( DEMO_SKIP_SECONDS );
+}
+
 /*===================================================================
 	Procedure	:		Init the level select menu...
 	Input		:		Nothing
@@ -9302,6 +9299,7 @@ void GetGamePrefs( void )
     MyUseShortPackets                = config_get_bool( "UseShortPackets",			true );
     ShowTeamInfo                     = config_get_bool( "ShowTeamInfo",				true );
 	render_info.fullscreen			 = config_get_bool( "FullScreen",				false );
+	render_info.texture_compression	 = config_get_bool( "TextureCompression",		false );
 
 	memset( MyPickupValid, 0, sizeof(MyPickupValid) );
 
@@ -9467,6 +9465,7 @@ void SetGamePrefs( void )
 	config_set_bool( "UseShortPackets",		MyUseShortPackets );
 	config_set_bool( "ShowTeamInfo",		ShowTeamInfo );
 	config_set_bool( "FullScreen",			render_info.fullscreen );
+	config_set_bool( "TextureCompression",	render_info.texture_compression );
 
 	config_set_bool( "AllowMugs",               MyPickupValid[ PICKUP_Mugs ] );
 	config_set_bool( "AllowHeatseaker",         MyPickupValid[ PICKUP_HeatseakerPickup ] );
@@ -11601,6 +11600,9 @@ bool Plot2dBox (TEXTINFO *TextInfo)
 {
 	u_int8_t r, g, b;
 
+	if( CurrentScreenPoly >= MAXVDUBOXPOLYS )
+		return false;
+
 	screenpoly[CurrentScreenPoly] = FindFreeScrPoly();					
 	testboxpoly = screenpoly[CurrentScreenPoly];
 	if( screenpoly[CurrentScreenPoly] != (u_int16_t ) -1 )
@@ -14938,6 +14940,7 @@ void DebugLastError( void )
 
 bool DeleteSavedGame( LIST *l, int item )
 {
+	savefile_flush();
 	if ( delete_file( SaveGameFileName( item ) )
 		&& delete_file( SaveGamePicFileName( item ) ) )
 	{
@@ -15547,6 +15550,9 @@ void TitleReset( MENUITEM *item )
 	PlaceObjects();
 	TitleInitDone = false;
 	CameraStatus = CAMERA_AtStart;
+	// a quick start skipped the title room's sounds
+	if ( QuickStart != QUICKSTART_None )
+		RequestTitleRoomSfx();
 	QuickStart = QUICKSTART_None;
 }
 
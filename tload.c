@@ -128,6 +128,9 @@ bool Tload( TLOADHEADER * Tloadheader  )
 		}
 	}
 
+	// let the renderer pack the textures into arrays ( gl3 )
+	FSCreateTextureArrays( Tloadheader->lpTexture, Tloadheader->num_texture_files );
+
 	// Tloadheader is valid
 	Tloadheader->state = true;
 
@@ -136,6 +139,7 @@ bool Tload( TLOADHEADER * Tloadheader  )
 	
 //
 // this will create and set a brand new texture pointer
+// the image itself arrives later, see FSCreateTextureAsync
 //
 
 bool TloadTextureSurf( TLOADHEADER * Tloadheader , int n)
@@ -147,14 +151,14 @@ bool TloadTextureSurf( TLOADHEADER * Tloadheader , int n)
 	{
 		if( Tloadheader->MipMap[n] )
 		{
-			FSCreateTexture(
+			FSCreateTextureAsync(
 				&lpSrcTexture, &Tloadheader->ImageFile[n][0],
 				&Tloadheader->Xsize[n], &Tloadheader->Ysize[n],
 				0, &Tloadheader->ColourKey[n]);
 		}
 		else
 		{
-			FSCreateTexture(
+			FSCreateTextureAsync(
 				&lpSrcTexture, &Tloadheader->ImageFile[n][0],
 				&Tloadheader->Xsize[n], &Tloadheader->Ysize[n],
 				1, &Tloadheader->ColourKey[n]);
@@ -227,6 +231,7 @@ void
 ReleaseTloadheader( TLOADHEADER * Tloadheader )
 {
     int i;
+    FSReleaseTextureArrays();
     for (i = 0; i < Tloadheader->num_texture_files; i++)
     {
         TloadReleaseTexture( Tloadheader , i);
@@ -18,7 +18,7 @@
 		Externals...
 ===================================================================*/
 extern RENDERMATRIX identity;
-extern MODEL Models[MAXNUMOFMODELS];
+extern MODEL *	Models;
 
 /*===================================================================
 		Globals...
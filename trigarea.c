@@ -89,7 +89,6 @@ TRIGGER_AREA * GroupTriggerArea_enemy_shoots[MAXGROUPS];
 bool TriggerAreaload( char * Filename )
 {
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	char		*	OrgBuffer;
 	int16_t			*	int16_tpnt;
@@ -117,19 +116,13 @@ bool TriggerAreaload( char * Filename )
 	}
 	
 
-	File_Size = Get_File_Size( Filename );	
+	if( !Get_File_Size( Filename ) ) return true;
 
-	if( !File_Size ) return true;
-
-	Buffer = malloc( File_Size );
+	Buffer = load_file_buffer( Filename, &File_Size, 0 );
 	OrgBuffer = Buffer;
 
 	if( Buffer == NULL ) return false;
 
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size ) return false;
-
 	u_int32_tpnt = (u_int32_t *) Buffer;
 	MagicNumber = *u_int32_tpnt++;
 	VersionNumber = *u_int32_tpnt++;
@@ -218,7 +211,7 @@ bool TriggerAreaload( char * Filename )
 		AreaPnt++;
 	}
 	
-	free( OrgBuffer );
+	release_file_buffer( OrgBuffer );
 
 	// Make up Group Link List....
 
@@ -687,7 +687,6 @@ void EVENT_TeleportDisable( u_int8_t * Data )
 bool Triggerload( char * Filename )
 {
 	long			File_Size;
-	long			Read_Size;
 	char		*	Buffer;
 	char		*	OrgBuffer;
 	int			*	intpnt;
@@ -718,20 +717,14 @@ bool Triggerload( char * Filename )
 	TimeLimitTrigger = NULL;
 
 
-	File_Size = Get_File_Size( Filename );
-	if( !File_Size ) return true;
+	if( !Get_File_Size( Filename ) ) return true;
 
-	Buffer = malloc( File_Size );
+	Buffer = load_file_buffer( Filename, &File_Size, 0 );
 
 	if( Buffer == NULL )
 		return false;
 	OrgBuffer = Buffer;
 
-	Read_Size = Read_File( Filename, Buffer, File_Size );
-
-	if( Read_Size != File_Size )
-		return false;
-
 	u_int32Pnt = (u_int32_t *) Buffer;
 	MagicNumber = *u_int32Pnt++;
 	VersionNumber = *u_int32Pnt++;
@@ -1143,7 +1136,7 @@ bool Triggerload( char * Filename )
 	}
 	NumOfActiveConditions = 0;
 	
-	free( OrgBuffer );
+	release_file_buffer( OrgBuffer );
 	return true;
 }
 
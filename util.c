@@ -36,7 +36,8 @@ char* convert_path( char* _str )
 #ifdef WIN32
 	return _str;
 #else
-	static char temp[500];
+	// per thread, the texture and level load workers open files too
+	static THREAD_LOCAL char temp[500];
 	char * str = temp;
 	strncpy( temp, _str, sizeof(temp) );
 	while (*str)
@@ -51,6 +52,22 @@ char* convert_path( char* _str )
 #endif
 }
 
+#ifndef WIN32
+bool QueryPerformanceCounter( LARGE_INTEGER * count )
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	count->QuadPart = (LONGLONG) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+	return true;
+}
+
+bool QueryPerformanceFrequency( LARGE_INTEGER * freq )
+{
+	freq->QuadPart = 1000000;
+	return true;
+}
+#endif
+
 void strtoupper(char *str)
 {
 	while (*str)
@@ -137,7 +154,7 @@ void Change_Ext( const char * Src, char * Dest, const char * Ext )
 
 void DebugPrintf( const char * format, ... ) // timestamp prefix
 {
-	static char buf[0x4000];
+	static THREAD_LOCAL char buf[0x4000];
 	char *buf2;
 	int buf_length;
 	va_list args;
@@ -164,7 +181,7 @@ void DebugPrintf( const char * format, ... ) // timestamp prefix
 
 void DebugPrintf_( const char * format, ... ) // no timestamp prefix
 {
-	static char buf[0x4000];
+	static THREAD_LOCAL char buf[0x4000];
 	va_list args;
 
 	if(!Debug)
@@ -7,6 +7,14 @@ extern "C" {
 
 #include "main.h"
 
+// storage each thread gets its own copy of, for scratch buffers used
+// by code the loader threads share with the main thread
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
 void strtoupper(char *str);
 
 int Msg( const char * fmt, ... );
@@ -23,6 +31,12 @@ void GetFilename( u_int8_t * Src, u_int8_t * Dest );
 char* convert_path( char* _str );
 char * convert_char( char from, char to, char* in );
 
+#ifndef WIN32
+// winapi compatibility, a microsecond counter
+bool QueryPerformanceCounter( LARGE_INTEGER * count );
+bool QueryPerformanceFrequency( LARGE_INTEGER * freq );
+#endif
+
 #ifdef __cplusplus
 };
 #endif
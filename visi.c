@@ -27,6 +27,7 @@
 #include "util.h"
 #include "water.h"
 #include "render.h"
+#include "transexe.h"
 
 extern render_info_t render_info;
 
@@ -1174,6 +1175,159 @@ int ClipGroup( CAMERA *cam, u_int16_t group )
 	return 1;
 }
 
+/*===================================================================
+		Background batching
+
+	Drawing each visible group with its own viewport and projection
+	binds the same textures over and over.  A group's viewport and
+	projection only clip it to its portal extent, which the camera's
+	own viewport and projection do just as well with a scissor round
+	the extent.  So the solid execute buffers of every visible group
+	are queued by texture group, sorted by texture and drawn in one
+	pass, changing only the scissor between groups.
+
+	With NEW_LIGHTING the lighting state is set per group at draw time
+	so the groups are still drawn one by one.
+===================================================================*/
+#ifndef NEW_LIGHTING
+#define BATCH_BACKGROUND
+#endif
+
+#ifdef BATCH_BACKGROUND
+
+typedef struct BACKGROUNDBATCH
+{
+	RENDEROBJECT	*	renderObject;
+	VISGROUP		*	group;
+	LPTEXTURE			texture;
+	u_int16_t			order;			// place of the group in the front to back list
+	u_int16_t			texture_group;
+} BACKGROUNDBATCH;
+
+static BACKGROUNDBATCH	*	BackgroundBatch = NULL;
+static int					BackgroundBatchSize = 0;
+static int					NumBackgroundBatch = 0;
+
+/*===================================================================
+	Procedure	:	Queue the solid texture groups of a visible group
+				:	Transparent execute buffers go to the trans exe
+				:	list as ExecuteSingleGroupMloadHeader does
+	Input		:	MLOADHEADER	*	Mloadheader
+				:	VISGROUP	*	Visible group
+				:	u_int16_t		Place in the visible list
+	Output		:	bool			false on failure
+===================================================================*/
+static bool QueueSingleGroupMloadHeader( MLOADHEADER * Mloadheader, VISGROUP * g, u_int16_t order )
+{
+	RENDERMATRIX		Matrix;
+	RENDEROBJECT	*	renderObject;
+	BACKGROUNDBATCH	*	batch;
+	u_int16_t			group = (u_int16_t) g->group;
+	int					i, t;
+
+	if ( Mloadheader->state != true )
+		return true;
+
+	for ( i = 0; i < Mloadheader->Group[ group ].num_execbufs; i++ )
+	{
+		renderObject = (RENDEROBJECT*) &Mloadheader->Group[ group ].renderObject[ i ];
+
+		if( Mloadheader->Group[ group ].exec_type[ i ] & HASTRANSPARENCIES )
+		{
+			if (!FSGetWorld(&Matrix))
+				return false;
+			AddTransExe( &Matrix, renderObject, 0, (u_int16_t) -1, group,
+				Mloadheader->Group[ group ].num_verts_per_execbuf[ i ] );
+			continue;
+		}
+
+		if ( NumBackgroundBatch + renderObject->numTextureGroups > BackgroundBatchSize )
+		{
+			int size = BackgroundBatchSize ? BackgroundBatchSize : 256;
+			while ( size < NumBackgroundBatch + renderObject->numTextureGroups )
+				size *= 2;
+			batch = (BACKGROUNDBATCH *) realloc( BackgroundBatch, size * sizeof( BACKGROUNDBATCH ) );
+			if ( !batch )
+			{
+				Msg( "Unable to grow the background batch to %d\n", size );
+				return false;
+			}
+			BackgroundBatch = batch;
+			BackgroundBatchSize = size;
+		}
+
+		for ( t = 0; t < renderObject->numTextureGroups; t++ )
+		{
+			batch = &BackgroundBatch[ NumBackgroundBatch++ ];
+			batch->renderObject = renderObject;
+			batch->group = g;
+			batch->texture = renderObject->textureGroups[ t ].texture;
+			batch->order = order;
+			batch->texture_group = (u_int16_t) t;
+		}
+	}
+
+	return true;
+}
+
+static int CompareBackgroundBatch( const void * a, const void * b )
+{
+	const BACKGROUNDBATCH * ba = (const BACKGROUNDBATCH *) a;
+	const BACKGROUNDBATCH * bb = (const BACKGROUNDBATCH *) b;
+
+	if ( ba->texture != bb->texture )
+		return ( (size_t) ba->texture < (size_t) bb->texture ) ? -1 : 1;
+	if ( ba->order != bb->order )
+		return ( ba->order < bb->order ) ? -1 : 1;
+	if ( ba->renderObject != bb->renderObject )
+		return ( (size_t) ba->renderObject < (size_t) bb->renderObject ) ? -1 : 1;
+	return (int) ba->texture_group - (int) bb->texture_group;
+}
+
+/*===================================================================
+	Procedure	:	Draw everything queued for the frame sorted by
+				:	texture, scissored to each group's extent
+	Input		:	CAMERA	*	cam
+	Output		:	bool		false on failure
+===================================================================*/
+static bool DrawBackgroundBatch( CAMERA * cam )
+{
+	BACKGROUNDBATCH	*	batch;
+	VISGROUP		*	scissor = NULL;
+	int					i;
+	bool				ok = true;
+
+	if ( !NumBackgroundBatch )
+		return true;
+
+	// the first visible group is the camera's own and covers the viewport
+	ClipGroup( cam, (u_int16_t) cam->visible.first_visible->group );
+
+	qsort( BackgroundBatch, NumBackgroundBatch, sizeof( BACKGROUNDBATCH ), CompareBackgroundBatch );
+
+	for ( i = 0, batch = BackgroundBatch; i < NumBackgroundBatch; i++, batch++ )
+	{
+		if ( DoClipping && batch->group != scissor )
+		{
+			FSSetScissor( &batch->group->viewport );
+			scissor = batch->group;
+		}
+
+		if ( !draw_object_group( batch->renderObject, batch->texture_group ) )
+		{
+			ok = false;
+			break;
+		}
+	}
+
+	FSResetScissor();
+	NumBackgroundBatch = 0;
+
+	return ok;
+}
+
+#endif // BATCH_BACKGROUND
+
 /*===================================================================
 		Disp Visipoly Model
 ===================================================================*/
@@ -1217,7 +1371,9 @@ DisplayBackground( MLOADHEADER	* Mloadheader, CAMERA *cam )
 		t = 0;
 		for ( g = cam->visible.first_visible, i = 0; g; g = g->next_visible, i++ )
 		{
+#ifndef BATCH_BACKGROUND
 		 	ClipGroup( &CurrentCamera, (u_int16_t) g->group );
+#endif
 		  CurrentGroupVisible = GroupsVisible[i];
 			GroupInVisibleList = i;
 			group = GroupsVisible[i];
@@ -1225,20 +1381,42 @@ DisplayBackground( MLOADHEADER	* Mloadheader, CAMERA *cam )
 			if ( XLight1Group(  Mloadheader, GroupsVisible[i] ) != true  )
 				return false;
 
+#ifdef BATCH_BACKGROUND
+			if ( QueueSingleGroupMloadHeader( Mloadheader, g, (u_int16_t) i ) != true )
+				return false;
+#else
  			if ( ExecuteSingleGroupMloadHeader(  Mloadheader, (u_int16_t) g->group ) != true  )
 				return false;
+#endif
 
 #ifdef NEW_LIGHTING
 			render_reset_lighting_variables();
 #endif
 
+#ifndef BATCH_BACKGROUND
 			DispGroupTriggerAreas( (u_int16_t) g->group );
 			if ( CaptureTheFlag || CTF )
 				DisplayGoal( (u_int16_t) g->group );
+#endif
 //			ShowAllColZones( (u_int16_t) g->group );
 
 			t += GroupTris[ g->group ];
 		}
+
+#ifdef BATCH_BACKGROUND
+		if ( DrawBackgroundBatch( cam ) != true )
+			return false;
+
+		// the trigger areas and goals still expect their own group's clip
+		for ( g = cam->visible.first_visible; g; g = g->next_visible )
+		{
+		 	ClipGroup( &CurrentCamera, (u_int16_t) g->group );
+			DispGroupTriggerAreas( (u_int16_t) g->group );
+			if ( CaptureTheFlag || CTF )
+				DisplayGoal( (u_int16_t) g->group );
+		}
+#endif
+
 		// accumulate visibility stats
 		VisiStats[ GroupImIn ].tsum += t;
 		if ( VisiStats[ GroupImIn ].tmax < t )
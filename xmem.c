@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "main.h"
 #include "util.h"
+#include <SDL.h>
 
 size_t	MemUsed = 0;
 
@@ -14,10 +15,29 @@ char *	BlockInFile[MAXBLOCKS];
 int		BlockInLine[MAXBLOCKS];
 int BlocksUsed = 0;
 
+// the texture, save and level load workers allocate too
+static SDL_mutex * XMemLock = NULL;
+
+static void XMem_Lock( void )
+{
+	if( XMemLock )
+		SDL_LockMutex( XMemLock );
+}
+
+static void XMem_Unlock( void )
+{
+	if( XMemLock )
+		SDL_UnlockMutex( XMemLock );
+}
+
 void XMem_Init( void )
 {
 	int i;
 
+	// before any thread is started
+	if( !XMemLock )
+		XMemLock = SDL_CreateMutex();
+
 	MemUsed =0;
 	for( i = 0 ; i < MAXBLOCKS ; i++ )
 	{
@@ -27,6 +47,13 @@ void XMem_Init( void )
 	}
 }
 
+// false if the block tables can't be locked,
+// nothing may allocate off the main thread then
+bool XMem_ThreadSafe( void )
+{
+	return XMemLock != NULL;
+}
+
 int XMem_FindFree( void )
 {
 	int i;
@@ -59,9 +86,11 @@ void * X_strdup( char *str, char *in_file, int in_line )
 	void * Pnt;
 	int i;
 	
+	XMem_Lock();
 	i = XMem_FindFree();
 	if( i == -1 )
 	{
+		XMem_Unlock();
 		DebugPrintf( "MEM: Ran out of free memory Blocks\n"); // break point
 		return NULL;
 	}
@@ -69,7 +98,11 @@ void * X_strdup( char *str, char *in_file, int in_line )
 	Pnt = strdup( str );
 	
 	if( !Pnt )
+	{
+		BlocksUsed--;
+		XMem_Unlock();
 		return Pnt;
+	}
 
 	int size = strlen(str)+1;
 
@@ -80,6 +113,8 @@ void * X_strdup( char *str, char *in_file, int in_line )
 	BlockInLine[i] = in_line;
 	MemUsed += size;
 
+	XMem_Unlock();
+
 	return Pnt;
 
 }
@@ -88,9 +123,11 @@ void * X_malloc( size_t size, char *in_file, int in_line )
 	void * Pnt;
 	int i;
 	
+	XMem_Lock();
 	i = XMem_FindFree();
 	if( i == -1 )
 	{
+		XMem_Unlock();
 		DebugPrintf( "MEM: Ran out of free memory Blocks\n"); // break point
 		return NULL;
 	}
@@ -98,7 +135,11 @@ void * X_malloc( size_t size, char *in_file, int in_line )
 	Pnt = malloc( size );
 	
 	if( !Pnt )
+	{
+		BlocksUsed--;
+		XMem_Unlock();
 		return Pnt;
+	}
 
 	BlockUsed[i] = true;
 	BlockPnts[i] = Pnt;
@@ -109,6 +150,8 @@ void * X_malloc( size_t size, char *in_file, int in_line )
 
 	memset(Pnt,0,sizeof(Pnt)); // this protects whole program against dirty memory
 
+	XMem_Unlock();
+
 	return Pnt;
 
 }
@@ -118,9 +161,11 @@ void * X_calloc( size_t num,size_t size, char *in_file, int in_line )
 	void * Pnt;
 	int i;
 
+	XMem_Lock();
 	i = XMem_FindFree();
 	if( i == -1 )
 	{
+		XMem_Unlock();
 		DebugPrintf( "MEM: Ran out of free memory Blocks\n"); // break point
 		return NULL;
 	}
@@ -128,7 +173,11 @@ void * X_calloc( size_t num,size_t size, char *in_file, int in_line )
 	Pnt = calloc( num , size );
 
 	if( !Pnt )
+	{
+		BlocksUsed--;
+		XMem_Unlock();
 		return Pnt;
+	}
 
 	BlockUsed[i] = true;
 	BlockPnts[i] = Pnt;
@@ -139,6 +188,8 @@ void * X_calloc( size_t num,size_t size, char *in_file, int in_line )
 	
 	memset(Pnt,0,sizeof(Pnt)); // this protects whole program against dirty memory
 
+	XMem_Unlock();
+
 	return Pnt;
 
 }
@@ -157,6 +208,7 @@ void X_free( void * Pnt, char *in_file, int in_line )
 		last_line = in_line;
 		return;
 	}
+	XMem_Lock();
 	i = XMem_FindSame( Pnt );
 	if( i == -1 )
 	{
@@ -164,6 +216,7 @@ void X_free( void * Pnt, char *in_file, int in_line )
 	 		DebugPrintf( "MEM: Tried to free un-malloced block in %s line %d\n", in_file, in_line ); // break point
 		last_file = in_file;
 		last_line = in_line;
+		XMem_Unlock();
 		return;
 	}
 	free(Pnt);
@@ -176,15 +229,22 @@ void X_free( void * Pnt, char *in_file, int in_line )
 
 	BlockSize[i] = 0;
 	BlocksUsed--;
+	XMem_Unlock();
 }
 
 void * X_realloc( void * Pnt , size_t size, char *in_file, int in_line )
 {
 	int i;
+
+	// growing from nothing, like realloc itself
+	if( !Pnt )
+		return X_malloc( size, in_file, in_line );
 	
+	XMem_Lock();
 	i = XMem_FindSame( Pnt );
 	if( i == -1 )
 	{
+		XMem_Unlock();
 		DebugPrintf( "MEM: tried to realloc un-alloced block\n"); // break point
 		return NULL;
 	}
@@ -192,7 +252,10 @@ void * X_realloc( void * Pnt , size_t size, char *in_file, int in_line )
 	Pnt = realloc( Pnt , size );
 
 	if( !Pnt )
+	{
+		XMem_Unlock();
 		return Pnt;
+	}
 
 	BlockUsed[i] = true;
 	BlockPnts[i] = Pnt;
@@ -205,6 +268,8 @@ void * X_realloc( void * Pnt , size_t size, char *in_file, int in_line )
 	MemUsed -= BlockSize[i];
 	BlockSize[i] = size;
 	MemUsed += size;
+
+	XMem_Unlock();
 	
 	return Pnt;
 
@@ -214,6 +279,7 @@ int UnMallocedBlocks( void )
 {
 	int i;
 
+	XMem_Lock();
 	if ( BlocksUsed )
 	{
 		for ( i = 0; i < MAXBLOCKS; i++ )
@@ -227,5 +293,7 @@ int UnMallocedBlocks( void )
 	}
 	DebugPrintf( "MEM: MemUsed = %d   BlocksUsed = %d\n",
 		MemUsed, BlocksUsed ); // break point
-	return BlocksUsed;
+	i = BlocksUsed;
+	XMem_Unlock();
+	return i;
 }
@@ -23,6 +23,7 @@ void X_free( void * Pnt, char *in_file, int in_line );
 void * X_realloc( void * Pnt , size_t size, char *in_file, int in_line );
 void * X_strdup( void * Pnt , char *in_file, int in_line );
 int UnMallocedBlocks( void );
+bool XMem_ThreadSafe( void );
 
 #endif
 